@@ -0,0 +1,282 @@
+#include "SyntheticLogGenerator.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/Defs.h"
+
+namespace {
+constexpr std::array<std::string_view, 4> cServices{"api", "auth", "billing", "search"};
+constexpr std::array<std::string_view, 3> cHttpMethods{"GET", "POST", "PUT"};
+constexpr std::array<std::string_view, 4> cResources{"orders", "users", "sessions", "invoices"};
+constexpr std::array<int64_t, 6> cStatusCodes{200, 200, 200, 201, 404, 500};
+constexpr std::array<std::string_view, 12> cMonths{
+        "Jan",
+        "Feb",
+        "Mar",
+        "Apr",
+        "May",
+        "Jun",
+        "Jul",
+        "Aug",
+        "Sep",
+        "Oct",
+        "Nov",
+        "Dec"
+};
+
+constexpr uint64_t cNumUsers{5000};
+constexpr uint64_t cNumHosts{64};
+constexpr uint64_t cMaxTimestampIncrement{250};
+
+/**
+ * A timestamp broken down into its calendar fields, in UTC.
+ */
+struct BrokenDownTime {
+    int year;
+    unsigned month;
+    unsigned day;
+    int64_t hour;
+    int64_t minute;
+    int64_t second;
+    int64_t millisecond;
+};
+
+/**
+ * @param timestamp A millisecond epoch timestamp.
+ * @return The timestamp broken down into its calendar fields.
+ */
+auto break_down(clp::epochtime_t timestamp) -> BrokenDownTime;
+
+/**
+ * @param timestamp
+ * @return The timestamp formatted as "2024-03-05 00:00:00,012".
+ */
+auto format_log4j_timestamp(clp::epochtime_t timestamp) -> std::string;
+
+auto break_down(clp::epochtime_t timestamp) -> BrokenDownTime {
+    std::chrono::sys_time<std::chrono::milliseconds> const time_point{
+            std::chrono::milliseconds{timestamp}
+    };
+    auto const day{std::chrono::floor<std::chrono::days>(time_point)};
+    std::chrono::year_month_day const date{day};
+    std::chrono::hh_mm_ss const time_of_day{time_point - day};
+    return {
+            static_cast<int>(date.year()),
+            static_cast<unsigned>(date.month()),
+            static_cast<unsigned>(date.day()),
+            time_of_day.hours().count(),
+            time_of_day.minutes().count(),
+            time_of_day.seconds().count(),
+            time_of_day.subseconds().count()
+    };
+}
+
+auto format_log4j_timestamp(clp::epochtime_t timestamp) -> std::string {
+    auto const time{break_down(timestamp)};
+    return fmt::format(
+            "{:04}-{:02}-{:02} {:02}:{:02}:{:02},{:03}",
+            time.year,
+            time.month,
+            time.day,
+            time.hour,
+            time.minute,
+            time.second,
+            time.millisecond
+    );
+}
+}  // namespace
+
+auto SyntheticLogGenerator::next_text_message() -> std::string {
+    auto const timestamp{next_timestamp()};
+    auto const [level, body] = next_message_body();
+    return fmt::format("{} {} {}", format_log4j_timestamp(timestamp), level, body);
+}
+
+auto SyntheticLogGenerator::next_json_record() -> nlohmann::json {
+    auto const timestamp{next_timestamp()};
+    auto [level, body] = next_message_body();
+
+    nlohmann::json record{
+            {"timestamp", timestamp},
+            {"level", level},
+            {"service", cServices.at(next_uint(cServices.size()))},
+            {"host", fmt::format("host-{}", next_skewed_uint(cNumHosts))},
+            {"status", cStatusCodes.at(next_uint(cStatusCodes.size()))},
+            {"latency_ms", static_cast<double>(next_uint(100'000)) / 100.0},
+            {"user", fmt::format("user_{}", next_skewed_uint(cNumUsers))},
+            {"message", std::move(body)}
+    };
+    // Vary the set of fields so that records fall into several schemas
+    if ("INFO" == level) {
+        auto const method{cHttpMethods.at(next_uint(cHttpMethods.size()))};
+        auto const resource{cResources.at(next_uint(cResources.size()))};
+        auto const resource_id{next_skewed_uint(cNumUsers)};
+        auto const num_bytes{next_uint(1'000'000)};
+        record["http"] = {
+                {"method", method},
+                {"path", fmt::format("/v1/{}/{}", resource, resource_id)},
+                {"bytes", num_bytes}
+        };
+    } else if ("WARN" == level) {
+        record["retries"] = next_uint(5);
+    }
+    return record;
+}
+
+auto SyntheticLogGenerator::next_timestamp_string() -> std::string {
+    constexpr uint64_t cNumFormats{5};
+    auto const time{break_down(next_timestamp())};
+    switch (next_uint(cNumFormats)) {
+        case 0:
+            return fmt::format(
+                    "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z",
+                    time.year,
+                    time.month,
+                    time.day,
+                    time.hour,
+                    time.minute,
+                    time.second,
+                    time.millisecond
+            );
+        case 1:
+            return fmt::format(
+                    "{:04}-{:02}-{:02} {:02}:{:02}:{:02},{:03}",
+                    time.year,
+                    time.month,
+                    time.day,
+                    time.hour,
+                    time.minute,
+                    time.second,
+                    time.millisecond
+            );
+        case 2:
+            return fmt::format(
+                    "[{:04}-{:02}-{:02} {:02}:{:02}:{:02}]",
+                    time.year,
+                    time.month,
+                    time.day,
+                    time.hour,
+                    time.minute,
+                    time.second
+            );
+        case 3:
+            return fmt::format(
+                    "{:02} {} {:04} {:02}:{:02}:{:02}.{:03}",
+                    time.day,
+                    cMonths.at(time.month - 1),
+                    time.year,
+                    time.hour,
+                    time.minute,
+                    time.second,
+                    time.millisecond
+            );
+        default:
+            return fmt::format(
+                    "{} {:02} {:02}:{:02}:{:02}",
+                    cMonths.at(time.month - 1),
+                    time.day,
+                    time.hour,
+                    time.minute,
+                    time.second
+            );
+    }
+}
+
+auto SyntheticLogGenerator::next_dictionary_variable() -> std::string {
+    constexpr uint64_t cNumKinds{3};
+    switch (next_uint(cNumKinds)) {
+        case 0:
+            return fmt::format("user_{}", next_skewed_uint(cNumUsers));
+        case 1:
+            return fmt::format("0x{:04x}", next_uint(UINT16_MAX));
+        default: {
+            auto const shard{next_skewed_uint(cNumHosts)};
+            auto const part{next_uint(1000)};
+            return fmt::format("/var/data/shard-{}/part-{}.log", shard, part);
+        }
+    }
+}
+
+auto SyntheticLogGenerator::next_skewed_uint(uint64_t bound) -> uint64_t {
+    return next_uint(next_uint(bound) + 1);
+}
+
+auto SyntheticLogGenerator::next_timestamp() -> clp::epochtime_t {
+    m_timestamp += static_cast<clp::epochtime_t>(next_uint(cMaxTimestampIncrement));
+    return m_timestamp;
+}
+
+auto SyntheticLogGenerator::next_message_body() -> std::pair<std::string_view, std::string> {
+    // NOTE: Random values are drawn into locals before formatting since the evaluation order of
+    // function arguments is unspecified, which would make the output compiler-dependent.
+
+    // Weight the templates so that INFO messages are the most common
+    constexpr uint64_t cTemplateWeightSum{20};
+    auto const template_idx{next_uint(cTemplateWeightSum)};
+    if (template_idx < 12) {
+        auto const worker_id{next_uint(16)};
+        auto const request_id{next_uint(UINT16_MAX)};
+        auto const user_id{next_skewed_uint(cNumUsers)};
+        auto const latency_ms{next_skewed_uint(1000)};
+        auto const latency_fraction{next_uint(100)};
+        return {"INFO",
+                fmt::format(
+                        "[worker-{}] Processed request 0x{:04x} for user user_{} in {}.{:02} ms",
+                        worker_id,
+                        request_id,
+                        user_id,
+                        latency_ms,
+                        latency_fraction
+                )};
+    }
+    if (template_idx < 15) {
+        auto const subnet{next_uint(4)};
+        auto const third_octet{next_uint(256)};
+        auto const fourth_octet{next_uint(256)};
+        auto const port{8000 + next_uint(8)};
+        auto const num_retries{next_uint(5)};
+        return {"WARN",
+                fmt::format(
+                        "Connection to 10.{}.{}.{}:{} timed out after {} retries",
+                        subnet,
+                        third_octet,
+                        fourth_octet,
+                        port,
+                        num_retries
+                )};
+    }
+    if (template_idx < 16) {
+        auto const shard{next_skewed_uint(cNumHosts)};
+        auto const part{next_uint(1000)};
+        auto const error_code{next_uint(32)};
+        return {"ERROR",
+                fmt::format(
+                        "Failed to open /var/data/shard-{}/part-{}.log: error code {}",
+                        shard,
+                        part,
+                        error_code
+                )};
+    }
+    auto const hit_ratio{next_uint(1000)};
+    auto const session_id{next_uint(UINT32_MAX)};
+    return {"DEBUG",
+            fmt::format("Cache hit ratio 0.{:03} for key session:{:08x}", hit_ratio, session_id)};
+}
+
+auto write_json_lines_file(std::string const& path, size_t num_records, uint64_t seed) -> void {
+    SyntheticLogGenerator generator{seed};
+    std::ofstream file{path};
+    for (size_t i{0}; i < num_records; ++i) {
+        file << generator.next_json_record().dump() << '\n';
+    }
+}
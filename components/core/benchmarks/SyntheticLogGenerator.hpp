@@ -0,0 +1,103 @@
+#ifndef BENCHMARKS_SYNTHETICLOGGENERATOR_HPP
+#define BENCHMARKS_SYNTHETICLOGGENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/Defs.h"
+
+/**
+ * Generates synthetic logs for the benchmarks.
+ *
+ * The generated logs only depend on the seed, so that benchmark results are reproducible across
+ * runs and machines. In particular, values are derived directly from a `std::mt19937_64`, whose
+ * output is fully specified by the standard, rather than through the standard distributions, whose
+ * output is implementation-defined.
+ *
+ * The logs mimic a service's request logs: a handful of message templates containing integers,
+ * floats, and dictionary variables (IDs, IPs, and paths), where the dictionary variables are
+ * skewed so that some values repeat often.
+ */
+class SyntheticLogGenerator {
+public:
+    // Constants
+    static constexpr uint64_t cDefaultSeed{0x5eed'c10b'5eed'c10bULL};
+    // 2024-03-05 00:00:00 UTC
+    static constexpr clp::epochtime_t cStartTimestamp{1'709'596'800'000};
+
+    // Constructors
+    explicit SyntheticLogGenerator(uint64_t seed = cDefaultSeed) : m_rng{seed} {}
+
+    // Methods
+    /**
+     * @return A log message starting with a timestamp, e.g.,
+     * "2024-03-05 00:00:00,012 INFO [worker-3] Processed request 0x1f3a for user user_81 in
+     * 45.67 ms".
+     */
+    [[nodiscard]] auto next_text_message() -> std::string;
+
+    /**
+     * @return A JSON log event with a millisecond epoch timestamp under "timestamp", a message
+     * under "message", and a mix of string, integer, float, and nested fields.
+     */
+    [[nodiscard]] auto next_json_record() -> nlohmann::json;
+
+    /**
+     * @return A timestamp string in one of several common formats.
+     */
+    [[nodiscard]] auto next_timestamp_string() -> std::string;
+
+    /**
+     * @return A value like the dictionary variables in the generated messages.
+     */
+    [[nodiscard]] auto next_dictionary_variable() -> std::string;
+
+private:
+    // Methods
+    /**
+     * @param bound
+     * @return A value in [0, bound).
+     */
+    [[nodiscard]] auto next_uint(uint64_t bound) -> uint64_t { return m_rng() % bound; }
+
+    /**
+     * @param bound
+     * @return A value in [0, bound) where smaller values are much more likely.
+     */
+    [[nodiscard]] auto next_skewed_uint(uint64_t bound) -> uint64_t;
+
+    /**
+     * Advances the current timestamp by a small random amount.
+     * @return The new timestamp.
+     */
+    [[nodiscard]] auto next_timestamp() -> clp::epochtime_t;
+
+    /**
+     * @return A pair containing the log level and the message without a timestamp or log level.
+     */
+    [[nodiscard]] auto next_message_body() -> std::pair<std::string_view, std::string>;
+
+    // Variables
+    std::mt19937_64 m_rng;
+    clp::epochtime_t m_timestamp{cStartTimestamp};
+};
+
+/**
+ * Writes newline-delimited JSON log events generated by a `SyntheticLogGenerator` to a file.
+ * @param path
+ * @param num_records
+ * @param seed
+ */
+auto write_json_lines_file(
+        std::string const& path,
+        size_t num_records,
+        uint64_t seed = SyntheticLogGenerator::cDefaultSeed
+) -> void;
+
+#endif  // BENCHMARKS_SYNTHETICLOGGENERATOR_HPP
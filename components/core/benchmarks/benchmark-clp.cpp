@@ -0,0 +1,464 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/types.h>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include <log_surgeon/Lexer.hpp>
+#include <msgpack.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/Defs.h"
+#include "../src/clp/ErrorCode.hpp"
+#include "../src/clp/ffi/encoding_methods.hpp"
+#include "../src/clp/ffi/ir_stream/Serializer.hpp"
+#include "../src/clp/GrepCore.hpp"
+#include "../src/clp/ir/parsing.hpp"
+#include "../src/clp/ir/types.hpp"
+#include "../src/clp/streaming_compression/zstd/Compressor.hpp"
+#include "../src/clp/TimestampPattern.hpp"
+#include "../src/clp/VariableDictionaryWriter.hpp"
+#include "../src/clp/WriterInterface.hpp"
+#include "../tests/MockLogTypeDictionary.hpp"
+#include "../tests/MockVariableDictionary.hpp"
+#include "../tests/TestOutputCleaner.hpp"
+#include "SyntheticLogGenerator.hpp"
+
+using clp::ir::eight_byte_encoded_variable_t;
+using clp::ir::four_byte_encoded_variable_t;
+using std::string;
+using std::vector;
+
+namespace {
+constexpr size_t cNumMessages{10'000};
+constexpr std::string_view cDictionaryDirectory{"benchmark-clp-dictionaries"};
+constexpr size_t cTokenizationInputSize{8ULL * 1024 * 1024};
+
+/**
+ * A writer that discards everything written to it, so that compression can be benchmarked without
+ * the cost of I/O.
+ */
+class NullWriter : public clp::WriterInterface {
+public:
+    // Methods implementing WriterInterface
+    void write([[maybe_unused]] char const* data, size_t data_length) override {
+        m_pos += data_length;
+    }
+
+    void flush() override {}
+
+    auto try_seek_from_begin(size_t pos) -> clp::ErrorCode override {
+        m_pos = pos;
+        return clp::ErrorCode_Success;
+    }
+
+    auto try_seek_from_current(off_t offset) -> clp::ErrorCode override {
+        m_pos += offset;
+        return clp::ErrorCode_Success;
+    }
+
+    auto try_get_pos(size_t& pos) const -> clp::ErrorCode override {
+        pos = m_pos;
+        return clp::ErrorCode_Success;
+    }
+
+private:
+    size_t m_pos{0};
+};
+
+/**
+ * @param num_messages
+ * @return `num_messages` messages generated by a `SyntheticLogGenerator`.
+ */
+auto generate_text_messages(size_t num_messages) -> vector<string>;
+
+/**
+ * @param num_records
+ * @return `num_records` JSON records generated by a `SyntheticLogGenerator`, each as a msgpack map.
+ */
+auto generate_msgpack_records(size_t num_records) -> vector<msgpack::object_handle>;
+
+/**
+ * Populates mock dictionaries with the logtypes and dictionary variables of the given messages,
+ * like an archive containing the messages would.
+ * @param messages
+ * @param logtype_dict
+ * @param var_dict
+ */
+auto populate_dictionaries(
+        vector<string> const& messages,
+        MockLogTypeDictionary& logtype_dict,
+        MockVariableDictionary& var_dict
+) -> void;
+
+/**
+ * Encodes each message, as is done when compressing unstructured logs.
+ * @tparam encoded_variable_t
+ * @param messages
+ * @return The total size of the encoded logtypes.
+ */
+template <typename encoded_variable_t>
+auto encode_messages(vector<string> const& messages) -> size_t;
+
+/**
+ * @param min_size
+ * @return The lines of the unit tests' log files, repeated until their total size (excluding line
+ * delimiters) is at least `min_size`.
+ */
+auto load_test_log_lines(size_t min_size) -> vector<string>;
+
+/**
+ * Finds the bounds of every variable in each line, as is done when encoding a message.
+ * @param lines
+ * @return The number of variables found.
+ */
+auto find_all_var_bounds(vector<string> const& lines) -> size_t;
+
+/**
+ * @param message A message generated by `SyntheticLogGenerator::next_text_message`.
+ * @return The message without its leading timestamp.
+ */
+auto strip_timestamp(string const& message) -> string;
+
+/**
+ * Searches each message for a timestamp in any of the known timestamp patterns.
+ * @param messages
+ * @return The number of messages containing a timestamp.
+ */
+auto search_known_ts_patterns(vector<string> const& messages) -> size_t;
+
+auto generate_text_messages(size_t num_messages) -> vector<string> {
+    SyntheticLogGenerator generator;
+    vector<string> messages;
+    messages.reserve(num_messages);
+    for (size_t i{0}; i < num_messages; ++i) {
+        messages.emplace_back(generator.next_text_message());
+    }
+    return messages;
+}
+
+auto generate_msgpack_records(size_t num_records) -> vector<msgpack::object_handle> {
+    SyntheticLogGenerator generator;
+    vector<msgpack::object_handle> records;
+    records.reserve(num_records);
+    for (size_t i{0}; i < num_records; ++i) {
+        auto const msgpack_bytes{nlohmann::json::to_msgpack(generator.next_json_record())};
+        records.emplace_back(msgpack::unpack(
+                reinterpret_cast<char const*>(msgpack_bytes.data()),
+                msgpack_bytes.size()
+        ));
+    }
+    return records;
+}
+
+auto populate_dictionaries(
+        vector<string> const& messages,
+        MockLogTypeDictionary& logtype_dict,
+        MockVariableDictionary& var_dict
+) -> void {
+    std::unordered_set<string> logtypes;
+    std::unordered_set<string> dictionary_vars;
+    string logtype;
+    vector<eight_byte_encoded_variable_t> encoded_vars;
+    vector<int32_t> dictionary_var_bounds;
+    for (auto const& message : messages) {
+        encoded_vars.clear();
+        dictionary_var_bounds.clear();
+        REQUIRE(clp::ffi::encode_message(message, logtype, encoded_vars, dictionary_var_bounds));
+        if (logtypes.emplace(logtype).second) {
+            logtype_dict.add_entry(logtype, logtypes.size() - 1);
+        }
+        for (size_t i{0}; i < dictionary_var_bounds.size(); i += 2) {
+            auto const begin_pos{static_cast<size_t>(dictionary_var_bounds[i])};
+            auto const end_pos{static_cast<size_t>(dictionary_var_bounds[i + 1])};
+            string var{message.substr(begin_pos, end_pos - begin_pos)};
+            if (dictionary_vars.emplace(var).second) {
+                var_dict.add_entry(dictionary_vars.size() - 1, std::move(var));
+            }
+        }
+    }
+}
+
+template <typename encoded_variable_t>
+auto encode_messages(vector<string> const& messages) -> size_t {
+    string logtype;
+    vector<encoded_variable_t> encoded_vars;
+    vector<int32_t> dictionary_var_bounds;
+    size_t total_logtype_size{0};
+    for (auto const& message : messages) {
+        encoded_vars.clear();
+        dictionary_var_bounds.clear();
+        clp::ffi::encode_message(message, logtype, encoded_vars, dictionary_var_bounds);
+        total_logtype_size += logtype.size();
+    }
+    return total_logtype_size;
+}
+
+auto load_test_log_lines(size_t min_size) -> vector<string> {
+    std::filesystem::path const current_file_path{__FILE__};
+    auto const test_log_dir{
+            current_file_path.parent_path().parent_path() / "tests" / "test_log_files"
+    };
+    vector<std::filesystem::path> test_log_paths;
+    for (auto const& entry : std::filesystem::directory_iterator{test_log_dir}) {
+        test_log_paths.emplace_back(entry.path());
+    }
+    std::sort(test_log_paths.begin(), test_log_paths.end());
+
+    vector<string> test_log_lines;
+    for (auto const& path : test_log_paths) {
+        std::ifstream file{path};
+        REQUIRE(file.is_open());
+        for (string line; std::getline(file, line);) {
+            test_log_lines.emplace_back(std::move(line));
+        }
+    }
+    REQUIRE((false == test_log_lines.empty()));
+
+    vector<string> lines;
+    size_t size{0};
+    while (size < min_size) {
+        for (auto const& line : test_log_lines) {
+            lines.emplace_back(line);
+            size += line.size();
+        }
+    }
+    return lines;
+}
+
+auto find_all_var_bounds(vector<string> const& lines) -> size_t {
+    size_t num_vars{0};
+    for (auto const& line : lines) {
+        size_t begin_pos{0};
+        size_t end_pos{0};
+        while (clp::ir::get_bounds_of_next_var(line, begin_pos, end_pos)) {
+            ++num_vars;
+        }
+    }
+    return num_vars;
+}
+
+auto strip_timestamp(string const& message) -> string {
+    // The timestamp contains exactly one space (between the date and the time)
+    auto const date_end_pos{message.find(' ')};
+    return message.substr(message.find(' ', date_end_pos + 1) + 1);
+}
+
+auto search_known_ts_patterns(vector<string> const& messages) -> size_t {
+    size_t num_timestamps_found{0};
+    clp::epochtime_t timestamp{};
+    size_t timestamp_begin_pos{};
+    size_t timestamp_end_pos{};
+    for (auto const& message : messages) {
+        if (nullptr
+            != clp::TimestampPattern::search_known_ts_patterns(
+                    message,
+                    timestamp,
+                    timestamp_begin_pos,
+                    timestamp_end_pos
+            ))
+        {
+            ++num_timestamps_found;
+        }
+    }
+    return num_timestamps_found;
+}
+}  // namespace
+
+TEST_CASE("benchmark-encode_message", "[benchmark][clp][ffi]") {
+    auto const messages{generate_text_messages(cNumMessages)};
+
+    BENCHMARK("ffi::encode_message<eight_byte_encoded_variable_t>") {
+        return encode_messages<eight_byte_encoded_variable_t>(messages);
+    };
+
+    BENCHMARK("ffi::encode_message<four_byte_encoded_variable_t>") {
+        return encode_messages<four_byte_encoded_variable_t>(messages);
+    };
+}
+
+TEST_CASE("benchmark-ir_parsing", "[benchmark][clp][ir]") {
+    auto const lines{load_test_log_lines(cTokenizationInputSize)};
+    size_t input_size{0};
+    for (auto const& line : lines) {
+        input_size += line.size();
+    }
+
+    // Catch2 reports the time per run, so the throughput (MB/s) is the input size in the
+    // benchmark's name divided by the mean time.
+    constexpr double cNumBytesPerMB{1'000'000};
+    auto benchmark_name{fmt::format(
+            "ir::get_bounds_of_next_var ({:.1f} MB)",
+            static_cast<double>(input_size) / cNumBytesPerMB
+    )};
+    BENCHMARK(std::move(benchmark_name)) {
+        return find_all_var_bounds(lines);
+    };
+}
+
+TEST_CASE("benchmark-ir_stream_Serializer", "[benchmark][clp][ffi][ir_stream]") {
+    auto const records{generate_msgpack_records(cNumMessages)};
+    auto const empty_map_bytes{nlohmann::json::to_msgpack(nlohmann::json::object())};
+    auto const empty_map_handle{msgpack::unpack(
+            reinterpret_cast<char const*>(empty_map_bytes.data()),
+            empty_map_bytes.size()
+    )};
+    auto const& empty_map{empty_map_handle.get().via.map};
+
+    size_t num_failures{0};
+    BENCHMARK("ir_stream::Serializer::serialize_msgpack_map") {
+        auto serializer_result{
+                clp::ffi::ir_stream::Serializer<eight_byte_encoded_variable_t>::create()
+        };
+        if (serializer_result.has_error()) {
+            ++num_failures;
+            return size_t{0};
+        }
+        auto& serializer{serializer_result.value()};
+        for (auto const& record : records) {
+            if (serializer.serialize_msgpack_map(empty_map, record.get().via.map).has_error()) {
+                ++num_failures;
+            }
+        }
+        return serializer.get_ir_buf_view().size();
+    };
+    REQUIRE((0 == num_failures));
+}
+
+TEST_CASE("benchmark-VariableDictionaryWriter", "[benchmark][clp][dictionary]") {
+    TestOutputCleaner const test_cleanup{{string{cDictionaryDirectory}}};
+    std::filesystem::create_directory(cDictionaryDirectory);
+
+    // Most variables repeat, as in real logs, so most calls find an existing entry
+    SyntheticLogGenerator generator;
+    vector<string> variables;
+    variables.reserve(cNumMessages);
+    for (size_t i{0}; i < cNumMessages; ++i) {
+        variables.emplace_back(generator.next_dictionary_variable());
+    }
+
+    BENCHMARK_ADVANCED("VariableDictionaryWriter::add_entry")(Catch::Benchmark::Chronometer meter) {
+        // Each run adds the variables to a new dictionary
+        vector<std::unique_ptr<clp::VariableDictionaryWriter>> dictionaries;
+        for (int i{0}; i < meter.runs(); ++i) {
+            auto const path_prefix{fmt::format("{}/{}", cDictionaryDirectory, i)};
+            auto& dictionary{
+                    dictionaries.emplace_back(std::make_unique<clp::VariableDictionaryWriter>())
+            };
+            dictionary->open(
+                    path_prefix + ".dict",
+                    path_prefix + ".segindex",
+                    clp::cVariableDictionaryIdMax
+            );
+        }
+
+        meter.measure([&](int run_idx) {
+            auto& dictionary{*dictionaries[static_cast<size_t>(run_idx)]};
+            clp::variable_dictionary_id_t id{};
+            for (auto const& variable : variables) {
+                dictionary.add_entry(variable, id);
+            }
+            return id;
+        });
+
+        for (auto& dictionary : dictionaries) {
+            dictionary->close();
+        }
+    };
+}
+
+TEST_CASE("benchmark-zstd_Compressor", "[benchmark][clp][streaming_compression]") {
+    auto const messages{generate_text_messages(cNumMessages)};
+
+    BENCHMARK("streaming_compression::zstd::Compressor") {
+        NullWriter writer;
+        clp::streaming_compression::zstd::Compressor compressor;
+        compressor.open(writer);
+        for (auto const& message : messages) {
+            compressor.write(message.data(), message.size());
+        }
+        compressor.close();
+        size_t compressed_size{0};
+        writer.try_get_pos(compressed_size);
+        return compressed_size;
+    };
+}
+
+TEST_CASE("benchmark-TimestampPattern", "[benchmark][clp][timestamp]") {
+    clp::TimestampPattern::init();
+    auto const messages{generate_text_messages(cNumMessages)};
+
+    // Lines in a mix of timestamp formats, which match patterns at different positions in the list
+    // of known patterns, and lines without a timestamp, which every known pattern must reject.
+    SyntheticLogGenerator generator;
+    vector<string> mixed_format_messages;
+    vector<string> messages_without_timestamps;
+    mixed_format_messages.reserve(messages.size());
+    messages_without_timestamps.reserve(messages.size());
+    for (auto const& message : messages) {
+        auto message_body{strip_timestamp(message)};
+        mixed_format_messages.emplace_back(
+                fmt::format("{} {}", generator.next_timestamp_string(), message_body)
+        );
+        messages_without_timestamps.emplace_back(std::move(message_body));
+    }
+
+    BENCHMARK("TimestampPattern::search_known_ts_patterns") {
+        return search_known_ts_patterns(messages);
+    };
+
+    BENCHMARK("TimestampPattern::search_known_ts_patterns (mixed formats)") {
+        return search_known_ts_patterns(mixed_format_messages);
+    };
+
+    BENCHMARK("TimestampPattern::search_known_ts_patterns (no timestamps)") {
+        return search_known_ts_patterns(messages_without_timestamps);
+    };
+}
+
+TEST_CASE("benchmark-GrepCore", "[benchmark][clp][search]") {
+    // The dictionaries are mocks that store entries in memory, so this measures query processing
+    // against small dictionaries rather than dictionary I/O.
+    MockLogTypeDictionary logtype_dict;
+    MockVariableDictionary var_dict;
+    populate_dictionaries(generate_text_messages(cNumMessages), logtype_dict, var_dict);
+
+    vector<string> const queries{
+            "*Processed request * for user user_12 in *",
+            "*timed out after 3 retries*",
+            "*Failed to open /var/data/shard-2/part-1*",
+            "*error code 17*",
+            "*session:0000*"
+    };
+    log_surgeon::lexers::ByteLexer lexer;
+
+    BENCHMARK("GrepCore::process_raw_query") {
+        size_t num_sub_queries{0};
+        for (auto const& query : queries) {
+            auto const processed_query{clp::GrepCore::process_raw_query(
+                    logtype_dict,
+                    var_dict,
+                    query,
+                    clp::cEpochTimeMin,
+                    clp::cEpochTimeMax,
+                    false,
+                    lexer,
+                    true
+            )};
+            if (processed_query.has_value()) {
+                num_sub_queries += processed_query->get_sub_queries().size();
+            }
+        }
+        return num_sub_queries;
+    };
+}
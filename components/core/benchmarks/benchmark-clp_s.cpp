@@ -0,0 +1,218 @@
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "../src/clp_s/ArchiveReader.hpp"
+#include "../src/clp_s/InputConfig.hpp"
+#include "../src/clp_s/OutputHandlerImpl.hpp"
+#include "../src/clp_s/search/ast/ConvertToExists.hpp"
+#include "../src/clp_s/search/ast/EmptyExpr.hpp"
+#include "../src/clp_s/search/ast/Expression.hpp"
+#include "../src/clp_s/search/ast/NarrowTypes.hpp"
+#include "../src/clp_s/search/ast/OrOfAndForm.hpp"
+#include "../src/clp_s/search/EvaluateRangeIndexFilters.hpp"
+#include "../src/clp_s/search/EvaluateTimestampIndex.hpp"
+#include "../src/clp_s/search/kql/kql.hpp"
+#include "../src/clp_s/search/Output.hpp"
+#include "../src/clp_s/search/SchemaMatch.hpp"
+#include "../src/clp_s/tests/clp_s_test_utils.hpp"
+#include "../src/clp_s/timestamp_parser/TimestampParser.hpp"
+#include "../tests/TestOutputCleaner.hpp"
+#include "SyntheticLogGenerator.hpp"
+
+using std::string;
+using std::vector;
+
+namespace {
+constexpr size_t cNumRecords{20'000};
+constexpr std::string_view cInputFile{"benchmark-clp-s-input.jsonl"};
+constexpr std::string_view cArchiveDirectory{"benchmark-clp-s-archives"};
+constexpr std::string_view cTimestampKey{"timestamp"};
+
+/**
+ * Parses a KQL query and runs the passes that precede searching an archive.
+ * @param query
+ * @return The expression to search for.
+ */
+auto parse_query(string const& query) -> std::shared_ptr<clp_s::search::ast::Expression>;
+
+/**
+ * Searches every archive in a directory, as clp-s does.
+ * @param expr
+ * @param archive_directory
+ * @return The number of matching log events.
+ */
+auto search_archives(
+        std::shared_ptr<clp_s::search::ast::Expression> const& expr,
+        std::string_view archive_directory
+) -> size_t;
+
+auto parse_query(string const& query) -> std::shared_ptr<clp_s::search::ast::Expression> {
+    auto query_stream{std::istringstream{query}};
+    auto expr{clp_s::search::kql::parse_kql_expression(query_stream)};
+    REQUIRE(nullptr != expr);
+
+    clp_s::search::ast::OrOfAndForm standardize_pass;
+    expr = standardize_pass.run(expr);
+    clp_s::search::ast::NarrowTypes narrow_pass;
+    expr = narrow_pass.run(expr);
+    clp_s::search::ast::ConvertToExists convert_pass;
+    expr = convert_pass.run(expr);
+    REQUIRE(nullptr != expr);
+    REQUIRE(nullptr == std::dynamic_pointer_cast<clp_s::search::ast::EmptyExpr>(expr));
+    return expr;
+}
+
+auto search_archives(
+        std::shared_ptr<clp_s::search::ast::Expression> const& expr,
+        std::string_view archive_directory
+) -> size_t {
+    vector<clp_s::VectorOutputHandler::QueryResult> results;
+    for (auto const& entry : std::filesystem::directory_iterator(archive_directory)) {
+        auto archive_reader{std::make_shared<clp_s::ArchiveReader>()};
+        archive_reader->open(
+                clp_s::Path{.source{clp_s::InputSource::Filesystem}, .path{entry.path().string()}},
+                clp_s::NetworkAuthOption{}
+        );
+
+        auto archive_expr{expr->copy()};
+        clp_s::search::EvaluateRangeIndexFilters metadata_filter_pass{
+                archive_reader->get_range_index(),
+                true
+        };
+        archive_expr = metadata_filter_pass.run(archive_expr);
+        if (std::dynamic_pointer_cast<clp_s::search::ast::EmptyExpr>(archive_expr)) {
+            archive_reader->close();
+            continue;
+        }
+
+        clp_s::search::EvaluateTimestampIndex timestamp_index_pass{
+                archive_reader->get_timestamp_dictionary()
+        };
+        if (clp_s::EvaluatedValue::False == timestamp_index_pass.run(archive_expr)) {
+            archive_reader->close();
+            continue;
+        }
+
+        auto match_pass{std::make_shared<clp_s::search::SchemaMatch>(
+                archive_reader->get_schema_tree(),
+                archive_reader->get_schema_map()
+        )};
+        archive_expr = match_pass->run(archive_expr);
+        if (std::dynamic_pointer_cast<clp_s::search::ast::EmptyExpr>(archive_expr)) {
+            archive_reader->close();
+            continue;
+        }
+
+        clp_s::search::Output output_pass{
+                match_pass,
+                archive_expr,
+                archive_reader,
+                std::make_unique<clp_s::VectorOutputHandler>(results),
+                false
+        };
+        output_pass.filter();
+        archive_reader->close();
+    }
+    return results.size();
+}
+}  // namespace
+
+TEST_CASE("benchmark-JsonParser", "[benchmark][clp-s][compression]") {
+    TestOutputCleaner const test_cleanup{{string{cInputFile}, string{cArchiveDirectory}}};
+    write_json_lines_file(string{cInputFile}, cNumRecords);
+    std::filesystem::create_directory(cArchiveDirectory);
+
+    BENCHMARK_ADVANCED("JsonParser::ingest")(Catch::Benchmark::Chronometer meter) {
+        // Each run compresses the input into a new archive directory
+        vector<string> archive_directories;
+        for (int i{0}; i < meter.runs(); ++i) {
+            archive_directories.emplace_back(fmt::format("{}/{}", cArchiveDirectory, i));
+        }
+
+        meter.measure([&](int run_idx) {
+            return compress_archive(
+                    string{cInputFile},
+                    archive_directories[static_cast<size_t>(run_idx)],
+                    string{cTimestampKey},
+                    false,
+                    false,
+                    false
+            );
+        });
+
+        for (auto const& archive_directory : archive_directories) {
+            std::filesystem::remove_all(archive_directory);
+        }
+    };
+}
+
+TEST_CASE("benchmark-clp-s-search", "[benchmark][clp-s][search]") {
+    TestOutputCleaner const test_cleanup{{string{cInputFile}, string{cArchiveDirectory}}};
+    write_json_lines_file(string{cInputFile}, cNumRecords);
+    std::ignore = compress_archive(
+            string{cInputFile},
+            string{cArchiveDirectory},
+            string{cTimestampKey},
+            false,
+            false,
+            false
+    );
+
+    // Numeric and exact-match filters are evaluated column-at-a-time by `ColumnScan`, while
+    // wildcard filters on messages are evaluated row-at-a-time by `QueryRunner::filter`.
+    auto const numeric_expr{parse_query("latency_ms > 990")};
+    BENCHMARK("search (ColumnScan): latency_ms > 990") {
+        return search_archives(numeric_expr, cArchiveDirectory);
+    };
+
+    auto const conjunction_expr{parse_query("status: 500 AND level: ERROR")};
+    BENCHMARK("search (ColumnScan): status: 500 AND level: ERROR") {
+        return search_archives(conjunction_expr, cArchiveDirectory);
+    };
+
+    auto const wildcard_expr{parse_query(R"(message: "*timed out after 3 retries*")")};
+    BENCHMARK(R"(search (QueryRunner::filter): message: "*timed out after 3 retries*")") {
+        return search_archives(wildcard_expr, cArchiveDirectory);
+    };
+}
+
+TEST_CASE("benchmark-TimestampParser", "[benchmark][clp-s][timestamp]") {
+    auto const patterns_result{clp_s::timestamp_parser::get_all_default_timestamp_patterns()};
+    REQUIRE_FALSE(patterns_result.has_error());
+    auto const& patterns{patterns_result.value()};
+
+    SyntheticLogGenerator generator;
+    vector<string> timestamps;
+    timestamps.reserve(cNumRecords);
+    for (size_t i{0}; i < cNumRecords; ++i) {
+        timestamps.emplace_back(generator.next_timestamp_string());
+    }
+
+    BENCHMARK("timestamp_parser::search_known_timestamp_patterns") {
+        size_t num_timestamps_found{0};
+        string generated_pattern;
+        for (auto const& timestamp : timestamps) {
+            if (clp_s::timestamp_parser::search_known_timestamp_patterns(
+                        timestamp,
+                        patterns,
+                        false,
+                        generated_pattern
+                )
+                        .has_value())
+            {
+                ++num_timestamps_found;
+            }
+        }
+        return num_timestamps_found;
+    };
+}
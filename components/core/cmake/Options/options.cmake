@@ -11,6 +11,12 @@ option(
     ON
 )
 
+option(
+    CLP_BUILD_BENCHMARKS
+    "Build the microbenchmarks."
+    OFF
+)
+
 option(
     CLP_BUILD_CLP_REGEX_UTILS
     "Build clp::regex_utils."
@@ -150,6 +156,7 @@ function(validate_clp_binaries_dependencies)
         CLP_BUILD_CLP_S_ARCHIVEREADER
         CLP_BUILD_CLP_S_ARCHIVEWRITER
         CLP_BUILD_CLP_S_CLP_DEPENDENCIES
+        CLP_BUILD_CLP_S_FILTER
         CLP_BUILD_CLP_S_IO
         CLP_BUILD_CLP_S_JSONCONSTRUCTOR
         CLP_BUILD_CLP_S_REDUCER_DEPENDENCIES
@@ -235,6 +242,7 @@ function(validate_clp_s_archivereader_dependencies)
     validate_clp_dependencies_for_target(CLP_BUILD_CLP_S_ARCHIVEREADER
         CLP_BUILD_CLP_STRING_UTILS
         CLP_BUILD_CLP_S_CLP_DEPENDENCIES
+        CLP_BUILD_CLP_S_FILTER
         CLP_BUILD_CLP_S_IO
         CLP_BUILD_CLP_S_TIMESTAMP_PARSER
         CLP_BUILD_CLP_S_TIMESTAMPPATTERN
@@ -256,6 +264,7 @@ endfunction()
 function(validate_clp_s_archivewriter_dependencies)
     validate_clp_dependencies_for_target(CLP_BUILD_CLP_S_ARCHIVEWRITER
         CLP_BUILD_CLP_S_CLP_DEPENDENCIES
+        CLP_BUILD_CLP_S_FILTER
         CLP_BUILD_CLP_S_IO
         CLP_BUILD_CLP_S_TIMESTAMP_PARSER
         CLP_BUILD_CLP_S_TIMESTAMPPATTERN
@@ -474,6 +483,11 @@ function(validate_and_setup_all_clp_dependency_flags)
         set_clp_tests_dependencies()
     endif()
 
+    if (CLP_BUILD_BENCHMARKS)
+        # The benchmarks are built from the same sources and dependencies as the unit tests.
+        validate_clp_dependencies_for_target(CLP_BUILD_BENCHMARKS CLP_BUILD_TESTING)
+    endif()
+
     if (CLP_BUILD_CLP_REGEX_UTILS)
         validate_clp_regex_utils_dependencies()
         set_clp_regex_utils_dependencies()
@@ -32,7 +32,8 @@ CurlDownloadHandler::CurlDownloadHandler(
         bool disable_caching,
         std::chrono::seconds connection_timeout,
         std::chrono::seconds overall_timeout,
-        std::optional<std::unordered_map<std::string, std::string>> const& http_header_kv_pairs
+        std::optional<std::unordered_map<std::string, std::string>> const& http_header_kv_pairs,
+        std::optional<size_t> num_bytes_to_download
 )
         : m_error_msg_buf{std::move(error_msg_buf)} {
     if (nullptr != m_error_msg_buf) {
@@ -76,7 +77,22 @@ CurlDownloadHandler::CurlDownloadHandler(
             cCacheControlHeaderName,
             cPragmaHeaderName
     };
-    if (0 != offset) {
+    if (num_bytes_to_download.has_value()) {
+        // Unlike a range header, `CURLOPT_RANGE` also applies to non-HTTP protocols (e.g., file://)
+        if (0 == num_bytes_to_download.value()) {
+            throw CurlOperationFailed(
+                    ErrorCode_BadParam,
+                    __FILE__,
+                    __LINE__,
+                    CURLE_BAD_FUNCTION_ARGUMENT,
+                    "`CurlDownloadHandler` can't download an empty range."
+            );
+        }
+        auto const range{
+                fmt::format("{}-{}", offset, offset + num_bytes_to_download.value() - 1)
+        };
+        m_easy_handle.set_option(CURLOPT_RANGE, range.c_str());
+    } else if (0 != offset) {
         m_http_headers.append(fmt::format("{}: bytes={}-", cRangeHeaderName, offset));
     }
     if (disable_caching) {
@@ -59,6 +59,9 @@ public:
      * `connection_timeout`. Doc: https://curl.se/libcurl/c/CURLOPT_TIMEOUT.html
      * @param http_header_kv_pairs Key-value pairs representing HTTP headers to pass to the server
      * in the download request. Doc: https://curl.se/libcurl/c/CURLOPT_HTTPHEADER.html
+     * @param num_bytes_to_download The number of bytes to download starting at `offset`, or
+     * std::nullopt to download until the end of the data. Doc:
+     * https://curl.se/libcurl/c/CURLOPT_RANGE.html
      * @throw CurlOperationFailed if an error occurs.
      */
     explicit CurlDownloadHandler(
@@ -72,7 +75,8 @@ public:
             std::chrono::seconds connection_timeout = cDefaultConnectionTimeout,
             std::chrono::seconds overall_timeout = cDefaultOverallTimeout,
             std::optional<std::unordered_map<std::string, std::string>> const& http_header_kv_pairs
-            = std::nullopt
+            = std::nullopt,
+            std::optional<size_t> num_bytes_to_download = std::nullopt
     );
 
     // Disable copy/move constructors/assignment operators
@@ -91,6 +95,15 @@ public:
      */
     [[nodiscard]] auto perform() -> CURLcode { return m_easy_handle.perform(); }
 
+    /**
+     * @return The last response code received (e.g., the HTTP status code), or 0 if no response
+     * has been received.
+     * @throw CurlOperationFailed if an error occurs.
+     */
+    [[nodiscard]] auto get_response_code() -> long {
+        return m_easy_handle.get_info<long>(CURLINFO_RESPONSE_CODE);
+    }
+
 private:
     /**
      * Locates the certificate authority (CA) bundle file available on the current host.
@@ -66,6 +66,28 @@ public:
         }
     }
 
+    /**
+     * Gets the given CURL info from this handle.
+     * @tparam ValueType
+     * @param info
+     * @return The value of the info.
+     * @throw CurlOperationFailed if an error occurs.
+     */
+    template <typename ValueType>
+    [[nodiscard]] auto get_info(CURLINFO info) -> ValueType {
+        ValueType value{};
+        if (auto const err{curl_easy_getinfo(m_handle, info, &value)}; CURLE_OK != err) {
+            throw CurlOperationFailed(
+                    ErrorCode_Failure,
+                    __FILE__,
+                    __LINE__,
+                    err,
+                    "`curl_easy_getinfo` failed."
+            );
+        }
+        return value;
+    }
+
 private:
     CURL* m_handle{nullptr};
 };
@@ -0,0 +1,154 @@
+#include "CurlRangeFetcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <curl/curl.h>
+
+#include "CurlDownloadHandler.hpp"
+#include "CurlOperationFailed.hpp"
+#include "ErrorCode.hpp"
+#include "spdlog_with_specializations.hpp"
+
+namespace clp {
+namespace {
+// See https://www.rfc-editor.org/rfc/rfc9110#status.416
+constexpr long cHttpRangeNotSatisfiable{416};
+
+/**
+ * The destination of a single fetch.
+ */
+struct FetchDestination {
+    std::span<char> dst;
+    size_t num_bytes_written{0};
+};
+
+/**
+ * libcurl progress callback that never aborts the transfer.
+ * NOTE: This function must have C linkage to be a libcurl callback.
+ * @return 0
+ */
+extern "C" auto curl_progress_callback(
+        [[maybe_unused]] void* arg,
+        [[maybe_unused]] curl_off_t dltotal,
+        [[maybe_unused]] curl_off_t dlnow,
+        [[maybe_unused]] curl_off_t ultotal,
+        [[maybe_unused]] curl_off_t ulnow
+) -> int {
+    return 0;
+}
+
+/**
+ * libcurl write callback that copies downloaded data into the fetch's destination.
+ * NOTE: This function must have C linkage to be a libcurl callback.
+ * @param ptr A pointer to the downloaded data.
+ * @param size Always 1.
+ * @param nmemb The number of bytes downloaded.
+ * @param destination_ptr A pointer to a `FetchDestination`.
+ * @return The number of bytes copied. If this is less than `nmemb` (i.e., the server sent more
+ * data than was requested), the transfer will be aborted.
+ */
+extern "C" auto curl_write_callback(char* ptr, size_t size, size_t nmemb, void* destination_ptr)
+        -> size_t {
+    auto& destination{*static_cast<FetchDestination*>(destination_ptr)};
+    auto const num_bytes_downloaded{size * nmemb};
+    auto const num_bytes_to_copy{std::min(
+            num_bytes_downloaded,
+            destination.dst.size() - destination.num_bytes_written
+    )};
+    std::memcpy(destination.dst.data() + destination.num_bytes_written, ptr, num_bytes_to_copy);
+    destination.num_bytes_written += num_bytes_to_copy;
+    return num_bytes_to_copy;
+}
+}  // namespace
+
+CurlRangeFetcher::CurlRangeFetcher(
+        std::string_view src_url,
+        std::chrono::seconds connection_timeout,
+        std::chrono::seconds overall_timeout,
+        std::optional<std::unordered_map<std::string, std::string>> http_header_kv_pairs
+)
+        : m_src_url{src_url},
+          m_connection_timeout{connection_timeout},
+          m_overall_timeout{overall_timeout},
+          m_http_header_kv_pairs{std::move(http_header_kv_pairs)} {}
+
+auto CurlRangeFetcher::fetch(size_t begin, std::span<char> dst, size_t& num_bytes_fetched)
+        -> ErrorCode {
+    num_bytes_fetched = 0;
+    if (dst.empty()) {
+        return ErrorCode_Success;
+    }
+
+    FetchDestination destination{.dst = dst};
+    auto const error_msg_buf{std::make_shared<CurlDownloadHandler::ErrorMsgBuf>()};
+    try {
+        CurlDownloadHandler curl_handler{
+                error_msg_buf,
+                curl_progress_callback,
+                curl_write_callback,
+                static_cast<void*>(&destination),
+                m_src_url,
+                begin,
+                false,
+                m_connection_timeout,
+                m_overall_timeout,
+                m_http_header_kv_pairs,
+                dst.size()
+        };
+        auto const curl_code{curl_handler.perform()};
+        switch (curl_code) {
+            case CURLE_OK:
+                break;
+            case CURLE_BAD_DOWNLOAD_RESUME:
+                // Non-HTTP protocols (e.g., file://) report a range beyond the end this way
+                return ErrorCode_EndOfFile;
+            case CURLE_HTTP_RETURNED_ERROR:
+                if (cHttpRangeNotSatisfiable == curl_handler.get_response_code()) {
+                    return ErrorCode_EndOfFile;
+                }
+                SPDLOG_ERROR(
+                        "CurlRangeFetcher: Failed to fetch {} bytes at offset {} - {}",
+                        dst.size(),
+                        begin,
+                        error_msg_buf->data()
+                );
+                return ErrorCode_Failure;
+            case CURLE_WRITE_ERROR:
+                SPDLOG_ERROR(
+                        "CurlRangeFetcher: Server returned more than the {} bytes requested at"
+                        " offset {}; range requests may be unsupported.",
+                        dst.size(),
+                        begin
+                );
+                return ErrorCode_Unsupported;
+            default:
+                SPDLOG_ERROR(
+                        "CurlRangeFetcher: Failed to fetch {} bytes at offset {} - {}",
+                        dst.size(),
+                        begin,
+                        error_msg_buf->data()
+                );
+                return ErrorCode_Failure;
+        }
+    } catch (CurlOperationFailed const& e) {
+        SPDLOG_ERROR("CurlRangeFetcher: {}", e.what());
+        return ErrorCode_Failure;
+    }
+
+    num_bytes_fetched = destination.num_bytes_written;
+    if (0 == num_bytes_fetched) {
+        return ErrorCode_EndOfFile;
+    }
+    return ErrorCode_Success;
+}
+}  // namespace clp
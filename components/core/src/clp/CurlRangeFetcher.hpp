@@ -0,0 +1,67 @@
+#ifndef CLP_CURLRANGEFETCHER_HPP
+#define CLP_CURLRANGEFETCHER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "CurlDownloadHandler.hpp"
+#include "CurlGlobalInstance.hpp"
+#include "ErrorCode.hpp"
+#include "HttpRangeReader.hpp"
+
+namespace clp {
+/**
+ * Fetches byte ranges of the data at a URL using libcurl, issuing one range request per fetch.
+ *
+ * NOTE: Like `NetworkReader`, this class maintains an instance of `CurlGlobalInstance`, but it's
+ * better for performance if the user instantiates one that outlives all instances of this class.
+ */
+class CurlRangeFetcher : public HttpRangeReader::RangeFetcher {
+public:
+    // Constructors
+    /**
+     * @param src_url
+     * @param connection_timeout Maximum time that the connection phase of each request may take.
+     * Doc: https://curl.se/libcurl/c/CURLOPT_CONNECTTIMEOUT.html
+     * @param overall_timeout Maximum time that each request may take. Note that this includes
+     * `connection_timeout`. Doc: https://curl.se/libcurl/c/CURLOPT_TIMEOUT.html
+     * @param http_header_kv_pairs Key-value pairs representing HTTP headers to pass to the server
+     * in each request. Doc: https://curl.se/libcurl/c/CURLOPT_HTTPHEADER.html
+     */
+    explicit CurlRangeFetcher(
+            std::string_view src_url,
+            std::chrono::seconds connection_timeout
+            = CurlDownloadHandler::cDefaultConnectionTimeout,
+            std::chrono::seconds overall_timeout = CurlDownloadHandler::cDefaultOverallTimeout,
+            std::optional<std::unordered_map<std::string, std::string>> http_header_kv_pairs
+            = std::nullopt
+    );
+
+    // Methods implementing `HttpRangeReader::RangeFetcher`
+    /**
+     * @param begin
+     * @param dst
+     * @param num_bytes_fetched
+     * @return ErrorCode_Success on success.
+     * @return ErrorCode_EndOfFile if `begin` is at or beyond the end of the data.
+     * @return ErrorCode_Unsupported if the server ignored the range and returned more data.
+     * @return ErrorCode_Failure if the request failed.
+     */
+    [[nodiscard]] auto fetch(size_t begin, std::span<char> dst, size_t& num_bytes_fetched)
+            -> ErrorCode override;
+
+private:
+    CurlGlobalInstance m_curl_global_instance;
+    std::string m_src_url;
+    std::chrono::seconds m_connection_timeout;
+    std::chrono::seconds m_overall_timeout;
+    std::optional<std::unordered_map<std::string, std::string>> m_http_header_kv_pairs;
+};
+}  // namespace clp
+
+#endif  // CLP_CURLRANGEFETCHER_HPP
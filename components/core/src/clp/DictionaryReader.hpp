@@ -2,6 +2,7 @@
 #define CLP_DICTIONARYREADER_HPP
 
 #include <iterator>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -12,6 +13,7 @@
 
 #include "dictionary_utils.hpp"
 #include "DictionaryEntry.hpp"
+#include "DictionaryTrigramIndex.hpp"
 #include "FileReader.hpp"
 #include "streaming_compression/passthrough/Decompressor.hpp"
 #include "streaming_compression/zstd/Decompressor.hpp"
@@ -65,6 +67,13 @@ public:
      */
     void read_new_entries();
 
+    /**
+     * Loads a trigram index over the dictionary's entries, which wildcard searches then use to
+     * shortlist the entries they need to match against.
+     * @param index_path
+     */
+    void load_trigram_index(std::string const& index_path);
+
     /**
      * Gets the dictionary's entries
      * @return All dictionary entries
@@ -126,6 +135,7 @@ protected:
 #endif
     size_t m_num_segments_read_from_index;
     std::vector<EntryType> m_entries;
+    std::optional<DictionaryTrigramIndex<DictionaryIdType>> m_trigram_index;
 };
 
 template <typename DictionaryIdType, typename EntryType>
@@ -170,6 +180,7 @@ void DictionaryReader<DictionaryIdType, EntryType>::close() {
 
     m_num_segments_read_from_index = 0;
     m_entries.clear();
+    m_trigram_index.reset();
 
     m_is_open = false;
 }
@@ -216,6 +227,17 @@ void DictionaryReader<DictionaryIdType, EntryType>::read_new_entries() {
     }
 }
 
+template <typename DictionaryIdType, typename EntryType>
+void DictionaryReader<DictionaryIdType, EntryType>::load_trigram_index(
+        std::string const& index_path
+) {
+    if (false == m_is_open) {
+        throw OperationFailed(ErrorCode_NotInit, __FILENAME__, __LINE__);
+    }
+
+    m_trigram_index.emplace(DictionaryTrigramIndex<DictionaryIdType>::read(index_path));
+}
+
 template <typename DictionaryIdType, typename EntryType>
 EntryType const&
 DictionaryReader<DictionaryIdType, EntryType>::get_entry(DictionaryIdType id) const {
@@ -277,7 +299,7 @@ void DictionaryReader<DictionaryIdType, EntryType>::get_entries_matching_wildcar
         bool ignore_case,
         std::unordered_set<EntryType const*>& entries
 ) const {
-    for (auto const& entry : m_entries) {
+    auto match_entry = [&](EntryType const& entry) {
         if (string_utils::wildcard_match_unsafe(
                     entry.get_value(),
                     wildcard_string,
@@ -286,6 +308,28 @@ void DictionaryReader<DictionaryIdType, EntryType>::get_entries_matching_wildcar
         {
             entries.insert(&entry);
         }
+    };
+
+    size_t num_indexed_entries{0};
+    if (m_trigram_index.has_value()) {
+        if (auto const candidate_ids{m_trigram_index->get_candidate_ids(wildcard_string)};
+            candidate_ids.has_value())
+        {
+            for (auto const id : candidate_ids.value()) {
+                // The index may cover entries that haven't been read yet
+                if (static_cast<size_t>(id) >= m_entries.size()) {
+                    break;
+                }
+                match_entry(m_entries[id]);
+            }
+            num_indexed_entries
+                    = std::min(m_trigram_index->get_num_indexed_entries(), m_entries.size());
+        }
+    }
+
+    // Entries added after the index was built aren't covered by it
+    for (size_t i{num_indexed_entries}; i < m_entries.size(); ++i) {
+        match_entry(m_entries[i]);
     }
 }
 
@@ -0,0 +1,295 @@
+#ifndef CLP_DICTIONARYTRIGRAMINDEX_HPP
+#define CLP_DICTIONARYTRIGRAMINDEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ErrorCode.hpp"
+#include "FileReader.hpp"
+#include "FileWriter.hpp"
+#include "streaming_compression/zstd/Compressor.hpp"
+#include "streaming_compression/zstd/Decompressor.hpp"
+#include "TraceableException.hpp"
+
+namespace clp {
+/**
+ * Index mapping each trigram (sequence of three bytes) to the IDs of the dictionary entries
+ * containing it. Wildcard searches use the index to shortlist the entries that can match before
+ * running the wildcard match on each of them.
+ *
+ * Trigrams are case-folded (ASCII only) so that the same index serves case-sensitive and
+ * case-insensitive searches.
+ *
+ * On-disk format (zstd-compressed):
+ * - Number of indexed entries: <64-bit integer>
+ * - Number of trigrams: <64-bit integer>
+ * - For each trigram:
+ *   - Trigram: <32-bit integer>
+ *   - Number of IDs: <64-bit integer>
+ *   - IDs, in ascending order, each stored as the delta from the previous ID: <DictionaryIdType>
+ *     * number of IDs
+ * @tparam DictionaryIdType
+ */
+template <typename DictionaryIdType>
+class DictionaryTrigramIndex {
+public:
+    // Types
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+
+        // Methods
+        char const* what() const noexcept override {
+            return "DictionaryTrigramIndex operation failed";
+        }
+    };
+
+    // Methods
+    /**
+     * Builds an index over the given entries.
+     * @tparam ValueToIdMap A map from each entry's value to its ID.
+     * @param value_to_id
+     * @return The index.
+     */
+    template <typename ValueToIdMap>
+    [[nodiscard]] static auto build(ValueToIdMap const& value_to_id) -> DictionaryTrigramIndex;
+
+    /**
+     * Writes the index to a new file.
+     * @param path
+     */
+    void write(std::string const& path) const;
+
+    /**
+     * Reads an index from a file.
+     * @param path
+     * @return The index.
+     * @throw OperationFailed if the file is truncated or corrupt.
+     */
+    [[nodiscard]] static auto read(std::string const& path) -> DictionaryTrigramIndex;
+
+    /**
+     * @return The number of entries covered by the index. Entries with larger IDs were added to
+     * the dictionary after the index was built.
+     */
+    [[nodiscard]] auto get_num_indexed_entries() const -> size_t { return m_num_indexed_entries; }
+
+    /**
+     * Gets the IDs of the indexed entries that contain every trigram in the literal (non-wildcard)
+     * parts of the given wildcard string.
+     * @param wildcard_string
+     * @return The IDs of the candidate entries in ascending order, or std::nullopt if the wildcard
+     * string has no literal part long enough to rule out any entry.
+     */
+    [[nodiscard]] auto get_candidate_ids(std::string_view wildcard_string) const
+            -> std::optional<std::vector<DictionaryIdType>>;
+
+private:
+    // Types
+    using trigram_t = uint32_t;
+
+    // Methods
+    /**
+     * Appends the trigrams of a case-folded literal string to the given vector.
+     * @param literal
+     * @param trigrams
+     */
+    static void append_trigrams(std::string_view literal, std::vector<trigram_t>& trigrams);
+
+    /**
+     * @param c
+     * @return `c` in lowercase if it's an ASCII uppercase letter, or `c` otherwise.
+     */
+    [[nodiscard]] static auto fold_case(char c) -> char {
+        return ('A' <= c && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // Variables
+    size_t m_num_indexed_entries{0};
+    std::unordered_map<trigram_t, std::vector<DictionaryIdType>> m_trigram_to_ids;
+};
+
+template <typename DictionaryIdType>
+template <typename ValueToIdMap>
+auto DictionaryTrigramIndex<DictionaryIdType>::build(ValueToIdMap const& value_to_id)
+        -> DictionaryTrigramIndex {
+    DictionaryTrigramIndex index;
+    index.m_num_indexed_entries = value_to_id.size();
+
+    std::string folded_value;
+    std::vector<trigram_t> trigrams;
+    for (auto const& [value, id] : value_to_id) {
+        folded_value.clear();
+        std::ranges::transform(value, std::back_inserter(folded_value), fold_case);
+        trigrams.clear();
+        append_trigrams(folded_value, trigrams);
+        std::ranges::sort(trigrams);
+        auto const duplicates{std::ranges::unique(trigrams)};
+        trigrams.erase(duplicates.begin(), duplicates.end());
+        for (auto const trigram : trigrams) {
+            index.m_trigram_to_ids[trigram].push_back(id);
+        }
+    }
+    for (auto& [trigram, ids] : index.m_trigram_to_ids) {
+        std::ranges::sort(ids);
+    }
+    return index;
+}
+
+template <typename DictionaryIdType>
+void DictionaryTrigramIndex<DictionaryIdType>::write(std::string const& path) const {
+    FileWriter file_writer;
+    file_writer.open(path, FileWriter::OpenMode::CREATE_FOR_WRITING);
+    streaming_compression::zstd::Compressor compressor;
+    compressor.open(file_writer);
+
+    // Trigrams are written in sorted order so that the file's contents are deterministic.
+    std::vector<trigram_t> trigrams;
+    trigrams.reserve(m_trigram_to_ids.size());
+    for (auto const& [trigram, ids] : m_trigram_to_ids) {
+        trigrams.push_back(trigram);
+    }
+    std::ranges::sort(trigrams);
+
+    compressor.write_numeric_value<uint64_t>(m_num_indexed_entries);
+    compressor.write_numeric_value<uint64_t>(trigrams.size());
+    for (auto const trigram : trigrams) {
+        auto const& ids{m_trigram_to_ids.at(trigram)};
+        compressor.write_numeric_value(trigram);
+        compressor.write_numeric_value<uint64_t>(ids.size());
+        DictionaryIdType prev_id{0};
+        for (auto const id : ids) {
+            compressor.write_numeric_value<DictionaryIdType>(id - prev_id);
+            prev_id = id;
+        }
+    }
+
+    compressor.close();
+    file_writer.close();
+}
+
+template <typename DictionaryIdType>
+auto DictionaryTrigramIndex<DictionaryIdType>::read(std::string const& path)
+        -> DictionaryTrigramIndex {
+    constexpr size_t cDecompressorFileReadBufferCapacity = 64 * 1024;  // 64 KiB
+
+    FileReader file_reader{path};
+    streaming_compression::zstd::Decompressor decompressor;
+    decompressor.open(file_reader, cDecompressorFileReadBufferCapacity);
+
+    auto read_value = [&]<typename T>(T& value) {
+        if (ErrorCode_Success != decompressor.try_read_numeric_value(value)) {
+            throw OperationFailed(ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+    };
+
+    DictionaryTrigramIndex index;
+    uint64_t num_indexed_entries{0};
+    read_value(num_indexed_entries);
+    index.m_num_indexed_entries = num_indexed_entries;
+
+    uint64_t num_trigrams{0};
+    read_value(num_trigrams);
+    for (uint64_t i{0}; i < num_trigrams; ++i) {
+        trigram_t trigram{0};
+        read_value(trigram);
+        uint64_t num_ids{0};
+        read_value(num_ids);
+        if (num_ids > num_indexed_entries) {
+            throw OperationFailed(ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+
+        auto& ids{index.m_trigram_to_ids[trigram]};
+        ids.reserve(num_ids);
+        DictionaryIdType id{0};
+        for (uint64_t j{0}; j < num_ids; ++j) {
+            DictionaryIdType delta{0};
+            read_value(delta);
+            id += delta;
+            ids.push_back(id);
+        }
+    }
+
+    decompressor.close();
+    return index;
+}
+
+template <typename DictionaryIdType>
+auto DictionaryTrigramIndex<DictionaryIdType>::get_candidate_ids(std::string_view wildcard_string
+) const -> std::optional<std::vector<DictionaryIdType>> {
+    // Split the wildcard string into its literal parts, unescaping any escaped characters
+    std::vector<trigram_t> trigrams;
+    std::string literal;
+    for (size_t i{0}; i < wildcard_string.size(); ++i) {
+        auto const c{wildcard_string[i]};
+        if ('*' == c || '?' == c) {
+            append_trigrams(literal, trigrams);
+            literal.clear();
+            continue;
+        }
+        if ('\\' == c && i + 1 < wildcard_string.size()) {
+            ++i;
+        }
+        literal.push_back(fold_case(wildcard_string[i]));
+    }
+    append_trigrams(literal, trigrams);
+    if (trigrams.empty()) {
+        return std::nullopt;
+    }
+    std::ranges::sort(trigrams);
+    auto const duplicates{std::ranges::unique(trigrams)};
+    trigrams.erase(duplicates.begin(), duplicates.end());
+
+    // Intersect the ID lists starting from the shortest, so each intersection is as cheap as
+    // possible.
+    std::vector<std::vector<DictionaryIdType> const*> id_lists;
+    id_lists.reserve(trigrams.size());
+    for (auto const trigram : trigrams) {
+        auto const it{m_trigram_to_ids.find(trigram)};
+        if (m_trigram_to_ids.end() == it) {
+            return std::vector<DictionaryIdType>{};
+        }
+        id_lists.push_back(&it->second);
+    }
+    std::ranges::sort(id_lists, {}, [](auto const* ids) { return ids->size(); });
+
+    std::vector<DictionaryIdType> candidate_ids{*id_lists.front()};
+    std::vector<DictionaryIdType> intersection;
+    for (size_t i{1}; i < id_lists.size() && false == candidate_ids.empty(); ++i) {
+        intersection.clear();
+        std::ranges::set_intersection(
+                candidate_ids,
+                *id_lists[i],
+                std::back_inserter(intersection)
+        );
+        std::swap(candidate_ids, intersection);
+    }
+    return candidate_ids;
+}
+
+template <typename DictionaryIdType>
+void DictionaryTrigramIndex<DictionaryIdType>::append_trigrams(
+        std::string_view literal,
+        std::vector<trigram_t>& trigrams
+) {
+    for (size_t i{0}; i + 3 <= literal.size(); ++i) {
+        trigrams.push_back(
+                static_cast<trigram_t>(static_cast<unsigned char>(literal[i])) << 16
+                | static_cast<trigram_t>(static_cast<unsigned char>(literal[i + 1])) << 8
+                | static_cast<trigram_t>(static_cast<unsigned char>(literal[i + 2]))
+        );
+    }
+}
+}  // namespace clp
+
+#endif  // CLP_DICTIONARYTRIGRAMINDEX_HPP
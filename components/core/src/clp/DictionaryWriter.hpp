@@ -1,12 +1,14 @@
 #ifndef CLP_DICTIONARYWRITER_HPP
 #define CLP_DICTIONARYWRITER_HPP
 
+#include <optional>
 #include <string>
 
 #include <absl/container/flat_hash_map.h>
 
 #include "ArrayBackedPosIntSet.hpp"
 #include "Defs.h"
+#include "DictionaryTrigramIndex.hpp"
 #include "FileWriter.hpp"
 #include "spdlog_with_specializations.hpp"
 #include "streaming_compression/passthrough/Compressor.hpp"
@@ -59,6 +61,13 @@ public:
      */
     void close();
 
+    /**
+     * Enables building a trigram index over the dictionary's entries. The index is built and
+     * written to the given path when the dictionary is closed.
+     * @param index_path
+     */
+    void enable_trigram_index(std::string const& index_path) { m_trigram_index_path = index_path; }
+
     /**
      * Writes the dictionary's header and flushes unwritten content to disk
      */
@@ -107,6 +116,7 @@ protected:
     size_t m_num_segments_in_index;
 
     value_to_id_t m_value_to_id;
+    std::optional<std::string> m_trigram_index_path;
     DictionaryIdType m_next_id;
     DictionaryIdType m_max_id;
 
@@ -157,6 +167,11 @@ void DictionaryWriter<DictionaryIdType, EntryType>::close() {
     m_dictionary_compressor.close();
     m_dictionary_file_writer.close();
 
+    if (m_trigram_index_path.has_value()) {
+        DictionaryTrigramIndex<DictionaryIdType>::build(m_value_to_id)
+                .write(m_trigram_index_path.value());
+        m_trigram_index_path.reset();
+    }
     m_value_to_id.clear();
 
     m_is_open = false;
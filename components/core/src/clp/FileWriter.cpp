@@ -8,6 +8,7 @@
 
 #include "Defs.h"
 #include "Platform.hpp"
+#include "RuntimeMetrics.hpp"
 #include "spdlog_with_specializations.hpp"
 
 // Define a fdatasync shim for compilation (just compilation) on macOS
@@ -31,7 +32,9 @@ void FileWriter::write(char const* data, size_t data_length) {
     } else if (nullptr == data) {
         error_code = ErrorCode_BadParam;
     } else {
+        RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::IoWait};
         size_t num_bytes_written = fwrite(data, sizeof(*data), data_length, m_file);
+        timer.add_bytes(num_bytes_written);
         if (num_bytes_written < data_length) {
             error_code = ErrorCode_errno;
         }
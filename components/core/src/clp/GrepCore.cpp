@@ -1,6 +1,7 @@
 #include "GrepCore.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -8,7 +9,10 @@
 
 #include <clp/ir/parsing.hpp>
 
-using clp::ir::is_delim;
+using clp::ir::cAlphabetCharClass;
+using clp::ir::cDecimalDigitCharClass;
+using clp::ir::cNonDelimCharClass;
+using clp::ir::get_char_classes;
 using clp::string_utils::is_alphabet;
 using clp::string_utils::is_wildcard;
 using std::string;
@@ -35,11 +39,12 @@ bool GrepCore::get_bounds_of_next_potential_var(
         bool is_escaped = false;
         for (; begin_pos < value_length; ++begin_pos) {
             char c = value[begin_pos];
+            bool const is_non_delim = 0 != (get_char_classes(c) & cNonDelimCharClass);
 
             if (is_escaped) {
                 is_escaped = false;
 
-                if (false == is_delim(c)) {
+                if (is_non_delim) {
                     // Found escaped non-delimiter, so reverse the index to retain the escape
                     // character
                     --begin_pos;
@@ -53,25 +58,25 @@ bool GrepCore::get_bounds_of_next_potential_var(
                     contains_wildcard = true;
                     break;
                 }
-                if (false == is_delim(c)) {
+                if (is_non_delim) {
                     break;
                 }
             }
         }
 
-        bool contains_decimal_digit = false;
-        bool contains_alphabet = false;
-
-        // Find next delimiter
+        // Find next delimiter, accumulating the classes of the token's characters
+        uint8_t token_char_classes{0};
         is_escaped = false;
         end_pos = begin_pos;
         for (; end_pos < value_length; ++end_pos) {
             char c = value[end_pos];
+            auto const char_classes = get_char_classes(c);
+            bool const is_delim = 0 == (char_classes & cNonDelimCharClass);
 
             if (is_escaped) {
                 is_escaped = false;
 
-                if (is_delim(c)) {
+                if (is_delim) {
                     // Found escaped delimiter, so reverse the index to retain the escape character
                     --end_pos;
                     break;
@@ -82,18 +87,16 @@ bool GrepCore::get_bounds_of_next_potential_var(
             } else {
                 if (is_wildcard(c)) {
                     contains_wildcard = true;
-                } else if (is_delim(c)) {
+                } else if (is_delim) {
                     // Found delimiter that's not also a wildcard
                     break;
                 }
             }
 
-            if (string_utils::is_decimal_digit(c)) {
-                contains_decimal_digit = true;
-            } else if (is_alphabet(c)) {
-                contains_alphabet = true;
-            }
+            token_char_classes |= char_classes;
         }
+        bool const contains_decimal_digit = 0 != (token_char_classes & cDecimalDigitCharClass);
+        bool const contains_alphabet = 0 != (token_char_classes & cAlphabetCharClass);
 
         // Treat token as a definite variable if:
         // - it contains a decimal digit, or
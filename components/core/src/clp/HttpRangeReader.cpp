@@ -0,0 +1,190 @@
+#include "HttpRangeReader.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ErrorCode.hpp"
+
+namespace clp {
+HttpRangeReader::HttpRangeReader(
+        std::unique_ptr<RangeFetcher> fetcher,
+        size_t block_size,
+        size_t max_num_cached_blocks
+)
+        : m_fetcher{std::move(fetcher)},
+          m_block_size{block_size},
+          m_max_num_cached_blocks{max_num_cached_blocks} {
+    if (nullptr == m_fetcher || 0 == m_block_size || 0 == m_max_num_cached_blocks) {
+        throw OperationFailed(ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+}
+
+auto HttpRangeReader::try_read(char* buf, size_t num_bytes_to_read, size_t& num_bytes_read)
+        -> ErrorCode {
+    num_bytes_read = 0;
+    if (0 == num_bytes_to_read) {
+        return ErrorCode_Success;
+    }
+    if (nullptr == buf) {
+        return ErrorCode_BadParam;
+    }
+
+    while (num_bytes_read < num_bytes_to_read) {
+        Block const* block{nullptr};
+        if (auto const error_code{get_block(m_pos / m_block_size, block)};
+            ErrorCode_Success != error_code)
+        {
+            return error_code;
+        }
+        auto const pos_in_block{m_pos % m_block_size};
+        if (nullptr == block || pos_in_block >= block->data.size()) {
+            break;
+        }
+
+        auto const num_bytes_to_copy{
+                std::min(block->data.size() - pos_in_block, num_bytes_to_read - num_bytes_read)
+        };
+        std::memcpy(buf + num_bytes_read, block->data.data() + pos_in_block, num_bytes_to_copy);
+        num_bytes_read += num_bytes_to_copy;
+        m_pos += num_bytes_to_copy;
+    }
+
+    if (0 == num_bytes_read) {
+        return ErrorCode_EndOfFile;
+    }
+    return ErrorCode_Success;
+}
+
+auto HttpRangeReader::try_seek_from_begin(size_t pos) -> ErrorCode {
+    if (m_size.has_value() && pos > m_size.value()) {
+        return ErrorCode_OutOfBounds;
+    }
+    m_pos = pos;
+    return ErrorCode_Success;
+}
+
+auto HttpRangeReader::prefetch(std::span<std::pair<size_t, size_t> const> byte_ranges)
+        -> ErrorCode {
+    std::vector<size_t> block_indices;
+    for (auto const& [begin, end] : byte_ranges) {
+        if (begin >= end) {
+            continue;
+        }
+        auto const last_block_index{(end - 1) / m_block_size};
+        for (auto block_index{begin / m_block_size}; block_index <= last_block_index;
+             ++block_index)
+        {
+            if (m_size.has_value() && block_index * m_block_size >= m_size.value()) {
+                break;
+            }
+            if (false == m_block_index_to_cached_block.contains(block_index)) {
+                block_indices.push_back(block_index);
+            }
+        }
+    }
+    std::sort(block_indices.begin(), block_indices.end());
+    block_indices.erase(
+            std::unique(block_indices.begin(), block_indices.end()),
+            block_indices.end()
+    );
+    if (block_indices.size() > m_max_num_cached_blocks) {
+        block_indices.resize(m_max_num_cached_blocks);
+    }
+
+    // Fetch each run of consecutive blocks with a single request
+    for (size_t run_begin{0}; run_begin < block_indices.size();) {
+        auto run_end{run_begin + 1};
+        while (run_end < block_indices.size()
+               && block_indices[run_end - 1] + 1 == block_indices[run_end])
+        {
+            ++run_end;
+        }
+        if (auto const error_code{fetch_blocks(block_indices[run_begin], run_end - run_begin)};
+            ErrorCode_Success != error_code)
+        {
+            return error_code;
+        }
+        run_begin = run_end;
+    }
+    return ErrorCode_Success;
+}
+
+auto HttpRangeReader::get_block(size_t block_index, Block const*& block) -> ErrorCode {
+    block = nullptr;
+    auto it{m_block_index_to_cached_block.find(block_index)};
+    if (m_block_index_to_cached_block.end() == it) {
+        if (auto const error_code{fetch_blocks(block_index, 1)}; ErrorCode_Success != error_code) {
+            return error_code;
+        }
+        it = m_block_index_to_cached_block.find(block_index);
+        if (m_block_index_to_cached_block.end() == it) {
+            // The block is beyond the end of the data
+            return ErrorCode_Success;
+        }
+    }
+
+    // Mark the block as the most recently used
+    m_cached_blocks.splice(m_cached_blocks.begin(), m_cached_blocks, it->second);
+    block = &(*it->second);
+    return ErrorCode_Success;
+}
+
+auto HttpRangeReader::fetch_blocks(size_t first_block_index, size_t num_blocks) -> ErrorCode {
+    auto const begin{first_block_index * m_block_size};
+    auto num_bytes_to_fetch{num_blocks * m_block_size};
+    if (m_size.has_value()) {
+        if (begin >= m_size.value()) {
+            return ErrorCode_Success;
+        }
+        num_bytes_to_fetch = std::min(num_bytes_to_fetch, m_size.value() - begin);
+    }
+
+    std::vector<char> buf(num_bytes_to_fetch);
+    size_t num_bytes_fetched{0};
+    ++m_num_requests;
+    auto const error_code{m_fetcher->fetch(begin, buf, num_bytes_fetched)};
+    if (ErrorCode_EndOfFile == error_code) {
+        m_size = begin;
+        return ErrorCode_Success;
+    }
+    if (ErrorCode_Success != error_code) {
+        return error_code;
+    }
+    m_num_bytes_fetched += num_bytes_fetched;
+    if (num_bytes_fetched < num_bytes_to_fetch) {
+        m_size = begin + num_bytes_fetched;
+    }
+
+    for (size_t block_begin{0}; block_begin < num_bytes_fetched; block_begin += m_block_size) {
+        auto const block_end{std::min(block_begin + m_block_size, num_bytes_fetched)};
+        cache_block(
+                first_block_index + block_begin / m_block_size,
+                {buf.cbegin() + static_cast<std::ptrdiff_t>(block_begin),
+                 buf.cbegin() + static_cast<std::ptrdiff_t>(block_end)}
+        );
+    }
+    return ErrorCode_Success;
+}
+
+auto HttpRangeReader::cache_block(size_t block_index, std::vector<char> data) -> void {
+    if (auto const it{m_block_index_to_cached_block.find(block_index)};
+        m_block_index_to_cached_block.end() != it)
+    {
+        it->second->data = std::move(data);
+        m_cached_blocks.splice(m_cached_blocks.begin(), m_cached_blocks, it->second);
+        return;
+    }
+
+    m_cached_blocks.emplace_front(block_index, std::move(data));
+    m_block_index_to_cached_block.emplace(block_index, m_cached_blocks.begin());
+    if (m_cached_blocks.size() > m_max_num_cached_blocks) {
+        m_block_index_to_cached_block.erase(m_cached_blocks.back().index);
+        m_cached_blocks.pop_back();
+    }
+}
+}  // namespace clp
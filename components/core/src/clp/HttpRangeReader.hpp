@@ -0,0 +1,187 @@
+#ifndef CLP_HTTPRANGEREADER_HPP
+#define CLP_HTTPRANGEREADER_HPP
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ErrorCode.hpp"
+#include "ReaderInterface.hpp"
+#include "TraceableException.hpp"
+
+namespace clp {
+/**
+ * A seekable reader for remote data (e.g., a single-file archive on S3) that's fetched in byte
+ * ranges (e.g., with HTTP range requests).
+ *
+ * The data is divided into fixed-size blocks, which are fetched on demand and kept in a bounded
+ * cache with least-recently-used eviction, so seeking backwards to a recently read block costs no
+ * requests. Callers that know which parts of the data they'll read can `prefetch` them, in which
+ * case adjacent blocks that aren't cached are coalesced into a single request.
+ *
+ * NOTE: This class isn't thread-safe.
+ */
+class HttpRangeReader : public ReaderInterface {
+public:
+    // Types
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+
+        // Methods
+        [[nodiscard]] auto what() const noexcept -> char const* override {
+            return "clp::HttpRangeReader operation failed";
+        }
+    };
+
+    /**
+     * Interface for fetching byte ranges of the remote data.
+     */
+    class RangeFetcher {
+    public:
+        // Destructor
+        virtual ~RangeFetcher() = default;
+
+        // Methods
+        /**
+         * Fetches the bytes in [begin, begin + dst.size()) of the data into `dst`.
+         * @param begin
+         * @param dst
+         * @param num_bytes_fetched Returns the number of bytes fetched, which is only less than
+         * `dst.size()` if the data ends within the range.
+         * @return ErrorCode_Success on success.
+         * @return ErrorCode_EndOfFile if `begin` is at or beyond the end of the data.
+         * @return ErrorCode_Failure or another relevant ErrorCode on failure.
+         */
+        [[nodiscard]] virtual auto
+        fetch(size_t begin, std::span<char> dst, size_t& num_bytes_fetched) -> ErrorCode
+                = 0;
+    };
+
+    // Constants
+    static constexpr size_t cDefaultBlockSize{1024ULL * 1024};  // 1 MiB
+    static constexpr size_t cDefaultMaxNumCachedBlocks{64};
+
+    // Constructors
+    /**
+     * @param fetcher
+     * @param block_size The size of each block fetched and cached.
+     * @param max_num_cached_blocks
+     * @throw OperationFailed if `fetcher` is null, or `block_size` or `max_num_cached_blocks` is 0.
+     */
+    explicit HttpRangeReader(
+            std::unique_ptr<RangeFetcher> fetcher,
+            size_t block_size = cDefaultBlockSize,
+            size_t max_num_cached_blocks = cDefaultMaxNumCachedBlocks
+    );
+
+    // Methods implementing the ReaderInterface
+    /**
+     * Tries to read up to a given number of bytes, fetching any blocks that aren't cached.
+     * @param buf
+     * @param num_bytes_to_read
+     * @param num_bytes_read Returns the number of bytes read.
+     * @return ErrorCode_EndOfFile if the read head is at the end of the data.
+     * @return ErrorCode_Success on success.
+     * @return Same as RangeFetcher::fetch on failure.
+     */
+    [[nodiscard]] auto try_read(char* buf, size_t num_bytes_to_read, size_t& num_bytes_read)
+            -> ErrorCode override;
+
+    /**
+     * Tries to seek to the given position, relative to the beginning of the data. This doesn't
+     * fetch any data.
+     * @param pos
+     * @return ErrorCode_OutOfBounds if the end of the data is known and `pos` is beyond it.
+     * @return ErrorCode_Success on success.
+     */
+    [[nodiscard]] auto try_seek_from_begin(size_t pos) -> ErrorCode override;
+
+    /**
+     * @param pos Returns the position of the read head.
+     * @return ErrorCode_Success
+     */
+    [[nodiscard]] auto try_get_pos(size_t& pos) -> ErrorCode override {
+        pos = m_pos;
+        return ErrorCode_Success;
+    }
+
+    // Methods
+    /**
+     * Fetches the blocks covering the given byte ranges that aren't already cached, coalescing
+     * adjacent blocks into a single request. At most `max_num_cached_blocks` blocks are fetched, so
+     * that prefetched blocks don't evict each other; any remaining blocks are fetched on demand.
+     * @param byte_ranges [begin, end) pairs of byte ranges that will be read.
+     * @return ErrorCode_Success on success.
+     * @return Same as RangeFetcher::fetch on failure, except ErrorCode_EndOfFile.
+     */
+    [[nodiscard]] auto prefetch(std::span<std::pair<size_t, size_t> const> byte_ranges)
+            -> ErrorCode;
+
+    /**
+     * @return The number of requests made to the fetcher so far.
+     */
+    [[nodiscard]] auto get_num_requests() const -> size_t { return m_num_requests; }
+
+    /**
+     * @return The number of bytes fetched so far.
+     */
+    [[nodiscard]] auto get_num_bytes_fetched() const -> size_t { return m_num_bytes_fetched; }
+
+private:
+    // Types
+    struct Block {
+        size_t index;
+        std::vector<char> data;
+    };
+
+    // Methods
+    /**
+     * Gets a block from the cache, or fetches it if it isn't cached.
+     * @param block_index
+     * @param block Returns the block, or nullptr if it's beyond the end of the data.
+     * @return ErrorCode_Success on success.
+     * @return Same as `fetch_blocks` on failure.
+     */
+    [[nodiscard]] auto get_block(size_t block_index, Block const*& block) -> ErrorCode;
+
+    /**
+     * Fetches a run of consecutive blocks with a single request and caches them.
+     * @param first_block_index
+     * @param num_blocks
+     * @return ErrorCode_Success on success, including if the run is beyond the end of the data.
+     * @return Same as RangeFetcher::fetch on failure, except ErrorCode_EndOfFile.
+     */
+    [[nodiscard]] auto fetch_blocks(size_t first_block_index, size_t num_blocks) -> ErrorCode;
+
+    /**
+     * Caches a block, evicting the least recently used block if the cache is full.
+     * @param block_index
+     * @param data
+     */
+    auto cache_block(size_t block_index, std::vector<char> data) -> void;
+
+    std::unique_ptr<RangeFetcher> m_fetcher;
+    size_t m_block_size;
+    size_t m_max_num_cached_blocks;
+    size_t m_pos{0};
+    // The size of the data, once a fetch has reached its end
+    std::optional<size_t> m_size;
+
+    // Cached blocks in LRU order (LRU block at the back)
+    std::list<Block> m_cached_blocks;
+    std::unordered_map<size_t, std::list<Block>::iterator> m_block_index_to_cached_block;
+
+    size_t m_num_requests{0};
+    size_t m_num_bytes_fetched{0};
+};
+}  // namespace clp
+
+#endif  // CLP_HTTPRANGEREADER_HPP
@@ -1,6 +1,7 @@
 #include "LogTypeDictionaryWriter.hpp"
 
 #include "dictionary_utils.hpp"
+#include "RuntimeMetrics.hpp"
 
 using std::string;
 
@@ -12,6 +13,8 @@ bool LogTypeDictionaryWriter::add_entry(
     bool is_new_entry = false;
 
     string const& value = logtype_entry.get_value();
+    RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::DictionaryInsert};
+    timer.add_bytes(value.size());
     auto const ix = m_value_to_id.find(value);
     if (m_value_to_id.end() != ix) {
         // Entry exists so get its ID
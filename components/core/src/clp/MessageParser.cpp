@@ -1,5 +1,8 @@
 #include "MessageParser.hpp"
 
+#include <cstddef>
+#include <string_view>
+
 #include "Defs.h"
 #include "TimestampPattern.hpp"
 
@@ -21,16 +24,14 @@ bool MessageParser::parse_next_message(
             break;
         }
 
-        // Read a line up to the delimiter
-        bool found_delim = false;
-        for (; false == found_delim && buf_pos < buffer_length; ++buf_pos) {
-            auto c = buffer[buf_pos];
-
-            m_line += c;
-            if (cLineDelimiter == c) {
-                found_delim = true;
-            }
-        }
+        // Read a line up to the delimiter, appending it to the line in one step rather than
+        // character by character
+        std::string_view const remaining_buffer{buffer + buf_pos, buffer_length - buf_pos};
+        auto line_length = remaining_buffer.find(cLineDelimiter);
+        bool const found_delim = std::string_view::npos != line_length;
+        line_length = found_delim ? line_length + 1 : remaining_buffer.length();
+        m_line.append(remaining_buffer.substr(0, line_length));
+        buf_pos += line_length;
 
         if (false == found_delim && false == drain_source) {
             // No delimiter was found and the source doesn't need to be drained
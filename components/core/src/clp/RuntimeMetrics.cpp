@@ -0,0 +1,332 @@
+#include "RuntimeMetrics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include "ErrorCode.hpp"
+#include "spdlog_with_specializations.hpp"
+#include "type_utils.hpp"
+
+namespace clp {
+namespace {
+constexpr std::array<std::string_view, RuntimeMetrics::cNumStages> cStageNames{
+        "parse",
+        "encode",
+        "dictionary_insert",
+        "compress",
+        "io_wait",
+        "decompress",
+        "filter"
+};
+constexpr double cNanosecondsPerSecond{1e9};
+
+/**
+ * Counters for a stage that are only written by the thread that owns them, but may be read by any
+ * thread taking a snapshot.
+ */
+struct StageCounters {
+    std::atomic<uint64_t> num_operations{0};
+    std::atomic<uint64_t> total_duration_ns{0};
+    std::atomic<uint64_t> num_bytes{0};
+    std::array<std::atomic<uint64_t>, RuntimeMetrics::cNumHistogramBuckets>
+            histogram_bucket_counts{};
+};
+
+/**
+ * The counters of a single thread. Each instance registers itself with the `Registry` for the
+ * lifetime of its thread, and its counts are retained by the registry when its thread exits.
+ */
+class ThreadCounters {
+public:
+    // Constructors
+    ThreadCounters();
+
+    // Delete copy & move constructors and assignment operators
+    ThreadCounters(ThreadCounters const&) = delete;
+    ThreadCounters(ThreadCounters&&) = delete;
+    auto operator=(ThreadCounters const&) -> ThreadCounters& = delete;
+    auto operator=(ThreadCounters&&) -> ThreadCounters& = delete;
+
+    // Destructor
+    ~ThreadCounters();
+
+    // Methods
+    auto record(RuntimeMetrics::Stage stage, uint64_t duration_ns, size_t num_bytes) -> void;
+
+    /**
+     * Adds the counters to the given snapshot.
+     * @param snapshot
+     */
+    auto add_to(RuntimeMetrics::Snapshot& snapshot) const -> void;
+
+    auto reset() -> void;
+
+private:
+    // Variables
+    std::array<StageCounters, RuntimeMetrics::cNumStages> m_stages;
+};
+
+/**
+ * The set of live threads' counters, along with the counts of threads that have exited.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadCounters*> live_thread_counters;
+    RuntimeMetrics::Snapshot exited_threads_snapshot{};
+};
+
+/**
+ * @return The registry. It's intentionally leaked so that it outlives the thread-local counters of
+ * any thread, including those destroyed during program exit.
+ */
+auto get_registry() -> Registry&;
+
+/**
+ * @return The calling thread's counters.
+ */
+auto get_thread_counters() -> ThreadCounters&;
+
+/**
+ * Adds to a counter that's only written by the calling thread. Since there's a single writer, a
+ * relaxed load and store suffice, avoiding the cost of an atomic read-modify-write.
+ * @param counter
+ * @param value
+ */
+auto add_to_owned_counter(std::atomic<uint64_t>& counter, uint64_t value) -> void;
+
+/**
+ * @param duration_ns
+ * @return The index of the histogram bucket containing the given duration.
+ */
+auto get_histogram_bucket_index(uint64_t duration_ns) -> size_t;
+
+ThreadCounters::ThreadCounters() {
+    auto& registry{get_registry()};
+    std::lock_guard const lock{registry.mutex};
+    registry.live_thread_counters.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters() {
+    auto& registry{get_registry()};
+    std::lock_guard const lock{registry.mutex};
+    add_to(registry.exited_threads_snapshot);
+    std::erase(registry.live_thread_counters, this);
+}
+
+auto ThreadCounters::record(RuntimeMetrics::Stage stage, uint64_t duration_ns, size_t num_bytes)
+        -> void {
+    auto& counters{m_stages[enum_to_underlying_type(stage)]};
+    add_to_owned_counter(counters.num_operations, 1);
+    add_to_owned_counter(counters.total_duration_ns, duration_ns);
+    add_to_owned_counter(counters.num_bytes, num_bytes);
+    add_to_owned_counter(
+            counters.histogram_bucket_counts[get_histogram_bucket_index(duration_ns)],
+            1
+    );
+}
+
+auto ThreadCounters::add_to(RuntimeMetrics::Snapshot& snapshot) const -> void {
+    for (size_t i{0}; i < RuntimeMetrics::cNumStages; ++i) {
+        auto const& counters{m_stages[i]};
+        auto& stage_snapshot{snapshot[i]};
+        stage_snapshot.num_operations += counters.num_operations.load(std::memory_order_relaxed);
+        stage_snapshot.total_duration_ns
+                += counters.total_duration_ns.load(std::memory_order_relaxed);
+        stage_snapshot.num_bytes += counters.num_bytes.load(std::memory_order_relaxed);
+        for (size_t j{0}; j < RuntimeMetrics::cNumHistogramBuckets; ++j) {
+            stage_snapshot.histogram_bucket_counts[j]
+                    += counters.histogram_bucket_counts[j].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+auto ThreadCounters::reset() -> void {
+    for (auto& counters : m_stages) {
+        counters.num_operations.store(0, std::memory_order_relaxed);
+        counters.total_duration_ns.store(0, std::memory_order_relaxed);
+        counters.num_bytes.store(0, std::memory_order_relaxed);
+        for (auto& count : counters.histogram_bucket_counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+auto get_registry() -> Registry& {
+    static auto* registry{new Registry{}};
+    return *registry;
+}
+
+auto get_thread_counters() -> ThreadCounters& {
+    thread_local ThreadCounters thread_counters;
+    return thread_counters;
+}
+
+auto add_to_owned_counter(std::atomic<uint64_t>& counter, uint64_t value) -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+auto get_histogram_bucket_index(uint64_t duration_ns) -> size_t {
+    auto const& upper_bounds{RuntimeMetrics::cHistogramBucketUpperBoundsNs};
+    return static_cast<size_t>(
+            std::lower_bound(upper_bounds.cbegin(), upper_bounds.cend(), duration_ns)
+            - upper_bounds.cbegin()
+    );
+}
+}  // namespace
+
+std::atomic<bool> RuntimeMetrics::m_enabled{false};
+
+RuntimeMetrics::FileExporter::~FileExporter() {
+    if (auto const error_code{write_to_file(m_path, m_format)}; ErrorCode_Success != error_code) {
+        SPDLOG_ERROR("Failed to write runtime metrics to {}, errno={}", m_path, errno);
+    }
+}
+
+auto RuntimeMetrics::record(Stage stage, std::chrono::nanoseconds duration, size_t num_bytes)
+        -> void {
+    get_thread_counters().record(stage, static_cast<uint64_t>(duration.count()), num_bytes);
+}
+
+auto RuntimeMetrics::get_snapshot() -> Snapshot {
+    auto& registry{get_registry()};
+    std::lock_guard const lock{registry.mutex};
+    auto snapshot{registry.exited_threads_snapshot};
+    for (auto const* thread_counters : registry.live_thread_counters) {
+        thread_counters->add_to(snapshot);
+    }
+    return snapshot;
+}
+
+auto RuntimeMetrics::reset() -> void {
+    auto& registry{get_registry()};
+    std::lock_guard const lock{registry.mutex};
+    registry.exited_threads_snapshot = {};
+    for (auto* thread_counters : registry.live_thread_counters) {
+        thread_counters->reset();
+    }
+}
+
+auto RuntimeMetrics::get_stage_name(Stage stage) -> std::string_view {
+    return cStageNames.at(enum_to_underlying_type(stage));
+}
+
+auto RuntimeMetrics::parse_output_format(std::string_view name) -> std::optional<OutputFormat> {
+    if ("json" == name) {
+        return OutputFormat::Json;
+    }
+    if ("prometheus" == name) {
+        return OutputFormat::Prometheus;
+    }
+    return std::nullopt;
+}
+
+auto RuntimeMetrics::to_json(Snapshot const& snapshot) -> nlohmann::json {
+    nlohmann::json bucket_upper_bounds_seconds = nlohmann::json::array();
+    for (auto const upper_bound_ns : cHistogramBucketUpperBoundsNs) {
+        bucket_upper_bounds_seconds.push_back(
+                static_cast<double>(upper_bound_ns) / cNanosecondsPerSecond
+        );
+    }
+
+    nlohmann::json stages = nlohmann::json::object();
+    for (size_t i{0}; i < cNumStages; ++i) {
+        auto const& stage_snapshot{snapshot[i]};
+        nlohmann::json histogram = nlohmann::json::object();
+        histogram["bucket_upper_bounds_seconds"] = bucket_upper_bounds_seconds;
+        histogram["bucket_counts"] = stage_snapshot.histogram_bucket_counts;
+
+        auto& stage_json{stages[cStageNames[i]]};
+        stage_json["num_operations"] = stage_snapshot.num_operations;
+        stage_json["total_duration_seconds"]
+                = static_cast<double>(stage_snapshot.total_duration_ns) / cNanosecondsPerSecond;
+        stage_json["num_bytes"] = stage_snapshot.num_bytes;
+        stage_json["histogram"] = std::move(histogram);
+    }
+
+    nlohmann::json metrics = nlohmann::json::object();
+    metrics["stages"] = std::move(stages);
+    return metrics;
+}
+
+auto RuntimeMetrics::to_prometheus_text(Snapshot const& snapshot) -> std::string {
+    std::string text;
+    auto text_it{std::back_inserter(text)};
+    text += "# HELP clp_stage_duration_seconds Duration of the operations in each stage.\n";
+    text += "# TYPE clp_stage_duration_seconds histogram\n";
+    for (size_t i{0}; i < cNumStages; ++i) {
+        auto const& stage_snapshot{snapshot[i]};
+        auto const stage_name{cStageNames[i]};
+
+        // Prometheus histogram buckets are cumulative
+        uint64_t cumulative_count{0};
+        for (size_t j{0}; j < cHistogramBucketUpperBoundsNs.size(); ++j) {
+            cumulative_count += stage_snapshot.histogram_bucket_counts[j];
+            fmt::format_to(
+                    text_it,
+                    "clp_stage_duration_seconds_bucket{{stage=\"{}\",le=\"{}\"}} {}\n",
+                    stage_name,
+                    static_cast<double>(cHistogramBucketUpperBoundsNs[j]) / cNanosecondsPerSecond,
+                    cumulative_count
+            );
+        }
+        fmt::format_to(
+                text_it,
+                "clp_stage_duration_seconds_bucket{{stage=\"{}\",le=\"+Inf\"}} {}\n"
+                "clp_stage_duration_seconds_sum{{stage=\"{}\"}} {}\n"
+                "clp_stage_duration_seconds_count{{stage=\"{}\"}} {}\n",
+                stage_name,
+                stage_snapshot.num_operations,
+                stage_name,
+                static_cast<double>(stage_snapshot.total_duration_ns) / cNanosecondsPerSecond,
+                stage_name,
+                stage_snapshot.num_operations
+        );
+    }
+
+    text += "# HELP clp_stage_bytes_total Bytes processed by the operations in each stage.\n";
+    text += "# TYPE clp_stage_bytes_total counter\n";
+    for (size_t i{0}; i < cNumStages; ++i) {
+        fmt::format_to(
+                text_it,
+                "clp_stage_bytes_total{{stage=\"{}\"}} {}\n",
+                cStageNames[i],
+                snapshot[i].num_bytes
+        );
+    }
+    return text;
+}
+
+auto RuntimeMetrics::write_to_file(std::string const& path, OutputFormat format) -> ErrorCode {
+    auto const snapshot{get_snapshot()};
+    std::ofstream file{path};
+    if (false == file.is_open()) {
+        return ErrorCode_errno;
+    }
+    if (OutputFormat::Json == format) {
+        file << to_json(snapshot).dump() << '\n';
+    } else {
+        file << to_prometheus_text(snapshot);
+    }
+    file.close();
+    if (file.fail()) {
+        return ErrorCode_errno;
+    }
+    return ErrorCode_Success;
+}
+}  // namespace clp
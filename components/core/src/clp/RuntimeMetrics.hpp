@@ -0,0 +1,227 @@
+#ifndef CLP_RUNTIMEMETRICS_HPP
+#define CLP_RUNTIMEMETRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include "ErrorCode.hpp"
+#include "type_utils.hpp"
+
+namespace clp {
+/**
+ * Class to collect per-stage timing metrics at runtime.
+ *
+ * Unlike `Profiler`, which is compiled out unless `PROF_ENABLED` is set, these metrics are compiled
+ * into every build and enabled at runtime (e.g., with a program's `--metrics-file` option), so that
+ * a slow job can be attributed to a stage without rebuilding. For each stage, the class records the
+ * number of operations, their total duration, a histogram of their durations, and the number of
+ * bytes they processed.
+ *
+ * To keep the overhead low:
+ * - When disabled, timing an operation costs a relaxed atomic load and a branch.
+ * - When enabled, each thread records into its own counters, so recording never contends with other
+ *   threads. The counters are only aggregated when a snapshot is taken (e.g., at the end of a job).
+ *
+ * Stages may nest (e.g., decompressing a file includes waiting for its I/O), so the durations of
+ * different stages shouldn't be summed.
+ */
+class RuntimeMetrics {
+public:
+    // Types
+    enum class Stage : uint8_t {
+        // Parsing an input file, including everything done with its contents
+        Parse = 0,
+        // Encoding a log event into an archive's format
+        Encode,
+        // Looking up or adding a value in a dictionary
+        DictionaryInsert,
+        // Compressing a buffer
+        Compress,
+        // Reading from or writing to a file
+        IoWait,
+        // Decompressing into a buffer
+        Decompress,
+        // Evaluating a query against an archive's contents
+        Filter,
+        Length
+    };
+
+    enum class OutputFormat : uint8_t {
+        Json = 0,
+        Prometheus
+    };
+
+    // Constants
+    static constexpr size_t cNumStages{enum_to_underlying_type(Stage::Length)};
+    // Upper bounds of the duration histogram's buckets; the last bucket is unbounded.
+    static constexpr std::array<uint64_t, 9> cHistogramBucketUpperBoundsNs{
+            1000ULL,
+            10'000ULL,
+            100'000ULL,
+            1'000'000ULL,
+            10'000'000ULL,
+            100'000'000ULL,
+            1'000'000'000ULL,
+            10'000'000'000ULL,
+            100'000'000'000ULL
+    };
+    static constexpr size_t cNumHistogramBuckets{cHistogramBucketUpperBoundsNs.size() + 1};
+
+    struct StageSnapshot {
+        uint64_t num_operations{0};
+        uint64_t total_duration_ns{0};
+        uint64_t num_bytes{0};
+        std::array<uint64_t, cNumHistogramBuckets> histogram_bucket_counts{};
+    };
+
+    using Snapshot = std::array<StageSnapshot, cNumStages>;
+
+    /**
+     * Times an operation of the given stage from construction until destruction, if metrics are
+     * enabled at construction.
+     */
+    class ScopedTimer {
+    public:
+        // Constructors
+        explicit ScopedTimer(Stage stage) : m_stage{stage}, m_enabled{is_enabled()} {
+            if (m_enabled) {
+                m_begin = std::chrono::steady_clock::now();
+            }
+        }
+
+        // Delete copy & move constructors and assignment operators
+        ScopedTimer(ScopedTimer const&) = delete;
+        ScopedTimer(ScopedTimer&&) = delete;
+        auto operator=(ScopedTimer const&) -> ScopedTimer& = delete;
+        auto operator=(ScopedTimer&&) -> ScopedTimer& = delete;
+
+        // Destructor
+        ~ScopedTimer() {
+            if (m_enabled) {
+                record(m_stage, std::chrono::steady_clock::now() - m_begin, m_num_bytes);
+            }
+        }
+
+        // Methods
+        /**
+         * Adds to the number of bytes the timed operation processed.
+         * @param num_bytes
+         */
+        auto add_bytes(size_t num_bytes) -> void { m_num_bytes += num_bytes; }
+
+    private:
+        // Variables
+        Stage m_stage;
+        bool m_enabled;
+        size_t m_num_bytes{0};
+        std::chrono::steady_clock::time_point m_begin;
+    };
+
+    /**
+     * Enables collecting metrics on construction and writes them to a file on destruction, so that
+     * a program can export its metrics however it exits.
+     */
+    class FileExporter {
+    public:
+        // Constructors
+        FileExporter(std::string path, OutputFormat format)
+                : m_path{std::move(path)},
+                  m_format{format} {
+            enable();
+        }
+
+        // Delete copy & move constructors and assignment operators
+        FileExporter(FileExporter const&) = delete;
+        FileExporter(FileExporter&&) = delete;
+        auto operator=(FileExporter const&) -> FileExporter& = delete;
+        auto operator=(FileExporter&&) -> FileExporter& = delete;
+
+        // Destructor
+        ~FileExporter();
+
+    private:
+        // Variables
+        std::string m_path;
+        OutputFormat m_format;
+    };
+
+    // Methods
+    /**
+     * Enables collecting metrics for the rest of the program.
+     */
+    static auto enable() -> void { m_enabled.store(true, std::memory_order_relaxed); }
+
+    [[nodiscard]] static auto is_enabled() -> bool {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Records an operation for the given stage in the calling thread's counters.
+     * @param stage
+     * @param duration
+     * @param num_bytes
+     */
+    static auto record(Stage stage, std::chrono::nanoseconds duration, size_t num_bytes) -> void;
+
+    /**
+     * @return The metrics recorded by all threads so far.
+     */
+    [[nodiscard]] static auto get_snapshot() -> Snapshot;
+
+    /**
+     * Clears the metrics recorded by all threads so far.
+     */
+    static auto reset() -> void;
+
+    /**
+     * @param stage
+     * @return The stage's name as used in the exported metrics.
+     */
+    [[nodiscard]] static auto get_stage_name(Stage stage) -> std::string_view;
+
+    /**
+     * @param name
+     * @return The output format with the given name ("json" or "prometheus"), or std::nullopt if
+     * there's no such format.
+     */
+    [[nodiscard]] static auto parse_output_format(std::string_view name)
+            -> std::optional<OutputFormat>;
+
+    /**
+     * @param snapshot
+     * @return The snapshot as a JSON object keyed by stage name.
+     */
+    [[nodiscard]] static auto to_json(Snapshot const& snapshot) -> nlohmann::json;
+
+    /**
+     * @param snapshot
+     * @return The snapshot in Prometheus's text exposition format.
+     */
+    [[nodiscard]] static auto to_prometheus_text(Snapshot const& snapshot) -> std::string;
+
+    /**
+     * Writes a snapshot of the metrics recorded so far to the given file.
+     * @param path
+     * @param format
+     * @return ErrorCode_Success on success
+     * @return ErrorCode_errno if the file couldn't be written
+     */
+    [[nodiscard]] static auto write_to_file(std::string const& path, OutputFormat format)
+            -> ErrorCode;
+
+private:
+    // Variables
+    static std::atomic<bool> m_enabled;
+};
+}  // namespace clp
+
+#endif  // CLP_RUNTIMEMETRICS_HPP
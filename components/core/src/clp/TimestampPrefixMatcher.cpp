@@ -0,0 +1,114 @@
+#include "TimestampPrefixMatcher.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace clp {
+namespace {
+// Characters used in a prefix shape to stand for any character of a given class
+constexpr char cDigitShape{'\x01'};
+constexpr char cDigitOrSpaceShape{'\x02'};
+constexpr char cLetterShape{'\x03'};
+}  // namespace
+
+auto TimestampPrefixMatcher::get_prefix_shape(std::string_view format) -> std::string {
+    std::string prefix_shape;
+    for (size_t format_ix{0}; format_ix < format.length(); ++format_ix) {
+        if ('%' != format[format_ix]) {
+            prefix_shape += format[format_ix];
+            continue;
+        }
+        ++format_ix;
+        if (format_ix >= format.length()) {
+            break;
+        }
+        switch (format[format_ix]) {
+            case '%':
+                prefix_shape += '%';
+                break;
+            case 'Y':
+                prefix_shape.append(4, cDigitShape);
+                break;
+            case 'y':
+            case 'm':
+            case 'd':
+            case 'H':
+            case 'I':
+            case 'M':
+            case 'S':
+                prefix_shape.append(2, cDigitShape);
+                break;
+            case '3':
+                prefix_shape.append(3, cDigitShape);
+                break;
+            case 'e':
+            case 'k':
+            case 'l':
+                prefix_shape.append(2, cDigitOrSpaceShape);
+                break;
+            case 'a':
+            case 'b':
+                prefix_shape.append(3, cLetterShape);
+                break;
+            case 'p':
+                prefix_shape.append(2, cLetterShape);
+                break;
+            case '#':
+                // Relative timestamps have at least one digit
+                prefix_shape += cDigitShape;
+                return prefix_shape;
+            default:
+                // Variable-length field (e.g., a full month name)
+                return prefix_shape;
+        }
+    }
+    return prefix_shape;
+}
+
+auto TimestampPrefixMatcher::matches(uint8_t num_spaces_before_ts, std::string_view prefix_shape)
+        -> bool {
+    for (; m_num_spaces_found < num_spaces_before_ts && m_line_ix < m_line.length(); ++m_line_ix) {
+        if (' ' == m_line[m_line_ix]) {
+            ++m_num_spaces_found;
+            m_ts_begin_positions[m_num_spaces_found] = m_line_ix + 1;
+        }
+    }
+    if (m_num_spaces_found < num_spaces_before_ts) {
+        return false;
+    }
+
+    auto const begin_pos{m_ts_begin_positions[num_spaces_before_ts]};
+    if (m_line.length() - begin_pos < prefix_shape.length()) {
+        return false;
+    }
+    for (size_t i{0}; i < prefix_shape.length(); ++i) {
+        auto const c{m_line[begin_pos + i]};
+        bool const is_digit{'0' <= c && c <= '9'};
+        switch (prefix_shape[i]) {
+            case cDigitShape:
+                if (false == is_digit) {
+                    return false;
+                }
+                break;
+            case cDigitOrSpaceShape:
+                if (false == is_digit && ' ' != c) {
+                    return false;
+                }
+                break;
+            case cLetterShape:
+                if (false == (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z'))) {
+                    return false;
+                }
+                break;
+            default:
+                if (prefix_shape[i] != c) {
+                    return false;
+                }
+                break;
+        }
+    }
+    return true;
+}
+}  // namespace clp
@@ -0,0 +1,59 @@
+#ifndef CLP_TIMESTAMPPREFIXMATCHER_HPP
+#define CLP_TIMESTAMPPREFIXMATCHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace clp {
+/**
+ * Class for quickly ruling out timestamp patterns that can't parse a timestamp from a line.
+ *
+ * Every timestamp parsed with a given format starts with a prefix of a fixed shape: the format's
+ * literal characters, plus classes of characters (e.g., digits) for its fixed-width fields, up to
+ * the first variable-width field. The matcher checks a line against the prefix shapes of a sequence
+ * of patterns, finding where each pattern's timestamp would begin by scanning the line for spaces
+ * only once, however many patterns are checked.
+ *
+ * NOTE: The line must outlive the matcher.
+ */
+class TimestampPrefixMatcher {
+public:
+    // Constructor
+    explicit TimestampPrefixMatcher(std::string_view line) : m_line{line} {
+        m_ts_begin_positions[0] = 0;
+    }
+
+    // Methods
+    /**
+     * Gets the shape of the prefix that every timestamp parsed with the given format must start
+     * with. Each character of the shape is either a character the timestamp must contain verbatim,
+     * or a character standing for a class of characters.
+     * @param format
+     * @return The prefix shape
+     */
+    [[nodiscard]] static auto get_prefix_shape(std::string_view format) -> std::string;
+
+    /**
+     * @param num_spaces_before_ts The number of spaces before the timestamp in the line
+     * @param prefix_shape
+     * @return Whether the line has the given prefix shape where a timestamp preceded by the given
+     * number of spaces would begin
+     */
+    [[nodiscard]] auto matches(uint8_t num_spaces_before_ts, std::string_view prefix_shape) -> bool;
+
+private:
+    // Variables
+    std::string_view m_line;
+    // Positions where a timestamp preceded by the given number of spaces would begin, for every
+    // number of spaces up to m_num_spaces_found
+    std::array<size_t, std::numeric_limits<uint8_t>::max() + 1> m_ts_begin_positions;
+    size_t m_num_spaces_found{0};
+    size_t m_line_ix{0};
+};
+}  // namespace clp
+
+#endif  // CLP_TIMESTAMPPREFIXMATCHER_HPP
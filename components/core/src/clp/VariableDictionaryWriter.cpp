@@ -5,10 +5,13 @@
 
 #include "Defs.h"
 #include "dictionary_utils.hpp"
+#include "RuntimeMetrics.hpp"
 #include "spdlog_with_specializations.hpp"
 
 namespace clp {
 bool VariableDictionaryWriter::add_entry(std::string_view value, variable_dictionary_id_t& id) {
+    RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::DictionaryInsert};
+    timer.add_bytes(value.size());
     bool new_entry = false;
 
     auto const ix = m_value_to_id.find(value);
@@ -65,12 +65,23 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
     // Define output options
     po::options_description options_output("Output Options");
     char output_method_input = 's';
+    string metrics_format_input{"json"};
     options_output.add_options()(
             "output-method",
             po::value<char>(&output_method_input)
                     ->value_name("CHAR")
                     ->default_value(output_method_input),
             "Use output method specified by CHAR (s - stdout, b - binary)"
+    )(
+            "metrics-file",
+            po::value<string>(&m_metrics_file_path)->value_name("FILE"),
+            "Write runtime metrics (per-stage timings) to FILE when the search ends"
+    )(
+            "metrics-format",
+            po::value<string>(&metrics_format_input)
+                    ->value_name("FORMAT")
+                    ->default_value(metrics_format_input),
+            "Format of the runtime metrics (json | prometheus)"
     );
 
     // Define match controls
@@ -269,6 +280,12 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             default:
                 throw invalid_argument("Unknown --output-method specified.");
         }
+
+        auto const metrics_format{RuntimeMetrics::parse_output_format(metrics_format_input)};
+        if (false == metrics_format.has_value()) {
+            throw invalid_argument("Unknown --metrics-format specified.");
+        }
+        m_metrics_format = metrics_format.value();
     } catch (exception& e) {
         SPDLOG_ERROR("{}", e.what());
         print_basic_usage();
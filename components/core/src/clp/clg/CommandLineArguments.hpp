@@ -9,6 +9,7 @@
 #include "../CommandLineArgumentsBase.hpp"
 #include "../Defs.h"
 #include "../GlobalMetadataDBConfig.hpp"
+#include "../RuntimeMetrics.hpp"
 
 namespace clp::clg {
 class CommandLineArguments : public CommandLineArgumentsBase {
@@ -50,6 +51,10 @@ public:
         return m_metadata_db_config;
     }
 
+    std::string const& get_metrics_file_path() const { return m_metrics_file_path; }
+
+    RuntimeMetrics::OutputFormat get_metrics_format() const { return m_metrics_format; }
+
 private:
     // Methods
     void print_basic_usage() const override;
@@ -63,6 +68,8 @@ private:
     OutputMethod m_output_method;
     epochtime_t m_search_begin_ts, m_search_end_ts;
     std::optional<GlobalMetadataDBConfig> m_metadata_db_config;
+    std::string m_metrics_file_path;
+    RuntimeMetrics::OutputFormat m_metrics_format{RuntimeMetrics::OutputFormat::Json};
 };
 }  // namespace clp::clg
 
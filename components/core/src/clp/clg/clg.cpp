@@ -3,6 +3,7 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 #include <set>
 
 #include <log_surgeon/Lexer.hpp>
@@ -14,6 +15,7 @@
 #include "../Grep.hpp"
 #include "../GrepCore.hpp"
 #include "../Profiler.hpp"
+#include "../RuntimeMetrics.hpp"
 #include "../spdlog_with_specializations.hpp"
 #include "../streaming_archive/Constants.hpp"
 #include "../Utils.hpp"
@@ -33,6 +35,7 @@ using clp::load_lexer_from_file;
 using clp::logtype_dictionary_id_t;
 using clp::Profiler;
 using clp::Query;
+using clp::RuntimeMetrics;
 using clp::segment_id_t;
 using clp::streaming_archive::MetadataDB;
 using clp::streaming_archive::reader::Archive;
@@ -392,6 +395,7 @@ static size_t search_files(
 
             for (auto const& query : queries) {
                 archive.reset_file_indices(compressed_file);
+                RuntimeMetrics::ScopedTimer const filter_timer{RuntimeMetrics::Stage::Filter};
                 num_matches += Grep::search_and_output(
                         query,
                         SIZE_MAX,
@@ -500,6 +504,14 @@ int main(int argc, char const* argv[]) {
             break;
     }
 
+    std::optional<RuntimeMetrics::FileExporter> metrics_exporter;
+    if (false == command_line_args.get_metrics_file_path().empty()) {
+        metrics_exporter.emplace(
+                command_line_args.get_metrics_file_path(),
+                command_line_args.get_metrics_format()
+        );
+    }
+
     Profiler::start_continuous_measurement<Profiler::ContinuousMeasurementIndex::Search>();
 
     auto add_implicit_wildcards = [](string const& search_string) -> string {
@@ -41,6 +41,7 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
         config_file_path += '/';
     }
     config_file_path += cDefaultConfigFilename;
+    string metrics_format_input{"json"};
     // clang-format off
     options_general.add_options()
             ("help,h", "Print help")
@@ -51,6 +52,18 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                             ->value_name("FILE")
                             ->default_value(config_file_path),
                     "Use configuration options from FILE"
+            )
+            (
+                    "metrics-file",
+                    po::value<string>(&m_metrics_file_path)->value_name("FILE"),
+                    "Write runtime metrics (per-stage timings) to FILE when the command ends"
+            )
+            (
+                    "metrics-format",
+                    po::value<string>(&metrics_format_input)
+                            ->value_name("FORMAT")
+                            ->default_value(metrics_format_input),
+                    "Format of the runtime metrics (json | prometheus)"
             );
     // clang-format on
     m_metadata_db_config.emplace(options_general);
@@ -347,10 +360,22 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                             ->value_name("LEVEL")
                             ->default_value(m_compression_level),
                     "1 (fast/low compression) to 19 (slow/high compression)"
+            )(
+                    "threads",
+                    po::value<size_t>(&m_num_threads)
+                            ->value_name("NUM_THREADS")
+                            ->default_value(m_num_threads),
+                    "Number of threads used to compress files concurrently. Each thread writes its"
+                    " own archives."
             )(
                     "print-archive-stats-progress",
                     po::bool_switch(&m_print_archive_stats_progress),
                     "Print statistics (ndjson) about each archive as it's compressed"
+            )(
+                    "build-dictionary-trigram-indexes",
+                    po::bool_switch(&m_build_dictionary_trigram_indexes),
+                    "Store a trigram index over each archive's dictionaries to speed up wildcard"
+                    " searches"
             )(
                     "progress",
                     po::bool_switch(&m_show_progress),
@@ -416,6 +441,10 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                 throw invalid_argument("target-data-size-of-dictionaries must be non-zero.");
             }
 
+            if (m_num_threads < 1) {
+                throw invalid_argument("threads must be non-zero.");
+            }
+
             if (false == m_path_prefix_to_remove.empty()) {
                 if (false == boost::filesystem::exists(m_path_prefix_to_remove)) {
                     throw invalid_argument("Specified prefix to remove does not exist.");
@@ -447,6 +476,12 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
         if (m_output_dir.empty()) {
             throw invalid_argument("output-dir not specified or empty.");
         }
+
+        auto const metrics_format{RuntimeMetrics::parse_output_format(metrics_format_input)};
+        if (false == metrics_format.has_value()) {
+            throw invalid_argument("Unknown --metrics-format specified.");
+        }
+        m_metrics_format = metrics_format.value();
     } catch (exception& e) {
         SPDLOG_ERROR("{}", e.what());
         print_basic_usage();
@@ -9,6 +9,7 @@
 
 #include "../CommandLineArgumentsBase.hpp"
 #include "../GlobalMetadataDBConfig.hpp"
+#include "../RuntimeMetrics.hpp"
 
 namespace clp::clp {
 class CommandLineArguments : public CommandLineArgumentsBase {
@@ -50,6 +51,8 @@ public:
 
     bool print_archive_stats_progress() const { return m_print_archive_stats_progress; }
 
+    bool build_dictionary_trigram_indexes() const { return m_build_dictionary_trigram_indexes; }
+
     size_t get_target_encoded_file_size() const { return m_target_encoded_file_size; }
 
     size_t get_target_segment_uncompressed_size() const {
@@ -62,6 +65,8 @@ public:
 
     int get_compression_level() const { return m_compression_level; }
 
+    size_t get_num_threads() const { return m_num_threads; }
+
     Command get_command() const { return m_command; }
 
     std::string const& get_archives_dir() const { return m_archives_dir; }
@@ -78,6 +83,10 @@ public:
         return m_metadata_db_config;
     }
 
+    std::string const& get_metrics_file_path() const { return m_metrics_file_path; }
+
+    RuntimeMetrics::OutputFormat get_metrics_format() const { return m_metrics_format; }
+
 private:
     // Methods
     void print_basic_usage() const override;
@@ -96,14 +105,18 @@ private:
     std::string m_schema_file_path;
     bool m_show_progress;
     bool m_print_archive_stats_progress;
+    bool m_build_dictionary_trigram_indexes{false};
     size_t m_target_encoded_file_size;
     size_t m_target_segment_uncompressed_size;
     size_t m_target_data_size_of_dictionaries;
     int m_compression_level;
+    size_t m_num_threads{1};
     Command m_command;
     std::string m_archives_dir;
     std::vector<std::string> m_input_paths;
     std::optional<GlobalMetadataDBConfig> m_metadata_db_config;
+    std::string m_metrics_file_path;
+    RuntimeMetrics::OutputFormat m_metrics_format{RuntimeMetrics::OutputFormat::Json};
 };
 }  // namespace clp::clp
 
@@ -19,6 +19,7 @@
 #include "../ir/utils.hpp"
 #include "../LogSurgeonReader.hpp"
 #include "../Profiler.hpp"
+#include "../RuntimeMetrics.hpp"
 #include "../streaming_archive/writer/utils.hpp"
 #include "../utf8_utils.hpp"
 #include "utils.hpp"
@@ -127,6 +128,7 @@ bool FileCompressor::compress_file(
 
     PROFILER_SPDLOG_INFO("Start parsing {}", file_name)
     Profiler::start_continuous_measurement<Profiler::ContinuousMeasurementIndex::ParseLogFile>();
+    RuntimeMetrics::ScopedTimer const parse_timer{RuntimeMetrics::Stage::Parse};
 
     BufferedReader buffered_file_reader{make_unique<FileReader>(file_to_compress.get_path())};
 
@@ -1,8 +1,15 @@
 #include "compression.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
 
 #include <archive_entry.h>
 #include <boost/filesystem/operations.hpp>
@@ -43,6 +50,43 @@ static bool file_group_id_comparator(FileToCompress const& lhs, FileToCompress c
  */
 static bool
 file_gt_last_write_time_comparator(FileToCompress const& lhs, FileToCompress const& rhs);
+/**
+ * Splits the files to compress into batches that can be compressed independently. Each ungrouped
+ * file is a batch of its own, while grouped files are batched by group ID so that a group is never
+ * spread across archives written by different threads.
+ * @param files_to_compress
+ * @param grouped_files_to_compress Grouped files, sorted by group ID
+ * @return The batches, in the order in which they should be compressed
+ */
+static auto batch_files_to_compress(
+        vector<FileToCompress> const& files_to_compress,
+        vector<FileToCompress> const& grouped_files_to_compress
+) -> vector<std::span<FileToCompress const>>;
+/**
+ * Compresses batches of files using multiple threads, where each thread compresses the batches it
+ * claims into its own archives.
+ * @param command_line_args
+ * @param archive_user_config The config to derive each thread's archive config from
+ * @param file_batches
+ * @param empty_directory_paths
+ * @param target_encoded_file_size
+ * @param reader_parser
+ * @param use_heuristic
+ * @param num_files_to_compress The total number of files, for reporting progress
+ * @return true if all files were compressed successfully, false otherwise
+ * @throw The first exception thrown by any of the threads, after the other threads' archives are
+ * closed
+ */
+static bool compress_in_parallel(
+        CommandLineArguments const& command_line_args,
+        streaming_archive::writer::Archive::UserConfig const& archive_user_config,
+        vector<std::span<FileToCompress const>> const& file_batches,
+        vector<string> const& empty_directory_paths,
+        size_t target_encoded_file_size,
+        std::unique_ptr<log_surgeon::ReaderParser> reader_parser,
+        bool use_heuristic,
+        size_t num_files_to_compress
+);
 
 static bool file_group_id_comparator(FileToCompress const& lhs, FileToCompress const& rhs) {
     return lhs.get_group_id() < rhs.get_group_id();
@@ -54,6 +98,157 @@ file_gt_last_write_time_comparator(FileToCompress const& lhs, FileToCompress con
            > boost::filesystem::last_write_time(rhs.get_path());
 }
 
+static auto batch_files_to_compress(
+        vector<FileToCompress> const& files_to_compress,
+        vector<FileToCompress> const& grouped_files_to_compress
+) -> vector<std::span<FileToCompress const>> {
+    vector<std::span<FileToCompress const>> file_batches;
+    for (auto const& file_to_compress : files_to_compress) {
+        file_batches.emplace_back(&file_to_compress, 1);
+    }
+    auto const grouped_files_end = grouped_files_to_compress.cend();
+    for (auto group_begin = grouped_files_to_compress.cbegin(); group_begin != grouped_files_end;) {
+        auto const group_id = group_begin->get_group_id();
+        auto const group_end = std::find_if(
+                group_begin,
+                grouped_files_end,
+                [&](FileToCompress const& file) { return file.get_group_id() != group_id; }
+        );
+        file_batches.emplace_back(group_begin, group_end);
+        group_begin = group_end;
+    }
+    return file_batches;
+}
+
+static bool compress_in_parallel(
+        CommandLineArguments const& command_line_args,
+        streaming_archive::writer::Archive::UserConfig const& archive_user_config,
+        vector<std::span<FileToCompress const>> const& file_batches,
+        vector<string> const& empty_directory_paths,
+        size_t target_encoded_file_size,
+        std::unique_ptr<log_surgeon::ReaderParser> reader_parser,
+        bool use_heuristic,
+        size_t num_files_to_compress
+) {
+    /**
+     * State owned by a single thread. Each thread has its own creator ID, so the creation numbers
+     * of the archives it writes are independent of those written by other threads.
+     */
+    struct Worker {
+        boost::uuids::random_generator uuid_generator;
+        streaming_archive::writer::Archive::UserConfig archive_user_config;
+        streaming_archive::writer::Archive archive_writer;
+        std::unique_ptr<FileCompressor> file_compressor;
+        bool all_files_compressed_successfully{true};
+        std::exception_ptr exception;
+    };
+
+    // Each thread compresses at least one batch, so there's no point in having more threads than
+    // batches.
+    auto const num_workers = std::max<size_t>(
+            std::min(command_line_args.get_num_threads(), file_batches.size()),
+            1
+    );
+    std::mutex global_metadata_db_mutex;
+    vector<unique_ptr<Worker>> workers;
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        auto& worker = *workers.emplace_back(make_unique<Worker>());
+        worker.archive_user_config = archive_user_config;
+        worker.archive_user_config.id = worker.uuid_generator();
+        worker.archive_user_config.creator_id = worker.uuid_generator();
+        worker.archive_user_config.global_metadata_db_mutex = &global_metadata_db_mutex;
+        if (false == use_heuristic) {
+            worker.archive_writer.m_schema_file_path = command_line_args.get_schema_file_path();
+        }
+        // The log-surgeon parser is stateful, so each thread needs its own.
+        std::unique_ptr<log_surgeon::ReaderParser> worker_reader_parser;
+        if (0 == i) {
+            worker_reader_parser = std::move(reader_parser);
+        } else if (false == use_heuristic) {
+            worker_reader_parser = make_unique<log_surgeon::ReaderParser>(
+                    command_line_args.get_schema_file_path()
+            );
+        }
+        worker.file_compressor = make_unique<FileCompressor>(
+                worker.uuid_generator,
+                std::move(worker_reader_parser)
+        );
+    }
+
+    auto const target_data_size_of_dictionaries
+            = command_line_args.get_target_data_size_of_dictionaries();
+    std::atomic_size_t next_batch_idx{0};
+    std::atomic_bool failed{false};
+    std::mutex progress_mutex;
+    size_t num_files_compressed = 0;
+
+    auto compress_batches = [&](size_t worker_idx) -> void {
+        auto& worker = *workers[worker_idx];
+        auto& archive_writer = worker.archive_writer;
+        try {
+            archive_writer.open(worker.archive_user_config);
+            if (0 == worker_idx) {
+                archive_writer.add_empty_directories(empty_directory_paths);
+            }
+            while (false == failed.load()) {
+                auto const batch_idx = next_batch_idx.fetch_add(1);
+                if (batch_idx >= file_batches.size()) {
+                    break;
+                }
+                for (auto const& file_to_compress : file_batches[batch_idx]) {
+                    if (archive_writer.get_data_size_of_dictionaries()
+                        >= target_data_size_of_dictionaries)
+                    {
+                        split_archive(worker.archive_user_config, archive_writer);
+                    }
+                    if (false
+                        == worker.file_compressor->compress_file(
+                                target_data_size_of_dictionaries,
+                                worker.archive_user_config,
+                                target_encoded_file_size,
+                                file_to_compress,
+                                archive_writer,
+                                use_heuristic
+                        ))
+                    {
+                        worker.all_files_compressed_successfully = false;
+                    }
+                    if (command_line_args.show_progress()) {
+                        std::lock_guard<std::mutex> const progress_lock{progress_mutex};
+                        ++num_files_compressed;
+                        cerr << "Compressed " << num_files_compressed << '/'
+                             << num_files_to_compress << " files" << '\r';
+                    }
+                }
+            }
+            archive_writer.close();
+        } catch (...) {
+            worker.exception = std::current_exception();
+            failed = true;
+        }
+    };
+
+    vector<std::thread> threads;
+    threads.reserve(workers.size());
+    for (size_t i = 0; i < workers.size(); ++i) {
+        threads.emplace_back(compress_batches, i);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    bool all_files_compressed_successfully = true;
+    for (auto const& worker : workers) {
+        if (nullptr != worker->exception) {
+            std::rethrow_exception(worker->exception);
+        }
+        all_files_compressed_successfully
+                = all_files_compressed_successfully && worker->all_files_compressed_successfully;
+    }
+    return all_files_compressed_successfully;
+}
+
 bool compress(
         CommandLineArguments& command_line_args,
         vector<FileToCompress>& files_to_compress,
@@ -96,6 +291,35 @@ bool compress(
     archive_user_config.global_metadata_db = global_metadata_db.get();
     archive_user_config.print_archive_stats_progress
             = command_line_args.print_archive_stats_progress();
+    archive_user_config.build_dictionary_trigram_indexes
+            = command_line_args.build_dictionary_trigram_indexes();
+
+    size_t num_files_to_compress = 0;
+    if (command_line_args.show_progress()) {
+        num_files_to_compress = files_to_compress.size() + grouped_files_to_compress.size();
+    }
+    if (command_line_args.sort_input_files()) {
+        sort(files_to_compress.begin(),
+             files_to_compress.end(),
+             file_gt_last_write_time_comparator);
+    }
+    // Sort files by group ID to avoid spreading groups over multiple segments
+    sort(grouped_files_to_compress.begin(),
+         grouped_files_to_compress.end(),
+         file_group_id_comparator);
+
+    if (command_line_args.get_num_threads() > 1) {
+        return compress_in_parallel(
+                command_line_args,
+                archive_user_config,
+                batch_files_to_compress(files_to_compress, grouped_files_to_compress),
+                empty_directory_paths,
+                target_encoded_file_size,
+                std::move(reader_parser),
+                use_heuristic,
+                num_files_to_compress
+        );
+    }
 
     // Open Archive
     streaming_archive::writer::Archive archive_writer;
@@ -115,15 +339,6 @@ bool compress(
 
     // Compress all files
     size_t num_files_compressed = 0;
-    size_t num_files_to_compress = 0;
-    if (command_line_args.show_progress()) {
-        num_files_to_compress = files_to_compress.size() + grouped_files_to_compress.size();
-    }
-    if (command_line_args.sort_input_files()) {
-        sort(files_to_compress.begin(),
-             files_to_compress.end(),
-             file_gt_last_write_time_comparator);
-    }
     for (auto it = files_to_compress.cbegin(); it != files_to_compress.cend(); ++it) {
         if (archive_writer.get_data_size_of_dictionaries() >= target_data_size_of_dictionaries) {
             split_archive(archive_user_config, archive_writer);
@@ -147,10 +362,6 @@ bool compress(
         }
     }
 
-    // Sort files by group ID to avoid spreading groups over multiple segments
-    sort(grouped_files_to_compress.begin(),
-         grouped_files_to_compress.end(),
-         file_group_id_comparator);
     // Compress grouped files
     for (auto const& file_to_compress : grouped_files_to_compress) {
         if (archive_writer.get_data_size_of_dictionaries() >= target_data_size_of_dictionaries) {
@@ -1,11 +1,13 @@
 #include "run.hpp"
 
+#include <optional>
 #include <unordered_set>
 
 #include <log_surgeon/LogParser.hpp>
 #include <spdlog/sinks/stdout_sinks.h>
 
 #include "../Profiler.hpp"
+#include "../RuntimeMetrics.hpp"
 #include "../spdlog_with_specializations.hpp"
 #include "../Utils.hpp"
 #include "CommandLineArguments.hpp"
@@ -43,6 +45,14 @@ int run(int argc, char const* argv[]) {
             break;
     }
 
+    std::optional<RuntimeMetrics::FileExporter> metrics_exporter;
+    if (false == command_line_args.get_metrics_file_path().empty()) {
+        metrics_exporter.emplace(
+                command_line_args.get_metrics_file_path(),
+                command_line_args.get_metrics_format()
+        );
+    }
+
     vector<string> input_paths = command_line_args.get_input_paths();
 
     Profiler::start_continuous_measurement<Profiler::ContinuousMeasurementIndex::Compression>();
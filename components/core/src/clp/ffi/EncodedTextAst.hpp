@@ -171,6 +171,21 @@ public:
         return decoded_string;
     }
 
+    /**
+     * Releases the underlying buffers, cleared, so that they can be reused to create another
+     * encoded text AST.
+     * @return A pair:
+     * - The (empty) buffer of encoded variables.
+     * - The (empty) string blob.
+     */
+    [[nodiscard]] auto release_buffers() &&
+            -> std::pair<std::vector<encoded_variable_t>, StringBlob> {
+        m_encoded_vars.clear();
+        m_string_blob.clear();
+        m_num_dict_vars = 0;
+        return {std::move(m_encoded_vars), std::move(m_string_blob)};
+    }
+
 private:
     // Constructor
     EncodedTextAst(std::vector<encoded_variable_t> encoded_vars, StringBlob string_blob)
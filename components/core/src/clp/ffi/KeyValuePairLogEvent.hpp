@@ -2,8 +2,6 @@
 #define CLP_FFI_KEYVALUEPAIRLOGEVENT_HPP
 
 #include <memory>
-#include <optional>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -11,8 +9,8 @@
 #include <ystdlib/error_handling/Result.hpp>
 
 #include "../time_types.hpp"
+#include "NodeIdValuePairs.hpp"
 #include "SchemaTree.hpp"
-#include "Value.hpp"
 
 namespace clp::ffi {
 /**
@@ -28,7 +26,7 @@ namespace clp::ffi {
 class KeyValuePairLogEvent {
 public:
     // Types
-    using NodeIdValuePairs = std::unordered_map<SchemaTree::Node::id_t, std::optional<Value>>;
+    using NodeIdValuePairs = ffi::NodeIdValuePairs;
 
     // Factory functions
     /**
@@ -113,6 +111,19 @@ public:
     [[nodiscard]] auto serialize_to_json() const
             -> ystdlib::error_handling::Result<std::pair<nlohmann::json, nlohmann::json>>;
 
+    /**
+     * Releases the node-ID-value pairs so that their storage can be reused to deserialize another
+     * log event.
+     * @return A pair:
+     * - The auto-generated node-ID-value pairs.
+     * - The user-generated node-ID-value pairs.
+     */
+    [[nodiscard]] auto release_node_id_value_pairs() &&
+            -> std::pair<NodeIdValuePairs, NodeIdValuePairs> {
+        return {std::move(m_auto_gen_node_id_value_pairs),
+                std::move(m_user_gen_node_id_value_pairs)};
+    }
+
 private:
     // Constructor
     KeyValuePairLogEvent(
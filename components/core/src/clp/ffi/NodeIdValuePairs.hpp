@@ -0,0 +1,240 @@
+#ifndef CLP_FFI_NODEIDVALUEPAIRS_HPP
+#define CLP_FFI_NODEIDVALUEPAIRS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../ErrorCode.hpp"
+#include "../TraceableException.hpp"
+#include "SchemaTree.hpp"
+#include "Value.hpp"
+
+namespace clp::ffi {
+/**
+ * A flat collection of unique schema-tree-node-ID & value pairs, stored in insertion order with a
+ * sorted index for lookups.
+ *
+ * Clearing the collection keeps the storage of the removed pairs (including any buffers owned by
+ * their values) so that it can be reused by subsequent insertions. Reusing a single instance to
+ * deserialize a sequence of log events with the same schema therefore avoids heap allocations once
+ * the instance has grown to fit the largest log event. See `try_emplace_recycled` for details.
+ */
+class NodeIdValuePairs {
+public:
+    // Types
+    using value_type = std::pair<SchemaTree::Node::id_t, std::optional<Value>>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    class OperationFailed : public TraceableException {
+    public:
+        OperationFailed(
+                ErrorCode error_code,
+                char const* const filename,
+                int line_number,
+                std::string message
+        )
+                : TraceableException{error_code, filename, line_number},
+                  m_message{std::move(message)} {}
+
+        [[nodiscard]] auto what() const noexcept -> char const* override {
+            return m_message.c_str();
+        }
+
+    private:
+        std::string m_message;
+    };
+
+    // Constructors
+    NodeIdValuePairs() = default;
+
+    /**
+     * Constructs the collection from the given pairs. Pairs with duplicate node IDs are ignored.
+     * @param pairs
+     */
+    NodeIdValuePairs(std::initializer_list<value_type> pairs) {
+        reserve(pairs.size());
+        for (auto const& [node_id, value] : pairs) {
+            emplace(node_id, value);
+        }
+    }
+
+    // Default copy constructor and assignment operator
+    NodeIdValuePairs(NodeIdValuePairs const&) = default;
+    auto operator=(NodeIdValuePairs const&) -> NodeIdValuePairs& = default;
+
+    // Move constructor and assignment operator that leave the moved-from instance empty
+    NodeIdValuePairs(NodeIdValuePairs&& other) noexcept
+            : m_pairs{std::exchange(other.m_pairs, {})},
+              m_sorted_index{std::exchange(other.m_sorted_index, {})},
+              m_size{std::exchange(other.m_size, 0)} {}
+
+    auto operator=(NodeIdValuePairs&& other) noexcept -> NodeIdValuePairs& {
+        if (this != &other) {
+            m_pairs = std::exchange(other.m_pairs, {});
+            m_sorted_index = std::exchange(other.m_sorted_index, {});
+            m_size = std::exchange(other.m_size, 0);
+        }
+        return *this;
+    }
+
+    // Destructor
+    ~NodeIdValuePairs() = default;
+
+    // Methods
+    [[nodiscard]] auto begin() const -> const_iterator { return m_pairs.cbegin(); }
+
+    [[nodiscard]] auto end() const -> const_iterator {
+        return m_pairs.cbegin() + static_cast<std::ptrdiff_t>(m_size);
+    }
+
+    [[nodiscard]] auto size() const -> size_t { return m_size; }
+
+    [[nodiscard]] auto empty() const -> bool { return 0 == m_size; }
+
+    /**
+     * @param node_id
+     * @return An iterator to the pair with the given node ID, or `end()` if there's no such pair.
+     */
+    [[nodiscard]] auto find(SchemaTree::Node::id_t node_id) const -> const_iterator {
+        auto const it{lower_bound(node_id)};
+        if (m_sorted_index.cend() == it || it->first != node_id) {
+            return end();
+        }
+        return m_pairs.cbegin() + static_cast<std::ptrdiff_t>(it->second);
+    }
+
+    [[nodiscard]] auto contains(SchemaTree::Node::id_t node_id) const -> bool {
+        return end() != find(node_id);
+    }
+
+    /**
+     * @param node_id
+     * @return The value of the pair with the given node ID.
+     * @throw OperationFailed if there's no pair with the given node ID.
+     */
+    [[nodiscard]] auto at(SchemaTree::Node::id_t node_id) const -> std::optional<Value> const& {
+        auto const it{find(node_id)};
+        if (end() == it) {
+            throw OperationFailed(
+                    ErrorCode_OutOfBounds,
+                    __FILE__,
+                    __LINE__,
+                    "No pair exists with the given node ID."
+            );
+        }
+        return it->second;
+    }
+
+    /**
+     * Inserts a pair with the given node ID and a value constructed from the given arguments, if
+     * no pair with the given node ID exists.
+     * @tparam ValueArgs
+     * @param node_id
+     * @param value_args Arguments to construct the `std::optional<Value>` from.
+     * @return Whether the pair was inserted.
+     */
+    template <typename... ValueArgs>
+    auto emplace(SchemaTree::Node::id_t node_id, ValueArgs&&... value_args) -> bool {
+        auto* value{try_emplace_recycled(node_id)};
+        if (nullptr == value) {
+            return false;
+        }
+        *value = std::optional<Value>{std::forward<ValueArgs>(value_args)...};
+        return true;
+    }
+
+    /**
+     * Inserts a pair with the given node ID, if no pair with the given node ID exists, without
+     * assigning its value. Instead, the pair reuses the storage of a pair removed by `clear`, so
+     * its value is unspecified (it's whatever that pair held, or `std::nullopt`). This allows the
+     * caller to reuse the buffers owned by the value (e.g., by `Value::release`) before assigning
+     * the new value.
+     *
+     * NOTE: The returned pointer is invalidated by any subsequent insertion.
+     * @param node_id
+     * @return A pointer to the inserted pair's value, or nullptr if a pair with the given node ID
+     * already exists.
+     */
+    [[nodiscard]] auto try_emplace_recycled(SchemaTree::Node::id_t node_id)
+            -> std::optional<Value>* {
+        auto const it{lower_bound(node_id)};
+        if (m_sorted_index.cend() != it && it->first == node_id) {
+            return nullptr;
+        }
+        m_sorted_index.emplace(it, node_id, m_size);
+        if (m_pairs.size() == m_size) {
+            m_pairs.emplace_back(node_id, std::nullopt);
+        } else {
+            m_pairs[m_size].first = node_id;
+        }
+        return &m_pairs[m_size++].second;
+    }
+
+    /**
+     * @param idx
+     * @return The value of the `idx`-th pair in insertion order.
+     * @throw OperationFailed if `idx` is out of bounds.
+     */
+    [[nodiscard]] auto get_value_at(size_t idx) -> std::optional<Value>& {
+        if (idx >= m_size) {
+            throw OperationFailed(
+                    ErrorCode_OutOfBounds,
+                    __FILE__,
+                    __LINE__,
+                    "The given index is out of bounds."
+            );
+        }
+        return m_pairs[idx].second;
+    }
+
+    /**
+     * Removes all pairs while keeping their storage for reuse by subsequent insertions.
+     */
+    auto clear() -> void {
+        m_sorted_index.clear();
+        m_size = 0;
+    }
+
+    auto reserve(size_t num_pairs) -> void {
+        m_pairs.reserve(num_pairs);
+        m_sorted_index.reserve(num_pairs);
+    }
+
+private:
+    // Types
+    // A pair of a node ID and the index of its pair in `m_pairs`
+    using IndexEntry = std::pair<SchemaTree::Node::id_t, size_t>;
+
+    // Methods
+    /**
+     * @param node_id
+     * @return An iterator to the first entry in the sorted index whose node ID isn't less than
+     * `node_id`.
+     */
+    [[nodiscard]] auto lower_bound(SchemaTree::Node::id_t node_id) const
+            -> std::vector<IndexEntry>::const_iterator {
+        return std::lower_bound(
+                m_sorted_index.cbegin(),
+                m_sorted_index.cend(),
+                node_id,
+                [](IndexEntry const& entry, SchemaTree::Node::id_t id) -> bool {
+                    return entry.first < id;
+                }
+        );
+    }
+
+    // Variables
+    // Pairs in insertion order. Only the first `m_size` pairs are valid; the rest are kept for
+    // reuse.
+    std::vector<value_type> m_pairs;
+    std::vector<IndexEntry> m_sorted_index;
+    size_t m_size{0};
+};
+}  // namespace clp::ffi
+
+#endif  // CLP_FFI_NODEIDVALUEPAIRS_HPP
@@ -70,6 +70,14 @@ public:
         m_offsets.emplace_back(end_offset);
     }
 
+    /**
+     * Removes all strings from the blob while keeping its allocated capacity.
+     */
+    auto clear() -> void {
+        m_data.clear();
+        m_offsets.resize(1);
+    }
+
 private:
     std::string m_data;
     std::vector<size_t> m_offsets{0};
@@ -2,6 +2,7 @@
 #define CLP_FFI_VALUE_HPP
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -185,6 +186,23 @@ public:
         return std::holds_alternative<std::monostate>(m_value);
     }
 
+    /**
+     * Moves the underlying value out if its type matches the given type, leaving this value null.
+     * This allows the caller to reuse the buffers owned by the underlying value.
+     * @tparam T
+     * @return The underlying value if its type matches the given type, or std::nullopt otherwise.
+     */
+    template <MoveConstructablePrimitiveValueType T>
+    [[nodiscard]] auto release() -> std::optional<T> {
+        auto* value{std::get_if<T>(&m_value)};
+        if (nullptr == value) {
+            return std::nullopt;
+        }
+        std::optional<T> released_value{std::move(*value)};
+        m_value = std::monostate{};
+        return released_value;
+    }
+
 private:
     PrimitiveValueVariant m_value{std::monostate{}};
 };
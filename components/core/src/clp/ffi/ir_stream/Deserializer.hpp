@@ -5,7 +5,9 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
@@ -14,9 +16,11 @@
 #include "../../ir/types.hpp"
 #include "../../ReaderInterface.hpp"
 #include "../../time_types.hpp"
+#include "../KeyValuePairLogEvent.hpp"
 #include "../SchemaTree.hpp"
 #include "DeserializerImpl.hpp"
 #include "IrDeserializationError.hpp"
+#include "IrStreamIndex.hpp"
 #include "IrUnitHandlerReq.hpp"
 #include "IrUnitType.hpp"
 #include "KvIrDeserializerImpl.hpp"
@@ -105,6 +109,11 @@ public:
      * `search::EmptyQueryHandler`, `handle_log_event` will only be invoked if the query handler
      * returns `search::AstEvaluationResult::True`.
      *
+     * NOTE: The storage of a deserialized log event's node-ID-value pairs is reused to deserialize
+     * subsequent log events, unless `handle_log_event` moves them out of the given log event. To
+     * keep a log event while still allowing its storage to be reused, a handler can swap it with a
+     * previously kept log event.
+     *
      * @param reader
      * @return Forwards `DeserializerImpl::get_next_ir_unit_type`'s return values if it fails to
      * determine the type of the next IR unit.
@@ -143,6 +152,32 @@ public:
     [[nodiscard]] auto deserialize_next_ir_unit(ReaderInterface& reader)
             -> ystdlib::error_handling::Result<IrUnitType>;
 
+    /**
+     * Prepares the deserializer to resume deserialization from the given checkpoint of the stream's
+     * index, by restoring the schema trees and UTC offset at the checkpoint. Before the next call
+     * to `deserialize_next_ir_unit`, the caller must position the reader at the checkpoint, i.e.,
+     * at `Checkpoint::ir_stream_offset` in the IR stream or, if the stream is compressed, at the
+     * start of the compressed frame at `Checkpoint::compressed_offset` (if set).
+     *
+     * Schema tree nodes that the deserializer hasn't deserialized yet are passed to the IR unit
+     * handler (and the query handler) as if they were deserialized from the stream. Since schema
+     * trees only grow, the deserializer can't resume from a checkpoint before the last deserialized
+     * IR unit.
+     * @param index
+     * @param checkpoint_idx
+     * @return A void result on success, or an error code indicating the failure:
+     * - std::errc::operation_not_permitted if the deserializer already reached the end of stream.
+     * - std::errc::result_out_of_range if `checkpoint_idx` is out of bounds.
+     * - std::errc::invalid_argument if the checkpoint is before the last deserialized IR unit.
+     * - std::errc::protocol_error if the index's schema tree nodes don't match the nodes the
+     *   deserializer already deserialized.
+     * - Forwards `insert_schema_tree_node`'s return values on failure.
+     * - Forwards `handle_utc_offset_change`'s return values from the user-defined IR unit handler
+     *   on unit handling failure.
+     */
+    [[nodiscard]] auto resume_from_checkpoint(IrStreamIndex const& index, size_t checkpoint_idx)
+            -> ystdlib::error_handling::Result<void>;
+
     /**
      * @return Whether the stream has completed. A stream is considered completed if an
      * end-of-stream IR unit has already been deserialized.
@@ -208,6 +243,34 @@ private:
               m_ir_unit_handler{std::move(ir_unit_handler)},
               m_query_handler{std::move(query_handler)} {}
 
+    // Methods
+    /**
+     * Inserts a schema tree node, and notifies the query handler and the IR unit handler of the
+     * insertion.
+     * @param is_auto_generated Whether the node belongs to the auto-generated-keys schema tree.
+     * @param node_locator
+     * @return A void result on success, or an error code indicating the failure:
+     * - std::errc::protocol_error if the node already exists in the schema tree.
+     * - Forwards `search::QueryHandler::update_partially_resolved_columns`'s return values on
+     *   failure, if `QueryHandlerType` is not `search::EmptyQueryHandler`.
+     * - Forwards `handle_schema_tree_node_insertion`'s return values from the user-defined IR unit
+     *   handler on unit handling failure.
+     */
+    [[nodiscard]] auto
+    insert_schema_tree_node(bool is_auto_generated, SchemaTree::NodeLocator const& node_locator)
+            -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * @param schema_tree
+     * @param nodes The nodes of a schema tree that `schema_tree` should be a prefix of.
+     * @return Whether each node in `schema_tree` (other than the root) matches the node with the
+     * same ID in `nodes`.
+     */
+    [[nodiscard]] static auto is_schema_tree_prefix_of(
+            SchemaTree const& schema_tree,
+            std::vector<IrStreamIndex::SchemaTreeNode> const& nodes
+    ) -> bool;
+
     // Variables
     std::unique_ptr<DeserializerImpl> m_deserializer_impl;
     std::shared_ptr<SchemaTree> m_auto_gen_keys_schema_tree{std::make_shared<SchemaTree>()};
@@ -218,6 +281,10 @@ private:
     bool m_is_complete{false};
     [[no_unique_address]] QueryHandlerType m_query_handler;
     size_t m_next_log_event_idx{0};
+
+    // Storage reused to deserialize log events
+    KeyValuePairLogEvent::NodeIdValuePairs m_recycled_auto_gen_node_id_value_pairs;
+    KeyValuePairLogEvent::NodeIdValuePairs m_recycled_user_gen_node_id_value_pairs;
 };
 
 /**
@@ -325,7 +392,9 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
                             tag,
                             m_auto_gen_keys_schema_tree,
                             m_user_gen_keys_schema_tree,
-                            m_utc_offset
+                            m_utc_offset,
+                            std::move(m_recycled_auto_gen_node_id_value_pairs),
+                            std::move(m_recycled_user_gen_node_id_value_pairs)
                     )
             )};
 
@@ -338,6 +407,9 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
                             m_query_handler.evaluate_kv_pair_log_event(log_event)
                     ))
                 {
+                    std::tie(m_recycled_auto_gen_node_id_value_pairs,
+                             m_recycled_user_gen_node_id_value_pairs)
+                            = std::move(log_event).release_node_id_value_pairs();
                     break;
                 }
             }
@@ -349,6 +421,13 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
             {
                 return ir_error_code_to_errc(err);
             }
+            // `handle_log_event` takes an rvalue reference, so the log event is only moved from if
+            // the handler moved it.
+            // NOLINTBEGIN(bugprone-use-after-move, hicpp-invalid-access-moved)
+            std::tie(m_recycled_auto_gen_node_id_value_pairs,
+                     m_recycled_user_gen_node_id_value_pairs)
+                    = std::move(log_event).release_node_id_value_pairs();
+            // NOLINTEND(bugprone-use-after-move, hicpp-invalid-access-moved)
             break;
         }
 
@@ -361,33 +440,7 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
                             key_name_buffer
                     )
             )};
-            auto& schema_tree_to_insert{
-                    is_auto_generated ? m_auto_gen_keys_schema_tree : m_user_gen_keys_schema_tree
-            };
-
-            if (schema_tree_to_insert->has_node(node_locator)) {
-                return std::errc::protocol_error;
-            }
-
-            auto const node_id{schema_tree_to_insert->insert_node(node_locator)};
-
-            if constexpr (search::IsNonEmptyQueryHandler<QueryHandlerType>::value) {
-                YSTDLIB_ERROR_HANDLING_TRYV(m_query_handler.update_partially_resolved_columns(
-                        is_auto_generated,
-                        node_locator,
-                        node_id
-                ));
-            }
-
-            if (auto const err{m_ir_unit_handler.handle_schema_tree_node_insertion(
-                        is_auto_generated,
-                        node_locator,
-                        schema_tree_to_insert
-                )};
-                IRErrorCode::IRErrorCode_Success != err)
-            {
-                return ir_error_code_to_errc(err);
-            }
+            YSTDLIB_ERROR_HANDLING_TRYV(insert_schema_tree_node(is_auto_generated, node_locator));
             break;
         }
 
@@ -424,6 +477,126 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
     return ir_unit_type;
 }
 
+template <IrUnitHandlerReq IrUnitHandler, search::QueryHandlerReq QueryHandlerType>
+auto Deserializer<IrUnitHandler, QueryHandlerType>::resume_from_checkpoint(
+        IrStreamIndex const& index,
+        size_t checkpoint_idx
+) -> ystdlib::error_handling::Result<void> {
+    if (is_stream_completed()) {
+        return std::errc::operation_not_permitted;
+    }
+
+    auto const& checkpoints{index.get_checkpoints()};
+    if (checkpoint_idx >= checkpoints.size()) {
+        return std::errc::result_out_of_range;
+    }
+    auto const& checkpoint{checkpoints[checkpoint_idx]};
+    if (checkpoint.log_event_idx < m_next_log_event_idx
+        || checkpoint.auto_gen_keys_schema_tree_size < m_auto_gen_keys_schema_tree->get_size()
+        || checkpoint.user_gen_keys_schema_tree_size < m_user_gen_keys_schema_tree->get_size())
+    {
+        return std::errc::invalid_argument;
+    }
+
+    auto const& auto_gen_nodes{index.get_auto_gen_keys_schema_tree_nodes()};
+    auto const& user_gen_nodes{index.get_user_gen_keys_schema_tree_nodes()};
+    if (checkpoint.auto_gen_keys_schema_tree_size > auto_gen_nodes.size() + 1
+        || checkpoint.user_gen_keys_schema_tree_size > user_gen_nodes.size() + 1
+        || false == is_schema_tree_prefix_of(*m_auto_gen_keys_schema_tree, auto_gen_nodes)
+        || false == is_schema_tree_prefix_of(*m_user_gen_keys_schema_tree, user_gen_nodes))
+    {
+        return std::errc::protocol_error;
+    }
+
+    // The node with ID `i` is at index `i - 1` in the index's nodes
+    for (auto id{m_auto_gen_keys_schema_tree->get_size()};
+         id < checkpoint.auto_gen_keys_schema_tree_size;
+         ++id)
+    {
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                insert_schema_tree_node(true, auto_gen_nodes[id - 1].get_locator())
+        );
+    }
+    for (auto id{m_user_gen_keys_schema_tree->get_size()};
+         id < checkpoint.user_gen_keys_schema_tree_size;
+         ++id)
+    {
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                insert_schema_tree_node(false, user_gen_nodes[id - 1].get_locator())
+        );
+    }
+
+    if (checkpoint.utc_offset != m_utc_offset) {
+        if (auto const err{
+                    m_ir_unit_handler.handle_utc_offset_change(m_utc_offset, checkpoint.utc_offset)
+            };
+            IRErrorCode::IRErrorCode_Success != err)
+        {
+            return ir_error_code_to_errc(err);
+        }
+        m_utc_offset = checkpoint.utc_offset;
+    }
+
+    m_next_log_event_idx = checkpoint.log_event_idx;
+    return ystdlib::error_handling::success();
+}
+
+template <IrUnitHandlerReq IrUnitHandler, search::QueryHandlerReq QueryHandlerType>
+auto Deserializer<IrUnitHandler, QueryHandlerType>::is_schema_tree_prefix_of(
+        SchemaTree const& schema_tree,
+        std::vector<IrStreamIndex::SchemaTreeNode> const& nodes
+) -> bool {
+    if (schema_tree.get_size() > nodes.size() + 1) {
+        return false;
+    }
+    for (SchemaTree::Node::id_t id{SchemaTree::cRootId + 1}; id < schema_tree.get_size(); ++id) {
+        auto const& node{schema_tree.get_node(id)};
+        auto const& expected_node{nodes[id - 1]};
+        if (node.get_parent_id_unsafe() != expected_node.parent_id
+            || node.get_key_name() != expected_node.key_name
+            || node.get_type() != expected_node.type)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <IrUnitHandlerReq IrUnitHandler, search::QueryHandlerReq QueryHandlerType>
+auto Deserializer<IrUnitHandler, QueryHandlerType>::insert_schema_tree_node(
+        bool is_auto_generated,
+        SchemaTree::NodeLocator const& node_locator
+) -> ystdlib::error_handling::Result<void> {
+    auto& schema_tree_to_insert{
+            is_auto_generated ? m_auto_gen_keys_schema_tree : m_user_gen_keys_schema_tree
+    };
+
+    if (schema_tree_to_insert->has_node(node_locator)) {
+        return std::errc::protocol_error;
+    }
+
+    auto const node_id{schema_tree_to_insert->insert_node(node_locator)};
+
+    if constexpr (search::IsNonEmptyQueryHandler<QueryHandlerType>::value) {
+        YSTDLIB_ERROR_HANDLING_TRYV(m_query_handler.update_partially_resolved_columns(
+                is_auto_generated,
+                node_locator,
+                node_id
+        ));
+    }
+
+    if (auto const err{m_ir_unit_handler.handle_schema_tree_node_insertion(
+                is_auto_generated,
+                node_locator,
+                schema_tree_to_insert
+        )};
+        IRErrorCode::IRErrorCode_Success != err)
+    {
+        return ir_error_code_to_errc(err);
+    }
+    return ystdlib::error_handling::success();
+}
+
 template <IrUnitHandlerReq IrUnitHandlerType>
 [[nodiscard]] auto make_deserializer(ReaderInterface& reader, IrUnitHandlerType ir_unit_handler)
         -> ystdlib::error_handling::Result<Deserializer<IrUnitHandlerType>> {
@@ -65,6 +65,10 @@ public:
      * @param auto_gen_keys_schema_tree
      * @param user_gen_keys_schema_tree
      * @param utc_offset
+     * @param recycled_auto_gen_node_id_value_pairs Node-ID-value pairs whose storage may be reused
+     * for the log event's auto-generated pairs.
+     * @param recycled_user_gen_node_id_value_pairs Node-ID-value pairs whose storage may be reused
+     * for the log event's user-generated pairs.
      * @return A result containing the deserialized KV pair log event on success, or an error code
      * indicating the failure defined by the derived class.
      */
@@ -73,7 +77,9 @@ public:
             encoded_tag_t tag,
             std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
             std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
-            UtcOffset utc_offset
+            UtcOffset utc_offset,
+            KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+            KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
     ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>
             = 0;
 
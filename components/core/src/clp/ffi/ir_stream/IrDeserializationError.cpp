@@ -23,6 +23,8 @@ auto IrErrorCategory::message(IrDeserializationErrorEnum error_enum) const -> st
             return "reached end-of-stream IR unit";
         case IrDeserializationErrorEnum::IncompleteStream:
             return "incomplete IR stream";
+        case IrDeserializationErrorEnum::InvalidIndex:
+            return "IR stream index is malformed or inconsistent";
         case IrDeserializationErrorEnum::InvalidKeyGroupOrdering:
             return "invalid key-ID-group ordering";
         case IrDeserializationErrorEnum::InvalidMagicNumber:
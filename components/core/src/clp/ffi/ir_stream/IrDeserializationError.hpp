@@ -14,6 +14,7 @@ enum class IrDeserializationErrorEnum : uint8_t {
     EncodedTextAstDeserializationFailure,
     EndOfStream,
     IncompleteStream,
+    InvalidIndex,
     InvalidKeyGroupOrdering,
     InvalidMagicNumber,
     InvalidReferenceTimestampMetadata,
@@ -39,6 +39,9 @@ auto IrSerializationErrorCategory::message(IrSerializationErrorEnum error_enum)
             return "the schema tree node type is unknown";
         case IrSerializationErrorEnum::UnsupportedUserDefinedMetadata:
             return "the user-defined metadata is not a valid JSON object";
+        case IrSerializationErrorEnum::InvalidLogEventColumns:
+            return "the log event columns have empty key paths, mismatched lengths, or conflicting"
+                   " keys";
         default:
             return "unknown serialization error code enum";
     }
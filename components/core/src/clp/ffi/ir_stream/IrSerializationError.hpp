@@ -21,6 +21,7 @@ enum class IrSerializationErrorEnum : uint8_t {
     SchemaTreeNodeIdSerializationFailure,
     UnknownSchemaTreeNodeType,
     UnsupportedUserDefinedMetadata,
+    InvalidLogEventColumns,
 };
 
 using IrSerializationError = ystdlib::error_handling::ErrorCode<IrSerializationErrorEnum>;
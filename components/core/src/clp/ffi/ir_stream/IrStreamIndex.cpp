@@ -0,0 +1,324 @@
+#include "IrStreamIndex.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/types.hpp"
+#include "../../time_types.hpp"
+#include "../SchemaTree.hpp"
+#include "IrDeserializationError.hpp"
+
+namespace clp::ffi::ir_stream {
+namespace {
+constexpr std::string_view cVersionKey{"version"};
+constexpr std::string_view cCheckpointsKey{"checkpoints"};
+constexpr std::string_view cAutoGenKeysSchemaTreeNodesKey{"auto_gen_keys_schema_tree_nodes"};
+constexpr std::string_view cUserGenKeysSchemaTreeNodesKey{"user_gen_keys_schema_tree_nodes"};
+
+constexpr std::string_view cIrStreamOffsetKey{"ir_stream_offset"};
+constexpr std::string_view cCompressedOffsetKey{"compressed_offset"};
+constexpr std::string_view cLogEventIdxKey{"log_event_idx"};
+constexpr std::string_view cAutoGenKeysSchemaTreeSizeKey{"auto_gen_keys_schema_tree_size"};
+constexpr std::string_view cUserGenKeysSchemaTreeSizeKey{"user_gen_keys_schema_tree_size"};
+constexpr std::string_view cUtcOffsetKey{"utc_offset"};
+constexpr std::string_view cMinTimestampKey{"min_timestamp"};
+constexpr std::string_view cMaxTimestampKey{"max_timestamp"};
+
+/**
+ * @param schema_tree
+ * @return The nodes of the given schema tree, excluding the root, in ID order.
+ */
+[[nodiscard]] auto get_schema_tree_nodes(SchemaTree const& schema_tree)
+        -> std::vector<IrStreamIndex::SchemaTreeNode>;
+
+/**
+ * @param nodes
+ * @return The given schema tree nodes as a JSON array of [parent ID, key name, type] arrays.
+ */
+[[nodiscard]] auto
+schema_tree_nodes_to_json(std::vector<IrStreamIndex::SchemaTreeNode> const& nodes)
+        -> nlohmann::json;
+
+/**
+ * @param json_nodes A JSON array generated by `schema_tree_nodes_to_json`.
+ * @return The schema tree nodes in the given JSON array, or std::nullopt if any node is invalid
+ * (i.e., its type is unknown, or its parent isn't a preceding object node).
+ * @throw nlohmann::json::exception if the JSON array is malformed.
+ */
+[[nodiscard]] auto schema_tree_nodes_from_json(nlohmann::json const& json_nodes)
+        -> std::optional<std::vector<IrStreamIndex::SchemaTreeNode>>;
+
+/**
+ * @param checkpoint
+ * @return The given checkpoint as a JSON object.
+ */
+[[nodiscard]] auto checkpoint_to_json(IrStreamIndex::Checkpoint const& checkpoint)
+        -> nlohmann::json;
+
+/**
+ * @param json_checkpoint A JSON object generated by `checkpoint_to_json`.
+ * @return The checkpoint in the given JSON object.
+ * @throw nlohmann::json::exception if the JSON object is malformed.
+ */
+[[nodiscard]] auto checkpoint_from_json(nlohmann::json const& json_checkpoint)
+        -> IrStreamIndex::Checkpoint;
+
+/**
+ * @param checkpoints
+ * @param num_auto_gen_keys_schema_tree_nodes
+ * @param num_user_gen_keys_schema_tree_nodes
+ * @return Whether the given checkpoints are in stream order and only refer to existing schema tree
+ * nodes.
+ */
+[[nodiscard]] auto are_checkpoints_valid(
+        std::vector<IrStreamIndex::Checkpoint> const& checkpoints,
+        size_t num_auto_gen_keys_schema_tree_nodes,
+        size_t num_user_gen_keys_schema_tree_nodes
+) -> bool;
+
+auto get_schema_tree_nodes(SchemaTree const& schema_tree)
+        -> std::vector<IrStreamIndex::SchemaTreeNode> {
+    std::vector<IrStreamIndex::SchemaTreeNode> nodes;
+    nodes.reserve(schema_tree.get_size() - 1);
+    for (SchemaTree::Node::id_t id{SchemaTree::cRootId + 1}; id < schema_tree.get_size(); ++id) {
+        auto const& node{schema_tree.get_node(id)};
+        nodes.push_back(
+                {.parent_id = node.get_parent_id_unsafe(),
+                 .key_name = std::string{node.get_key_name()},
+                 .type = node.get_type()}
+        );
+    }
+    return nodes;
+}
+
+auto schema_tree_nodes_to_json(std::vector<IrStreamIndex::SchemaTreeNode> const& nodes)
+        -> nlohmann::json {
+    nlohmann::json json_nodes = nlohmann::json::array();
+    for (auto const& node : nodes) {
+        json_nodes.push_back(
+                nlohmann::json::array(
+                        {node.parent_id, node.key_name, static_cast<uint8_t>(node.type)}
+                )
+        );
+    }
+    return json_nodes;
+}
+
+auto schema_tree_nodes_from_json(nlohmann::json const& json_nodes)
+        -> std::optional<std::vector<IrStreamIndex::SchemaTreeNode>> {
+    std::vector<IrStreamIndex::SchemaTreeNode> nodes;
+    nodes.reserve(json_nodes.size());
+    for (auto const& json_node : json_nodes) {
+        auto const parent_id{json_node.at(0).get<SchemaTree::Node::id_t>()};
+        auto const type{json_node.at(2).get<uint8_t>()};
+        if (type > static_cast<uint8_t>(SchemaTree::Node::Type::Obj)) {
+            return std::nullopt;
+        }
+
+        // The parent must precede the node (the root has ID 0 and the n-th node has ID n) and be
+        // an object.
+        if (parent_id > nodes.size()
+            || (SchemaTree::cRootId != parent_id
+                && SchemaTree::Node::Type::Obj != nodes[parent_id - 1].type))
+        {
+            return std::nullopt;
+        }
+        nodes.push_back(
+                {.parent_id = parent_id,
+                 .key_name = json_node.at(1).get<std::string>(),
+                 .type = static_cast<SchemaTree::Node::Type>(type)}
+        );
+    }
+    return nodes;
+}
+
+auto checkpoint_to_json(IrStreamIndex::Checkpoint const& checkpoint) -> nlohmann::json {
+    nlohmann::json json_checkpoint{
+            {cIrStreamOffsetKey, checkpoint.ir_stream_offset},
+            {cLogEventIdxKey, checkpoint.log_event_idx},
+            {cAutoGenKeysSchemaTreeSizeKey, checkpoint.auto_gen_keys_schema_tree_size},
+            {cUserGenKeysSchemaTreeSizeKey, checkpoint.user_gen_keys_schema_tree_size},
+            {cUtcOffsetKey, checkpoint.utc_offset.count()}
+    };
+    if (checkpoint.compressed_offset.has_value()) {
+        json_checkpoint.emplace(cCompressedOffsetKey, checkpoint.compressed_offset.value());
+    }
+    if (checkpoint.timestamp_range.has_value()) {
+        auto const [min_timestamp, max_timestamp]{checkpoint.timestamp_range.value()};
+        json_checkpoint.emplace(cMinTimestampKey, min_timestamp);
+        json_checkpoint.emplace(cMaxTimestampKey, max_timestamp);
+    }
+    return json_checkpoint;
+}
+
+auto checkpoint_from_json(nlohmann::json const& json_checkpoint) -> IrStreamIndex::Checkpoint {
+    IrStreamIndex::Checkpoint checkpoint{
+            .ir_stream_offset = json_checkpoint.at(cIrStreamOffsetKey).get<size_t>(),
+            .compressed_offset = std::nullopt,
+            .log_event_idx = json_checkpoint.at(cLogEventIdxKey).get<size_t>(),
+            .auto_gen_keys_schema_tree_size
+            = json_checkpoint.at(cAutoGenKeysSchemaTreeSizeKey).get<size_t>(),
+            .user_gen_keys_schema_tree_size
+            = json_checkpoint.at(cUserGenKeysSchemaTreeSizeKey).get<size_t>(),
+            .utc_offset = UtcOffset{json_checkpoint.at(cUtcOffsetKey).get<int64_t>()},
+            .timestamp_range = std::nullopt
+    };
+    if (json_checkpoint.contains(cCompressedOffsetKey)) {
+        checkpoint.compressed_offset = json_checkpoint.at(cCompressedOffsetKey).get<size_t>();
+    }
+    if (json_checkpoint.contains(cMinTimestampKey)) {
+        checkpoint.timestamp_range.emplace(
+                json_checkpoint.at(cMinTimestampKey).get<ir::epoch_time_ms_t>(),
+                json_checkpoint.at(cMaxTimestampKey).get<ir::epoch_time_ms_t>()
+        );
+    }
+    return checkpoint;
+}
+
+auto are_checkpoints_valid(
+        std::vector<IrStreamIndex::Checkpoint> const& checkpoints,
+        size_t num_auto_gen_keys_schema_tree_nodes,
+        size_t num_user_gen_keys_schema_tree_nodes
+) -> bool {
+    IrStreamIndex::Checkpoint const* prev_checkpoint{nullptr};
+    for (auto const& checkpoint : checkpoints) {
+        if (checkpoint.auto_gen_keys_schema_tree_size < 1
+            || checkpoint.auto_gen_keys_schema_tree_size > num_auto_gen_keys_schema_tree_nodes + 1
+            || checkpoint.user_gen_keys_schema_tree_size < 1
+            || checkpoint.user_gen_keys_schema_tree_size > num_user_gen_keys_schema_tree_nodes + 1)
+        {
+            return false;
+        }
+        if (checkpoint.timestamp_range.has_value()
+            && checkpoint.timestamp_range->first > checkpoint.timestamp_range->second)
+        {
+            return false;
+        }
+        if (nullptr != prev_checkpoint
+            && (checkpoint.ir_stream_offset < prev_checkpoint->ir_stream_offset
+                || checkpoint.log_event_idx < prev_checkpoint->log_event_idx
+                || checkpoint.auto_gen_keys_schema_tree_size
+                           < prev_checkpoint->auto_gen_keys_schema_tree_size
+                || checkpoint.user_gen_keys_schema_tree_size
+                           < prev_checkpoint->user_gen_keys_schema_tree_size))
+        {
+            return false;
+        }
+        prev_checkpoint = &checkpoint;
+    }
+    return true;
+}
+}  // namespace
+
+auto IrStreamIndex::deserialize(std::span<uint8_t const> buf)
+        -> ystdlib::error_handling::Result<IrStreamIndex> {
+    auto const json_index = nlohmann::json::from_msgpack(buf.begin(), buf.end(), true, false);
+    if (json_index.is_discarded() || false == json_index.is_object()) {
+        return IrDeserializationError{IrDeserializationErrorEnum::InvalidIndex};
+    }
+
+    IrStreamIndex index;
+    try {
+        if (cVersion != json_index.at(cVersionKey).get<uint64_t>()) {
+            return IrDeserializationError{IrDeserializationErrorEnum::UnsupportedVersion};
+        }
+
+        auto auto_gen_keys_schema_tree_nodes{
+                schema_tree_nodes_from_json(json_index.at(cAutoGenKeysSchemaTreeNodesKey))
+        };
+        auto user_gen_keys_schema_tree_nodes{
+                schema_tree_nodes_from_json(json_index.at(cUserGenKeysSchemaTreeNodesKey))
+        };
+        if (false == auto_gen_keys_schema_tree_nodes.has_value()
+            || false == user_gen_keys_schema_tree_nodes.has_value())
+        {
+            return IrDeserializationError{IrDeserializationErrorEnum::InvalidIndex};
+        }
+        index.m_auto_gen_keys_schema_tree_nodes
+                = std::move(auto_gen_keys_schema_tree_nodes.value());
+        index.m_user_gen_keys_schema_tree_nodes
+                = std::move(user_gen_keys_schema_tree_nodes.value());
+
+        for (auto const& json_checkpoint : json_index.at(cCheckpointsKey)) {
+            index.m_checkpoints.push_back(checkpoint_from_json(json_checkpoint));
+        }
+    } catch (nlohmann::json::exception const&) {
+        return IrDeserializationError{IrDeserializationErrorEnum::InvalidIndex};
+    }
+
+    if (false
+        == are_checkpoints_valid(
+                index.m_checkpoints,
+                index.m_auto_gen_keys_schema_tree_nodes.size(),
+                index.m_user_gen_keys_schema_tree_nodes.size()
+        ))
+    {
+        return IrDeserializationError{IrDeserializationErrorEnum::InvalidIndex};
+    }
+    return index;
+}
+
+auto IrStreamIndex::add_timestamp(ir::epoch_time_ms_t timestamp) -> void {
+    if (m_checkpoints.empty()) {
+        return;
+    }
+    auto& timestamp_range{m_checkpoints.back().timestamp_range};
+    if (false == timestamp_range.has_value()) {
+        timestamp_range.emplace(timestamp, timestamp);
+        return;
+    }
+    timestamp_range->first = std::min(timestamp_range->first, timestamp);
+    timestamp_range->second = std::max(timestamp_range->second, timestamp);
+}
+
+auto IrStreamIndex::set_schema_tree_nodes(
+        SchemaTree const& auto_gen_keys_schema_tree,
+        SchemaTree const& user_gen_keys_schema_tree
+) -> void {
+    m_auto_gen_keys_schema_tree_nodes = get_schema_tree_nodes(auto_gen_keys_schema_tree);
+    m_user_gen_keys_schema_tree_nodes = get_schema_tree_nodes(user_gen_keys_schema_tree);
+}
+
+auto IrStreamIndex::find_checkpoints_in_time_range(
+        ir::epoch_time_ms_t begin_timestamp,
+        ir::epoch_time_ms_t end_timestamp
+) const -> std::vector<size_t> {
+    std::vector<size_t> checkpoint_indices;
+    for (size_t i{0}; i < m_checkpoints.size(); ++i) {
+        auto const& timestamp_range{m_checkpoints[i].timestamp_range};
+        if (false == timestamp_range.has_value()
+            || (timestamp_range->first <= end_timestamp
+                && timestamp_range->second >= begin_timestamp))
+        {
+            checkpoint_indices.push_back(i);
+        }
+    }
+    return checkpoint_indices;
+}
+
+auto IrStreamIndex::serialize() const -> std::vector<uint8_t> {
+    nlohmann::json json_checkpoints = nlohmann::json::array();
+    for (auto const& checkpoint : m_checkpoints) {
+        json_checkpoints.push_back(checkpoint_to_json(checkpoint));
+    }
+    nlohmann::json const json_index{
+            {cVersionKey, cVersion},
+            {cCheckpointsKey, std::move(json_checkpoints)},
+            {cAutoGenKeysSchemaTreeNodesKey,
+             schema_tree_nodes_to_json(m_auto_gen_keys_schema_tree_nodes)},
+            {cUserGenKeysSchemaTreeNodesKey,
+             schema_tree_nodes_to_json(m_user_gen_keys_schema_tree_nodes)}
+    };
+    return nlohmann::json::to_msgpack(json_index);
+}
+}  // namespace clp::ffi::ir_stream
@@ -0,0 +1,153 @@
+#ifndef CLP_FFI_IR_STREAM_IRSTREAMINDEX_HPP
+#define CLP_FFI_IR_STREAM_IRSTREAMINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/types.hpp"
+#include "../../time_types.hpp"
+#include "../SchemaTree.hpp"
+
+namespace clp::ffi::ir_stream {
+/**
+ * An index of checkpoints in a kv-pair IR stream, allowing deserialization to resume from any
+ * checkpoint instead of the start of the stream.
+ *
+ * A checkpoint is a position between two log events. Resuming deserialization from a checkpoint
+ * requires the state the deserializer would have built up by then: the schema trees and the UTC
+ * offset. Since schema trees only grow, the trees at any checkpoint are a prefix of the stream's
+ * final trees, so the index stores the final trees' nodes once and each checkpoint only stores the
+ * size of each tree.
+ *
+ * Each checkpoint also stores the range of timestamps of the log events between it and the next
+ * checkpoint, so that readers can skip parts of the stream that can't match a time-range filter.
+ */
+class IrStreamIndex {
+public:
+    // Types
+    struct Checkpoint {
+        // The checkpoint's offset in the (decompressed) IR stream.
+        size_t ir_stream_offset{0};
+        // The offset of the compressed frame that starts at the checkpoint, if the IR stream was
+        // compressed with a frame boundary at the checkpoint.
+        std::optional<size_t> compressed_offset;
+        // The index of the first log event after the checkpoint.
+        size_t log_event_idx{0};
+        size_t auto_gen_keys_schema_tree_size{1};
+        size_t user_gen_keys_schema_tree_size{1};
+        UtcOffset utc_offset{0};
+        // The minimum and maximum timestamps of the log events between this checkpoint and the
+        // next, or std::nullopt if none of them were serialized with a timestamp.
+        std::optional<std::pair<ir::epoch_time_ms_t, ir::epoch_time_ms_t>> timestamp_range;
+    };
+
+    /**
+     * A non-root schema tree node, stored independently of any schema tree.
+     */
+    struct SchemaTreeNode {
+        [[nodiscard]] auto get_locator() const -> SchemaTree::NodeLocator {
+            return {parent_id, key_name, type};
+        }
+
+        SchemaTree::Node::id_t parent_id{SchemaTree::cRootId};
+        std::string key_name;
+        SchemaTree::Node::Type type{SchemaTree::Node::Type::Obj};
+    };
+
+    // Factory function
+    /**
+     * Deserializes an index serialized by `serialize`.
+     * @param buf
+     * @return A result containing the deserialized index on success, or an error code indicating
+     * the failure:
+     * - IrDeserializationErrorEnum::UnsupportedVersion if the index's version is unsupported.
+     * - IrDeserializationErrorEnum::InvalidIndex if the index is malformed or inconsistent (e.g., a
+     *   checkpoint refers to more schema tree nodes than the index contains).
+     */
+    [[nodiscard]] static auto deserialize(std::span<uint8_t const> buf)
+            -> ystdlib::error_handling::Result<IrStreamIndex>;
+
+    // Methods
+    [[nodiscard]] auto get_checkpoints() const -> std::vector<Checkpoint> const& {
+        return m_checkpoints;
+    }
+
+    /**
+     * @return The nodes of the stream's auto-generated-keys schema tree, excluding the root, in ID
+     * order (i.e., the node with ID `i` is at index `i - 1`).
+     */
+    [[nodiscard]] auto get_auto_gen_keys_schema_tree_nodes() const
+            -> std::vector<SchemaTreeNode> const& {
+        return m_auto_gen_keys_schema_tree_nodes;
+    }
+
+    /**
+     * @return The nodes of the stream's user-generated-keys schema tree, excluding the root, in ID
+     * order (i.e., the node with ID `i` is at index `i - 1`).
+     */
+    [[nodiscard]] auto get_user_gen_keys_schema_tree_nodes() const
+            -> std::vector<SchemaTreeNode> const& {
+        return m_user_gen_keys_schema_tree_nodes;
+    }
+
+    /**
+     * Appends a checkpoint. Checkpoints must be appended in stream order.
+     * @param checkpoint
+     */
+    auto add_checkpoint(Checkpoint const& checkpoint) -> void {
+        m_checkpoints.push_back(checkpoint);
+    }
+
+    /**
+     * Extends the timestamp range of the last checkpoint to include the given timestamp. Does
+     * nothing if the index has no checkpoints.
+     * @param timestamp
+     */
+    auto add_timestamp(ir::epoch_time_ms_t timestamp) -> void;
+
+    /**
+     * Replaces the index's schema tree nodes with the nodes of the given trees.
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     */
+    auto set_schema_tree_nodes(
+            SchemaTree const& auto_gen_keys_schema_tree,
+            SchemaTree const& user_gen_keys_schema_tree
+    ) -> void;
+
+    /**
+     * @param begin_timestamp
+     * @param end_timestamp
+     * @return The indices (in ascending order) of the checkpoints whose log events may have
+     * timestamps in the range [`begin_timestamp`, `end_timestamp`]. This includes any checkpoint
+     * whose log events have no timestamps.
+     */
+    [[nodiscard]] auto find_checkpoints_in_time_range(
+            ir::epoch_time_ms_t begin_timestamp,
+            ir::epoch_time_ms_t end_timestamp
+    ) const -> std::vector<size_t>;
+
+    /**
+     * @return The index serialized as msgpack.
+     */
+    [[nodiscard]] auto serialize() const -> std::vector<uint8_t>;
+
+private:
+    // Constants
+    static constexpr uint64_t cVersion{1};
+
+    // Variables
+    std::vector<Checkpoint> m_checkpoints;
+    std::vector<SchemaTreeNode> m_auto_gen_keys_schema_tree_nodes;
+    std::vector<SchemaTreeNode> m_user_gen_keys_schema_tree_nodes;
+};
+}  // namespace clp::ffi::ir_stream
+
+#endif  // CLP_FFI_IR_STREAM_IRSTREAMINDEX_HPP
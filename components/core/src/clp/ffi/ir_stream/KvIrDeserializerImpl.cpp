@@ -1,5 +1,7 @@
 #include "KvIrDeserializerImpl.hpp"
 
+#include <utility>
+
 #include "ir_unit_deserialization_methods.hpp"
 #include "IrDeserializationError.hpp"
 
@@ -19,14 +21,18 @@ auto KvIrDeserializerImpl::deserialize_ir_unit_kv_pair_log_event(
         encoded_tag_t tag,
         std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
         std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
-        UtcOffset utc_offset
+        UtcOffset utc_offset,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
 ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
     return ir_stream::deserialize_ir_unit_kv_pair_log_event(
             reader,
             tag,
             auto_gen_keys_schema_tree,
             user_gen_keys_schema_tree,
-            utc_offset
+            utc_offset,
+            std::move(recycled_auto_gen_node_id_value_pairs),
+            std::move(recycled_user_gen_node_id_value_pairs)
     );
 }
 
@@ -1,6 +1,8 @@
 #include "Serializer.hpp"
 
+#include <algorithm>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
@@ -8,6 +10,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <msgpack.hpp>
@@ -21,6 +24,7 @@
 #include "../encoding_methods.hpp"
 #include "../SchemaTree.hpp"
 #include "encoding_methods.hpp"
+#include "IrStreamIndex.hpp"
 #include "protocol_constants.hpp"
 #include "utils.hpp"
 
@@ -230,6 +234,48 @@ template <typename encoded_variable_t>
  */
 [[nodiscard]] auto is_msgpack_array_serializable(msgpack::object const& array) -> bool;
 
+/**
+ * @param schema_tree
+ * @param node_id
+ * @param locator
+ * @return Whether the schema tree contains a node with the given ID at the given locator.
+ */
+[[nodiscard]] auto is_node_at_locator(
+        SchemaTree const& schema_tree,
+        SchemaTree::Node::id_t node_id,
+        SchemaTree::NodeLocator const& locator
+) -> bool;
+
+/**
+ * @param column
+ * @return The number of values in the given column.
+ */
+[[nodiscard]] auto get_num_column_values(LogEventColumn const& column) -> size_t;
+
+/**
+ * @param column
+ * @return The type of the schema tree node that corresponds with the given column's values.
+ */
+[[nodiscard]] auto get_column_node_type(LogEventColumn const& column) -> SchemaTree::Node::Type;
+
+/**
+ * Serializes the value at the given index of the given column.
+ * @tparam encoded_variable_t
+ * @param column
+ * @param idx
+ * @param logtype_buf
+ * @param output_buf
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrSerializationErrorEnum::StringSerializationFailure if string serialization fails.
+ */
+template <typename encoded_variable_t>
+[[nodiscard]] auto serialize_column_value(
+        LogEventColumn const& column,
+        size_t idx,
+        string& logtype_buf,
+        vector<int8_t>& output_buf
+) -> ystdlib::error_handling::Result<void>;
+
 /**
  * Serializes the given msgpack map using a depth-first search (DFS).
  * @tparam SchemaTreeNodeSerializationMethod
@@ -237,6 +283,9 @@ template <typename encoded_variable_t>
  * @tparam EmptyMapSerializationMethod
  * @param msgpack_map
  * @param schema_tree
+ * @param resolved_node_ids The IDs of the schema tree nodes that the keys of the previously
+ * serialized map resolved to, in DFS order. Each key's node is first looked up here, and then
+ * replaced with the node the key actually resolved to.
  * @param schema_tree_node_serialization_method
  * @param node_id_value_pair_serialization_method
  * @param empty_map_serialization_method
@@ -255,6 +304,7 @@ template <
 [[nodiscard]] auto serialize_msgpack_map_using_dfs(
         msgpack::object_map const& msgpack_map,
         SchemaTree& schema_tree,
+        vector<SchemaTree::Node::id_t>& resolved_node_ids,
         SchemaTreeNodeSerializationMethod schema_tree_node_serialization_method,
         NodeIdValuePairSerializationMethod node_id_value_pair_serialization_method,
         EmptyMapSerializationMethod empty_map_serialization_method
@@ -439,6 +489,74 @@ auto is_msgpack_array_serializable(msgpack::object const& array) -> bool {
     return true;
 }
 
+auto is_node_at_locator(
+        SchemaTree const& schema_tree,
+        SchemaTree::Node::id_t node_id,
+        SchemaTree::NodeLocator const& locator
+) -> bool {
+    if (SchemaTree::cRootId == node_id || schema_tree.get_size() <= node_id) {
+        return false;
+    }
+    auto const& node{schema_tree.get_node(node_id)};
+    return node.get_parent_id_unsafe() == locator.get_parent_id()
+           && node.get_type() == locator.get_type()
+           && node.get_key_name() == locator.get_key_name();
+}
+
+auto get_num_column_values(LogEventColumn const& column) -> size_t {
+    return std::visit([](auto const& values) -> size_t { return values.size(); }, column.values);
+}
+
+auto get_column_node_type(LogEventColumn const& column) -> SchemaTree::Node::Type {
+    return std::visit(
+            []<typename T>(span<T const> const&) -> SchemaTree::Node::Type {
+                if constexpr (std::is_same_v<T, int64_t>) {
+                    return SchemaTree::Node::Type::Int;
+                } else if constexpr (std::is_same_v<T, double>) {
+                    return SchemaTree::Node::Type::Float;
+                } else if constexpr (std::is_same_v<T, bool>) {
+                    return SchemaTree::Node::Type::Bool;
+                } else {
+                    static_assert(std::is_same_v<T, string_view>);
+                    return SchemaTree::Node::Type::Str;
+                }
+            },
+            column.values
+    );
+}
+
+template <typename encoded_variable_t>
+auto serialize_column_value(
+        LogEventColumn const& column,
+        size_t idx,
+        string& logtype_buf,
+        vector<int8_t>& output_buf
+) -> ystdlib::error_handling::Result<void> {
+    return std::visit(
+            [&]<typename T>(span<T const> const& values) -> ystdlib::error_handling::Result<void> {
+                if constexpr (std::is_same_v<T, int64_t>) {
+                    serialize_value_int(values[idx], output_buf);
+                } else if constexpr (std::is_same_v<T, double>) {
+                    serialize_value_float(values[idx], output_buf);
+                } else if constexpr (std::is_same_v<T, bool>) {
+                    serialize_value_bool(values[idx], output_buf);
+                } else if (false
+                           == serialize_value_string<encoded_variable_t>(
+                                   values[idx],
+                                   logtype_buf,
+                                   output_buf
+                           ))
+                {
+                    return IrSerializationError{
+                            IrSerializationErrorEnum::StringSerializationFailure
+                    };
+                }
+                return success();
+            },
+            column.values
+    );
+}
+
 template <
         SchemaTreeNodeSerializationMethodReq SchemaTreeNodeSerializationMethod,
         NodeIdValuePairSerializationMethodReq NodeIdValuePairSerializationMethod,
@@ -447,10 +565,12 @@ template <
 [[nodiscard]] auto serialize_msgpack_map_using_dfs(
         msgpack::object_map const& msgpack_map,
         SchemaTree& schema_tree,
+        vector<SchemaTree::Node::id_t>& resolved_node_ids,
         SchemaTreeNodeSerializationMethod schema_tree_node_serialization_method,
         NodeIdValuePairSerializationMethod node_id_value_pair_serialization_method,
         EmptyMapSerializationMethod empty_map_serialization_method
 ) -> ystdlib::error_handling::Result<void> {
+    size_t num_resolved_keys{0};
     vector<MsgpackMapIterator> dfs_stack;
     dfs_stack.emplace_back(
             SchemaTree::cRootId,
@@ -481,13 +601,27 @@ template <
         };
 
         // Get the schema-tree node that corresponds with the current kv-pair, or add it if it
-        // doesn't exist.
-        auto opt_schema_tree_node_id{schema_tree.try_get_node_id(locator)};
-        if (false == opt_schema_tree_node_id.has_value()) {
-            opt_schema_tree_node_id.emplace(schema_tree.insert_node(locator));
-            YSTDLIB_ERROR_HANDLING_TRYV(schema_tree_node_serialization_method(locator));
+        // doesn't exist. The node that the key at the same position in the previous map resolved
+        // to is tried first, to avoid searching the schema tree.
+        SchemaTree::Node::id_t schema_tree_node_id{};
+        if (num_resolved_keys < resolved_node_ids.size()
+            && is_node_at_locator(schema_tree, resolved_node_ids[num_resolved_keys], locator))
+        {
+            schema_tree_node_id = resolved_node_ids[num_resolved_keys];
+        } else {
+            auto opt_schema_tree_node_id{schema_tree.try_get_node_id(locator)};
+            if (false == opt_schema_tree_node_id.has_value()) {
+                opt_schema_tree_node_id.emplace(schema_tree.insert_node(locator));
+                YSTDLIB_ERROR_HANDLING_TRYV(schema_tree_node_serialization_method(locator));
+            }
+            schema_tree_node_id = opt_schema_tree_node_id.value();
+            if (num_resolved_keys < resolved_node_ids.size()) {
+                resolved_node_ids[num_resolved_keys] = schema_tree_node_id;
+            } else {
+                resolved_node_ids.push_back(schema_tree_node_id);
+            }
         }
-        auto const schema_tree_node_id{opt_schema_tree_node_id.value()};
+        ++num_resolved_keys;
 
         if (msgpack::type::MAP == val.type) {
             // Serialize map
@@ -513,6 +647,7 @@ template <
                 schema_tree_node_type
         ));
     }
+    resolved_node_ids.resize(num_resolved_keys);
 
     return success();
 }
@@ -574,7 +709,8 @@ auto Serializer<encoded_variable_t>::change_utc_offset(UtcOffset utc_offset) ->
 template <typename encoded_variable_t>
 auto Serializer<encoded_variable_t>::serialize_msgpack_map(
         msgpack::object_map const& auto_gen_kv_pairs_map,
-        msgpack::object_map const& user_gen_kv_pairs_map
+        msgpack::object_map const& user_gen_kv_pairs_map,
+        std::optional<ir::epoch_time_ms_t> timestamp
 ) -> ystdlib::error_handling::Result<void> {
     m_auto_gen_keys_schema_tree.take_snapshot();
     m_user_gen_keys_schema_tree.take_snapshot();
@@ -586,6 +722,173 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
             }
     };
 
+    YSTDLIB_ERROR_HANDLING_TRYV(
+            serialize_msgpack_map_to_ir_buf(auto_gen_kv_pairs_map, user_gen_kv_pairs_map)
+    );
+    ++m_num_log_events;
+    if (timestamp.has_value()) {
+        m_index.add_timestamp(timestamp.value());
+    }
+
+    revert_manager.mark_success();
+    return success();
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackLogEvent const> log_events
+) -> ystdlib::error_handling::Result<void> {
+    auto const original_ir_buf_size{m_ir_buf.size()};
+    m_auto_gen_keys_schema_tree.take_snapshot();
+    m_user_gen_keys_schema_tree.take_snapshot();
+    TransactionManager revert_manager{
+            []() noexcept -> void {},
+            [&]() noexcept -> void {
+                m_user_gen_keys_schema_tree.revert();
+                m_auto_gen_keys_schema_tree.revert();
+                m_ir_buf.resize(original_ir_buf_size);
+            }
+    };
+
+    reserve_ir_buf(log_events.size());
+    for (auto const& log_event : log_events) {
+        YSTDLIB_ERROR_HANDLING_TRYV(serialize_msgpack_map_to_ir_buf(
+                log_event.auto_gen_kv_pairs_map,
+                log_event.user_gen_kv_pairs_map
+        ));
+    }
+
+    m_num_log_events += log_events.size();
+    for (auto const& log_event : log_events) {
+        if (log_event.timestamp.has_value()) {
+            m_index.add_timestamp(log_event.timestamp.value());
+        }
+    }
+
+    revert_manager.mark_success();
+    return success();
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::serialize_columns(ColumnarLogEvents const& log_events)
+        -> ystdlib::error_handling::Result<void> {
+    auto const num_log_events{log_events.num_log_events};
+    if (false == log_events.timestamps.empty() && num_log_events != log_events.timestamps.size())
+    {
+        return IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns};
+    }
+    for (auto const columns : {log_events.auto_gen_columns, log_events.user_gen_columns}) {
+        for (auto const& column : columns) {
+            if (num_log_events != get_num_column_values(column)) {
+                return IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns};
+            }
+        }
+    }
+    if (0 == num_log_events) {
+        return success();
+    }
+
+    auto const original_ir_buf_size{m_ir_buf.size()};
+    m_auto_gen_keys_schema_tree.take_snapshot();
+    m_user_gen_keys_schema_tree.take_snapshot();
+    TransactionManager revert_manager{
+            []() noexcept -> void {},
+            [&]() noexcept -> void {
+                m_user_gen_keys_schema_tree.revert();
+                m_auto_gen_keys_schema_tree.revert();
+                m_ir_buf.resize(original_ir_buf_size);
+            }
+    };
+
+    // Resolve every column's node once, so that the log events can be serialized without any
+    // schema tree lookups. Any new nodes must precede the first log event that uses them.
+    m_schema_tree_node_buf.clear();
+    vector<Buffer> auto_gen_encoded_node_ids;
+    vector<Buffer> user_gen_encoded_node_ids;
+    YSTDLIB_ERROR_HANDLING_TRYV(
+            resolve_columns<true>(log_events.auto_gen_columns, auto_gen_encoded_node_ids)
+    );
+    YSTDLIB_ERROR_HANDLING_TRYV(
+            resolve_columns<false>(log_events.user_gen_columns, user_gen_encoded_node_ids)
+    );
+    m_ir_buf.insert(
+            m_ir_buf.cend(),
+            m_schema_tree_node_buf.cbegin(),
+            m_schema_tree_node_buf.cend()
+    );
+
+    reserve_ir_buf(num_log_events);
+    for (size_t log_event_idx{0}; log_event_idx < num_log_events; ++log_event_idx) {
+        for (size_t i{0}; i < log_events.auto_gen_columns.size(); ++i) {
+            auto const& encoded_node_id{auto_gen_encoded_node_ids[i]};
+            m_ir_buf.insert(m_ir_buf.cend(), encoded_node_id.cbegin(), encoded_node_id.cend());
+            YSTDLIB_ERROR_HANDLING_TRYV(serialize_column_value<encoded_variable_t>(
+                    log_events.auto_gen_columns[i],
+                    log_event_idx,
+                    m_logtype_buf,
+                    m_ir_buf
+            ));
+        }
+
+        if (log_events.user_gen_columns.empty()) {
+            serialize_value_empty_object(m_ir_buf);
+            continue;
+        }
+        m_user_gen_val_group_buf.clear();
+        for (size_t i{0}; i < log_events.user_gen_columns.size(); ++i) {
+            auto const& encoded_node_id{user_gen_encoded_node_ids[i]};
+            m_ir_buf.insert(m_ir_buf.cend(), encoded_node_id.cbegin(), encoded_node_id.cend());
+            YSTDLIB_ERROR_HANDLING_TRYV(serialize_column_value<encoded_variable_t>(
+                    log_events.user_gen_columns[i],
+                    log_event_idx,
+                    m_logtype_buf,
+                    m_user_gen_val_group_buf
+            ));
+        }
+        m_ir_buf.insert(
+                m_ir_buf.cend(),
+                m_user_gen_val_group_buf.cbegin(),
+                m_user_gen_val_group_buf.cend()
+        );
+    }
+
+    m_num_log_events += num_log_events;
+    for (auto const& timestamp : log_events.timestamps) {
+        if (timestamp.has_value()) {
+            m_index.add_timestamp(timestamp.value());
+        }
+    }
+
+    revert_manager.mark_success();
+    return success();
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::add_checkpoint(std::optional<size_t> compressed_offset)
+        -> void {
+    m_index.add_checkpoint(
+            {.ir_stream_offset = get_ir_stream_offset(),
+             .compressed_offset = compressed_offset,
+             .log_event_idx = m_num_log_events,
+             .auto_gen_keys_schema_tree_size = m_auto_gen_keys_schema_tree.get_size(),
+             .user_gen_keys_schema_tree_size = m_user_gen_keys_schema_tree.get_size(),
+             .utc_offset = m_curr_utc_offset,
+             .timestamp_range = std::nullopt}
+    );
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::get_index() const -> IrStreamIndex {
+    auto index{m_index};
+    index.set_schema_tree_nodes(m_auto_gen_keys_schema_tree, m_user_gen_keys_schema_tree);
+    return index;
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::serialize_msgpack_map_to_ir_buf(
+        msgpack::object_map const& auto_gen_kv_pairs_map,
+        msgpack::object_map const& user_gen_kv_pairs_map
+) -> ystdlib::error_handling::Result<void> {
     m_schema_tree_node_buf.clear();
     m_sequential_serialization_buf.clear();
     m_user_gen_val_group_buf.clear();
@@ -639,6 +942,7 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
         YSTDLIB_ERROR_HANDLING_TRYV(serialize_msgpack_map_using_dfs(
                 auto_gen_kv_pairs_map,
                 m_auto_gen_keys_schema_tree,
+                m_auto_gen_resolved_node_ids,
                 auto_gen_schema_tree_node_serialization_method,
                 auto_gen_node_id_value_pairs_serialization_method,
                 auto_gen_empty_map_serialization_method
@@ -696,6 +1000,7 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
         YSTDLIB_ERROR_HANDLING_TRYV(serialize_msgpack_map_using_dfs(
                 user_gen_kv_pairs_map,
                 m_user_gen_keys_schema_tree,
+                m_user_gen_resolved_node_ids,
                 user_gen_schema_tree_node_serialization_method,
                 user_gen_node_id_value_pairs_serialization_method,
                 user_gen_empty_map_serialization_method
@@ -718,8 +1023,89 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
             m_user_gen_val_group_buf.cbegin(),
             m_user_gen_val_group_buf.cend()
     );
+    return success();
+}
 
-    revert_manager.mark_success();
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::reserve_ir_buf(size_t num_log_events) -> void {
+    if (0 == m_num_log_events) {
+        return;
+    }
+    auto const average_log_event_size{get_ir_stream_offset() / m_num_log_events};
+    auto const required_capacity{m_ir_buf.size() + average_log_event_size * num_log_events};
+    if (required_capacity > m_ir_buf.capacity()) {
+        // Keep growing geometrically so that many small batches don't each reallocate the buffer
+        m_ir_buf.reserve(std::max(required_capacity, 2 * m_ir_buf.capacity()));
+    }
+}
+
+template <typename encoded_variable_t>
+template <bool is_auto_generated_node>
+auto Serializer<encoded_variable_t>::resolve_columns(
+        span<LogEventColumn const> columns,
+        vector<Buffer>& encoded_node_ids
+) -> ystdlib::error_handling::Result<void> {
+    auto& schema_tree{
+            is_auto_generated_node ? m_auto_gen_keys_schema_tree : m_user_gen_keys_schema_tree
+    };
+    auto get_or_insert_node = [&](SchemaTree::NodeLocator const& locator)
+            -> ystdlib::error_handling::Result<SchemaTree::Node::id_t> {
+        if (auto const node_id{schema_tree.try_get_node_id(locator)}; node_id.has_value()) {
+            return node_id.value();
+        }
+        auto const node_id{schema_tree.insert_node(locator)};
+        YSTDLIB_ERROR_HANDLING_TRYV(serialize_schema_tree_node<is_auto_generated_node>(locator));
+        return node_id;
+    };
+
+    vector<SchemaTree::Node::id_t> column_node_ids;
+    vector<SchemaTree::Node::id_t> path_node_ids;
+    for (auto const& column : columns) {
+        if (column.key_path.empty()) {
+            return IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns};
+        }
+        auto parent_id{SchemaTree::cRootId};
+        for (size_t i{0}; i + 1 < column.key_path.size(); ++i) {
+            parent_id = YSTDLIB_ERROR_HANDLING_TRYX(get_or_insert_node(
+                    {parent_id, column.key_path[i], SchemaTree::Node::Type::Obj}
+            ));
+            path_node_ids.push_back(parent_id);
+        }
+        auto const node_id{YSTDLIB_ERROR_HANDLING_TRYX(get_or_insert_node(
+                {parent_id, column.key_path.back(), get_column_node_type(column)}
+        ))};
+        column_node_ids.push_back(node_id);
+        path_node_ids.push_back(node_id);
+
+        Buffer encoded_node_id;
+        YSTDLIB_ERROR_HANDLING_TRYV((encode_and_serialize_schema_tree_node_id<
+                                     is_auto_generated_node,
+                                     cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
+                                     cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
+                                     cProtocol::Payload::EncodedSchemaTreeNodeIdInt
+        >(node_id, encoded_node_id)));
+        encoded_node_ids.emplace_back(std::move(encoded_node_id));
+    }
+
+    // A log event can't have two values for the same node...
+    std::ranges::sort(column_node_ids);
+    if (column_node_ids.cend() != std::ranges::adjacent_find(column_node_ids)) {
+        return IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns};
+    }
+
+    // ...or two nodes with the same key under the same parent (e.g., {"a"} and {"a", "b"}).
+    std::ranges::sort(path_node_ids);
+    auto const [unique_end, path_end]{std::ranges::unique(path_node_ids)};
+    path_node_ids.erase(unique_end, path_end);
+    auto get_key = [&](SchemaTree::Node::id_t node_id
+                   ) -> std::pair<SchemaTree::Node::id_t, string_view> {
+        auto const& node{schema_tree.get_node(node_id)};
+        return {node.get_parent_id_unsafe(), node.get_key_name()};
+    };
+    std::ranges::sort(path_node_ids, {}, get_key);
+    if (path_node_ids.cend() != std::ranges::adjacent_find(path_node_ids, {}, get_key)) {
+        return IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns};
+    }
     return success();
 }
 
@@ -781,13 +1167,39 @@ template auto Serializer<four_byte_encoded_variable_t>::change_utc_offset(UtcOff
 
 template auto Serializer<eight_byte_encoded_variable_t>::serialize_msgpack_map(
         msgpack::object_map const& auto_gen_kv_pairs_map,
-        msgpack::object_map const& user_gen_kv_pairs_map
+        msgpack::object_map const& user_gen_kv_pairs_map,
+        std::optional<ir::epoch_time_ms_t> timestamp
 ) -> ystdlib::error_handling::Result<void>;
 template auto Serializer<four_byte_encoded_variable_t>::serialize_msgpack_map(
         msgpack::object_map const& auto_gen_kv_pairs_map,
-        msgpack::object_map const& user_gen_kv_pairs_map
+        msgpack::object_map const& user_gen_kv_pairs_map,
+        std::optional<ir::epoch_time_ms_t> timestamp
+) -> ystdlib::error_handling::Result<void>;
+
+template auto Serializer<eight_byte_encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackLogEvent const> log_events
+) -> ystdlib::error_handling::Result<void>;
+template auto Serializer<four_byte_encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackLogEvent const> log_events
 ) -> ystdlib::error_handling::Result<void>;
 
+template auto Serializer<eight_byte_encoded_variable_t>::serialize_columns(
+        ColumnarLogEvents const& log_events
+) -> ystdlib::error_handling::Result<void>;
+template auto Serializer<four_byte_encoded_variable_t>::serialize_columns(
+        ColumnarLogEvents const& log_events
+) -> ystdlib::error_handling::Result<void>;
+
+template auto Serializer<eight_byte_encoded_variable_t>::add_checkpoint(
+        std::optional<size_t> compressed_offset
+) -> void;
+template auto Serializer<four_byte_encoded_variable_t>::add_checkpoint(
+        std::optional<size_t> compressed_offset
+) -> void;
+
+template auto Serializer<eight_byte_encoded_variable_t>::get_index() const -> IrStreamIndex;
+template auto Serializer<four_byte_encoded_variable_t>::get_index() const -> IrStreamIndex;
+
 template auto Serializer<eight_byte_encoded_variable_t>::serialize_schema_tree_node<true>(
         SchemaTree::NodeLocator const& locator
 ) -> ystdlib::error_handling::Result<void>;
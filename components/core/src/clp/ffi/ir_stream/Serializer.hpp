@@ -1,21 +1,63 @@
 #ifndef CLP_FFI_IR_STREAM_SERIALIZER_HPP
 #define CLP_FFI_IR_STREAM_SERIALIZER_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
 #include <string>
+#include <string_view>
+#include <variant>
 #include <vector>
 
 #include <msgpack.hpp>
 #include <nlohmann/json.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
+#include "../../ir/types.hpp"
 #include "../../time_types.hpp"
 #include "../SchemaTree.hpp"
 #include "IrSerializationError.hpp"
+#include "IrStreamIndex.hpp"
 
 namespace clp::ffi::ir_stream {
+/**
+ * A key-value pair log event given as msgpack maps, for batch serialization.
+ */
+struct MsgpackLogEvent {
+    msgpack::object_map auto_gen_kv_pairs_map{};
+    msgpack::object_map user_gen_kv_pairs_map{};
+    std::optional<ir::epoch_time_ms_t> timestamp;
+};
+
+/**
+ * The values of a single key across a batch of log events, stored as a contiguous array.
+ */
+struct LogEventColumn {
+    // The keys from the log event's root to the value, e.g., {"a", "b"} for `{"a": {"b": value}}`.
+    std::vector<std::string_view> key_path;
+    std::variant<
+            std::span<int64_t const>,
+            std::span<double const>,
+            std::span<bool const>,
+            std::span<std::string_view const>
+    >
+            values;
+};
+
+/**
+ * A batch of key-value pair log events given as columns (i.e., a struct of arrays), for batch
+ * serialization. Every log event has a value in every column.
+ */
+struct ColumnarLogEvents {
+    size_t num_log_events{0};
+    std::span<LogEventColumn const> auto_gen_columns;
+    std::span<LogEventColumn const> user_gen_columns;
+    // The log events' timestamps, if any, used to maintain the timestamp ranges of the stream's
+    // index. Either empty or one per log event.
+    std::span<std::optional<ir::epoch_time_ms_t> const> timestamps;
+};
+
 /**
  * Class for serializing log events into the kv-pair IR format.
  *
@@ -29,7 +71,11 @@ namespace clp::ffi::ir_stream {
  *   for writing the serialized bytes into I/O streams.
  * - This class doesn't provide an API to terminate the IR stream. Callers should
  *   terminate the stream by flushing this class' IR buffer to the I/O stream and then writing
- *   `clp::ffi::ir_stream::cProtocol::Eof` to the I/O stream.
+ *   `clp::ffi::ir_stream::cProtocol::Eof` to the I/O stream. `StreamingSerializer` does both for
+ *   callers that write the stream to a `WriterInterface`.
+ * - Consecutive log events usually have the same structure, so the serializer remembers the schema
+ *   tree nodes that the keys of the last log event resolved to and tries them first, instead of
+ *   searching the schema tree for every key.
  * @tparam encoded_variable_t Type of encoded variables in the serialized IR stream.
  */
 template <typename encoded_variable_t>
@@ -75,8 +121,21 @@ public:
 
     /**
      * Clears the underlying IR buffer.
+     *
+     * NOTE: The IR stream offsets recorded in checkpoints assume that the cleared bytes have been
+     * written to the I/O stream.
+     */
+    auto clear_ir_buf() -> void {
+        m_num_cleared_ir_bytes += m_ir_buf.size();
+        m_ir_buf.clear();
+    }
+
+    /**
+     * @return The offset in the IR stream of the end of the serialized IR bytes.
      */
-    auto clear_ir_buf() -> void { m_ir_buf.clear(); }
+    [[nodiscard]] auto get_ir_stream_offset() const -> size_t {
+        return m_num_cleared_ir_bytes + m_ir_buf.size();
+    }
 
     /**
      * @return The current UTC offset.
@@ -94,20 +153,112 @@ public:
      * Serializes the given msgpack maps as a key-value pair log event.
      * @param auto_gen_kv_pairs_map
      * @param user_gen_kv_pairs_map
+     * @param timestamp The log event's timestamp, if any, used to maintain the timestamp ranges of
+     * the stream's index.
      * @return A void result on success, or an error code indicating the failure:
      * - Forwards `serialize_schema_tree_node`'s return values on failure.
      * - Forwards `serialize_msgpack_map_using_dfs`'s return values on failure.
      */
     [[nodiscard]] auto serialize_msgpack_map(
             msgpack::object_map const& auto_gen_kv_pairs_map,
-            msgpack::object_map const& user_gen_kv_pairs_map
+            msgpack::object_map const& user_gen_kv_pairs_map,
+            std::optional<ir::epoch_time_ms_t> timestamp = std::nullopt
     ) -> ystdlib::error_handling::Result<void>;
 
+    /**
+     * Serializes the given batch of log events, each as if by `serialize_msgpack_map`. The IR
+     * buffer is grown once for the whole batch, based on the average size of the log events
+     * serialized so far.
+     *
+     * NOTE: The batch is serialized atomically: on failure, none of its log events are serialized.
+     * @param log_events
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `serialize_msgpack_map`'s return values on failure.
+     */
+    [[nodiscard]] auto serialize_msgpack_maps(std::span<MsgpackLogEvent const> log_events)
+            -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Serializes the given batch of log events given as columns. Each column's key path is
+     * resolved to a schema tree node once for the whole batch, and the log events are serialized
+     * without any schema tree lookups.
+     *
+     * NOTE: The batch is serialized atomically: on failure, none of its log events are serialized.
+     * @param log_events
+     * @return A void result on success, or an error code indicating the failure:
+     * - IrSerializationErrorEnum::InvalidLogEventColumns if any column has an empty key path or a
+     *   number of values that differs from `log_events.num_log_events`; if the number of
+     *   timestamps is neither zero nor `log_events.num_log_events`; or if two columns would give a
+     *   log event two values with the same key (e.g., the key paths {"a"} and {"a", "b"}).
+     * - IrSerializationErrorEnum::StringSerializationFailure if a string value couldn't be
+     *   serialized.
+     * - Forwards `serialize_schema_tree_node`'s return values on failure.
+     * - Forwards `encode_and_serialize_schema_tree_node_id`'s return values on failure.
+     */
+    [[nodiscard]] auto serialize_columns(ColumnarLogEvents const& log_events)
+            -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Adds a checkpoint at the current position in the IR stream (i.e., between the last
+     * serialized log event and the next) to the stream's index.
+     * @param compressed_offset The offset of the compressed frame that starts at the checkpoint, if
+     * the caller compresses the IR stream and ends a frame at the checkpoint.
+     */
+    auto add_checkpoint(std::optional<size_t> compressed_offset = std::nullopt) -> void;
+
+    /**
+     * @return The stream's index, containing the checkpoints added so far and the schema tree nodes
+     * necessary to resume deserialization from any of them.
+     */
+    [[nodiscard]] auto get_index() const -> IrStreamIndex;
+
 private:
     // Constructors
     Serializer() = default;
 
     // Methods
+    /**
+     * Serializes the given msgpack maps as a key-value pair log event and appends it to the IR
+     * buffer, without snapshotting the schema trees or updating the stream's index.
+     *
+     * NOTE: On failure, the IR buffer is unchanged but the schema trees may contain nodes added
+     * for the log event, so callers must revert them.
+     * @param auto_gen_kv_pairs_map
+     * @param user_gen_kv_pairs_map
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `serialize_schema_tree_node`'s return values on failure.
+     * - Forwards `serialize_msgpack_map_using_dfs`'s return values on failure.
+     */
+    [[nodiscard]] auto serialize_msgpack_map_to_ir_buf(
+            msgpack::object_map const& auto_gen_kv_pairs_map,
+            msgpack::object_map const& user_gen_kv_pairs_map
+    ) -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Reserves space in the IR buffer for the given number of log events, assuming they're the
+     * average size of the log events serialized so far.
+     * @param num_log_events
+     */
+    auto reserve_ir_buf(size_t num_log_events) -> void;
+
+    /**
+     * Resolves the key path of each of the given columns to a schema tree node, inserting any
+     * missing nodes and serializing them into `m_schema_tree_node_buf`.
+     * @tparam is_auto_generated_node
+     * @param columns
+     * @param encoded_node_ids Returns the serialized ID of each column's node.
+     * @return A void result on success, or an error code indicating the failure:
+     * - IrSerializationErrorEnum::InvalidLogEventColumns if any column's key path is empty, or if
+     *   two columns would give a log event two values with the same key.
+     * - Forwards `serialize_schema_tree_node`'s return values on failure.
+     * - Forwards `encode_and_serialize_schema_tree_node_id`'s return values on failure.
+     */
+    template <bool is_auto_generated_node>
+    [[nodiscard]] auto resolve_columns(
+            std::span<LogEventColumn const> columns,
+            std::vector<Buffer>& encoded_node_ids
+    ) -> ystdlib::error_handling::Result<void>;
+
     /**
      * Serializes a schema tree node identified by the given locator into `m_schema_tree_node_buf`.
      * @tparam is_auto_generated_node
@@ -124,8 +275,16 @@ private:
 
     UtcOffset m_curr_utc_offset{0};
     Buffer m_ir_buf;
+    size_t m_num_cleared_ir_bytes{0};
+    size_t m_num_log_events{0};
     SchemaTree m_auto_gen_keys_schema_tree;
     SchemaTree m_user_gen_keys_schema_tree;
+    IrStreamIndex m_index;
+
+    // The IDs of the schema tree nodes that the keys of the last serialized msgpack maps resolved
+    // to, in the order the keys were visited.
+    std::vector<SchemaTree::Node::id_t> m_auto_gen_resolved_node_ids;
+    std::vector<SchemaTree::Node::id_t> m_user_gen_resolved_node_ids;
 
     std::string m_logtype_buf;
     Buffer m_schema_tree_node_buf;
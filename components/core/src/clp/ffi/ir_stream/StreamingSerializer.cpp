@@ -0,0 +1,132 @@
+#include "StreamingSerializer.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include <msgpack.hpp>
+#include <nlohmann/json.hpp>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/types.hpp"
+#include "../../streaming_compression/zstd/Compressor.hpp"
+#include "../../type_utils.hpp"
+#include "../../WriterInterface.hpp"
+#include "protocol_constants.hpp"
+#include "Serializer.hpp"
+
+using clp::ir::eight_byte_encoded_variable_t;
+using clp::ir::four_byte_encoded_variable_t;
+
+namespace clp::ffi::ir_stream {
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::create(
+        WriterInterface& writer,
+        size_t frame_size,
+        int compression_level,
+        std::optional<nlohmann::json> optional_user_defined_metadata
+) -> ystdlib::error_handling::Result<StreamingSerializer<encoded_variable_t>> {
+    auto serializer{YSTDLIB_ERROR_HANDLING_TRYX(
+            Serializer<encoded_variable_t>::create(std::move(optional_user_defined_metadata))
+    )};
+    StreamingSerializer<encoded_variable_t> streaming_serializer{
+            std::move(serializer),
+            writer,
+            frame_size,
+            compression_level
+    };
+    // Add a checkpoint right after the preamble so that every log event is covered by one.
+    streaming_serializer.add_checkpoint();
+    return streaming_serializer;
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::serialize_msgpack_map(
+        msgpack::object_map const& auto_gen_kv_pairs_map,
+        msgpack::object_map const& user_gen_kv_pairs_map,
+        std::optional<ir::epoch_time_ms_t> timestamp
+) -> ystdlib::error_handling::Result<void> {
+    YSTDLIB_ERROR_HANDLING_TRYV(m_serializer.serialize_msgpack_map(
+            auto_gen_kv_pairs_map,
+            user_gen_kv_pairs_map,
+            timestamp
+    ));
+    handle_serialized_ir();
+    return ystdlib::error_handling::success();
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::serialize_msgpack_maps(
+        std::span<MsgpackLogEvent const> log_events
+) -> ystdlib::error_handling::Result<void> {
+    YSTDLIB_ERROR_HANDLING_TRYV(m_serializer.serialize_msgpack_maps(log_events));
+    handle_serialized_ir();
+    return ystdlib::error_handling::success();
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::serialize_columns(
+        ColumnarLogEvents const& log_events
+) -> ystdlib::error_handling::Result<void> {
+    YSTDLIB_ERROR_HANDLING_TRYV(m_serializer.serialize_columns(log_events));
+    handle_serialized_ir();
+    return ystdlib::error_handling::success();
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::close() -> void {
+    compress_ir_buf();
+    constexpr char cEof{cProtocol::Eof};
+    m_compressor->write(&cEof, sizeof(cEof));
+    m_compressor->close();
+}
+
+template <typename encoded_variable_t>
+StreamingSerializer<encoded_variable_t>::StreamingSerializer(
+        Serializer<encoded_variable_t> serializer,
+        WriterInterface& writer,
+        size_t frame_size,
+        int compression_level
+)
+        : m_serializer{std::move(serializer)},
+          m_writer{&writer},
+          m_compressor{std::make_unique<streaming_compression::zstd::Compressor>()},
+          m_frame_size{frame_size} {
+    m_compressor->open(writer, compression_level);
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::handle_serialized_ir() -> void {
+    if (m_serializer.get_ir_stream_offset() - m_frame_begin_ir_stream_offset >= m_frame_size) {
+        add_checkpoint();
+    } else if (m_serializer.get_ir_buf_view().size() >= cMaxIrBufSize) {
+        compress_ir_buf();
+    }
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::compress_ir_buf() -> void {
+    auto const ir_buf_view{m_serializer.get_ir_buf_view()};
+    m_compressor->write(
+            size_checked_pointer_cast<char const>(ir_buf_view.data()),
+            ir_buf_view.size()
+    );
+    m_serializer.clear_ir_buf();
+}
+
+template <typename encoded_variable_t>
+auto StreamingSerializer<encoded_variable_t>::add_checkpoint() -> void {
+    compress_ir_buf();
+    // Ending the frame writes all IR before the checkpoint to the writer
+    m_compressor->flush();
+    m_serializer.add_checkpoint(m_writer->get_pos());
+    m_frame_begin_ir_stream_offset = m_serializer.get_ir_stream_offset();
+}
+
+// Explicitly declare template specializations so that we can define the template methods in this
+// file
+template class StreamingSerializer<eight_byte_encoded_variable_t>;
+template class StreamingSerializer<four_byte_encoded_variable_t>;
+}  // namespace clp::ffi::ir_stream
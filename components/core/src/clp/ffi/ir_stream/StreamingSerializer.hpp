@@ -0,0 +1,166 @@
+#ifndef CLP_FFI_IR_STREAM_STREAMINGSERIALIZER_HPP
+#define CLP_FFI_IR_STREAM_STREAMINGSERIALIZER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+#include <msgpack.hpp>
+#include <nlohmann/json.hpp>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/types.hpp"
+#include "../../streaming_compression/zstd/Compressor.hpp"
+#include "../../streaming_compression/zstd/Constants.hpp"
+#include "../../time_types.hpp"
+#include "../../WriterInterface.hpp"
+#include "IrStreamIndex.hpp"
+#include "Serializer.hpp"
+
+namespace clp::ffi::ir_stream {
+/**
+ * Class for serializing log events into a zstd-compressed kv-pair IR stream that's written to a
+ * `WriterInterface`.
+ *
+ * The serialized IR is compressed and written as it's produced, rather than accumulated in memory.
+ * Roughly every `frame_size` bytes of IR, the serializer ends the current zstd frame and adds a
+ * checkpoint at the start of the next frame to the stream's index, so that readers can start
+ * decompressing and deserializing the stream at any checkpoint (see `IrStreamIndex`). The first
+ * checkpoint is right after the stream's preamble.
+ *
+ * NOTE: The compressed offsets in the stream's index are positions in the given writer.
+ * @tparam encoded_variable_t Type of encoded variables in the serialized IR stream.
+ */
+template <typename encoded_variable_t>
+class StreamingSerializer {
+public:
+    // Constants
+    static constexpr size_t cDefaultFrameSize{4ULL * 1024 * 1024};  // 4 MiB
+
+    // Factory function
+    /**
+     * Creates a serializer, and compresses and writes the stream's preamble.
+     * @param writer The writer to write the compressed stream to. Must outlive the serializer.
+     * @param frame_size The amount of IR to compress into each zstd frame.
+     * @param compression_level
+     * @param optional_user_defined_metadata Stream-level user-defined metadata, given as a JSON
+     * object.
+     * @return A result containing the serializer on success, or an error code indicating the
+     * failure:
+     * - Forwards `Serializer::create`'s return values on failure.
+     * @throw streaming_compression::zstd::Compressor::OperationFailed if the preamble couldn't be
+     * compressed.
+     */
+    [[nodiscard]] static auto create(
+            WriterInterface& writer,
+            size_t frame_size = cDefaultFrameSize,
+            int compression_level = streaming_compression::zstd::cDefaultCompressionLevel,
+            std::optional<nlohmann::json> optional_user_defined_metadata = std::nullopt
+    ) -> ystdlib::error_handling::Result<StreamingSerializer<encoded_variable_t>>;
+
+    // Delete copy constructor and assignment operator
+    StreamingSerializer(StreamingSerializer const&) = delete;
+    auto operator=(StreamingSerializer const&) -> StreamingSerializer& = delete;
+
+    // Default move constructor and assignment operator
+    StreamingSerializer(StreamingSerializer&&) noexcept = default;
+    auto operator=(StreamingSerializer&&) noexcept -> StreamingSerializer& = default;
+
+    // Destructor
+    ~StreamingSerializer() = default;
+
+    // Methods
+    /**
+     * Serializes the given log event. See `Serializer::serialize_msgpack_map`.
+     * @param auto_gen_kv_pairs_map
+     * @param user_gen_kv_pairs_map
+     * @param timestamp
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `Serializer::serialize_msgpack_map`'s return values on failure.
+     * @throw streaming_compression::zstd::Compressor::OperationFailed if the IR couldn't be
+     * compressed.
+     */
+    [[nodiscard]] auto serialize_msgpack_map(
+            msgpack::object_map const& auto_gen_kv_pairs_map,
+            msgpack::object_map const& user_gen_kv_pairs_map,
+            std::optional<ir::epoch_time_ms_t> timestamp = std::nullopt
+    ) -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Serializes the given batch of log events. See `Serializer::serialize_msgpack_maps`.
+     * @param log_events
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `Serializer::serialize_msgpack_maps`'s return values on failure.
+     * @throw streaming_compression::zstd::Compressor::OperationFailed if the IR couldn't be
+     * compressed.
+     */
+    [[nodiscard]] auto serialize_msgpack_maps(std::span<MsgpackLogEvent const> log_events)
+            -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Serializes the given batch of log events. See `Serializer::serialize_columns`.
+     * @param log_events
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `Serializer::serialize_columns`'s return values on failure.
+     * @throw streaming_compression::zstd::Compressor::OperationFailed if the IR couldn't be
+     * compressed.
+     */
+    [[nodiscard]] auto serialize_columns(ColumnarLogEvents const& log_events)
+            -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Terminates the stream, and compresses and writes any remaining IR. The serializer can't be
+     * used afterwards.
+     * @throw streaming_compression::zstd::Compressor::OperationFailed if the IR couldn't be
+     * compressed.
+     */
+    auto close() -> void;
+
+    /**
+     * @return The stream's index. See `Serializer::get_index`.
+     */
+    [[nodiscard]] auto get_index() const -> IrStreamIndex { return m_serializer.get_index(); }
+
+private:
+    // Constants
+    // The amount of IR to buffer before compressing it
+    static constexpr size_t cMaxIrBufSize{64ULL * 1024};  // 64 KiB
+
+    // Constructor
+    StreamingSerializer(
+            Serializer<encoded_variable_t> serializer,
+            WriterInterface& writer,
+            size_t frame_size,
+            int compression_level
+    );
+
+    // Methods
+    /**
+     * Compresses any buffered IR if there's enough of it, ending the current frame and adding a
+     * checkpoint if the frame has grown to the frame size.
+     */
+    auto handle_serialized_ir() -> void;
+
+    /**
+     * Compresses all buffered IR.
+     */
+    auto compress_ir_buf() -> void;
+
+    /**
+     * Compresses all buffered IR, ends the current frame, and adds a checkpoint at the start of
+     * the next frame.
+     */
+    auto add_checkpoint() -> void;
+
+    // Variables
+    Serializer<encoded_variable_t> m_serializer;
+    WriterInterface* m_writer;
+    std::unique_ptr<streaming_compression::zstd::Compressor> m_compressor;
+    size_t m_frame_size;
+    // The offset in the (decompressed) IR stream at which the current frame starts
+    size_t m_frame_begin_ir_stream_offset{0};
+};
+}  // namespace clp::ffi::ir_stream
+
+#endif  // CLP_FFI_IR_STREAM_STREAMINGSERIALIZER_HPP
@@ -90,7 +90,9 @@ auto UnstructuredIrDeserializerImpl<ir::four_byte_encoded_variable_t>::
                 encoded_tag_t tag,
                 std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
                 std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
-                UtcOffset utc_offset
+                UtcOffset utc_offset,
+                KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+                KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
         ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
     auto encoded_text_ast{YSTDLIB_ERROR_HANDLING_TRYX(
             deserialize_encoded_text_ast<ir::four_byte_encoded_variable_t>(reader, tag)
@@ -108,12 +110,15 @@ auto UnstructuredIrDeserializerImpl<ir::four_byte_encoded_variable_t>::
             this->resolve_required_node_ids(auto_gen_keys_schema_tree, user_gen_keys_schema_tree)
     )};
 
-    KeyValuePairLogEvent::NodeIdValuePairs auto_gen_pairs{
-            {timestamp_node_id, Value{static_cast<value_int_t>(m_previous_timestamp)}}
-    };
-    KeyValuePairLogEvent::NodeIdValuePairs user_gen_pairs{
-            {message_node_id, Value{std::move(encoded_text_ast)}}
-    };
+    auto auto_gen_pairs{std::move(recycled_auto_gen_node_id_value_pairs)};
+    auto_gen_pairs.clear();
+    auto_gen_pairs.emplace(
+            timestamp_node_id,
+            Value{static_cast<value_int_t>(m_previous_timestamp)}
+    );
+    auto user_gen_pairs{std::move(recycled_user_gen_node_id_value_pairs)};
+    user_gen_pairs.clear();
+    user_gen_pairs.emplace(message_node_id, Value{std::move(encoded_text_ast)});
 
     return KeyValuePairLogEvent::create(
             auto_gen_keys_schema_tree,
@@ -131,7 +136,9 @@ auto UnstructuredIrDeserializerImpl<ir::eight_byte_encoded_variable_t>::
                 encoded_tag_t tag,
                 std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
                 std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
-                UtcOffset utc_offset
+                UtcOffset utc_offset,
+                KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+                KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
         ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
     auto encoded_text_ast{YSTDLIB_ERROR_HANDLING_TRYX(
             deserialize_encoded_text_ast<ir::eight_byte_encoded_variable_t>(reader, tag)
@@ -148,15 +155,18 @@ auto UnstructuredIrDeserializerImpl<ir::eight_byte_encoded_variable_t>::
             this->resolve_required_node_ids(auto_gen_keys_schema_tree, user_gen_keys_schema_tree)
     )};
 
+    auto auto_gen_pairs{std::move(recycled_auto_gen_node_id_value_pairs)};
+    auto_gen_pairs.clear();
+    auto_gen_pairs.emplace(timestamp_node_id, Value{static_cast<value_int_t>(absolute_timestamp)});
+    auto user_gen_pairs{std::move(recycled_user_gen_node_id_value_pairs)};
+    user_gen_pairs.clear();
+    user_gen_pairs.emplace(message_node_id, Value{std::move(encoded_text_ast)});
+
     return KeyValuePairLogEvent::create(
             auto_gen_keys_schema_tree,
             user_gen_keys_schema_tree,
-            KeyValuePairLogEvent::NodeIdValuePairs{
-                    {timestamp_node_id, Value{static_cast<value_int_t>(absolute_timestamp)}}
-            },
-            KeyValuePairLogEvent::NodeIdValuePairs{
-                    {message_node_id, Value{std::move(encoded_text_ast)}}
-            },
+            std::move(auto_gen_pairs),
+            std::move(user_gen_pairs),
             utc_offset
     );
 }
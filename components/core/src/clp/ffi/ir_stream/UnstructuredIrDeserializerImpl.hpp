@@ -81,7 +81,9 @@ public:
             encoded_tag_t tag,
             std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
             std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
-            UtcOffset utc_offset
+            UtcOffset utc_offset,
+            KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+            KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
     ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> override;
 
     /**
@@ -533,8 +533,16 @@ auto deserialize_encoded_text_ast(
 template <ir::EncodedVariableTypeReq encoded_variable_t>
 [[nodiscard]] auto deserialize_encoded_text_ast(ReaderInterface& reader, encoded_tag_t encoded_tag)
         -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>> {
-    StringBlob string_blob;
-    vector<encoded_variable_t> encoded_vars;
+    return deserialize_encoded_text_ast<encoded_variable_t>(reader, encoded_tag, {}, {});
+}
+
+template <ir::EncodedVariableTypeReq encoded_variable_t>
+[[nodiscard]] auto deserialize_encoded_text_ast(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        vector<encoded_variable_t> encoded_vars,
+        StringBlob string_blob
+) -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>> {
     bool is_encoded_var{};
     while (is_variable_tag<encoded_variable_t>(encoded_tag, is_encoded_var)) {
         if (is_encoded_var) {
@@ -851,6 +859,20 @@ template auto deserialize_encoded_text_ast<eight_byte_encoded_variable_t>(
         encoded_tag_t encoded_tag
 ) -> ystdlib::error_handling::Result<EncodedTextAst<eight_byte_encoded_variable_t>>;
 
+template auto deserialize_encoded_text_ast<four_byte_encoded_variable_t>(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        std::vector<four_byte_encoded_variable_t> encoded_vars,
+        StringBlob string_blob
+) -> ystdlib::error_handling::Result<EncodedTextAst<four_byte_encoded_variable_t>>;
+
+template auto deserialize_encoded_text_ast<eight_byte_encoded_variable_t>(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        std::vector<eight_byte_encoded_variable_t> encoded_vars,
+        StringBlob string_blob
+) -> ystdlib::error_handling::Result<EncodedTextAst<eight_byte_encoded_variable_t>>;
+
 template auto deserialize_timestamp_or_timestamp_delta<four_byte_encoded_variable_t>(
         ReaderInterface& reader,
         encoded_tag_t encoded_tag
@@ -12,6 +12,7 @@
 #include "../../time_types.hpp"
 #include "../EncodedTextAst.hpp"
 #include "../encoding_methods.hpp"
+#include "../StringBlob.hpp"
 
 namespace clp::ffi::ir_stream {
 using encoded_tag_t = int8_t;
@@ -175,6 +176,30 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
 [[nodiscard]] auto deserialize_encoded_text_ast(ReaderInterface& reader, encoded_tag_t encoded_tag)
         -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>>;
 
+/**
+ * Deserializes an encoded text AST from the given reader into the given buffers, which may be
+ * recycled from a previously deserialized encoded text AST (see `EncodedTextAst::release_buffers`)
+ * to avoid reallocating them.
+ * @tparam encoded_variable_t
+ * @param reader
+ * @param encoded_tag
+ * @param encoded_vars An empty buffer for the encoded variables.
+ * @param string_blob An empty string blob for the dictionary variables and the logtype.
+ * @return A result containing the deserialized encoded text AST on success, or an error code
+ * indicating the failure:
+ * - Forwards `deserialize_int`'s return values on failure.
+ * - Forwards `deserialize_and_append_dict_var`'s return values on failure.
+ * - Forwards `deserialize_and_append_logtype`'s return values on failure.
+ * - Forwards `deserialize_tag`'s return values on failure.
+ */
+template <ir::EncodedVariableTypeReq encoded_variable_t>
+[[nodiscard]] auto deserialize_encoded_text_ast(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        std::vector<encoded_variable_t> encoded_vars,
+        StringBlob string_blob
+) -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>>;
+
 /**
  * Decodes the IR message calls the given methods to handle each component of the message
  * @tparam unescape_logtype Whether to remove the escape characters from the logtype before calling
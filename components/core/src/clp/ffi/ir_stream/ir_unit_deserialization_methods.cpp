@@ -6,6 +6,7 @@
 #include <optional>
 #include <string>
 #include <system_error>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -17,8 +18,10 @@
 #include "../../ReaderInterface.hpp"
 #include "../../time_types.hpp"
 #include "../../type_utils.hpp"
+#include "../EncodedTextAst.hpp"
 #include "../KeyValuePairLogEvent.hpp"
 #include "../SchemaTree.hpp"
+#include "../StringBlob.hpp"
 #include "../Value.hpp"
 #include "decoding_methods.hpp"
 #include "IrDeserializationError.hpp"
@@ -28,11 +31,6 @@
 
 namespace clp::ffi::ir_stream {
 namespace {
-/**
- * A collection of schema tree leaf node IDs. It represents the schema of a `KeyValuePairLogEvent`.
- */
-using Schema = std::vector<SchemaTree::Node::id_t>;
-
 /**
  * @param tag
  * @return A result containing the corresponding schema tree node type on success, or an error code
@@ -99,82 +97,76 @@ deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& dese
 
 /**
  * Deserializes the auto-generated node-ID-value pairs and the IDs of all user-generated keys in a
- * log event.
+ * log event. The values of the user-generated pairs are left to be deserialized by
+ * `deserialize_user_gen_values`.
  * @param reader
  * @param tag Takes the current tag as input and returns the last tag read.
- * @return A result containing a pair or an error code indicating the failure:
- * - The pair:
- *   - The auto-generated node-ID-value pairs.
- *   - The IDs of all user-generated keys.
- * - The possible error codes:
- *   - IrDeserializationErrorEnum::InvalidKeyGroupOrdering if the IR stream contains auto-generated
- *     key IDs *after* a user-generated key ID has been deserialized.
- *   - Forwards `deserialize_tag`'s return values on failure.
- *   - Forwards `deserialize_and_decode_schema_tree_node_id`'s return values on failure.
+ * @param auto_gen_node_id_value_pairs Returns the auto-generated node-ID-value pairs.
+ * @param user_gen_node_id_value_pairs Returns a pair for every user-generated key, in the order
+ * that the keys appear in the stream, with an unspecified value.
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::InvalidKeyGroupOrdering if the IR stream contains auto-generated
+ *   key IDs *after* a user-generated key ID has been deserialized.
+ * - IrDeserializationErrorEnum::DuplicateKey if a user-generated key is duplicated in the log
+ *   event.
+ * - Forwards `deserialize_tag`'s return values on failure.
+ * - Forwards `deserialize_and_decode_schema_tree_node_id`'s return values on failure.
+ * - Forwards `deserialize_value`'s return values on failure.
  */
-[[nodiscard]] auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
+[[nodiscard]] auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_node_ids(
         ReaderInterface& reader,
-        encoded_tag_t& tag
-) -> ystdlib::error_handling::Result<std::pair<KeyValuePairLogEvent::NodeIdValuePairs, Schema>>;
+        encoded_tag_t& tag,
+        KeyValuePairLogEvent::NodeIdValuePairs& auto_gen_node_id_value_pairs,
+        KeyValuePairLogEvent::NodeIdValuePairs& user_gen_node_id_value_pairs
+) -> ystdlib::error_handling::Result<void>;
 
 /**
- * Deserializes the next value and pushes the result into `node_id_value_pairs`.
+ * Deserializes the next value into `value`, reusing any buffers owned by its current value.
  * @param reader
  * @param tag
- * @param node_id The node ID that corresponds to the value.
- * @param node_id_value_pairs Returns the ID-value pair constructed from the deserialized value.
+ * @param value Returns the deserialized value.
  * @return A void result on success, or an error code indicating the failure:
  * - IrDeserializationErrorEnum::IncompleteStream if the stream is truncated.
  * - IrDeserializationErrorEnum::UnknownValueType if the tag doesn't correspond to any known value
  *   type.
- * - Forwards `deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs`'s return values on
- *   failure.
+ * - Forwards `deserialize_encoded_text_ast_value`'s return values on failure.
  * - Forwards `deserialize_int`'s return values on failure.
  * - Forwards `deserialize_int_val`'s return values on failure.
  * - Forwards `deserialize_string`'s return values on failure.
  */
-[[nodiscard]] auto deserialize_value_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
-        encoded_tag_t tag,
-        SchemaTree::Node::id_t node_id,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
-) -> ystdlib::error_handling::Result<void>;
+[[nodiscard]] auto
+deserialize_value(ReaderInterface& reader, encoded_tag_t tag, std::optional<Value>& value)
+        -> ystdlib::error_handling::Result<void>;
 
 /**
- * Deserializes an encoded text AST and pushes the result into node_id_value_pairs.
+ * Deserializes an encoded text AST into `value`, reusing the buffers of its current value if it's
+ * an encoded text AST of the same type.
  * @tparam encoded_variable_t
  * @param reader
- * @param node_id The node ID that corresponds to the value.
- * @param node_id_value_pairs Returns the ID-value pair constructed by the deserialized encoded text
- * AST.
+ * @param value Returns the deserialized encoded text AST.
  * @return A void result on success, or an error code indicating the failure:
  * - Forwards `deserialize_tag`'s return values on failure.
  * - Forwards `deserialize_encoded_text_ast`'s return values on failure.
  */
 template <ir::EncodedVariableTypeReq encoded_variable_t>
-[[nodiscard]] auto deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
-        SchemaTree::Node::id_t node_id,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
-) -> ystdlib::error_handling::Result<void>;
+[[nodiscard]] auto
+deserialize_encoded_text_ast_value(ReaderInterface& reader, std::optional<Value>& value)
+        -> ystdlib::error_handling::Result<void>;
 
 /**
- * Deserializes values and constructs ID-value pairs according to the given schema. The number of
- * values to deserialize is indicated by the size of the given schema.
+ * Deserializes the values of the given user-generated node-ID-value pairs, in insertion order.
  * @param reader
  * @param tag
- * @param schema The log event's schema.
- * @param node_id_value_pairs Returns the constructed ID-value pairs.
+ * @param user_gen_node_id_value_pairs The pairs returned by
+ * `deserialize_auto_gen_node_id_value_pairs_and_user_gen_node_ids`, whose values are assigned.
  * @return A void result on success, or an error code indicating the failure:
- * - IrDeserializationErrorEnum::DuplicateKey if a key is duplicated in the deserialized log event.
  * - Forwards `deserialize_tag`'s return values on failure.
- * - Forwards `deserialize_value_and_insert_to_node_id_value_pairs`'s return values on failure.
+ * - Forwards `deserialize_value`'s return values on failure.
  */
-[[nodiscard]] auto deserialize_value_and_construct_node_id_value_pairs(
+[[nodiscard]] auto deserialize_user_gen_values(
         ReaderInterface& reader,
         encoded_tag_t tag,
-        Schema const& schema,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
+        KeyValuePairLogEvent::NodeIdValuePairs& user_gen_node_id_value_pairs
 ) -> ystdlib::error_handling::Result<void>;
 
 /**
@@ -268,12 +260,14 @@ auto deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string&
     return ystdlib::error_handling::success();
 }
 
-auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
+auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_node_ids(
         ReaderInterface& reader,
-        encoded_tag_t& tag
-) -> ystdlib::error_handling::Result<std::pair<KeyValuePairLogEvent::NodeIdValuePairs, Schema>> {
-    KeyValuePairLogEvent::NodeIdValuePairs auto_gen_node_id_value_pairs;
-    Schema user_gen_schema;
+        encoded_tag_t& tag,
+        KeyValuePairLogEvent::NodeIdValuePairs& auto_gen_node_id_value_pairs,
+        KeyValuePairLogEvent::NodeIdValuePairs& user_gen_node_id_value_pairs
+) -> ystdlib::error_handling::Result<void> {
+    auto_gen_node_id_value_pairs.clear();
+    user_gen_node_id_value_pairs.clear();
 
     // Deserialize pairs of auto-generated node IDs and values
     while (true) {
@@ -298,16 +292,16 @@ auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
         if (false == is_auto_generated) {
             // User-generated node ID has been deserialized, so save the node ID and terminate
             // auto-generated node-ID-value pair deserialization.
-            user_gen_schema.push_back(node_id);
+            std::ignore = user_gen_node_id_value_pairs.try_emplace_recycled(node_id);
             break;
         }
 
-        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_insert_to_node_id_value_pairs(
-                reader,
-                tag,
-                node_id,
-                auto_gen_node_id_value_pairs
-        ));
+        // If the node ID is duplicated, the first value is kept and this one is discarded
+        std::optional<Value> discarded_value;
+        auto* value{auto_gen_node_id_value_pairs.try_emplace_recycled(node_id)};
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                deserialize_value(reader, tag, nullptr != value ? *value : discarded_value)
+        );
         tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
     }
 
@@ -325,73 +319,75 @@ auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
         if (is_auto_generated) {
             return IrDeserializationError{IrDeserializationErrorEnum::InvalidKeyGroupOrdering};
         }
-        user_gen_schema.push_back(node_id);
+        if (nullptr == user_gen_node_id_value_pairs.try_emplace_recycled(node_id)) {
+            // The key should be unique in a schema
+            return IrDeserializationError{IrDeserializationErrorEnum::DuplicateKey};
+        }
 
         tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
     }
 
-    return {std::move(auto_gen_node_id_value_pairs), std::move(user_gen_schema)};
+    return ystdlib::error_handling::success();
 }
 
-auto deserialize_value_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
-        encoded_tag_t tag,
-        SchemaTree::Node::id_t node_id,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
-) -> ystdlib::error_handling::Result<void> {
+auto deserialize_value(ReaderInterface& reader, encoded_tag_t tag, std::optional<Value>& value)
+        -> ystdlib::error_handling::Result<void> {
     switch (tag) {
         case cProtocol::Payload::ValueInt8:
         case cProtocol::Payload::ValueInt16:
         case cProtocol::Payload::ValueInt32:
         case cProtocol::Payload::ValueInt64: {
-            auto const value_int{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int_val(reader, tag))};
-            node_id_value_pairs.emplace(node_id, Value{value_int});
+            value.emplace(YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int_val(reader, tag)));
             break;
         }
         case cProtocol::Payload::ValueFloat: {
-            node_id_value_pairs.emplace(
-                    node_id,
-                    Value{bit_cast<value_float_t>(
-                            YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int<uint64_t>(reader))
-                    )}
-            );
+            value.emplace(bit_cast<value_float_t>(
+                    YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int<uint64_t>(reader))
+            ));
             break;
         }
         case cProtocol::Payload::ValueTrue:
-            node_id_value_pairs.emplace(node_id, Value{true});
+            value.emplace(true);
             break;
         case cProtocol::Payload::ValueFalse:
-            node_id_value_pairs.emplace(node_id, Value{false});
+            value.emplace(false);
             break;
         case cProtocol::Payload::StrLenUByte:
         case cProtocol::Payload::StrLenUShort:
         case cProtocol::Payload::StrLenUInt: {
             std::string value_str;
+            if (value.has_value()) {
+                if (auto released_str{value->release<std::string>()}; released_str.has_value()) {
+                    value_str = std::move(released_str.value());
+                }
+            }
             YSTDLIB_ERROR_HANDLING_TRYV(deserialize_string(reader, tag, value_str));
-            node_id_value_pairs.emplace(node_id, Value{std::move(value_str)});
+            value.emplace(std::move(value_str));
             break;
         }
         case cProtocol::Payload::ValueEightByteEncodingClpStr: {
             YSTDLIB_ERROR_HANDLING_TRYV(
-                    deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs<
-                            ir::eight_byte_encoded_variable_t
-                    >(reader, node_id, node_id_value_pairs)
+                    deserialize_encoded_text_ast_value<ir::eight_byte_encoded_variable_t>(
+                            reader,
+                            value
+                    )
             );
             break;
         }
         case cProtocol::Payload::ValueFourByteEncodingClpStr: {
             YSTDLIB_ERROR_HANDLING_TRYV(
-                    deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs<
-                            ir::four_byte_encoded_variable_t
-                    >(reader, node_id, node_id_value_pairs)
+                    deserialize_encoded_text_ast_value<ir::four_byte_encoded_variable_t>(
+                            reader,
+                            value
+                    )
             );
             break;
         }
         case cProtocol::Payload::ValueNull:
-            node_id_value_pairs.emplace(node_id, Value{});
+            value.emplace();
             break;
         case cProtocol::Payload::ValueEmpty:
-            node_id_value_pairs.emplace(node_id, std::nullopt);
+            value.reset();
             break;
         default:
             return IrDeserializationError{IrDeserializationErrorEnum::UnknownValueType};
@@ -400,43 +396,39 @@ auto deserialize_value_and_insert_to_node_id_value_pairs(
 }
 
 template <ir::EncodedVariableTypeReq encoded_variable_t>
-[[nodiscard]] auto deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
-        SchemaTree::Node::id_t node_id,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
-) -> ystdlib::error_handling::Result<void> {
+auto deserialize_encoded_text_ast_value(ReaderInterface& reader, std::optional<Value>& value)
+        -> ystdlib::error_handling::Result<void> {
+    std::vector<encoded_variable_t> encoded_vars;
+    StringBlob string_blob;
+    if (value.has_value()) {
+        if (auto released_encoded_text_ast{value->release<EncodedTextAst<encoded_variable_t>>()};
+            released_encoded_text_ast.has_value())
+        {
+            std::tie(encoded_vars, string_blob)
+                    = std::move(released_encoded_text_ast.value()).release_buffers();
+        }
+    }
     auto const tag{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader))};
-    node_id_value_pairs.emplace(
-            node_id,
-            Value{YSTDLIB_ERROR_HANDLING_TRYX(
-                    deserialize_encoded_text_ast<encoded_variable_t>(reader, tag)
-            )}
-    );
+    value.emplace(YSTDLIB_ERROR_HANDLING_TRYX(deserialize_encoded_text_ast<encoded_variable_t>(
+            reader,
+            tag,
+            std::move(encoded_vars),
+            std::move(string_blob)
+    )));
     return ystdlib::error_handling::success();
 }
 
-auto deserialize_value_and_construct_node_id_value_pairs(
+auto deserialize_user_gen_values(
         ReaderInterface& reader,
         encoded_tag_t tag,
-        Schema const& schema,
-        KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
+        KeyValuePairLogEvent::NodeIdValuePairs& user_gen_node_id_value_pairs
 ) -> ystdlib::error_handling::Result<void> {
-    node_id_value_pairs.clear();
-    node_id_value_pairs.reserve(schema.size());
-    for (auto const node_id : schema) {
-        if (node_id_value_pairs.contains(node_id)) {
-            // The key should be unique in a schema
-            return IrDeserializationError{IrDeserializationErrorEnum::DuplicateKey};
-        }
-
-        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_insert_to_node_id_value_pairs(
-                reader,
-                tag,
-                node_id,
-                node_id_value_pairs
-        ));
-
-        if (schema.size() != node_id_value_pairs.size()) {
+    auto const num_values{user_gen_node_id_value_pairs.size()};
+    for (size_t value_idx{0}; value_idx < num_values; ++value_idx) {
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                deserialize_value(reader, tag, user_gen_node_id_value_pairs.get_value_at(value_idx))
+        );
+        if (value_idx + 1 != num_values) {
             tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
         }
     }
@@ -510,25 +502,23 @@ auto deserialize_ir_unit_kv_pair_log_event(
         encoded_tag_t tag,
         std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
         std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
-        UtcOffset utc_offset
+        UtcOffset utc_offset,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
 ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
-    auto auto_gen_node_id_value_pairs_and_user_gen_schema_result{
-            deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(reader, tag)
-    };
-    if (auto_gen_node_id_value_pairs_and_user_gen_schema_result.has_error()) {
-        return auto_gen_node_id_value_pairs_and_user_gen_schema_result.error();
-    }
-    auto& [auto_gen_node_id_value_pairs,
-           user_gen_schema]{auto_gen_node_id_value_pairs_and_user_gen_schema_result.value()};
-
-    KeyValuePairLogEvent::NodeIdValuePairs user_gen_node_id_value_pairs;
-    if (false == user_gen_schema.empty()) {
-        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_construct_node_id_value_pairs(
-                reader,
-                tag,
-                user_gen_schema,
-                user_gen_node_id_value_pairs
-        ));
+    auto auto_gen_node_id_value_pairs{std::move(recycled_auto_gen_node_id_value_pairs)};
+    auto user_gen_node_id_value_pairs{std::move(recycled_user_gen_node_id_value_pairs)};
+    YSTDLIB_ERROR_HANDLING_TRYV(deserialize_auto_gen_node_id_value_pairs_and_user_gen_node_ids(
+            reader,
+            tag,
+            auto_gen_node_id_value_pairs,
+            user_gen_node_id_value_pairs
+    ));
+
+    if (false == user_gen_node_id_value_pairs.empty()) {
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                deserialize_user_gen_values(reader, tag, user_gen_node_id_value_pairs)
+        );
     } else {
         if (cProtocol::Payload::ValueEmpty != tag) {
             return IrDeserializationError{IrDeserializationErrorEnum::InvalidTag};
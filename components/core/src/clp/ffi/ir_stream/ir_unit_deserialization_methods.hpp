@@ -55,12 +55,17 @@ namespace clp::ffi::ir_stream {
  * @param user_gen_keys_schema_tree Schema tree for user-generated keys, used to construct the
  * KV-pair log event.
  * @param utc_offset UTC offset used to construct the KV-pair log event.
+ * @param recycled_auto_gen_node_id_value_pairs Node-ID-value pairs whose storage is reused for the
+ * log event's auto-generated pairs (e.g., those released from a previously deserialized log event
+ * via `KeyValuePairLogEvent::release_node_id_value_pairs`).
+ * @param recycled_user_gen_node_id_value_pairs Node-ID-value pairs whose storage is reused for the
+ * log event's user-generated pairs.
  * @return A result containing the deserialized log event or an error code indicating the failure:
  * - IrDeserializationErrorEnum::InvalidTag if the log event is empty but the tag is not
  *   `cProtocol::Payload::ValueEmpty`.
- * - Forwards `deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema`'s return values on
+ * - Forwards `deserialize_auto_gen_node_id_value_pairs_and_user_gen_node_ids`'s return values on
  *   failure.
- * - Forwards `deserialize_value_and_construct_node_id_value_pairs`'s return values on failure.
+ * - Forwards `deserialize_user_gen_values`'s return values on failure.
  * - Forwards `KeyValuePairLogEvent::create`'s return values on failure.
  */
 [[nodiscard]] auto deserialize_ir_unit_kv_pair_log_event(
@@ -68,7 +73,9 @@ namespace clp::ffi::ir_stream {
         encoded_tag_t tag,
         std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
         std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
-        UtcOffset utc_offset
+        UtcOffset utc_offset,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_auto_gen_node_id_value_pairs,
+        KeyValuePairLogEvent::NodeIdValuePairs recycled_user_gen_node_id_value_pairs
 ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
 }  // namespace clp::ffi::ir_stream
 
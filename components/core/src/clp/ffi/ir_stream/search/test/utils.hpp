@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <set>
 #include <string>
@@ -16,6 +17,7 @@
 #include <ystdlib/error_handling/Result.hpp>
 
 #include "../../../../../clp_s/search/ast/Literal.hpp"
+#include "../../../../ir/types.hpp"
 #include "../../../../type_utils.hpp"
 #include "../../../SchemaTree.hpp"
 #include "../../IrSerializationError.hpp"
@@ -101,6 +103,7 @@ private:
  * @param auto_gen_msgpack_bytes
  * @param user_gen_msgpack_bytes
  * @param serializer
+ * @param timestamp
  * @return A void result on success, or an error code indicating the failure:
  * - IrSerializationErrorEnum::KeyValuePairSerializationFailure if the msgpack bytes cannot be
  *   deserialized into a map.
@@ -110,14 +113,16 @@ template <typename encoded_variable_t>
 [[nodiscard]] auto unpack_and_serialize_msgpack_bytes(
         std::vector<uint8_t> const& auto_gen_msgpack_bytes,
         std::vector<uint8_t> const& user_gen_msgpack_bytes,
-        Serializer<encoded_variable_t>& serializer
+        Serializer<encoded_variable_t>& serializer,
+        std::optional<ir::epoch_time_ms_t> timestamp = std::nullopt
 ) -> ystdlib::error_handling::Result<void>;
 
 template <typename encoded_variable_t>
 auto unpack_and_serialize_msgpack_bytes(
         std::vector<uint8_t> const& auto_gen_msgpack_bytes,
         std::vector<uint8_t> const& user_gen_msgpack_bytes,
-        Serializer<encoded_variable_t>& serializer
+        Serializer<encoded_variable_t>& serializer,
+        std::optional<ir::epoch_time_ms_t> timestamp
 ) -> ystdlib::error_handling::Result<void> {
     // NOLINTNEXTLINE(misc-include-cleaner)
     auto const auto_gen_msgpack_byte_handle{msgpack::unpack(
@@ -148,7 +153,8 @@ auto unpack_and_serialize_msgpack_bytes(
     // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
     return serializer.serialize_msgpack_map(
             auto_gen_msgpack_obj.via.map,
-            user_gen_msgpack_obj.via.map
+            user_gen_msgpack_obj.via.map,
+            timestamp
     );
     // NOLINTEND(cppcoreguidelines-pro-type-union-access)
 }
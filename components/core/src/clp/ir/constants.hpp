@@ -5,6 +5,8 @@
 
 namespace clp::ir {
 constexpr std::string_view cIrFileExtension{".clp.zst"};
+// The extension appended to an IR file's path to get the path of its checkpoint index.
+constexpr std::string_view cIrStreamIndexFileExtension{".idx"};
 }  // namespace clp::ir
 
 #endif  // CLP_IR_CONSTANTS_HPP
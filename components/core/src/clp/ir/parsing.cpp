@@ -4,8 +4,6 @@
 #include <string>
 #include <string_view>
 
-#include <string_utils/string_utils.hpp>
-
 #include "../type_utils.hpp"
 #include "types.hpp"
 
@@ -45,8 +43,7 @@ bool get_bounds_of_next_var(string_view const str, size_t& begin_pos, size_t& en
 
         // Find next non-delimiter
         for (; begin_pos < msg_length; ++begin_pos) {
-            auto c = str[begin_pos];
-            if (false == is_delim(c)) {
+            if (0 != (get_char_classes(str[begin_pos]) & cNonDelimCharClass)) {
                 break;
             }
         }
@@ -55,21 +52,18 @@ bool get_bounds_of_next_var(string_view const str, size_t& begin_pos, size_t& en
             return false;
         }
 
-        bool contains_decimal_digit = false;
-        bool contains_alphabet = false;
-
-        // Find next delimiter
+        // Find next delimiter, accumulating the classes of the token's characters
+        uint8_t token_char_classes{0};
         end_pos = begin_pos;
         for (; end_pos < msg_length; ++end_pos) {
-            auto c = str[end_pos];
-            if (string_utils::is_decimal_digit(c)) {
-                contains_decimal_digit = true;
-            } else if (string_utils::is_alphabet(c)) {
-                contains_alphabet = true;
-            } else if (is_delim(c)) {
+            auto const char_classes = get_char_classes(str[end_pos]);
+            if (0 == (char_classes & cNonDelimCharClass)) {
                 break;
             }
+            token_char_classes |= char_classes;
         }
+        bool const contains_decimal_digit = 0 != (token_char_classes & cDecimalDigitCharClass);
+        bool const contains_alphabet = 0 != (token_char_classes & cAlphabetCharClass);
 
         auto variable = str.substr(begin_pos, end_pos - begin_pos);
         // Treat token as variable if:
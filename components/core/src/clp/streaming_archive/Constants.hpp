@@ -10,6 +10,8 @@ constexpr char cLogTypeDictFilename[] = "logtype.dict";
 constexpr char cVarDictFilename[] = "var.dict";
 constexpr char cLogTypeSegmentIndexFilename[] = "logtype.segindex";
 constexpr char cVarSegmentIndexFilename[] = "var.segindex";
+constexpr char cLogTypeDictTrigramIndexFilename[] = "logtype.dict.trigrams";
+constexpr char cVarDictTrigramIndexFilename[] = "var.dict.trigrams";
 constexpr char cMetadataFileName[] = "metadata";
 constexpr char cMetadataDBFileName[] = "metadata.db";
 constexpr char cSchemaFileName[] = "schema.txt";
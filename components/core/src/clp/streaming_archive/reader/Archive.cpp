@@ -97,6 +97,19 @@ void Archive::open(string const& path) {
     var_segment_index_path += cVarSegmentIndexFilename;
     m_var_dictionary.open(var_dict_path, var_segment_index_path);
 
+    // Load the dictionaries' trigram indexes if the archive has them. Wildcard searches fall back
+    // to scanning every dictionary entry otherwise.
+    auto const logtype_dict_trigram_index_path
+            = boost::filesystem::path(path) / cLogTypeDictTrigramIndexFilename;
+    if (boost::filesystem::exists(logtype_dict_trigram_index_path)) {
+        m_logtype_dictionary.load_trigram_index(logtype_dict_trigram_index_path.string());
+    }
+    auto const var_dict_trigram_index_path
+            = boost::filesystem::path(path) / cVarDictTrigramIndexFilename;
+    if (boost::filesystem::exists(var_dict_trigram_index_path)) {
+        m_var_dictionary.load_trigram_index(var_dict_trigram_index_path.string());
+    }
+
     // Open segment manager
     m_segments_dir_path = m_path;
     m_segments_dir_path += '/';
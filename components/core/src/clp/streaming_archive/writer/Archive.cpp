@@ -4,6 +4,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <system_error>
@@ -23,6 +24,7 @@
 #include <clp/EncodedVariableInterpreter.hpp>
 #include <clp/ir/LogEvent.hpp>
 #include <clp/ir/types.hpp>
+#include <clp/RuntimeMetrics.hpp>
 #include <clp/streaming_archive/Constants.hpp>
 #include <clp/streaming_archive/writer/utils.hpp>
 #include <clp/TimestampPattern.hpp>
@@ -158,6 +160,7 @@ void Archive::open(UserConfig const& user_config) {
     }
 
     m_global_metadata_db = user_config.global_metadata_db;
+    m_global_metadata_db_mutex = user_config.global_metadata_db_mutex;
 
     m_file = nullptr;
 
@@ -173,6 +176,13 @@ void Archive::open(UserConfig const& user_config) {
     string var_dict_segment_index_path = archive_path_string + '/' + cVarSegmentIndexFilename;
     m_var_dict.open(var_dict_path, var_dict_segment_index_path, cVariableDictionaryIdMax);
 
+    if (user_config.build_dictionary_trigram_indexes) {
+        m_logtype_dict.enable_trigram_index(
+                archive_path_string + '/' + cLogTypeDictTrigramIndexFilename
+        );
+        m_var_dict.enable_trigram_index(archive_path_string + '/' + cVarDictTrigramIndexFilename);
+    }
+
 #if FLUSH_TO_DISK_ENABLED
     // fsync archive directory now that everything in the archive directory has been created
     if (fsync(archive_dir_fd) != 0) {
@@ -238,6 +248,7 @@ void Archive::close() {
 
     update_global_metadata();
     m_global_metadata_db = nullptr;
+    m_global_metadata_db_mutex = nullptr;
 
     for (auto* file : m_file_metadata_for_global_update) {
         delete file;
@@ -299,6 +310,9 @@ void Archive::change_ts_pattern(TimestampPattern const* pattern) {
 
 void
 Archive::write_msg(epochtime_t timestamp, string const& message, size_t num_uncompressed_bytes) {
+    RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::Encode};
+    timer.add_bytes(num_uncompressed_bytes);
+
     // Encode message and add components to dictionaries
     vector<encoded_variable_t> encoded_vars;
     vector<variable_dictionary_id_t> var_ids;
@@ -433,22 +447,26 @@ auto Archive::add_token_to_dicts(log_surgeon::LogEventView const& event, log_sur
 }
 
 auto Archive::write_msg_using_schema(log_surgeon::LogEventView const& event) -> void {
+    RuntimeMetrics::ScopedTimer const timer{RuntimeMetrics::Stage::Encode};
     epochtime_t timestamp{0};
     TimestampPattern const* timestamp_pattern{nullptr};
     auto const& log_buf{event.get_log_output_buffer()};
     if (log_buf->has_header()) {
         size_t start{};
         size_t end{};
-        timestamp_pattern = TimestampPattern::search_known_ts_patterns(
-                log_buf->get_mutable_token(0).to_string(),
-                timestamp,
-                start,
-                end
-        );
+        auto const header{log_buf->get_mutable_token(0).to_string()};
+        // Consecutive events usually share a timestamp pattern, so try the previous one first
+        if (nullptr != m_old_ts_pattern
+            && m_old_ts_pattern->parse_timestamp(header, timestamp, start, end))
+        {
+            timestamp_pattern = m_old_ts_pattern;
+        } else {
+            timestamp_pattern
+                    = TimestampPattern::search_known_ts_patterns(header, timestamp, start, end);
+        }
         if (nullptr == timestamp_pattern) {
             throw(std::runtime_error(
-                    "Schema contains a timestamp regex that matches "
-                    + log_buf->get_mutable_token(0).to_string()
+                    "Schema contains a timestamp regex that matches " + header
                     + " which does not match any known timestamp pattern."
             ));
         }
@@ -717,6 +735,10 @@ void Archive::update_local_metadata() {
 }
 
 auto Archive::update_global_metadata() -> void {
+    std::unique_lock<std::mutex> global_metadata_db_lock;
+    if (nullptr != m_global_metadata_db_mutex) {
+        global_metadata_db_lock = std::unique_lock<std::mutex>{*m_global_metadata_db_mutex};
+    }
     m_global_metadata_db->open();
     if (false == m_local_metadata.has_value()) {
         throw OperationFailed(ErrorCode_Failure, __FILENAME__, __LINE__);
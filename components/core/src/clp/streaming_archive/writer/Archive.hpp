@@ -3,6 +3,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -36,8 +37,12 @@ public:
      * @param compression_level Compression level of the compressor being opened
      * @param output_dir Output directory
      * @param global_metadata_db
+     * @param global_metadata_db_mutex Mutex to hold while updating the global metadata DB, if it's
+     * shared with archives being written by other threads
      * @param print_archive_stats_progress Enable printing statistics about the archive as it's
      * compressed
+     * @param build_dictionary_trigram_indexes Whether to store a trigram index over the archive's
+     * logtype and variable dictionaries, so that wildcard searches can skip non-matching entries
      */
     struct UserConfig {
         boost::uuids::uuid id;
@@ -47,7 +52,9 @@ public:
         int compression_level;
         std::string output_dir;
         GlobalMetadataDB* global_metadata_db;
+        std::mutex* global_metadata_db_mutex{nullptr};
         bool print_archive_stats_progress;
+        bool build_dictionary_trigram_indexes{false};
     };
 
     class OperationFailed : public TraceableException {
@@ -362,6 +369,7 @@ private:
     FileWriter m_metadata_file_writer;
 
     GlobalMetadataDB* m_global_metadata_db;
+    std::mutex* m_global_metadata_db_mutex{nullptr};
 
     bool m_print_archive_stats_progress;
 };
@@ -6,6 +6,7 @@
 #include <zstd.h>
 
 #include "../../ErrorCode.hpp"
+#include "../../RuntimeMetrics.hpp"
 #include "../../TraceableException.hpp"
 #include "../../WriterInterface.hpp"
 
@@ -69,6 +70,8 @@ auto Compressor::write(char const* data, size_t data_length) -> void {
         throw OperationFailed(ErrorCode_BadParam, __FILENAME__, __LINE__);
     }
 
+    RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::Compress};
+    timer.add_bytes(data_length);
     ZSTD_inBuffer uncompressed_stream_block = {data, data_length, 0};
     while (uncompressed_stream_block.pos < uncompressed_stream_block.size) {
         m_compressed_stream_block.pos = 0;
@@ -103,6 +106,7 @@ auto Compressor::flush() -> void {
         return;
     }
 
+    RuntimeMetrics::ScopedTimer const timer{RuntimeMetrics::Stage::Compress};
     m_compressed_stream_block.pos = 0;
     auto const end_stream_result{ZSTD_endStream(m_compression_stream, &m_compressed_stream_block)};
     if (0 != ZSTD_isError(end_stream_result)) {
@@ -8,6 +8,7 @@
 #include "../../Defs.h"
 #include "../../ErrorCode.hpp"
 #include "../../ReadOnlyMemoryMappedFile.hpp"
+#include "../../RuntimeMetrics.hpp"
 #include "../../TraceableException.hpp"
 
 namespace clp::streaming_compression::zstd {
@@ -36,6 +37,7 @@ auto Decompressor::try_read(char* buf, size_t num_bytes_to_read, size_t& num_byt
 
     num_bytes_read = 0;
 
+    RuntimeMetrics::ScopedTimer timer{RuntimeMetrics::Stage::Decompress};
     ZSTD_outBuffer decompressed_stream_block{buf, num_bytes_to_read, 0};
     while (decompressed_stream_block.pos < num_bytes_to_read) {
         if (m_compressed_stream_block.pos == m_compressed_stream_block.size
@@ -45,6 +47,7 @@ auto Decompressor::try_read(char* buf, size_t num_bytes_to_read, size_t& num_byt
             if (ErrorCode_Success != error_code) {
                 m_decompressed_stream_pos += decompressed_stream_block.pos;
                 num_bytes_read = decompressed_stream_block.pos;
+                timer.add_bytes(num_bytes_read);
 
                 if (ErrorCode_EndOfFile == error_code && decompressed_stream_block.pos > 0) {
                     return ErrorCode_Success;
@@ -72,6 +75,7 @@ auto Decompressor::try_read(char* buf, size_t num_bytes_to_read, size_t& num_byt
 
     m_decompressed_stream_pos += decompressed_stream_block.pos;
     num_bytes_read = decompressed_stream_block.pos;
+    timer.add_bytes(num_bytes_read);
 
     return ErrorCode_Success;
 }
@@ -3,6 +3,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -15,12 +17,20 @@
 #include <clp/type_utils.hpp>
 #include <clp_s/archive_constants.hpp>
 #include <clp_s/ArchiveReaderAdaptor.hpp>
+#include <clp_s/ColumnValueRange.hpp>
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/ErrorCode.hpp>
+#include <clp_s/filter/FilterReader.hpp>
 #include <clp_s/InputConfig.hpp>
 #include <clp_s/ReaderUtils.hpp>
 
 namespace clp_s {
+namespace {
+// Bounds the memory used to prefetch tables while still letting decompression run ahead of the
+// table currently being processed.
+constexpr size_t cMaxNumPrefetchedStreams{2};
+}  // namespace
+
 void ArchiveReader::open(Path const& archive_path, NetworkAuthOption const& network_auth) {
     if (m_is_open) {
         throw OperationFailed(ErrorCodeNotReady, __FILENAME__, __LINE__);
@@ -186,6 +196,118 @@ auto ArchiveReader::read_metadata() -> ystdlib::error_handling::Result<void> {
     return ystdlib::error_handling::success();
 }
 
+auto ArchiveReader::read_variable_dictionary_filter() -> std::optional<filter::FilterReader> {
+    if (false == m_archive_reader_adaptor->has_section(constants::cArchiveVarDictFilterFile)) {
+        return std::nullopt;
+    }
+
+    auto filter_reader{m_archive_reader_adaptor->checkout_reader_for_section(
+            constants::cArchiveVarDictFilterFile
+    )};
+    auto filter_result{filter::FilterReader::try_read(*filter_reader)};
+    m_archive_reader_adaptor->checkin_reader_for_section(constants::cArchiveVarDictFilterFile);
+    if (filter_result.has_error()) {
+        // The filter is only an optimization, so searches fall back to reading the dictionary.
+        SPDLOG_WARN(
+                "Failed to read variable dictionary filter - {}",
+                filter_result.error().message()
+        );
+        return std::nullopt;
+    }
+    return std::move(filter_result.value());
+}
+
+void ArchiveReader::read_zone_maps() {
+    if (false == m_archive_reader_adaptor->has_section(constants::cArchiveTableZoneMapsFile)) {
+        return;
+    }
+
+    constexpr size_t cDecompressorFileReadBufferCapacity{64 * 1024};  // 64 KiB
+    auto zone_maps_reader{m_archive_reader_adaptor->checkout_reader_for_section(
+            constants::cArchiveTableZoneMapsFile
+    )};
+    ZstdDecompressor decompressor;
+    decompressor.open(*zone_maps_reader, cDecompressorFileReadBufferCapacity);
+    auto const error{try_read_zone_maps(decompressor)};
+    decompressor.close();
+    m_archive_reader_adaptor->checkin_reader_for_section(constants::cArchiveTableZoneMapsFile);
+    if (ErrorCodeSuccess != error) {
+        // Zone maps are only an optimization, so searches fall back to scanning every table.
+        SPDLOG_WARN("Failed to read schema table zone maps: {}", static_cast<int64_t>(error));
+        m_id_to_schema_zone_map.clear();
+    }
+}
+
+auto ArchiveReader::try_read_zone_maps(ZstdDecompressor& decompressor) -> ErrorCode {
+    uint64_t num_schemas{0};
+    if (auto const error{decompressor.try_read_numeric_value(num_schemas)};
+        ErrorCodeSuccess != error)
+    {
+        return error;
+    }
+    for (uint64_t i{0}; i < num_schemas; ++i) {
+        int32_t schema_id{0};
+        uint64_t num_columns{0};
+        if (auto const error{decompressor.try_read_numeric_value(schema_id)};
+            ErrorCodeSuccess != error)
+        {
+            return error;
+        }
+        if (auto const error{decompressor.try_read_numeric_value(num_columns)};
+            ErrorCodeSuccess != error)
+        {
+            return error;
+        }
+
+        auto& zone_map{m_id_to_schema_zone_map[schema_id]};
+        for (uint64_t j{0}; j < num_columns; ++j) {
+            int32_t column_id{0};
+            ColumnValueRangeType range_type{};
+            if (auto const error{decompressor.try_read_numeric_value(column_id)};
+                ErrorCodeSuccess != error)
+            {
+                return error;
+            }
+            if (auto const error{decompressor.try_read_numeric_value(range_type)};
+                ErrorCodeSuccess != error)
+            {
+                return error;
+            }
+
+            if (ColumnValueRangeType::Integer == range_type) {
+                ValueRange<int64_t> range{};
+                if (auto const error{decompressor.try_read_numeric_value(range.min)};
+                    ErrorCodeSuccess != error)
+                {
+                    return error;
+                }
+                if (auto const error{decompressor.try_read_numeric_value(range.max)};
+                    ErrorCodeSuccess != error)
+                {
+                    return error;
+                }
+                zone_map.emplace(column_id, range);
+            } else if (ColumnValueRangeType::Float == range_type) {
+                ValueRange<double> range{};
+                if (auto const error{decompressor.try_read_numeric_value(range.min)};
+                    ErrorCodeSuccess != error)
+                {
+                    return error;
+                }
+                if (auto const error{decompressor.try_read_numeric_value(range.max)};
+                    ErrorCodeSuccess != error)
+                {
+                    return error;
+                }
+                zone_map.emplace(column_id, range);
+            } else {
+                return ErrorCodeCorrupt;
+            }
+        }
+    }
+    return ErrorCodeSuccess;
+}
+
 void ArchiveReader::read_dictionaries_and_metadata() {
     if (auto const result{read_metadata()}; result.has_error()) {
         throw OperationFailed(ErrorCodeFailure, __FILENAME__, __LINE__);
@@ -199,6 +321,22 @@ void ArchiveReader::open_packed_streams() {
     m_stream_reader.open_packed_streams(m_archive_reader_adaptor);
 }
 
+void ArchiveReader::prefetch_schema_tables(std::span<int32_t const> schema_ids) {
+    std::vector<size_t> stream_ids;
+    for (auto const schema_id : schema_ids) {
+        auto const it{m_id_to_schema_metadata.find(schema_id)};
+        if (m_id_to_schema_metadata.end() == it) {
+            throw OperationFailed(ErrorCodeFileNotFound, __FILENAME__, __LINE__);
+        }
+        // Consecutive tables can share a stream, which only needs to be read once.
+        auto const stream_id{it->second.stream_id()};
+        if (stream_ids.empty() || stream_ids.back() != stream_id) {
+            stream_ids.push_back(stream_id);
+        }
+    }
+    m_stream_reader.prefetch_streams(std::move(stream_ids), cMaxNumPrefetchedStreams);
+}
+
 SchemaReader& ArchiveReader::read_schema_table(
         int32_t schema_id,
         bool should_extract_timestamp,
@@ -245,13 +383,14 @@ std::vector<std::shared_ptr<SchemaReader>> ArchiveReader::read_all_tables() {
 
 BaseColumnReader* ArchiveReader::append_reader_column(SchemaReader& reader, int32_t column_id) {
     BaseColumnReader* column_reader = nullptr;
+    auto const has_encoded_integers{has_encoded_integer_columns()};
     auto const& node = m_schema_tree->get_node(column_id);
     switch (node.get_type()) {
         case NodeType::Integer:
-            column_reader = new Int64ColumnReader(column_id);
+            column_reader = new Int64ColumnReader(column_id, has_encoded_integers);
             break;
         case NodeType::DeltaInteger:
-            column_reader = new DeltaEncodedInt64ColumnReader(column_id);
+            column_reader = new DeltaEncodedInt64ColumnReader(column_id, has_encoded_integers);
             break;
         case NodeType::Float:
             column_reader = new FloatColumnReader(column_id);
@@ -279,7 +418,11 @@ BaseColumnReader* ArchiveReader::append_reader_column(SchemaReader& reader, int3
                     = new DeprecatedDateStringColumnReader(column_id, get_timestamp_dictionary());
             break;
         case NodeType::Timestamp:
-            column_reader = new TimestampColumnReader(column_id, get_timestamp_dictionary());
+            column_reader = new TimestampColumnReader(
+                    column_id,
+                    get_timestamp_dictionary(),
+                    has_encoded_integers
+            );
             break;
         // No need to push columns without associated object readers into the SchemaReader.
         case NodeType::Metadata:
@@ -303,6 +446,7 @@ void ArchiveReader::append_unordered_reader_columns(
         bool should_marshal_records
 ) {
     size_t object_begin_pos = reader.get_column_size();
+    auto const has_encoded_integers{has_encoded_integer_columns()};
     for (int32_t column_id : schema_ids) {
         if (Schema::schema_entry_is_unordered_object(column_id)) {
             continue;
@@ -311,10 +455,10 @@ void ArchiveReader::append_unordered_reader_columns(
         auto const& node = m_schema_tree->get_node(column_id);
         switch (node.get_type()) {
             case NodeType::Integer:
-                column_reader = new Int64ColumnReader(column_id);
+                column_reader = new Int64ColumnReader(column_id, has_encoded_integers);
                 break;
             case NodeType::DeltaInteger:
-                column_reader = new DeltaEncodedInt64ColumnReader(column_id);
+                column_reader = new DeltaEncodedInt64ColumnReader(column_id, has_encoded_integers);
                 break;
             case NodeType::Float:
                 column_reader = new FloatColumnReader(column_id);
@@ -444,6 +588,7 @@ void ArchiveReader::close() {
     m_archive_reader_adaptor.reset();
 
     m_id_to_schema_metadata.clear();
+    m_id_to_schema_zone_map.clear();
     m_schema_ids.clear();
     m_cur_stream_id = 0;
     m_stream_buffer.reset();
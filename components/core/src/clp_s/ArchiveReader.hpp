@@ -2,8 +2,10 @@
 #define CLP_S_ARCHIVEREADER_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
@@ -14,8 +16,10 @@
 #include <ystdlib/error_handling/Result.hpp>
 
 #include <clp_s/ArchiveReaderAdaptor.hpp>
+#include <clp_s/ColumnValueRange.hpp>
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/DictionaryReader.hpp>
+#include <clp_s/filter/FilterReader.hpp>
 #include <clp_s/InputConfig.hpp>
 #include <clp_s/PackedStreamReader.hpp>
 #include <clp_s/ReaderUtils.hpp>
@@ -65,6 +69,37 @@ public:
      */
     void open_packed_streams();
 
+    /**
+     * Starts decompressing the tables with the given IDs in the background so that decompression
+     * overlaps with processing earlier tables. Must be called after `open_packed_streams` and
+     * before reading any table, and the tables must then be read in the given order.
+     * @param schema_ids The IDs of the tables that will be read, ordered as in `get_schema_ids`.
+     */
+    void prefetch_schema_tables(std::span<int32_t const> schema_ids);
+
+    /**
+     * Reads the filter over the values in the variable dictionary from the archive, if the archive
+     * has one. Must be called after `read_metadata` and before reading any dictionary.
+     * @return The filter, or std::nullopt if the archive doesn't have one or it couldn't be read.
+     */
+    [[nodiscard]] auto read_variable_dictionary_filter() -> std::optional<filter::FilterReader>;
+
+    /**
+     * Reads the zone map of every schema table from the archive, if the archive has them. Must be
+     * called after `read_metadata` and before reading any dictionary. Zone maps that can't be read
+     * are ignored, since they're only used to skip tables.
+     */
+    void read_zone_maps();
+
+    /**
+     * @param schema_id
+     * @return The zone map of the given schema table, or nullptr if it isn't available.
+     */
+    [[nodiscard]] auto get_zone_map(int32_t schema_id) const -> SchemaZoneMap const* {
+        auto const it{m_id_to_schema_zone_map.find(schema_id)};
+        return m_id_to_schema_zone_map.end() == it ? nullptr : &it->second;
+    }
+
     /**
      * Reads the variable dictionary from the archive.
      * @param lazy
@@ -192,6 +227,13 @@ public:
         return get_header().has_deprecated_timestamp_format();
     }
 
+    /**
+     * @return Whether integer columns in this archive are stored with an `IntegerEncoding`.
+     */
+    [[nodiscard]] auto has_encoded_integer_columns() const -> bool {
+        return get_header().has_encoded_integer_columns();
+    }
+
     /**
      * @param log_event_idx
      * @return The file-level metadata associated with the record at `log_event_idx`.
@@ -221,6 +263,13 @@ private:
     [[nodiscard]] auto read_single_schema_metadata()
             -> ystdlib::error_handling::Result<std::pair<int32_t, SchemaReader::SchemaMetadata>>;
 
+    /**
+     * Reads the zone maps of all schema tables from the zone map stream.
+     * @param decompressor
+     * @return ErrorCodeSuccess on success, or the error from the first failed read otherwise.
+     */
+    [[nodiscard]] auto try_read_zone_maps(ZstdDecompressor& decompressor) -> ErrorCode;
+
     /**
      * Initializes a schema reader passed by reference to become a reader for a given schema.
      * @param reader
@@ -282,6 +331,7 @@ private:
     std::shared_ptr<ReaderUtils::SchemaMap> m_schema_map;
     std::vector<int32_t> m_schema_ids;
     std::map<int32_t, SchemaReader::SchemaMetadata> m_id_to_schema_metadata;
+    std::map<int32_t, SchemaZoneMap> m_id_to_schema_zone_map;
     std::shared_ptr<search::Projection> m_projection{
             std::make_shared<search::Projection>(search::ProjectionMode::ReturnAllColumns)
     };
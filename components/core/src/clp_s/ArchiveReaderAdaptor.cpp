@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -17,6 +18,7 @@
 #include "../clp/BoundedReader.hpp"
 #include "../clp/ErrorCode.hpp"
 #include "../clp/FileReader.hpp"
+#include "../clp/HttpRangeReader.hpp"
 #include "archive_constants.hpp"
 #include "ErrorCode.hpp"
 #include "InputConfig.hpp"
@@ -288,10 +290,18 @@ std::shared_ptr<clp::ReaderInterface> ArchiveReaderAdaptor::try_create_reader_at
             return nullptr;
         }
     } else {
-        return try_create_reader(m_archive_path, m_network_auth);
+        return try_create_seekable_reader(m_archive_path, m_network_auth);
     }
 }
 
+auto ArchiveReaderAdaptor::has_section(std::string_view section) const -> bool {
+    return std::any_of(
+            m_archive_file_info.files.begin(),
+            m_archive_file_info.files.end(),
+            [&](ArchiveFileInfo const& info) { return info.n == section; }
+    );
+}
+
 std::unique_ptr<clp::ReaderInterface> ArchiveReaderAdaptor::checkout_reader_for_section(
         std::string_view section
 ) {
@@ -339,21 +349,33 @@ std::unique_ptr<clp::ReaderInterface> ArchiveReaderAdaptor::checkout_reader_for_
         next_file_offset = m_files_section_offset + it->o;
     }
 
-    if (curr_pos > file_offset) {
-        throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
-    }
-
     if (curr_pos != file_offset) {
+        // Seeking backwards fails for readers that only support streaming (e.g., a
+        // `clp::NetworkReader`), but succeeds for files and `clp::HttpRangeReader`s.
         if (auto rc = m_reader->try_seek_from_begin(file_offset);
             clp::ErrorCode::ErrorCode_Success != rc)
         {
-            throw OperationFailed(ErrorCodeFailure, __FILENAME__, __LINE__);
+            throw OperationFailed(
+                    curr_pos > file_offset ? ErrorCodeCorrupt : ErrorCodeFailure,
+                    __FILENAME__,
+                    __LINE__
+            );
         }
     }
 
     return std::make_unique<clp::BoundedReader>(m_reader.get(), next_file_offset);
 }
 
+auto ArchiveReaderAdaptor::prefetch_byte_ranges(
+        std::span<std::pair<size_t, size_t> const> byte_ranges
+) -> ErrorCode {
+    auto range_reader{std::dynamic_pointer_cast<clp::HttpRangeReader>(m_reader)};
+    if (nullptr == range_reader) {
+        return ErrorCodeSuccess;
+    }
+    return static_cast<ErrorCode>(range_reader->prefetch(byte_ranges));
+}
+
 void ArchiveReaderAdaptor::checkin_reader_for_section(std::string_view section) {
     if (false == m_current_reader_holder.has_value()) {
         throw OperationFailed(ErrorCodeNotInit, __FILENAME__, __LINE__);
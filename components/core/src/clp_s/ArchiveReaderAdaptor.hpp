@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -75,16 +76,35 @@ public:
      */
     ErrorCode load_archive_metadata();
 
+    /**
+     * @param section
+     * @return Whether the archive contains the given section. Optional sections (e.g., filters)
+     * may be missing from archives written with different options or by older versions.
+     */
+    [[nodiscard]] auto has_section(std::string_view section) const -> bool;
+
     /**
      * Checks out a reader for a given section of the archive. Reader must be checked back in with
      * the `checkin_reader_for_section` method.
      * @param section
      * @return A ReaderInterface opened and pointing to the requested section.
      * @throw OperationFailed if a reader is already checked out, or checking out this section would
-     *        force a backwards seek.
+     *        force a backwards seek on a reader that only supports streaming.
      */
     std::unique_ptr<clp::ReaderInterface> checkout_reader_for_section(std::string_view section);
 
+    /**
+     * Hints that the given byte ranges will be read soon. For a single-file archive read with
+     * range requests, this fetches the ranges ahead of time with as few requests as possible;
+     * otherwise, it's a no-op.
+     * @param byte_ranges [begin, end) pairs of positions in the readers returned by
+     * `checkout_reader_for_section`.
+     * @return ErrorCodeSuccess on success.
+     * @return relevant ErrorCode on failure.
+     */
+    [[nodiscard]] auto prefetch_byte_ranges(std::span<std::pair<size_t, size_t> const> byte_ranges)
+            -> ErrorCode;
+
     /**
      * Checks in a reader for a given section of the archive.
      * @param section
@@ -164,7 +184,8 @@ private:
      * @param section
      * @return A ReaderInterface opened and pointing to the requested section.
      * @throw OperationFailed if the requested section does not exist in ArchiveFileInfo, if
-     *        checking out the section would force a backward seek, or on any I/O error.
+     *        checking out the section would force a backward seek on a reader that only supports
+     *        streaming, or on any I/O error.
      */
     std::unique_ptr<clp::ReaderInterface> checkout_reader_for_sfa_section(std::string_view section);
 
@@ -1,19 +1,31 @@
 #include "ArchiveWriter.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <variant>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
+#include <clp/FileWriter.hpp>
+#include <clp/RuntimeMetrics.hpp>
 #include <clp_s/archive_constants.hpp>
+#include <clp_s/ColumnValueRange.hpp>
 #include <clp_s/Defs.hpp>
+#include <clp_s/filter/FilterBuilder.hpp>
+#include <clp_s/filter/FilterOptions.hpp>
 #include <clp_s/SchemaTree.hpp>
 #include <clp_s/SingleFileArchiveDefs.hpp>
 
@@ -24,9 +36,13 @@ void ArchiveWriter::open(ArchiveWriterOption const& option) {
     m_print_archive_stats = option.print_archive_stats;
     m_single_file_archive = option.single_file_archive;
     m_min_table_size = option.min_table_size;
+    m_num_compression_threads = std::max<size_t>(option.num_compression_threads, 1);
+    m_table_memory_budget = option.table_memory_budget;
     m_archives_dir = option.archives_dir;
     m_authoritative_timestamp = option.authoritative_timestamp;
     m_authoritative_timestamp_namespace = option.authoritative_timestamp_namespace;
+    m_var_dict_filter_type = option.var_dict_filter_type;
+    m_var_dict_filter_false_positive_rate = option.var_dict_filter_false_positive_rate;
     std::string working_dir_name = m_id;
     if (option.single_file_archive) {
         working_dir_name += constants::cTmpPostfix;
@@ -69,22 +85,39 @@ auto ArchiveWriter::close(bool is_split) -> ArchiveStats {
             throw OperationFailed(rc, __FILENAME__, __LINE__);
         }
     }
+    std::optional<size_t> var_dict_filter_size;
+    if (m_var_dict_filter_type.has_value()) {
+        var_dict_filter_size = store_var_dict_filter();
+    }
     auto var_dict_compressed_size = m_var_dict->close();
     auto log_dict_compressed_size = m_log_dict->close();
     auto array_dict_compressed_size = m_array_dict->close();
     auto schema_tree_compressed_size = m_schema_tree.store(m_archive_path, m_compression_level);
     auto schema_map_compressed_size = m_schema_map.store(m_archive_path, m_compression_level);
     auto [table_metadata_compressed_size, table_compressed_size] = store_tables();
+    auto const zone_maps_compressed_size{store_zone_maps()};
 
     std::vector<ArchiveFileInfo> files{
             {constants::cArchiveSchemaTreeFile, schema_tree_compressed_size},
             {constants::cArchiveSchemaMapFile, schema_map_compressed_size},
             {constants::cArchiveTableMetadataFile, table_metadata_compressed_size},
+            {constants::cArchiveTableZoneMapsFile, zone_maps_compressed_size},
             {constants::cArchiveVarDictFile, var_dict_compressed_size},
             {constants::cArchiveLogDictFile, log_dict_compressed_size},
             {constants::cArchiveArrayDictFile, array_dict_compressed_size},
             {constants::cArchiveTablesFile, table_compressed_size}
     };
+    if (var_dict_filter_size.has_value()) {
+        // The filter is placed before the dictionaries since sections of a single-file archive
+        // must be read in order, and the filter is consulted before any dictionary is read.
+        auto const var_dict_it{std::ranges::find_if(files, [](ArchiveFileInfo const& file) {
+            return constants::cArchiveVarDictFile == file.n;
+        })};
+        files.insert(
+                var_dict_it,
+                ArchiveFileInfo{constants::cArchiveVarDictFilterFile, var_dict_filter_size.value()}
+        );
+    }
     uint64_t offset = 0;
     for (auto& file : files) {
         uint64_t original_size = file.o;
@@ -107,7 +140,8 @@ auto ArchiveWriter::close(bool is_split) -> ArchiveStats {
         m_compressed_size
                 = var_dict_compressed_size + log_dict_compressed_size + array_dict_compressed_size
                   + metadata_size + schema_tree_compressed_size + schema_map_compressed_size
-                  + table_metadata_compressed_size + table_compressed_size + sizeof(ArchiveHeader);
+                  + table_metadata_compressed_size + table_compressed_size + sizeof(ArchiveHeader)
+                  + zone_maps_compressed_size + var_dict_filter_size.value_or(0);
 
         write_archive_header(header_and_metadata_writer, metadata_size);
         header_and_metadata_writer.close();
@@ -123,11 +157,14 @@ auto ArchiveWriter::close(bool is_split) -> ArchiveStats {
             is_split
     };
     if (m_print_archive_stats) {
-        std::cout << archive_stats.as_string() << '\n';
-        std::cout << std::flush;
+        // Write the stats with a single insertion so that stats printed by archive writers on
+        // different threads aren't interleaved.
+        std::cout << (archive_stats.as_string() + '\n') << std::flush;
     }
 
     m_id_to_schema_writer.clear();
+    m_spilled_tables.clear();
+    m_in_memory_table_size = 0UL;
     m_schema_tree.clear();
     m_schema_map.clear();
     m_timestamp_dict.clear();
@@ -219,26 +256,57 @@ void ArchiveWriter::write_archive_files(
         FileWriter& archive_writer,
         std::vector<ArchiveFileInfo> const& files
 ) {
-    FileReader reader;
     for (auto const& file : files) {
-        std::string file_path = m_archive_path + file.n;
-        reader.open(file_path);
-        char read_buffer[cReadBlockSize];
-        while (true) {
-            size_t num_bytes_read{0};
-            ErrorCode const error_code
-                    = reader.try_read(read_buffer, cReadBlockSize, num_bytes_read);
-            if (ErrorCodeEndOfFile == error_code) {
-                break;
-            } else if (ErrorCodeSuccess != error_code) {
-                throw OperationFailed(error_code, __FILENAME__, __LINE__);
-            }
-            archive_writer.write(read_buffer, num_bytes_read);
-        }
-        reader.close();
-        if (false == std::filesystem::remove(file_path)) {
-            throw OperationFailed(ErrorCodeFileExists, __FILENAME__, __LINE__);
+        append_and_remove_file(archive_writer, m_archive_path + file.n);
+    }
+}
+
+auto ArchiveWriter::store_var_dict_filter() -> size_t {
+    // Values are lowercased so that the filter can also rule out case-insensitive searches.
+    auto builder_result{filter::FilterBuilder::create(
+            m_var_dict_filter_type.value(),
+            filter::FilterNormalization::Lowercase,
+            m_var_dict->get_num_entries(),
+            m_var_dict_filter_false_positive_rate
+    )};
+    if (builder_result.has_error()) {
+        SPDLOG_ERROR(
+                "Failed to create variable dictionary filter - {}",
+                builder_result.error().message()
+        );
+        throw OperationFailed(ErrorCodeBadParam, __FILENAME__, __LINE__);
+    }
+    auto& builder{builder_result.value()};
+    m_var_dict->for_each_value([&](std::string_view value) { builder.add(value); });
+
+    clp::FileWriter filter_writer;
+    filter_writer.open(
+            m_archive_path + constants::cArchiveVarDictFilterFile,
+            clp::FileWriter::OpenMode::CREATE_FOR_WRITING
+    );
+    builder.write(filter_writer);
+    auto const filter_size{filter_writer.get_pos()};
+    filter_writer.close();
+    return filter_size;
+}
+
+void ArchiveWriter::append_and_remove_file(FileWriter& writer, std::string const& file_path) {
+    FileReader reader;
+    reader.open(file_path);
+    char read_buffer[cReadBlockSize];
+    while (true) {
+        size_t num_bytes_read{0};
+        ErrorCode const error_code = reader.try_read(read_buffer, cReadBlockSize, num_bytes_read);
+        if (ErrorCodeEndOfFile == error_code) {
+            break;
+        } else if (ErrorCodeSuccess != error_code) {
+            throw OperationFailed(error_code, __FILENAME__, __LINE__);
         }
+        writer.write(read_buffer, num_bytes_read);
+    }
+    reader.close();
+    if (false == std::filesystem::remove(file_path)) {
+        throw OperationFailed(ErrorCodeFileExists, __FILENAME__, __LINE__);
     }
 }
 
@@ -256,15 +324,73 @@ void ArchiveWriter::write_archive_header(FileWriter& archive_writer, size_t meta
 
 void
 ArchiveWriter::append_message(int32_t schema_id, Schema const& schema, ParsedMessage& message) {
+    clp::RuntimeMetrics::ScopedTimer encode_timer{clp::RuntimeMetrics::Stage::Encode};
     auto it = m_id_to_schema_writer.find(schema_id);
     if (it == m_id_to_schema_writer.end()) {
         auto schema_writer = std::make_unique<SchemaWriter>();
         initialize_schema_writer(schema_writer.get(), schema);
+        m_in_memory_table_size += schema_writer->get_total_uncompressed_size();
         it = m_id_to_schema_writer.emplace(schema_id, std::move(schema_writer)).first;
     }
 
-    m_encoded_message_size += it->second->append_message(message);
+    auto const message_size{it->second->append_message(message)};
+    encode_timer.add_bytes(message_size);
+    m_encoded_message_size += message_size;
+    m_in_memory_table_size += message_size;
     ++m_next_log_event_id;
+
+    if (0 != m_table_memory_budget && m_in_memory_table_size > m_table_memory_budget) {
+        spill_tables();
+    }
+}
+
+void ArchiveWriter::spill_tables() {
+    using schema_map_it = decltype(m_id_to_schema_writer)::iterator;
+    std::vector<schema_map_it> schemas;
+    schemas.reserve(m_id_to_schema_writer.size());
+    for (auto it = m_id_to_schema_writer.begin(); it != m_id_to_schema_writer.end(); ++it) {
+        schemas.push_back(it);
+    }
+    auto comp = [](schema_map_it const& lhs, schema_map_it const& rhs) -> bool {
+        return lhs->second->get_total_uncompressed_size()
+               > rhs->second->get_total_uncompressed_size();
+    };
+    std::sort(schemas.begin(), schemas.end(), comp);
+
+    if (m_spilled_tables.empty()) {
+        m_spill_file_writer.open(
+                m_archive_path + constants::cArchiveTablesSpillFile,
+                FileWriter::OpenMode::CreateForWriting
+        );
+    }
+
+    // Spilling down to half of the budget, rather than just below it, keeps a workload whose
+    // tables all grow at once from spilling a table on every message.
+    auto const target_in_memory_table_size{m_table_memory_budget / 2};
+    ZstdCompressor compressor;
+    for (auto it : schemas) {
+        if (m_in_memory_table_size <= target_in_memory_table_size) {
+            break;
+        }
+        auto& schema_writer{*it->second};
+        m_in_memory_table_size -= schema_writer.get_total_uncompressed_size();
+
+        schema_writer.finalize_encodings();
+        auto const spill_file_offset{m_spill_file_writer.get_pos()};
+        compressor.open(m_spill_file_writer, m_compression_level);
+        schema_writer.store(compressor);
+        compressor.close();
+        m_spilled_tables.push_back(SpilledTable{
+                it->first,
+                schema_writer.get_num_messages(),
+                spill_file_offset,
+                schema_writer.get_total_uncompressed_size(),
+                schema_writer.get_zone_map()
+        });
+
+        m_schema_map.retire_schema(it->first);
+        m_id_to_schema_writer.erase(it);
+    }
 }
 
 int32_t ArchiveWriter::add_node(int parent_node_id, NodeType type, std::string_view key) {
@@ -302,45 +428,43 @@ size_t ArchiveWriter::get_data_size() {
 }
 
 void ArchiveWriter::initialize_schema_writer(SchemaWriter* writer, Schema const& schema) {
-    for (int32_t id : schema) {
+    for (size_t i{0}; i < schema.size(); ++i) {
+        auto const id{schema[i]};
         if (Schema::schema_entry_is_unordered_object(id)) {
             continue;
         }
+        std::unique_ptr<BaseColumnWriter> column_writer;
         auto const& node = m_schema_tree.get_node(id);
         switch (node.get_type()) {
             case NodeType::Integer:
-                writer->append_column(std::make_unique<Int64ColumnWriter>());
+                column_writer = std::make_unique<Int64ColumnWriter>();
                 break;
             case NodeType::Float:
-                writer->append_column(std::make_unique<FloatColumnWriter>());
+                column_writer = std::make_unique<FloatColumnWriter>();
                 break;
             case NodeType::FormattedFloat:
-                writer->append_column(std::make_unique<FormattedFloatColumnWriter>());
+                column_writer = std::make_unique<FormattedFloatColumnWriter>();
                 break;
             case NodeType::DictionaryFloat:
-                writer->append_column(std::make_unique<DictionaryFloatColumnWriter>(m_var_dict));
+                column_writer = std::make_unique<DictionaryFloatColumnWriter>(m_var_dict);
                 break;
             case NodeType::ClpString:
-                writer->append_column(
-                        std::make_unique<ClpStringColumnWriter>(m_var_dict, m_log_dict)
-                );
+                column_writer = std::make_unique<ClpStringColumnWriter>(m_var_dict, m_log_dict);
                 break;
             case NodeType::VarString:
-                writer->append_column(std::make_unique<VariableStringColumnWriter>(m_var_dict));
+                column_writer = std::make_unique<VariableStringColumnWriter>(m_var_dict);
                 break;
             case NodeType::Boolean:
-                writer->append_column(std::make_unique<BooleanColumnWriter>());
+                column_writer = std::make_unique<BooleanColumnWriter>();
                 break;
             case NodeType::UnstructuredArray:
-                writer->append_column(
-                        std::make_unique<ClpStringColumnWriter>(m_var_dict, m_array_dict)
-                );
+                column_writer = std::make_unique<ClpStringColumnWriter>(m_var_dict, m_array_dict);
                 break;
             case NodeType::DeltaInteger:
-                writer->append_column(std::make_unique<DeltaEncodedInt64ColumnWriter>());
+                column_writer = std::make_unique<DeltaEncodedInt64ColumnWriter>();
                 break;
             case NodeType::Timestamp:
-                writer->append_column(std::make_unique<TimestampColumnWriter>());
+                column_writer = std::make_unique<TimestampColumnWriter>();
                 break;
             case NodeType::DeprecatedDateString:
             case NodeType::Metadata:
@@ -350,7 +474,75 @@ void ArchiveWriter::initialize_schema_writer(SchemaWriter* writer, Schema const&
             case NodeType::Unknown:
                 break;
         }
+        if (nullptr == column_writer) {
+            continue;
+        }
+
+        // Columns in the unordered region can repeat within a message, so only the ordered columns
+        // have value ranges recorded in the zone map.
+        if (i < schema.get_num_ordered()) {
+            writer->append_column(std::move(column_writer), id);
+        } else {
+            writer->append_column(std::move(column_writer));
+        }
+    }
+}
+
+auto ArchiveWriter::store_zone_maps() -> size_t {
+    /**
+     * Zone map schema
+     * ---------------
+     * - Number of schema tables: <64-bit integer>
+     * - For each schema table:
+     *   - Schema ID: <32-bit integer>
+     *   - Number of columns: <64-bit integer>
+     *   - For each column:
+     *     - Column ID: <32-bit integer>
+     *     - Range type: <8-bit `ColumnValueRangeType`>
+     *     - Minimum value: <64-bit integer or double>
+     *     - Maximum value: <64-bit integer or double>
+     */
+    FileWriter zone_maps_file_writer;
+    zone_maps_file_writer.open(
+            m_archive_path + constants::cArchiveTableZoneMapsFile,
+            FileWriter::OpenMode::CreateForWriting
+    );
+    ZstdCompressor compressor;
+    compressor.open(zone_maps_file_writer, m_compression_level);
+
+    auto write_zone_map = [&](int32_t schema_id, SchemaZoneMap const& zone_map) {
+        compressor.write_numeric_value(schema_id);
+        compressor.write_numeric_value(static_cast<uint64_t>(zone_map.size()));
+        for (auto const& [column_id, range] : zone_map) {
+            compressor.write_numeric_value(column_id);
+            if (auto const* int_range{std::get_if<ValueRange<int64_t>>(&range)};
+                nullptr != int_range)
+            {
+                compressor.write_numeric_value(ColumnValueRangeType::Integer);
+                compressor.write_numeric_value(int_range->min);
+                compressor.write_numeric_value(int_range->max);
+            } else {
+                auto const& float_range{std::get<ValueRange<double>>(range)};
+                compressor.write_numeric_value(ColumnValueRangeType::Float);
+                compressor.write_numeric_value(float_range.min);
+                compressor.write_numeric_value(float_range.max);
+            }
+        }
+    };
+    compressor.write_numeric_value(
+            static_cast<uint64_t>(m_id_to_schema_writer.size() + m_spilled_tables.size())
+    );
+    for (auto const& [schema_id, schema_writer] : m_id_to_schema_writer) {
+        write_zone_map(schema_id, schema_writer->get_zone_map());
     }
+    for (auto const& spilled_table : m_spilled_tables) {
+        write_zone_map(spilled_table.schema_id, spilled_table.zone_map);
+    }
+    compressor.close();
+
+    auto const zone_maps_compressed_size{zone_maps_file_writer.get_pos()};
+    zone_maps_file_writer.close();
+    return zone_maps_compressed_size;
 }
 
 std::pair<size_t, size_t> ArchiveWriter::store_tables() {
@@ -407,6 +599,8 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
     schema_metadata.reserve(m_id_to_schema_writer.size());
     schemas.reserve(m_id_to_schema_writer.size());
     for (auto it = m_id_to_schema_writer.begin(); it != m_id_to_schema_writer.end(); ++it) {
+        // Encodings must be chosen first since they determine the size of each table.
+        it->second->finalize_encodings();
         schemas.push_back(it);
     }
     auto comp = [](schema_map_it const& lhs, schema_map_it const& rhs) -> bool {
@@ -415,14 +609,19 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
     };
     std::sort(schemas.begin(), schemas.end(), comp);
 
+    // Partition the schema tables into packed streams. A stream is closed once its uncompressed
+    // size exceeds the minimum table size, so the boundaries only depend on the table sizes.
+    std::vector<std::vector<SchemaWriter*>> streams;
     uint64_t current_stream_offset{0};
-    uint64_t current_stream_id{0};
-    uint64_t current_table_file_offset{0};
-    m_tables_compressor.open(m_tables_file_writer, m_compression_level);
+    bool stream_open{false};
     for (auto it : schemas) {
-        it->second->store(m_tables_compressor);
+        if (false == stream_open) {
+            streams.emplace_back();
+            stream_open = true;
+        }
+        streams.back().push_back(it->second.get());
         schema_metadata.emplace_back(
-                current_stream_id,
+                streams.size() - 1,
                 current_stream_offset,
                 it->first,
                 it->second->get_num_messages()
@@ -430,15 +629,48 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
         current_stream_offset += it->second->get_total_uncompressed_size();
 
         if (current_stream_offset > m_min_table_size || schemas.size() == schema_metadata.size()) {
-            stream_metadata.emplace_back(current_table_file_offset, current_stream_offset);
-            m_tables_compressor.close();
+            stream_metadata.emplace_back(0, current_stream_offset);
             current_stream_offset = 0;
-            ++current_stream_id;
-            current_table_file_offset = m_tables_file_writer.get_pos();
+            stream_open = false;
+        }
+    }
 
-            if (schemas.size() != schema_metadata.size()) {
-                m_tables_compressor.open(m_tables_file_writer, m_compression_level);
+    if (m_num_compression_threads > 1 && streams.size() > 1) {
+        auto const stream_file_offsets{store_packed_streams_in_parallel(streams)};
+        for (size_t i{0}; i < stream_metadata.size(); ++i) {
+            stream_metadata[i].file_offset = stream_file_offsets[i];
+        }
+    } else {
+        for (size_t i{0}; i < streams.size(); ++i) {
+            stream_metadata[i].file_offset = m_tables_file_writer.get_pos();
+            m_tables_compressor.open(m_tables_file_writer, m_compression_level);
+            for (auto* schema_writer : streams[i]) {
+                schema_writer->store(m_tables_compressor);
             }
+            m_tables_compressor.close();
+        }
+    }
+
+    // Tables spilled during ingestion were already compressed as packed streams of their own, so
+    // they're appended to the tables file as-is.
+    if (false == m_spilled_tables.empty()) {
+        m_spill_file_writer.close();
+        auto const spill_file_base_offset{m_tables_file_writer.get_pos()};
+        append_and_remove_file(
+                m_tables_file_writer,
+                m_archive_path + constants::cArchiveTablesSpillFile
+        );
+        for (auto const& spilled_table : m_spilled_tables) {
+            schema_metadata.emplace_back(
+                    stream_metadata.size(),
+                    0,
+                    spilled_table.schema_id,
+                    spilled_table.num_messages
+            );
+            stream_metadata.emplace_back(
+                    spill_file_base_offset + spilled_table.spill_file_offset,
+                    spilled_table.uncompressed_size
+            );
         }
     }
 
@@ -470,4 +702,75 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
 
     return {table_metadata_compressed_size, table_compressed_size};
 }
+
+auto ArchiveWriter::store_packed_streams_in_parallel(
+        std::vector<std::vector<SchemaWriter*>> const& streams
+) -> std::vector<uint64_t> {
+    auto get_stream_file_path = [&](size_t stream_id) -> std::string {
+        return m_archive_path + constants::cArchiveTablesStreamFilePrefix
+               + std::to_string(stream_id);
+    };
+
+    // Each worker claims the next uncompressed stream and compresses it into its own temporary
+    // file. The schema writers are only read during `store`, so they can be shared across workers.
+    std::atomic_size_t next_stream_id{0};
+    std::atomic_bool failed{false};
+    std::exception_ptr first_exception;
+    std::mutex first_exception_mutex;
+    auto compress_streams = [&]() -> void {
+        ZstdCompressor compressor;
+        while (false == failed.load()) {
+            auto const stream_id{next_stream_id.fetch_add(1)};
+            if (stream_id >= streams.size()) {
+                break;
+            }
+            try {
+                FileWriter stream_file_writer;
+                stream_file_writer.open(
+                        get_stream_file_path(stream_id),
+                        FileWriter::OpenMode::CreateForWriting
+                );
+                compressor.open(stream_file_writer, m_compression_level);
+                for (auto* schema_writer : streams[stream_id]) {
+                    schema_writer->store(compressor);
+                }
+                compressor.close();
+                stream_file_writer.close();
+            } catch (...) {
+                std::lock_guard<std::mutex> const lock{first_exception_mutex};
+                if (nullptr == first_exception) {
+                    first_exception = std::current_exception();
+                }
+                failed = true;
+                break;
+            }
+        }
+    };
+
+    auto const num_threads{std::min(m_num_compression_threads, streams.size())};
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t i{0}; i < num_threads; ++i) {
+        workers.emplace_back(compress_streams);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (nullptr != first_exception) {
+        std::error_code ec;
+        for (size_t stream_id{0}; stream_id < streams.size(); ++stream_id) {
+            std::filesystem::remove(get_stream_file_path(stream_id), ec);
+        }
+        std::rethrow_exception(first_exception);
+    }
+
+    std::vector<uint64_t> stream_file_offsets;
+    stream_file_offsets.reserve(streams.size());
+    for (size_t stream_id{0}; stream_id < streams.size(); ++stream_id) {
+        stream_file_offsets.push_back(m_tables_file_writer.get_pos());
+        append_and_remove_file(m_tables_file_writer, get_stream_file_path(stream_id));
+    }
+    return stream_file_offsets;
+}
 }  // namespace clp_s
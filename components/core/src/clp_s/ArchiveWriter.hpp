@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -14,8 +15,10 @@
 
 #include <clp/streaming_archive/Constants.hpp>
 #include <clp_s/archive_constants.hpp>
+#include <clp_s/ColumnValueRange.hpp>
 #include <clp_s/Defs.hpp>
 #include <clp_s/DictionaryWriter.hpp>
+#include <clp_s/filter/FilterOptions.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/RangeIndexWriter.hpp>
 #include <clp_s/Schema.hpp>
@@ -26,6 +29,8 @@
 #include <clp_s/TimestampDictionaryWriter.hpp>
 
 namespace clp_s {
+constexpr double cDefaultVarDictFilterFalsePositiveRate{0.01};
+
 struct ArchiveWriterOption {
     boost::uuids::uuid id;
     std::string archives_dir;
@@ -33,8 +38,13 @@ struct ArchiveWriterOption {
     bool print_archive_stats;
     bool single_file_archive;
     size_t min_table_size;
+    size_t num_compression_threads{1};
+    // Limit (B) on the size of the schema tables held in memory, or 0 for no limit.
+    size_t table_memory_budget{0};
     std::vector<std::string> authoritative_timestamp;
     std::string authoritative_timestamp_namespace;
+    std::optional<filter::FilterType> var_dict_filter_type;
+    double var_dict_filter_false_positive_rate{cDefaultVarDictFilterFalsePositiveRate};
 };
 
 class ArchiveStats {
@@ -137,6 +147,17 @@ public:
         uint64_t num_messages{};
     };
 
+    /**
+     * A schema table that was compressed to the spill file before the archive was closed.
+     */
+    struct SpilledTable {
+        int32_t schema_id{};
+        uint64_t num_messages{};
+        uint64_t spill_file_offset{};
+        uint64_t uncompressed_size{};
+        SchemaZoneMap zone_map;
+    };
+
     // Constructor
     ArchiveWriter() = default;
 
@@ -296,6 +317,13 @@ private:
      */
     void initialize_schema_writer(SchemaWriter* writer, Schema const& schema);
 
+    /**
+     * Compresses the largest in-memory schema tables into the spill file, each as its own packed
+     * stream, until the in-memory tables use at most half of the table memory budget. The schema
+     * of each spilled table is retired, so later messages with that schema start a new table.
+     */
+    void spill_tables();
+
     /**
      * Compresses and stores the tables.
      * @return A pair containing:
@@ -304,6 +332,39 @@ private:
      */
     [[nodiscard]] std::pair<size_t, size_t> store_tables();
 
+    /**
+     * Compresses each packed stream into its own temporary file using a pool of worker threads,
+     * then appends the compressed streams to the tables file in stream order.
+     * @param streams The schema writers belonging to each packed stream, in stream order.
+     * @return The offset of each compressed stream within the tables file.
+     * @throw ArchiveWriter::OperationFailed or any exception thrown by a worker thread on failure.
+     */
+    [[nodiscard]] auto store_packed_streams_in_parallel(
+            std::vector<std::vector<SchemaWriter*>> const& streams
+    ) -> std::vector<uint64_t>;
+
+    /**
+     * Builds a filter over every value in the variable dictionary and writes it to the archive.
+     * Must be called before the variable dictionary is closed.
+     * @return The size of the written filter in bytes.
+     * @throw ArchiveWriter::OperationFailed if the filter can't be created.
+     */
+    [[nodiscard]] auto store_var_dict_filter() -> size_t;
+
+    /**
+     * Writes the zone map of every schema table to the archive. Must be called before the schema
+     * writers are cleared.
+     * @return The size of the compressed zone maps in bytes.
+     */
+    [[nodiscard]] auto store_zone_maps() -> size_t;
+
+    /**
+     * Appends the contents of a file to the given writer, and then deletes the file.
+     * @param writer
+     * @param file_path
+     */
+    void append_and_remove_file(FileWriter& writer, std::string const& file_path);
+
     /**
      * Writes the archive to a single file
      * @param files
@@ -357,6 +418,11 @@ private:
     bool m_print_archive_stats{};
     bool m_single_file_archive{};
     size_t m_min_table_size{};
+    size_t m_num_compression_threads{1};
+    size_t m_table_memory_budget{};
+    size_t m_in_memory_table_size{};
+    std::optional<filter::FilterType> m_var_dict_filter_type;
+    double m_var_dict_filter_false_positive_rate{cDefaultVarDictFilterFalsePositiveRate};
 
     std::vector<std::string> m_authoritative_timestamp;
     std::string m_authoritative_timestamp_namespace;
@@ -367,6 +433,8 @@ private:
     SchemaTree m_schema_tree;
 
     std::map<int32_t, std::unique_ptr<SchemaWriter>> m_id_to_schema_writer;
+    std::vector<SpilledTable> m_spilled_tables;
+    FileWriter m_spill_file_writer;
 
     FileWriter m_tables_file_writer;
     FileWriter m_table_metadata_file_writer;
@@ -17,12 +17,17 @@
 #include <clp_s/ColumnWriter.hpp>
 #include <clp_s/Defs.hpp>
 #include <clp_s/FloatFormatEncoding.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/SchemaTree.hpp>
 #include <clp_s/Utils.hpp>
 
 namespace clp_s {
 auto Int64ColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    if (m_is_encoded) {
+        m_values = read_encoded_integers(reader, num_messages, m_decoded_values);
+    } else {
+        m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    }
 }
 
 auto Int64ColumnReader::extract_value(uint64_t cur_message)
@@ -31,7 +36,11 @@ auto Int64ColumnReader::extract_value(uint64_t cur_message)
 }
 
 auto DeltaEncodedInt64ColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    if (m_is_encoded) {
+        m_values = read_encoded_integers(reader, num_messages, m_decoded_values);
+    } else {
+        m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    }
     if (num_messages > 0) {
         m_cur_idx = 0;
         m_cur_value = m_values[0];
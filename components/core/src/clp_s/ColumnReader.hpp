@@ -102,7 +102,14 @@ private:
 class Int64ColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    explicit Int64ColumnReader(int32_t id) : BaseColumnReader(id) {}
+    /**
+     * @param id
+     * @param is_encoded Whether the column is stored with an `IntegerEncoding`, rather than as raw
+     * 64-bit values.
+     */
+    Int64ColumnReader(int32_t id, bool is_encoded)
+            : BaseColumnReader(id),
+              m_is_encoded{is_encoded} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -115,14 +122,28 @@ public:
     auto extract_string_value_into_buffer(uint64_t cur_message, std::string& buffer)
             -> void override;
 
+    /**
+     * @return A view of the column's values, one per message.
+     */
+    [[nodiscard]] auto get_values() const -> UnalignedMemSpan<int64_t> { return m_values; }
+
 private:
     UnalignedMemSpan<int64_t> m_values;
+    std::vector<int64_t> m_decoded_values;
+    bool m_is_encoded;
 };
 
 class DeltaEncodedInt64ColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    explicit DeltaEncodedInt64ColumnReader(int32_t id) : BaseColumnReader(id) {}
+    /**
+     * @param id
+     * @param is_encoded Whether the deltas are stored with an `IntegerEncoding`, rather than as raw
+     * 64-bit values.
+     */
+    DeltaEncodedInt64ColumnReader(int32_t id, bool is_encoded)
+            : BaseColumnReader(id),
+              m_is_encoded{is_encoded} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -145,8 +166,10 @@ public:
 
 private:
     UnalignedMemSpan<int64_t> m_values;
+    std::vector<int64_t> m_decoded_values;
     int64_t m_cur_value{};
     size_t m_cur_idx{};
+    bool m_is_encoded;
 };
 
 class FloatColumnReader : public BaseColumnReader {
@@ -165,6 +188,11 @@ public:
     auto extract_string_value_into_buffer(uint64_t cur_message, std::string& buffer)
             -> void override;
 
+    /**
+     * @return A view of the column's values, one per message.
+     */
+    [[nodiscard]] auto get_values() const -> UnalignedMemSpan<double> { return m_values; }
+
 private:
     UnalignedMemSpan<double> m_values;
 };
@@ -192,6 +220,11 @@ public:
     auto extract_string_value_into_buffer(uint64_t cur_message, std::string& buffer)
             -> void override;
 
+    /**
+     * @return A view of the column's values, one per message.
+     */
+    [[nodiscard]] auto get_values() const -> UnalignedMemSpan<double> { return m_values; }
+
 private:
     UnalignedMemSpan<double> m_values;
     UnalignedMemSpan<float_format_t> m_formats;
@@ -239,6 +272,11 @@ public:
     auto extract_string_value_into_buffer(uint64_t cur_message, std::string& buffer)
             -> void override;
 
+    /**
+     * @return A view of the column's values, one per message.
+     */
+    [[nodiscard]] auto get_values() const -> UnalignedMemSpan<uint8_t> { return m_values; }
+
 private:
     UnalignedMemSpan<uint8_t> m_values;
 };
@@ -380,10 +418,20 @@ private:
 class TimestampColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    TimestampColumnReader(int32_t id, std::shared_ptr<TimestampDictionaryReader> timestamp_dict)
+    /**
+     * @param id
+     * @param timestamp_dict
+     * @param is_encoded Whether the timestamps are stored with an `IntegerEncoding`, rather than as
+     * raw 64-bit values.
+     */
+    TimestampColumnReader(
+            int32_t id,
+            std::shared_ptr<TimestampDictionaryReader> timestamp_dict,
+            bool is_encoded
+    )
             : BaseColumnReader{id},
               m_timestamp_dict{std::move(timestamp_dict)},
-              m_timestamps{id} {}
+              m_timestamps{id, is_encoded} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -0,0 +1,39 @@
+#ifndef CLP_S_COLUMNVALUERANGE_HPP
+#define CLP_S_COLUMNVALUERANGE_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <variant>
+
+namespace clp_s {
+/**
+ * The smallest and largest value stored in a column of a schema table.
+ * @tparam T
+ */
+template <typename T>
+struct ValueRange {
+    T min;
+    T max;
+};
+
+/**
+ * The range of values in a numeric column of a schema table. Integer and timestamp columns hold
+ * integer ranges, while float columns hold floating point ranges.
+ */
+using ColumnValueRange = std::variant<ValueRange<int64_t>, ValueRange<double>>;
+
+/**
+ * Tags identifying the type of a serialized `ColumnValueRange`.
+ */
+enum class ColumnValueRangeType : uint8_t {
+    Integer = 0,
+    Float = 1
+};
+
+/**
+ * The zone map of a schema table, mapping column IDs to the range of values in each column.
+ */
+using SchemaZoneMap = std::unordered_map<int32_t, ColumnValueRange>;
+}  // namespace clp_s
+
+#endif  // CLP_S_COLUMNVALUERANGE_HPP
@@ -1,8 +1,11 @@
 #include "ColumnWriter.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <variant>
@@ -16,23 +19,59 @@
 #include <clp/ffi/EncodedTextAst.hpp>
 #include <clp/ffi/ir_stream/decoding_methods.hpp>
 #include <clp/TraceableException.hpp>
+#include <clp_s/ColumnValueRange.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/ZstdCompressor.hpp>
 
 namespace clp_s {
+namespace {
+/**
+ * @param values
+ * @return The range of the given float values, or std::nullopt if there are no values or any value
+ * is NaN (since NaN compares unequal to everything, a range can't describe it).
+ */
+auto get_float_value_range(std::vector<double> const& values) -> std::optional<ColumnValueRange>;
+
+auto get_float_value_range(std::vector<double> const& values) -> std::optional<ColumnValueRange> {
+    if (values.empty()
+        || std::ranges::any_of(values, [](double value) -> bool { return std::isnan(value); }))
+    {
+        return std::nullopt;
+    }
+    auto const [min_it, max_it]{std::ranges::minmax_element(values)};
+    return ValueRange<double>{*min_it, *max_it};
+}
+}  // namespace
+
 size_t Int64ColumnWriter::add_value(ParsedMessage::variable_t& value) {
     m_values.push_back(std::get<int64_t>(value));
     return sizeof(int64_t);
 }
 
 void Int64ColumnWriter::store(ZstdCompressor& compressor) {
-    size_t size = m_values.size() * sizeof(int64_t);
-    compressor.write(reinterpret_cast<char const*>(m_values.data()), size);
+    write_encoded_integers(compressor, m_values, m_encoding);
+}
+
+auto Int64ColumnWriter::finalize_encoding() -> size_t {
+    m_encoding = choose_integer_encoding(m_values);
+    return get_encoded_integers_size(IntegerEncodingParameters{}, m_values.size())
+           - get_encoded_integers_size(m_encoding, m_values.size());
+}
+
+auto Int64ColumnWriter::get_value_range() const -> std::optional<ColumnValueRange> {
+    if (m_values.empty()) {
+        return std::nullopt;
+    }
+    auto const [min_it, max_it]{std::ranges::minmax_element(m_values)};
+    return ValueRange<int64_t>{*min_it, *max_it};
 }
 
 auto DeltaEncodedInt64ColumnWriter::add_value(int64_t value) -> size_t {
     m_values.emplace_back(value - m_cur);
     m_cur = value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
     return sizeof(int64_t);
 }
 
@@ -41,8 +80,22 @@ size_t DeltaEncodedInt64ColumnWriter::add_value(ParsedMessage::variable_t& value
 }
 
 void DeltaEncodedInt64ColumnWriter::store(ZstdCompressor& compressor) {
-    size_t size = m_values.size() * sizeof(int64_t);
-    compressor.write(reinterpret_cast<char const*>(m_values.data()), size);
+    write_encoded_integers(compressor, m_values, m_encoding);
+}
+
+auto DeltaEncodedInt64ColumnWriter::finalize_encoding() -> size_t {
+    // The deltas are encoded rather than the original values, so `IntegerEncoding::Delta` stores
+    // delta-of-deltas, which packs regularly spaced values (e.g., timestamps) into very few bits.
+    m_encoding = choose_integer_encoding(m_values);
+    return get_encoded_integers_size(IntegerEncodingParameters{}, m_values.size())
+           - get_encoded_integers_size(m_encoding, m_values.size());
+}
+
+auto DeltaEncodedInt64ColumnWriter::get_value_range() const -> std::optional<ColumnValueRange> {
+    if (m_values.empty()) {
+        return std::nullopt;
+    }
+    return ValueRange<int64_t>{m_min, m_max};
 }
 
 size_t FloatColumnWriter::add_value(ParsedMessage::variable_t& value) {
@@ -55,6 +108,10 @@ void FloatColumnWriter::store(ZstdCompressor& compressor) {
     compressor.write(reinterpret_cast<char const*>(m_values.data()), size);
 }
 
+auto FloatColumnWriter::get_value_range() const -> std::optional<ColumnValueRange> {
+    return get_float_value_range(m_values);
+}
+
 size_t FormattedFloatColumnWriter::add_value(ParsedMessage::variable_t& value) {
     auto const& [float_value, format]{std::get<std::pair<double, float_format_t>>(value)};
     m_values.push_back(float_value);
@@ -70,6 +127,10 @@ void FormattedFloatColumnWriter::store(ZstdCompressor& compressor) {
     compressor.write(reinterpret_cast<char const*>(m_formats.data()), format_size);
 }
 
+auto FormattedFloatColumnWriter::get_value_range() const -> std::optional<ColumnValueRange> {
+    return get_float_value_range(m_values);
+}
+
 size_t DictionaryFloatColumnWriter::add_value(ParsedMessage::variable_t& value) {
     clp::variable_dictionary_id_t id{};
     m_var_dict->add_entry(std::get<std::string>(value), id);
@@ -3,14 +3,18 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include <clp/Defs.h>
+#include <clp_s/ColumnValueRange.hpp>
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/DictionaryWriter.hpp>
 #include <clp_s/FloatFormatEncoding.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/ZstdCompressor.hpp>
 
@@ -52,6 +56,23 @@ public:
      * @return the total size of header data that will be written to the compressor in bytes
      */
     [[nodiscard]] virtual auto get_total_header_size() const -> size_t { return 0; }
+
+    /**
+     * Chooses how the column will be encoded once every value has been added. No values may be
+     * added afterwards.
+     *
+     * @return the number of bytes by which the chosen encoding shrinks the data written to the
+     * compressor, relative to the sizes reported by get_total_header_size and add_value
+     */
+    virtual auto finalize_encoding() -> size_t { return 0; }
+
+    /**
+     * @return The range of values added to the column, or std::nullopt if the column doesn't track
+     * its range or no usable range exists.
+     */
+    [[nodiscard]] virtual auto get_value_range() const -> std::optional<ColumnValueRange> {
+        return std::nullopt;
+    }
 };
 
 class Int64ColumnWriter : public BaseColumnWriter {
@@ -61,9 +82,18 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return sizeof(IntegerEncoding);
+    }
+
+    auto finalize_encoding() -> size_t override;
+
+    [[nodiscard]] auto get_value_range() const -> std::optional<ColumnValueRange> override;
+
 private:
     // Data members
     std::vector<int64_t> m_values;
+    IntegerEncodingParameters m_encoding;
 };
 
 class DeltaEncodedInt64ColumnWriter : public BaseColumnWriter {
@@ -73,13 +103,25 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return sizeof(IntegerEncoding);
+    }
+
+    auto finalize_encoding() -> size_t override;
+
+    [[nodiscard]] auto get_value_range() const -> std::optional<ColumnValueRange> override;
+
     // Methods
     [[nodiscard]] auto add_value(int64_t value) -> size_t;
 
 private:
     // Data members
     std::vector<int64_t> m_values;
+    IntegerEncodingParameters m_encoding;
     int64_t m_cur{};
+    // The range is tracked as values are added since only the deltas are buffered.
+    int64_t m_min{std::numeric_limits<int64_t>::max()};
+    int64_t m_max{std::numeric_limits<int64_t>::min()};
 };
 
 class FloatColumnWriter : public BaseColumnWriter {
@@ -89,6 +131,8 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_value_range() const -> std::optional<ColumnValueRange> override;
+
 private:
     // Data members
     std::vector<double> m_values;
@@ -101,6 +145,8 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_value_range() const -> std::optional<ColumnValueRange> override;
+
 private:
     // Data members
     std::vector<double> m_values;
@@ -224,6 +270,16 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return m_timestamps.get_total_header_size();
+    }
+
+    auto finalize_encoding() -> size_t override { return m_timestamps.finalize_encoding(); }
+
+    [[nodiscard]] auto get_value_range() const -> std::optional<ColumnValueRange> override {
+        return m_timestamps.get_value_range();
+    }
+
 private:
     // Data members
     DeltaEncodedInt64ColumnWriter m_timestamps;
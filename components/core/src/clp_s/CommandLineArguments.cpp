@@ -1,6 +1,7 @@
 #include "CommandLineArguments.hpp"
 
 #include <algorithm>
+#include <array>
 #include <filesystem>
 #include <iostream>
 #include <optional>
@@ -10,7 +11,9 @@
 #include <fmt/format.h>
 #include <spdlog/spdlog.h>
 
+#include "../clp/RuntimeMetrics.hpp"
 #include "../clp/type_utils.hpp"
+#include "../reducer/TopKSketch.hpp"
 #include "../reducer/types.hpp"
 #include "FileReader.hpp"
 
@@ -122,6 +125,23 @@ void validate_network_auth(std::string_view auth_method, NetworkAuthOption& auth
     }
 }
 
+/**
+ * Validates and populates the runtime metrics output format.
+ * @param format_name
+ * @param format
+ * @throws std::invalid_argument if the format is unknown
+ */
+void validate_metrics_format(
+        std::string_view format_name,
+        clp::RuntimeMetrics::OutputFormat& format
+) {
+    auto const parsed_format{clp::RuntimeMetrics::parse_output_format(format_name)};
+    if (false == parsed_format.has_value()) {
+        throw std::invalid_argument(fmt::format("Invalid metrics format \"{}\"", format_name));
+    }
+    format = parsed_format.value();
+}
+
 /**
  * Validates and populates archive paths.
  * @param archive_path
@@ -344,10 +364,12 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
 
             po::options_description compression_options("Compression options");
             std::string input_path_list_file_path;
+            std::string var_dict_filter_type_string;
             bool normalize_file_paths{false};
             std::string path_prefix_to_remove;
             bool remove_leading_slash{false};
             std::string auth{cNoAuth};
+            std::string metrics_format{"json"};
             // clang-format off
             compression_options.add_options()(
                     "compression-level",
@@ -365,6 +387,44 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                     po::value<size_t>(&m_minimum_table_size)->value_name("MIN_TABLE_SIZE")->
                         default_value(m_minimum_table_size),
                     "Minimum size (B) for a packed table before it gets compressed."
+            )(
+                    "compression-threads",
+                    po::value<size_t>(&m_num_compression_threads)->value_name("NUM_THREADS")->
+                        default_value(m_num_compression_threads),
+                    "Number of threads used to compress packed tables when storing an archive."
+            )(
+                    "table-memory-budget",
+                    po::value<size_t>(&m_table_memory_budget)->value_name("SIZE")->
+                        default_value(m_table_memory_budget),
+                    "Maximum size (B) of the schema tables each archive buffers in memory before"
+                    " its largest tables are compressed to a temporary file (0 for no limit)."
+            )(
+                    "ingestion-threads",
+                    po::value<size_t>(&m_num_ingestion_threads)->value_name("NUM_THREADS")->
+                        default_value(m_num_ingestion_threads),
+                    "Number of threads used to ingest input files concurrently. Each thread writes"
+                    " its own archives."
+            )(
+                    "kv-ir-deserialization-threads",
+                    po::value<size_t>(&m_num_kv_ir_deserialization_threads)
+                            ->value_name("NUM_THREADS")
+                            ->default_value(m_num_kv_ir_deserialization_threads),
+                    "Number of threads used to deserialize each kv-ir input. Only zstd-compressed"
+                    " inputs on the filesystem that have an index (see log-converter's"
+                    " --write-index) can be deserialized by more than one thread."
+            )(
+                    "var-dict-filter",
+                    po::value<std::string>(&var_dict_filter_type_string)
+                            ->value_name("TYPE")
+                            ->default_value(var_dict_filter_type_string),
+                    "Store a filter of the given type (e.g. bloom) over each archive's variable"
+                    " dictionary so that searches can skip archives that can't match."
+            )(
+                    "var-dict-filter-fpr",
+                    po::value<double>(&m_var_dict_filter_false_positive_rate)
+                            ->value_name("RATE")
+                            ->default_value(m_var_dict_filter_false_positive_rate),
+                    "Target false positive rate of the variable dictionary filter."
             )(
                     "max-document-size",
                     po::value<size_t>(&m_max_document_size)->value_name("DOC_SIZE")->
@@ -424,6 +484,16 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                     "Type of authentication required for network requests (s3 | none). Authentication"
                     " with s3 requires the AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY environment"
                     " variables, and optionally the AWS_SESSION_TOKEN environment variable."
+            )(
+                    "metrics-file",
+                    po::value<std::string>(&m_metrics_file_path)->value_name("FILE"),
+                    "Write runtime metrics (per-stage timings) to FILE when the command ends"
+            )(
+                    "metrics-format",
+                    po::value<std::string>(&metrics_format)
+                        ->value_name("FORMAT")
+                        ->default_value(metrics_format),
+                    "Format of the runtime metrics (json | prometheus)"
             );
             // clang-format on
 
@@ -466,6 +536,33 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                 throw std::invalid_argument("No archives directory specified.");
             }
 
+            if (0 == m_num_compression_threads) {
+                throw std::invalid_argument("compression-threads must be at least 1.");
+            }
+
+            if (0 == m_num_ingestion_threads) {
+                throw std::invalid_argument("ingestion-threads must be at least 1.");
+            }
+
+            if (0 == m_num_kv_ir_deserialization_threads) {
+                throw std::invalid_argument("kv-ir-deserialization-threads must be at least 1.");
+            }
+
+            if (false == var_dict_filter_type_string.empty()) {
+                m_var_dict_filter_type = filter::try_parse_filter_type(var_dict_filter_type_string);
+                if (false == m_var_dict_filter_type.has_value()) {
+                    throw std::invalid_argument(
+                            "Unknown var-dict-filter type: " + var_dict_filter_type_string
+                    );
+                }
+            }
+
+            if (m_var_dict_filter_false_positive_rate < 1e-6
+                || m_var_dict_filter_false_positive_rate >= 1.0)
+            {
+                throw std::invalid_argument("var-dict-filter-fpr must be in the range [1e-6, 1).");
+            }
+
             if (false == input_path_list_file_path.empty()) {
                 if (false == read_paths_from_file(input_path_list_file_path, input_paths)) {
                     SPDLOG_ERROR("Failed to read paths from {}", input_path_list_file_path);
@@ -564,6 +661,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
             }
 
             validate_network_auth(auth, m_network_auth);
+            validate_metrics_format(metrics_format, m_metrics_format);
         } else if ((char)Command::Extract == command_input) {
             po::options_description extraction_options;
             std::string archive_path;
@@ -581,6 +679,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
 
             po::options_description decompression_options("Decompression Options");
             std::string auth{cNoAuth};
+            std::string metrics_format{"json"};
             std::string archive_id;
             // clang-format off
             decompression_options.add_options()(
@@ -611,6 +710,16 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                     "Type of authentication required for network requests (s3 | none). Authentication"
                     " with s3 requires the AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY environment"
                     " variables, and optionally the AWS_SESSION_TOKEN environment variable."
+            )(
+                    "metrics-file",
+                    po::value<std::string>(&m_metrics_file_path)->value_name("FILE"),
+                    "Write runtime metrics (per-stage timings) to FILE when the command ends"
+            )(
+                    "metrics-format",
+                    po::value<std::string>(&metrics_format)
+                        ->value_name("FORMAT")
+                        ->default_value(metrics_format),
+                    "Format of the runtime metrics (json | prometheus)"
             );
             // clang-format on
             extraction_options.add(decompression_options);
@@ -667,6 +776,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
             validate_archive_paths(archive_path, archive_id, m_input_paths);
 
             validate_network_auth(auth, m_network_auth);
+            validate_metrics_format(metrics_format, m_metrics_format);
 
             if (m_output_dir.empty()) {
                 throw std::invalid_argument("No output directory specified");
@@ -729,6 +839,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
 
             po::options_description match_options("Match Controls");
             std::string auth{cNoAuth};
+            std::string metrics_format{"json"};
             std::string archive_id;
             // clang-format off
             match_options.add_options()(
@@ -752,6 +863,16 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                 "archive-id",
                 po::value<std::string>(&archive_id)->value_name("ID"),
                 "Limit search to the archive with the given ID in a subdirectory of archive-path"
+            )(
+                "search-threads",
+                po::value<size_t>(&m_num_search_threads)
+                    ->value_name("NUM_THREADS")
+                    ->default_value(m_num_search_threads),
+                "Number of threads used to search archives concurrently"
+            )(
+                "limit",
+                po::value<uint64_t>()->value_name("NUM_RESULTS"),
+                "Stop searching once NUM_RESULTS results have been output"
             )(
                 "projection",
                 po::value<std::vector<std::string>>(&m_projection_columns)
@@ -768,6 +889,16 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                 "Type of authentication required for network requests (s3 | none). Authentication"
                 " with s3 requires the AWS_ACCESS_KEY_ID and AWS_SECRET_ACCESS_KEY environment"
                 " variables, and optionally the AWS_SESSION_TOKEN environment variable."
+            )(
+                "metrics-file",
+                po::value<std::string>(&m_metrics_file_path)->value_name("FILE"),
+                "Write runtime metrics (per-stage timings) to FILE when the search ends"
+            )(
+                "metrics-format",
+                po::value<std::string>(&metrics_format)
+                    ->value_name("FORMAT")
+                    ->default_value(metrics_format),
+                "Format of the runtime metrics (json | prometheus)"
             );
             // clang-format on
             search_options.add(match_options);
@@ -781,6 +912,37 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                 "count-by-time",
                 po::value<int64_t>(&m_count_by_time_bucket_size_ms)->value_name("SIZE"),
                 "Count the number of results in each time span of the given size (ms)"
+            )(
+                "stats",
+                po::value<std::string>(&m_aggregation_field)->value_name("FIELD"),
+                "Compute the count, sum, min, max, and average of the given numeric field across"
+                " results"
+            )(
+                "count-distinct",
+                po::value<std::string>(&m_aggregation_field)->value_name("FIELD"),
+                "Estimate the number of distinct values of the given field across results"
+            )(
+                "quantiles",
+                po::value<std::string>(&m_aggregation_field)->value_name("FIELD"),
+                "Estimate the p50, p90, p95, p99, and p999 of the given numeric field across"
+                " results, within 1% relative error"
+            )(
+                "top-k",
+                po::value<std::string>(&m_aggregation_field)->value_name("FIELD"),
+                "Estimate the most frequent values of the given field across results"
+            )(
+                "top-k-size",
+                po::value<uint32_t>(&m_top_k_size)
+                    ->value_name("K")
+                    ->default_value(m_top_k_size),
+                "Number of most frequent values to output for top-k"
+            )(
+                "group-by",
+                po::value<std::vector<std::string>>(&m_group_by_keys)
+                    ->composing()
+                    ->value_name("FIELD"),
+                "Compute the aggregation of a field separately for each distinct value of the"
+                " given field (can be specified multiple times)"
             );
             // clang-format on
             search_options.add(aggregation_options);
@@ -952,6 +1114,25 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                           << std::endl;
                 std::cerr << "  " << m_program_name << R"( s archives-dir "level: INFO")"
                           << " --count" << std::endl;
+                std::cerr << std::endl;
+
+                std::cerr << "  # Search archives in archives-dir for logs matching a KQL query"
+                             R"( "level: INFO" and output the stats of "latency" for each)"
+                             R"( "service" to the reducer)"
+                          << std::endl;
+                std::cerr << "  " << m_program_name << R"( s archives-dir "level: INFO")"
+                          << " --stats latency --group-by service"
+                          << " " << cReducerOutputHandlerName << " --host localhost"
+                          << " --port 14009"
+                          << " --job-id 1" << std::endl;
+                std::cerr << std::endl;
+
+                std::cerr << "  # Search archives in archives-dir for logs matching a KQL query"
+                             R"( "level: ERROR" and output the 5 most frequent values of)"
+                             R"( "message" to stdout)"
+                          << std::endl;
+                std::cerr << "  " << m_program_name << R"( s archives-dir "level: ERROR")"
+                          << " --top-k message --top-k-size 5" << std::endl;
 
                 po::options_description visible_options;
                 visible_options.add(general_options);
@@ -1001,6 +1182,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
             validate_archive_paths(archive_path, archive_id, m_input_paths);
 
             validate_network_auth(auth, m_network_auth);
+            validate_metrics_format(metrics_format, m_metrics_format);
 
             if (m_query.empty()) {
                 throw std::invalid_argument("No query specified");
@@ -1028,9 +1210,24 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
 
             m_aggregation_type = parse_aggregation_options(
                     parsed_command_line_options,
-                    m_count_by_time_bucket_size_ms
+                    m_count_by_time_bucket_size_ms,
+                    m_top_k_size
             );
 
+            if (0 == m_num_search_threads) {
+                throw std::invalid_argument("search-threads must be at least 1.");
+            }
+
+            if (parsed_command_line_options.count("limit")) {
+                if (m_aggregation_type.has_value()) {
+                    throw std::invalid_argument("limit can't be used with aggregations.");
+                }
+                m_max_num_results = parsed_command_line_options["limit"].as<uint64_t>();
+                if (0 == m_max_num_results.value()) {
+                    throw std::invalid_argument("limit must be greater than zero.");
+                }
+            }
+
             for (auto const& [output_handler_name, output_handler_options] : output_options_map) {
                 if (cNetworkOutputHandlerName == output_handler_name) {
                     parse_network_dest_output_handler_options(
@@ -1122,7 +1319,8 @@ void CommandLineArguments::parse_network_dest_output_handler_options(
 
 auto CommandLineArguments::parse_aggregation_options(
         po::variables_map const& parsed_options,
-        int64_t count_by_time_bucket_size_ms
+        int64_t count_by_time_bucket_size_ms,
+        uint32_t top_k_size
 ) -> std::optional<AggregationType> {
     std::optional<AggregationType> aggregation_type;
     if (parsed_options.count("count")) {
@@ -1141,6 +1339,51 @@ auto CommandLineArguments::parse_aggregation_options(
 
         aggregation_type = AggregationType::CountByTime;
     }
+
+    constexpr std::array<std::pair<std::string_view, AggregationType>, 4> cFieldAggregations{{
+            {"stats", AggregationType::Statistics},
+            {"count-distinct", AggregationType::DistinctCount},
+            {"quantiles", AggregationType::Quantiles},
+            {"top-k", AggregationType::TopK},
+    }};
+    bool is_field_aggregation{false};
+    for (auto const& [option, field_aggregation_type] : cFieldAggregations) {
+        std::string const option_name{option};
+        if (0 == parsed_options.count(option_name)) {
+            continue;
+        }
+
+        if (aggregation_type.has_value()) {
+            throw std::invalid_argument(fmt::format(
+                    "The --{} option can't be combined with another aggregation option.",
+                    option
+            ));
+        }
+
+        if (parsed_options[option_name].as<std::string>().empty()) {
+            throw std::invalid_argument(fmt::format("{} cannot be an empty string.", option));
+        }
+
+        aggregation_type = field_aggregation_type;
+        is_field_aggregation = true;
+    }
+
+    if (false == parsed_options["top-k-size"].defaulted()) {
+        if (AggregationType::TopK != aggregation_type) {
+            throw std::invalid_argument("top-k-size can only be used with top-k.");
+        }
+        if (0 == top_k_size || top_k_size > reducer::TopKSketch::cMaxK) {
+            throw std::invalid_argument(fmt::format(
+                    "top-k-size must be between 1 and {}.",
+                    reducer::TopKSketch::cMaxK
+            ));
+        }
+    }
+    if (parsed_options.count("group-by") && false == is_field_aggregation) {
+        throw std::invalid_argument(
+                "group-by can only be used with stats, count-distinct, quantiles, or top-k."
+        );
+    }
     return aggregation_type;
 }
 
@@ -1185,8 +1428,8 @@ void CommandLineArguments::parse_reducer_output_handler_options(
 
     if (false == m_aggregation_type.has_value()) {
         throw std::invalid_argument(
-                "The reducer output handler currently only supports count and count-by-time"
-                " aggregations."
+                "The reducer output handler requires an aggregation (count, count-by-time,"
+                " stats, count-distinct, quantiles, or top-k)."
         );
     }
 }
@@ -1220,6 +1463,13 @@ void CommandLineArguments::parse_results_cache_output_handler_options(
     if (0 == results_cache_options.max_num_results) {
         throw std::invalid_argument("max-num-results cannot be 0.");
     }
+
+    if (false == m_aggregation_field.empty()) {
+        throw std::invalid_argument(
+                "The results cache output handler only supports count and count-by-time"
+                " aggregations."
+        );
+    }
 }
 
 void CommandLineArguments::parse_file_output_handler_options(
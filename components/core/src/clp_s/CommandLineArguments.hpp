@@ -1,6 +1,8 @@
 #ifndef CLP_S_COMMANDLINEARGUMENTS_HPP
 #define CLP_S_COMMANDLINEARGUMENTS_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -11,8 +13,10 @@
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/variables_map.hpp>
 
+#include "../clp/RuntimeMetrics.hpp"
 #include "../reducer/types.hpp"
 #include "Defs.hpp"
+#include "filter/FilterOptions.hpp"
 #include "InputConfig.hpp"
 
 namespace clp_s {
@@ -34,8 +38,15 @@ public:
     enum class AggregationType : uint8_t {
         Count,
         CountByTime,
+        Statistics,
+        DistinctCount,
+        Quantiles,
+        TopK,
     };
 
+    // Constants
+    static constexpr uint32_t cDefaultTopKSize{10};
+
     struct ResultsCacheOutputHandlerOptions {
         std::string uri;
         std::string collection;
@@ -119,6 +130,20 @@ public:
 
     [[nodiscard]] auto get_enable_telemetry() const -> bool { return m_enable_telemetry; }
 
+    [[nodiscard]] auto get_metrics_file_path() const -> std::string const& {
+        return m_metrics_file_path;
+    }
+
+    [[nodiscard]] auto get_metrics_format() const -> clp::RuntimeMetrics::OutputFormat {
+        return m_metrics_format;
+    }
+
+    [[nodiscard]] auto get_num_search_threads() const -> size_t { return m_num_search_threads; }
+
+    [[nodiscard]] auto get_result_limit() const -> std::optional<uint64_t> {
+        return m_max_num_results;
+    }
+
     auto get_output_handler_options() const -> OutputHandlerOptionsVariant const& {
         return m_output_handler_options;
     }
@@ -131,6 +156,19 @@ public:
         return m_count_by_time_bucket_size_ms;
     }
 
+    /**
+     * @return The field of the aggregation, for aggregations that are computed over a field.
+     */
+    [[nodiscard]] auto get_aggregation_field() const -> std::string const& {
+        return m_aggregation_field;
+    }
+
+    [[nodiscard]] auto get_top_k_size() const -> uint32_t { return m_top_k_size; }
+
+    [[nodiscard]] auto get_group_by_keys() const -> std::vector<std::string> const& {
+        return m_group_by_keys;
+    }
+
     [[nodiscard]] auto get_retain_float_format() const -> bool {
         return false == m_no_retain_float_format;
     }
@@ -145,6 +183,28 @@ public:
 
     size_t get_minimum_table_size() const { return m_minimum_table_size; }
 
+    [[nodiscard]] auto get_num_compression_threads() const -> size_t {
+        return m_num_compression_threads;
+    }
+
+    [[nodiscard]] auto get_table_memory_budget() const -> size_t { return m_table_memory_budget; }
+
+    [[nodiscard]] auto get_num_ingestion_threads() const -> size_t {
+        return m_num_ingestion_threads;
+    }
+
+    [[nodiscard]] auto get_num_kv_ir_deserialization_threads() const -> size_t {
+        return m_num_kv_ir_deserialization_threads;
+    }
+
+    [[nodiscard]] auto get_var_dict_filter_type() const -> std::optional<filter::FilterType> {
+        return m_var_dict_filter_type;
+    }
+
+    [[nodiscard]] auto get_var_dict_filter_false_positive_rate() const -> double {
+        return m_var_dict_filter_false_positive_rate;
+    }
+
     std::vector<std::string> const& get_projection_columns() const { return m_projection_columns; }
 
     bool get_record_log_order() const { return false == m_disable_log_order; }
@@ -165,16 +225,18 @@ private:
     );
 
     /**
-     * Validates the aggregation options (count and count-by-time) for output handlers that
-     * support aggregations.
+     * Validates the aggregation options (count, count-by-time, and the aggregations computed over a
+     * field) for output handlers that support aggregations.
      * @param parsed_options
      * @param count_by_time_bucket_size_ms The parsed value of the count-by-time option; only
      * validated when that option was specified.
+     * @param top_k_size The parsed value of the top-k-size option.
      * @return The requested aggregation type, or std::nullopt if no aggregation was requested.
      */
     [[nodiscard]] static auto parse_aggregation_options(
             boost::program_options::variables_map const& parsed_options,
-            int64_t count_by_time_bucket_size_ms
+            int64_t count_by_time_bucket_size_ms,
+            uint32_t top_k_size
     ) -> std::optional<AggregationType>;
 
     /**
@@ -240,6 +302,8 @@ private:
     std::vector<Path> m_input_paths;
     std::vector<std::pair<Path, std::string>> m_input_paths_and_canonical_filenames;
     NetworkAuthOption m_network_auth{};
+    std::string m_metrics_file_path;
+    clp::RuntimeMetrics::OutputFormat m_metrics_format{clp::RuntimeMetrics::OutputFormat::Json};
     std::string m_archives_dir;
     std::string m_output_dir;
     std::string m_timestamp_key;
@@ -254,6 +318,12 @@ private:
     size_t m_target_ordered_chunk_size{};
     bool m_print_ordered_chunk_stats{false};
     size_t m_minimum_table_size{1ULL * 1024 * 1024};  // 1 MiB
+    size_t m_num_compression_threads{1};
+    size_t m_table_memory_budget{0};
+    size_t m_num_ingestion_threads{1};
+    size_t m_num_kv_ir_deserialization_threads{1};
+    std::optional<filter::FilterType> m_var_dict_filter_type;
+    double m_var_dict_filter_false_positive_rate{0.01};
     bool m_disable_log_order{false};
     std::string m_mongodb_uri;
     std::string m_mongodb_collection;
@@ -268,9 +338,14 @@ private:
     bool m_ignore_case{false};
     bool m_enable_telemetry{false};
     std::vector<std::string> m_projection_columns;
+    size_t m_num_search_threads{1};
+    std::optional<uint64_t> m_max_num_results;
 
     std::optional<AggregationType> m_aggregation_type;
     int64_t m_count_by_time_bucket_size_ms{};
+    std::string m_aggregation_field;
+    uint32_t m_top_k_size{cDefaultTopKSize};
+    std::vector<std::string> m_group_by_keys;
 };
 }  // namespace clp_s
 
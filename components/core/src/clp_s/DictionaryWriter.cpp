@@ -8,10 +8,13 @@
 #include <spdlog/spdlog.h>
 
 #include "../clp/Defs.h"
+#include "../clp/RuntimeMetrics.hpp"
 
 namespace clp_s {
 bool
 VariableDictionaryWriter::add_entry(std::string_view value, clp::variable_dictionary_id_t& id) {
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::DictionaryInsert};
+    timer.add_bytes(value.size());
     bool new_entry = false;
 
     auto const ix = m_value_to_id.find(value);
@@ -49,6 +52,8 @@ bool LogTypeDictionaryWriter::add_entry(
     bool is_new_entry = false;
 
     std::string const& value = logtype_entry.get_value();
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::DictionaryInsert};
+    timer.add_bytes(value.size());
     auto const ix = m_value_to_id.find(value);
     if (m_value_to_id.end() != ix) {
         // Entry exists so get its ID
@@ -3,6 +3,10 @@
 #ifndef CLP_S_DICTIONARYWRITER_HPP
 #define CLP_S_DICTIONARYWRITER_HPP
 
+#include <cstddef>
+#include <string>
+#include <string_view>
+
 #include <absl/container/flat_hash_map.h>
 
 #include "../clp/Defs.h"
@@ -54,6 +58,23 @@ public:
      */
     size_t get_data_size() const { return m_data_size; }
 
+    /**
+     * @return The number of unique entries added to the dictionary since it was opened
+     */
+    [[nodiscard]] auto get_num_entries() const -> size_t { return m_value_to_id.size(); }
+
+    /**
+     * Invokes a callback on the value of every entry in the dictionary. Must be called before the
+     * dictionary is closed.
+     * @param callback Callable with the signature `void(std::string_view)`
+     */
+    template <typename Callback>
+    auto for_each_value(Callback&& callback) const -> void {
+        for (auto const& [value, id] : m_value_to_id) {
+            callback(std::string_view{value});
+        }
+    }
+
 protected:
     // Types
     using value_to_id_t = absl::flat_hash_map<std::string, DictionaryIdType>;
@@ -9,6 +9,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "../clp/RuntimeMetrics.hpp"
+
 using std::string;
 
 namespace clp_s {
@@ -25,7 +27,9 @@ void FileWriter::write(char const* data, size_t data_length) {
     } else if (nullptr == data) {
         error_code = ErrorCodeBadParam;
     } else {
+        clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::IoWait};
         size_t num_bytes_written = fwrite(data, sizeof(*data), data_length, m_file);
+        timer.add_bytes(num_bytes_written);
         if (num_bytes_written < data_length) {
             error_code = ErrorCodeErrno;
         }
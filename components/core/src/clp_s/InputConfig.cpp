@@ -4,6 +4,7 @@
 #include <cctype>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -12,6 +13,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <system_error>
 #include <thread>
 #include <vector>
 
@@ -25,19 +27,25 @@
 
 #include "../clp/BufferedReader.hpp"
 #include "../clp/ErrorCode.hpp"
+#include "../clp/ffi/ir_stream/IrStreamIndex.hpp"
 #include "../clp/ffi/ir_stream/protocol_constants.hpp"
 #include "../clp/FileReader.hpp"
+#include "../clp/ir/constants.hpp"
 #include "../clp/LibarchiveFileReader.hpp"
 #include "../clp/LibarchiveReader.hpp"
 #include "../clp/ReaderInterface.hpp"
 #include "../clp/spdlog_with_specializations.hpp"
 #include "../clp/streaming_compression/Decompressor.hpp"
 #include "../clp/streaming_compression/zstd/Decompressor.hpp"
+#include "../clp/TraceableException.hpp"
+#include "../clp/type_utils.hpp"
 #include "../clp/utf8_utils.hpp"
 #include "Utils.hpp"
 
 #if CLP_BUILD_CLP_S_ENABLE_CURL
     #include "../clp/aws/AwsAuthenticationSigner.hpp"
+    #include "../clp/CurlRangeFetcher.hpp"
+    #include "../clp/HttpRangeReader.hpp"
     #include "../clp/NetworkReader.hpp"
 #endif
 
@@ -238,28 +246,60 @@ auto try_sign_url(std::string& url) -> bool {
     return true;
 }
 
-auto try_create_network_reader(std::string_view const url, NetworkAuthOption const& auth)
-        -> std::shared_ptr<clp::ReaderInterface> {
+/**
+ * Applies the given authentication method to a URL.
+ * @param url
+ * @param auth
+ * @return The URL to request, or std::nullopt on failure.
+ */
+auto try_get_request_url(std::string_view const url, NetworkAuthOption const& auth)
+        -> std::optional<std::string> {
     std::string request_url{url};
     switch (auth.method) {
         case AuthMethod::S3PresignedUrlV4:
             if (false == try_sign_url(request_url)) {
-                return nullptr;
+                return std::nullopt;
             }
             break;
         case AuthMethod::None:
             break;
         default:
-            return nullptr;
+            return std::nullopt;
+    }
+    return request_url;
+}
+
+auto try_create_network_reader(std::string_view const url, NetworkAuthOption const& auth)
+        -> std::shared_ptr<clp::ReaderInterface> {
+    auto const request_url{try_get_request_url(url, auth)};
+    if (false == request_url.has_value()) {
+        return nullptr;
     }
 
     try {
-        return std::make_shared<clp::NetworkReader>(request_url);
+        return std::make_shared<clp::NetworkReader>(request_url.value());
     } catch (clp::NetworkReader::OperationFailed const& e) {
         SPDLOG_ERROR("Failed to open url for reading - {}", e.what());
         return nullptr;
     }
 }
+
+auto try_create_seekable_network_reader(std::string_view const url, NetworkAuthOption const& auth)
+        -> std::shared_ptr<clp::ReaderInterface> {
+    auto const request_url{try_get_request_url(url, auth)};
+    if (false == request_url.has_value()) {
+        return nullptr;
+    }
+
+    try {
+        return std::make_shared<clp::HttpRangeReader>(
+                std::make_unique<clp::CurlRangeFetcher>(request_url.value())
+        );
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to open url for random-access reading - {}", e.what());
+        return nullptr;
+    }
+}
 #else
 auto try_create_network_reader(
         [[maybe_unused]] std::string_view const url,
@@ -268,6 +308,14 @@ auto try_create_network_reader(
     SPDLOG_ERROR("This build of clp-s does not support network inputs (libcurl excluded).");
     return nullptr;
 }
+
+auto try_create_seekable_network_reader(
+        [[maybe_unused]] std::string_view const url,
+        [[maybe_unused]] NetworkAuthOption const& auth
+) -> std::shared_ptr<clp::ReaderInterface> {
+    SPDLOG_ERROR("This build of clp-s does not support network inputs (libcurl excluded).");
+    return nullptr;
+}
 #endif
 
 auto could_be_zstd(char const* peek_buf, size_t peek_size) -> bool {
@@ -515,6 +563,57 @@ auto try_create_reader(Path const& path, NetworkAuthOption const& network_auth)
     }
 }
 
+auto try_create_seekable_reader(Path const& path, NetworkAuthOption const& network_auth)
+        -> std::shared_ptr<clp::ReaderInterface> {
+    if (InputSource::Filesystem == path.source) {
+        return try_create_file_reader(path.path);
+    } else if (InputSource::Network == path.source) {
+        return try_create_seekable_network_reader(path.path, network_auth);
+    } else {
+        return nullptr;
+    }
+}
+
+auto try_read_ir_stream_index(Path const& stream_path)
+        -> std::optional<clp::ffi::ir_stream::IrStreamIndex> {
+    if (InputSource::Filesystem != stream_path.source) {
+        return std::nullopt;
+    }
+    auto const index_path{stream_path.path + std::string{clp::ir::cIrStreamIndexFileExtension}};
+    std::error_code ec;
+    auto const index_size{std::filesystem::file_size(index_path, ec)};
+    if (ec) {
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> buf(index_size);
+    try {
+        clp::FileReader reader{index_path};
+        auto const err{reader.try_read_exact_length(
+                clp::size_checked_pointer_cast<char>(buf.data()),
+                buf.size()
+        )};
+        if (clp::ErrorCode_Success != err) {
+            SPDLOG_WARN("Failed to read IR stream index {} - error_code={}", index_path, err);
+            return std::nullopt;
+        }
+    } catch (clp::TraceableException const& ex) {
+        SPDLOG_WARN("Failed to open IR stream index {} - {}", index_path, ex.what());
+        return std::nullopt;
+    }
+
+    auto index_result{clp::ffi::ir_stream::IrStreamIndex::deserialize(buf)};
+    if (index_result.has_error()) {
+        SPDLOG_WARN(
+                "Ignoring invalid IR stream index {} - {}",
+                index_path,
+                index_result.error().message()
+        );
+        return std::nullopt;
+    }
+    return std::move(index_result.value());
+}
+
 [[nodiscard]] auto try_deduce_reader_type(std::shared_ptr<clp::ReaderInterface> reader)
         -> std::pair<std::vector<std::shared_ptr<clp::ReaderInterface>>, FileType> {
     constexpr size_t cFileReadBufferCapacity = 64 * 1024;  // 64 KiB
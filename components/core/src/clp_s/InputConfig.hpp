@@ -11,6 +11,7 @@
 #include <variant>
 #include <vector>
 
+#include "../clp/ffi/ir_stream/IrStreamIndex.hpp"
 #include "../clp/ReaderInterface.hpp"
 
 namespace clp_s {
@@ -139,6 +140,30 @@ get_input_archives_for_raw_path(std::string_view const path, std::vector<Path>&
 [[nodiscard]] auto try_create_reader(Path const& path, NetworkAuthOption const& network_auth)
         -> std::shared_ptr<clp::ReaderInterface>;
 
+/**
+ * Tries to open a clp::ReaderInterface that supports seeking in any direction using the given Path
+ * and NetworkAuthOption. Network sources are read with HTTP range requests through a block cache,
+ * so only the parts of the source that are read get downloaded.
+ * @param path
+ * @param network_auth
+ * @return the opened clp::ReaderInterface or nullptr on error
+ */
+[[nodiscard]] auto
+try_create_seekable_reader(Path const& path, NetworkAuthOption const& network_auth)
+        -> std::shared_ptr<clp::ReaderInterface>;
+
+/**
+ * Tries to read the checkpoint index written alongside the kv-pair IR stream at the given path (see
+ * `clp::ffi::ir_stream::IrStreamIndex`).
+ *
+ * NOTE: Only streams on the filesystem are checked for an index.
+ * @param stream_path
+ * @return The stream's index, or std::nullopt if the stream has no index or the index couldn't be
+ * read.
+ */
+[[nodiscard]] auto try_read_ir_stream_index(Path const& stream_path)
+        -> std::optional<clp::ffi::ir_stream::IrStreamIndex>;
+
 /**
  * Tries to deduce the underlying file-type of the file opened by `reader`, and returns a
  * (potentially new) reader for underlying JSON or KV-IR content by unwrapping layers of
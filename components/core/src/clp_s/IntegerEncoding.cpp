@@ -0,0 +1,282 @@
+#include "IntegerEncoding.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "BufferViewReader.hpp"
+#include "ErrorCode.hpp"
+#include "Utils.hpp"
+#include "ZstdCompressor.hpp"
+
+namespace clp_s {
+namespace {
+constexpr size_t cBlockSize{64};
+constexpr size_t cBitsPerWord{64};
+// Offsets that need all 64 bits are never packed since they can't be smaller than `Raw` values.
+constexpr uint8_t cMaxPackedBitWidth{63};
+constexpr size_t cPackedHeaderSize{sizeof(int64_t) + sizeof(int64_t) + sizeof(uint8_t)};
+
+using unpack_block_kernel_t = void (*)(uint64_t const* packed, uint64_t* offsets);
+
+/**
+ * The smallest and largest offsets of a sequence, as used by the frame of reference encodings.
+ */
+struct OffsetRange {
+    int64_t min{std::numeric_limits<int64_t>::max()};
+    int64_t max{std::numeric_limits<int64_t>::min()};
+};
+
+/**
+ * @param num_values
+ * @return The number of 64-value blocks needed to pack every value after the first.
+ */
+[[nodiscard]] auto get_num_blocks(size_t num_values) -> size_t;
+
+/**
+ * @param range
+ * @return The number of bits needed to store any offset from `range.min` to `range.max`.
+ */
+[[nodiscard]] auto get_bit_width(OffsetRange const& range) -> uint8_t;
+
+/**
+ * @param values
+ * @param i An index greater than zero.
+ * @return The difference between `values[i]` and `values[i - 1]`, wrapping on overflow.
+ */
+[[nodiscard]] auto get_delta(std::span<int64_t const> values, size_t i) -> int64_t;
+
+/**
+ * Unpacks a block of 64 offsets that were each packed into `BitWidth` bits. Specializing the kernel
+ * on the bit width turns every shift and mask into a constant so the compiler can fully unroll and
+ * vectorize the loop.
+ * @tparam BitWidth
+ * @param packed The `BitWidth` words holding the block.
+ * @param offsets Returns the 64 unpacked offsets.
+ */
+template <uint8_t BitWidth>
+auto unpack_block(uint64_t const* packed, uint64_t* offsets) -> void;
+
+/**
+ * @return A table mapping each bit width to the kernel that unpacks blocks of that width.
+ */
+template <size_t... BitWidths>
+constexpr auto make_unpack_block_kernels(std::index_sequence<BitWidths...>)
+        -> std::array<unpack_block_kernel_t, sizeof...(BitWidths)>;
+
+auto get_num_blocks(size_t num_values) -> size_t {
+    if (num_values < 2) {
+        return 0;
+    }
+    return (num_values - 1 + cBlockSize - 1) / cBlockSize;
+}
+
+auto get_bit_width(OffsetRange const& range) -> uint8_t {
+    auto const span{static_cast<uint64_t>(range.max) - static_cast<uint64_t>(range.min)};
+    return static_cast<uint8_t>(std::bit_width(span));
+}
+
+auto get_delta(std::span<int64_t const> values, size_t i) -> int64_t {
+    return static_cast<int64_t>(
+            static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(values[i - 1])
+    );
+}
+
+template <uint8_t BitWidth>
+auto unpack_block(uint64_t const* packed, uint64_t* offsets) -> void {
+    if constexpr (0 == BitWidth) {
+        std::fill_n(offsets, cBlockSize, 0);
+    } else {
+        constexpr uint64_t cMask{(uint64_t{1} << BitWidth) - 1};
+        for (size_t i{0}; i < cBlockSize; ++i) {
+            size_t const bit_idx{i * BitWidth};
+            size_t const word_idx{bit_idx / cBitsPerWord};
+            size_t const shift{bit_idx % cBitsPerWord};
+            uint64_t offset{packed[word_idx] >> shift};
+            if (shift + BitWidth > cBitsPerWord) {
+                offset |= packed[word_idx + 1] << (cBitsPerWord - shift);
+            }
+            offsets[i] = offset & cMask;
+        }
+    }
+}
+
+template <size_t... BitWidths>
+constexpr auto make_unpack_block_kernels(std::index_sequence<BitWidths...>)
+        -> std::array<unpack_block_kernel_t, sizeof...(BitWidths)> {
+    return {&unpack_block<static_cast<uint8_t>(BitWidths)>...};
+}
+
+constexpr auto cUnpackBlockKernels{
+        make_unpack_block_kernels(std::make_index_sequence<cMaxPackedBitWidth + 1>{})
+};
+}  // namespace
+
+auto choose_integer_encoding(std::span<int64_t const> values) -> IntegerEncodingParameters {
+    IntegerEncodingParameters const raw_parameters{};
+    if (values.size() < 2) {
+        return raw_parameters;
+    }
+
+    OffsetRange value_range;
+    OffsetRange delta_range;
+    for (size_t i{1}; i < values.size(); ++i) {
+        value_range.min = std::min(value_range.min, values[i]);
+        value_range.max = std::max(value_range.max, values[i]);
+        auto const delta{get_delta(values, i)};
+        delta_range.min = std::min(delta_range.min, delta);
+        delta_range.max = std::max(delta_range.max, delta);
+    }
+
+    IntegerEncodingParameters const frame_of_reference_parameters{
+            IntegerEncoding::FrameOfReference,
+            value_range.min,
+            get_bit_width(value_range)
+    };
+    IntegerEncodingParameters const delta_parameters{
+            IntegerEncoding::Delta,
+            delta_range.min,
+            get_bit_width(delta_range)
+    };
+
+    auto best_parameters{raw_parameters};
+    auto best_size{get_encoded_integers_size(raw_parameters, values.size())};
+    for (auto const& parameters : {frame_of_reference_parameters, delta_parameters}) {
+        if (parameters.bit_width > cMaxPackedBitWidth) {
+            continue;
+        }
+        if (auto const size{get_encoded_integers_size(parameters, values.size())};
+            size < best_size)
+        {
+            best_parameters = parameters;
+            best_size = size;
+        }
+    }
+    return best_parameters;
+}
+
+auto get_encoded_integers_size(IntegerEncodingParameters const& parameters, size_t num_values)
+        -> size_t {
+    if (IntegerEncoding::Raw == parameters.encoding) {
+        return sizeof(IntegerEncoding) + num_values * sizeof(int64_t);
+    }
+    if (0 == num_values) {
+        return sizeof(IntegerEncoding);
+    }
+    return sizeof(IntegerEncoding) + cPackedHeaderSize
+           + get_num_blocks(num_values) * parameters.bit_width * sizeof(uint64_t);
+}
+
+auto write_encoded_integers(
+        ZstdCompressor& compressor,
+        std::span<int64_t const> values,
+        IntegerEncodingParameters const& parameters
+) -> void {
+    compressor.write_numeric_value(parameters.encoding);
+    if (IntegerEncoding::Raw == parameters.encoding) {
+        compressor.write(
+                reinterpret_cast<char const*>(values.data()),
+                values.size() * sizeof(int64_t)
+        );
+        return;
+    }
+    if (values.empty()) {
+        return;
+    }
+
+    auto const bit_width{parameters.bit_width};
+    auto const reference{static_cast<uint64_t>(parameters.reference)};
+    std::vector<uint64_t> packed(get_num_blocks(values.size()) * bit_width, 0);
+    if (bit_width > 0) {
+        for (size_t i{1}; i < values.size(); ++i) {
+            auto const value{
+                    IntegerEncoding::Delta == parameters.encoding ? get_delta(values, i)
+                                                                  : values[i]
+            };
+            auto const offset{static_cast<uint64_t>(value) - reference};
+            size_t const bit_idx{(i - 1) * bit_width};
+            size_t const word_idx{bit_idx / cBitsPerWord};
+            size_t const shift{bit_idx % cBitsPerWord};
+            packed[word_idx] |= offset << shift;
+            if (shift + bit_width > cBitsPerWord) {
+                packed[word_idx + 1] |= offset >> (cBitsPerWord - shift);
+            }
+        }
+    }
+
+    compressor.write_numeric_value(values.front());
+    compressor.write_numeric_value(parameters.reference);
+    compressor.write_numeric_value(bit_width);
+    compressor.write(
+            reinterpret_cast<char const*>(packed.data()),
+            packed.size() * sizeof(uint64_t)
+    );
+}
+
+auto read_encoded_integers(
+        BufferViewReader& reader,
+        uint64_t num_values,
+        std::vector<int64_t>& decoded_values
+) -> UnalignedMemSpan<int64_t> {
+    auto const encoding{reader.read_value<IntegerEncoding>()};
+    if (IntegerEncoding::Raw == encoding) {
+        return reader.read_unaligned_span_u64<int64_t>(num_values);
+    }
+    if (IntegerEncoding::FrameOfReference != encoding && IntegerEncoding::Delta != encoding) {
+        throw BufferViewReader::OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+    }
+    if (0 == num_values) {
+        return {};
+    }
+    if (num_values > std::numeric_limits<size_t>::max() - cBlockSize) {
+        throw BufferViewReader::OperationFailed(ErrorCodeOutOfBounds, __FILENAME__, __LINE__);
+    }
+
+    auto const first_value{reader.read_value<int64_t>()};
+    auto const reference{static_cast<uint64_t>(reader.read_value<int64_t>())};
+    auto const bit_width{reader.read_value<uint8_t>()};
+    if (bit_width > cMaxPackedBitWidth) {
+        throw BufferViewReader::OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+    }
+    auto const num_blocks{get_num_blocks(static_cast<size_t>(num_values))};
+    auto const packed{reader.read_unaligned_span<uint64_t>(num_blocks * bit_width)};
+
+    // Blocks are unpacked whole, so the buffer is padded to a multiple of the block size and
+    // truncated afterwards.
+    decoded_values.resize(1 + num_blocks * cBlockSize);
+    decoded_values[0] = first_value;
+    auto const unpack{cUnpackBlockKernels.at(bit_width)};
+    std::array<uint64_t, cMaxPackedBitWidth> block_words{};
+    std::array<uint64_t, cBlockSize> offsets{};
+    for (size_t block_idx{0}; block_idx < num_blocks; ++block_idx) {
+        std::memcpy(
+                block_words.data(),
+                packed.data() + block_idx * bit_width * sizeof(uint64_t),
+                bit_width * sizeof(uint64_t)
+        );
+        unpack(block_words.data(), offsets.data());
+        auto* block_values{decoded_values.data() + 1 + block_idx * cBlockSize};
+        for (size_t i{0}; i < cBlockSize; ++i) {
+            block_values[i] = static_cast<int64_t>(reference + offsets[i]);
+        }
+    }
+    decoded_values.resize(static_cast<size_t>(num_values));
+
+    if (IntegerEncoding::Delta == encoding) {
+        for (size_t i{1}; i < decoded_values.size(); ++i) {
+            decoded_values[i] = static_cast<int64_t>(
+                    static_cast<uint64_t>(decoded_values[i - 1])
+                    + static_cast<uint64_t>(decoded_values[i])
+            );
+        }
+    }
+    return {reinterpret_cast<char*>(decoded_values.data()), decoded_values.size()};
+}
+}  // namespace clp_s
@@ -0,0 +1,97 @@
+#ifndef CLP_S_INTEGERENCODING_HPP
+#define CLP_S_INTEGERENCODING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "BufferViewReader.hpp"
+#include "Utils.hpp"
+#include "ZstdCompressor.hpp"
+
+namespace clp_s {
+/**
+ * Encodings for a column of 64-bit integers. Every encoding except `Raw` stores the first value
+ * as-is and bit-packs the remaining values as unsigned offsets from a frame of reference.
+ *
+ * Layout:
+ * - Encoding: <8-bit `IntegerEncoding`>
+ * - If the encoding is `Raw`:
+ *   - Values: <64-bit integer> * number of values
+ * - Otherwise, if there is at least one value:
+ *   - First value: <64-bit integer>
+ *   - Frame of reference: <64-bit integer>
+ *   - Bit width: <8-bit integer>
+ *   - Packed offsets: <64-bit integer> * (bit width * number of 64-value blocks)
+ *
+ * The offsets are packed into blocks of 64 values so that each block occupies exactly "bit width"
+ * words, which lets every block be unpacked by a kernel specialized for its bit width.
+ */
+enum class IntegerEncoding : uint8_t {
+    // Each value is stored as a 64-bit integer.
+    Raw = 0,
+    // Each value after the first is stored as its offset from the smallest such value.
+    FrameOfReference = 1,
+    // Each value after the first is stored as the offset of its delta from the previous value from
+    // the smallest such delta.
+    Delta = 2
+};
+
+/**
+ * An integer encoding and the parameters needed to apply it to a specific sequence of values.
+ */
+struct IntegerEncodingParameters {
+    IntegerEncoding encoding{IntegerEncoding::Raw};
+    int64_t reference{};
+    uint8_t bit_width{};
+};
+
+/**
+ * Chooses the encoding that stores the given values in the fewest bytes, preferring `Raw` on
+ * ties.
+ * @param values
+ * @return The chosen encoding and its parameters.
+ */
+[[nodiscard]] auto choose_integer_encoding(std::span<int64_t const> values)
+        -> IntegerEncodingParameters;
+
+/**
+ * @param parameters
+ * @param num_values
+ * @return The number of bytes `write_encoded_integers` writes for `num_values` values encoded with
+ * the given parameters.
+ */
+[[nodiscard]] auto
+get_encoded_integers_size(IntegerEncodingParameters const& parameters, size_t num_values)
+        -> size_t;
+
+/**
+ * Encodes values with the given parameters and writes them to a compressor.
+ * @param compressor
+ * @param values
+ * @param parameters Parameters returned by `choose_integer_encoding` for `values`.
+ */
+auto write_encoded_integers(
+        ZstdCompressor& compressor,
+        std::span<int64_t const> values,
+        IntegerEncodingParameters const& parameters
+) -> void;
+
+/**
+ * Reads values written by `write_encoded_integers`. `Raw` values are returned as a view into the
+ * reader's buffer, while other encodings are decoded into `decoded_values`.
+ * @param reader
+ * @param num_values
+ * @param decoded_values Storage for decoded values. It must outlive the returned view.
+ * @return A view of the values.
+ * @throw BufferViewReader::OperationFailed if the buffer is too small or the encoding is invalid.
+ */
+[[nodiscard]] auto read_encoded_integers(
+        BufferViewReader& reader,
+        uint64_t num_values,
+        std::vector<int64_t>& decoded_values
+) -> UnalignedMemSpan<int64_t>;
+}  // namespace clp_s
+
+#endif  // CLP_S_INTEGERENCODING_HPP
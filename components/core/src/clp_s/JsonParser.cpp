@@ -27,12 +27,14 @@
 #include <clp/ffi/SchemaTree.hpp>
 #include <clp/ffi/Value.hpp>
 #include <clp/ReaderInterface.hpp>
+#include <clp/RuntimeMetrics.hpp>
 #include <clp/time_types.hpp>
 #include <clp_s/archive_constants.hpp>
 #include <clp_s/ErrorCode.hpp>
 #include <clp_s/FloatFormatEncoding.hpp>
 #include <clp_s/InputConfig.hpp>
 #include <clp_s/JsonFileIterator.hpp>
+#include <clp_s/ParallelKvIrDeserializer.hpp>
 #include <clp_s/search/ast/ColumnDescriptor.hpp>
 #include <clp_s/search/ast/SearchUtils.hpp>
 #include <clp_s/Utils.hpp>
@@ -79,7 +81,12 @@ public:
     [[nodiscard]] auto
     handle_log_event(KeyValuePairLogEvent&& log_event, [[maybe_unused]] size_t log_event_idx)
             -> IRErrorCode {
-        m_deserialized_log_event.emplace(std::move(log_event));
+        if (m_deserialized_log_event.has_value()) {
+            // Swap with the previous log event so that the deserializer can reuse its storage
+            std::swap(m_deserialized_log_event.value(), log_event);
+        } else {
+            m_deserialized_log_event.emplace(std::move(log_event));
+        }
         return IRErrorCode::IRErrorCode_Success;
     }
 
@@ -139,12 +146,14 @@ auto round_trip_is_identical(std::string_view float_str, double value, float_for
 JsonParser::JsonParser(JsonParserOption const& option)
         : m_target_encoded_size(option.target_encoded_size),
           m_max_document_size(option.max_document_size),
+          m_num_kv_ir_deserialization_threads(option.num_kv_ir_deserialization_threads),
           m_timestamp_key(option.timestamp_key),
           m_structurize_arrays(option.structurize_arrays),
           m_record_log_order(option.record_log_order),
           m_retain_float_format(option.retain_float_format),
           m_input_paths_and_canonical_filenames{option.input_paths_and_canonical_filenames},
-          m_network_auth(option.network_auth) {
+          m_network_auth(option.network_auth),
+          m_archive_creator_id{boost::uuids::to_string(m_generator())} {
     if (false == m_timestamp_key.empty()) {
         if (false
             == clp_s::search::ast::tokenize_column_descriptor(
@@ -178,6 +187,11 @@ JsonParser::JsonParser(JsonParserOption const& option)
     m_archive_options.print_archive_stats = option.print_archive_stats;
     m_archive_options.single_file_archive = option.single_file_archive;
     m_archive_options.min_table_size = option.min_table_size;
+    m_archive_options.num_compression_threads = option.num_compression_threads;
+    m_archive_options.table_memory_budget = option.table_memory_budget;
+    m_archive_options.var_dict_filter_type = option.var_dict_filter_type;
+    m_archive_options.var_dict_filter_false_positive_rate
+            = option.var_dict_filter_false_positive_rate;
     m_archive_options.id = m_generator();
     m_archive_options.authoritative_timestamp = m_timestamp_column;
     m_archive_options.authoritative_timestamp_namespace = m_timestamp_namespace;
@@ -644,106 +658,114 @@ void JsonParser::parse_line(
 }
 
 bool JsonParser::ingest() {
-    auto archive_creator_id = boost::uuids::to_string(m_generator());
     for (auto const& [path, file_name_in_metadata] : m_input_paths_and_canonical_filenames) {
-        auto [nested_readers, file_type]
-                = try_create_reader_and_deduce_type_with_retries(path, m_network_auth);
-
-        bool ingestion_successful{};
-        switch (file_type) {
-            case FileType::EmptyFile:
-            case FileType::Json:
-                ingestion_successful = ingest_json(
-                        nested_readers.back(),
-                        path,
-                        file_name_in_metadata,
-                        archive_creator_id
-                );
-                break;
-            case FileType::KeyValueIr:
-                ingestion_successful = ingest_kvir(
-                        nested_readers.back(),
-                        path,
-                        file_name_in_metadata,
-                        archive_creator_id
-                );
-                break;
-            case FileType::LogText:
-                SPDLOG_ERROR(
-                        "Direct ingestion of unstructured log-text is not supported from input {}",
-                        path.path
-                );
+        if (false == ingest_input(path, file_name_in_metadata)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto JsonParser::ingest_input(Path const& path, std::string const& file_name_in_metadata) -> bool {
+    clp::RuntimeMetrics::ScopedTimer const parse_timer{clp::RuntimeMetrics::Stage::Parse};
+    auto const& archive_creator_id{m_archive_creator_id};
+    auto [nested_readers, file_type]
+            = try_create_reader_and_deduce_type_with_retries(path, m_network_auth);
+
+    bool ingestion_successful{};
+    switch (file_type) {
+        case FileType::EmptyFile:
+        case FileType::Json:
+            ingestion_successful = ingest_json(
+                    nested_readers.back(),
+                    path,
+                    file_name_in_metadata,
+                    archive_creator_id
+            );
+            break;
+        case FileType::KeyValueIr:
+            ingestion_successful = ingest_kvir(
+                    nested_readers.back(),
+                    path,
+                    file_name_in_metadata,
+                    archive_creator_id,
+                    m_num_kv_ir_deserialization_threads > 1
+                            ? try_read_ir_stream_index(path)
+                            : std::nullopt
+            );
+            break;
+        case FileType::LogText:
+            SPDLOG_ERROR(
+                    "Direct ingestion of unstructured log-text is not supported from input {}",
+                    path.path
+            );
+            std::ignore = m_archive_writer->close();
+            return false;
+        case FileType::Unknown: {
+            if (false == nested_readers.empty()
+                && NetworkUtils::check_and_log_curl_error(path.path, nested_readers.front().get()))
+            {
+                close_nested_readers(nested_readers);
+                SPDLOG_ERROR("Could not deduce content type for input {}", path.path);
                 std::ignore = m_archive_writer->close();
                 return false;
-            case FileType::Unknown: {
-                if (false == nested_readers.empty()
-                    && NetworkUtils::check_and_log_curl_error(
-                            path.path,
-                            nested_readers.front().get()
-                    ))
-                {
-                    close_nested_readers(nested_readers);
-                    SPDLOG_ERROR("Could not deduce content type for input {}", path.path);
-                    std::ignore = m_archive_writer->close();
-                    return false;
-                }
-
-                auto json_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
-                                        std::string const& file_name) -> bool {
-                    return ingest_json(reader, path, file_name, archive_creator_id);
-                };
+            }
 
-                auto kv_ir_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
-                                         std::string const& file_name) -> bool {
-                    return ingest_kvir(reader, path, file_name, archive_creator_id);
-                };
+            auto json_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
+                                    std::string const& file_name) -> bool {
+                return ingest_json(reader, path, file_name, archive_creator_id);
+            };
 
-                auto log_text_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
-                                            std::string const& file_name) -> bool {
-                    SPDLOG_ERROR(
-                            "Direct ingestion of unstructured log-text is not supported from"
-                            " archive member {}",
-                            file_name
-                    );
-                    return false;
-                };
+            auto kv_ir_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
+                                     std::string const& file_name) -> bool {
+                return ingest_kvir(reader, path, file_name, archive_creator_id);
+            };
 
-                if (false == nested_readers.empty()
-                    && try_process_general_purpose_archive_with_libarchive(
-                            nested_readers.back(),
-                            path,
-                            file_name_in_metadata,
-                            json_handler,
-                            kv_ir_handler,
-                            log_text_handler,
-                            json_handler
-                    ))
-                {
-                    ingestion_successful = true;
-                    break;
-                }
-            }
-            case FileType::Zstd:
-            default: {
-                if (false == nested_readers.empty()) {
-                    NetworkUtils::check_and_log_curl_error(path.path, nested_readers.front().get());
-                    close_nested_readers(nested_readers);
-                }
-                SPDLOG_ERROR("Could not deduce content type for input {}", path.path);
-                std::ignore = m_archive_writer->close();
+            auto log_text_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
+                                        std::string const& file_name) -> bool {
+                SPDLOG_ERROR(
+                        "Direct ingestion of unstructured log-text is not supported from"
+                        " archive member {}",
+                        file_name
+                );
                 return false;
+            };
+
+            if (false == nested_readers.empty()
+                && try_process_general_purpose_archive_with_libarchive(
+                        nested_readers.back(),
+                        path,
+                        file_name_in_metadata,
+                        json_handler,
+                        kv_ir_handler,
+                        log_text_handler,
+                        json_handler
+                ))
+            {
+                ingestion_successful = true;
+                break;
             }
         }
-
-        close_nested_readers(nested_readers);
-        if (false == ingestion_successful
-            || (false == nested_readers.empty()
-                && NetworkUtils::check_and_log_curl_error(path.path, nested_readers.front().get())))
-        {
+        case FileType::Zstd:
+        default: {
+            if (false == nested_readers.empty()) {
+                NetworkUtils::check_and_log_curl_error(path.path, nested_readers.front().get());
+                close_nested_readers(nested_readers);
+            }
+            SPDLOG_ERROR("Could not deduce content type for input {}", path.path);
             std::ignore = m_archive_writer->close();
             return false;
         }
     }
+
+    close_nested_readers(nested_readers);
+    if (false == ingestion_successful
+        || (false == nested_readers.empty()
+            && NetworkUtils::check_and_log_curl_error(path.path, nested_readers.front().get())))
+    {
+        std::ignore = m_archive_writer->close();
+        return false;
+    }
     return true;
 }
 
@@ -921,7 +943,8 @@ auto JsonParser::ingest_kvir(
         std::shared_ptr<clp::ReaderInterface> reader,
         Path const& path,
         std::string const& file_name_in_metadata,
-        std::string const& archive_creator_id
+        std::string const& archive_creator_id,
+        std::optional<clp::ffi::ir_stream::IrStreamIndex> index
 ) -> bool {
     auto deserializer_result{Deserializer<IrUnitHandler>::create(*reader, IrUnitHandler{})};
     if (deserializer_result.has_error()) {
@@ -1011,75 +1034,127 @@ auto JsonParser::ingest_kvir(
 
     size_t curr_pos{};
     size_t last_pos{};
-    while (true) {
-        auto const kv_log_event_result{deserializer.deserialize_next_ir_unit(*reader)};
+    // Ingests a log event that ends at `log_event_end_pos` in the (decompressed) stream.
+    auto ingest_log_event = [&](KeyValuePairLogEvent const& kv_log_event,
+                                size_t log_event_end_pos) -> bool {
+        m_current_schema.clear();
 
-        if (kv_log_event_result.has_error()) {
-            auto err = kv_log_event_result.error();
-            SPDLOG_WARN(
-                    "Encountered error while deserializing kv-ir log event from stream \"{}\": "
-                    "({}) - {}",
-                    path.path,
-                    err.value(),
-                    err.message()
+        // Add log_event_idx field to metadata for record
+        if (m_record_log_order) {
+            m_current_parsed_message.add_value(
+                    log_event_idx_node_id,
+                    m_archive_writer->get_next_log_event_id()
             );
-            // Treat deserialization error as end of a truncated stream.
-            break;
+            m_current_schema.insert_ordered(log_event_idx_node_id);
         }
-        if (kv_log_event_result.value() == clp::ffi::ir_stream::IrUnitType::EndOfStream) {
-            break;
+
+        try {
+            parse_kv_log_event(kv_log_event);
+        } catch (std::exception const& e) {
+            SPDLOG_ERROR("Encountered error while parsing a kv log event - {}", e.what());
+            return false;
         }
-        if (kv_log_event_result.value() == clp::ffi::ir_stream::IrUnitType::LogEvent) {
-            auto const kv_log_event = &(ir_unit_handler.get_deserialized_log_event().value());
 
-            m_current_schema.clear();
+        if (m_archive_writer->get_data_size() >= m_target_encoded_size) {
+            m_ir_node_to_archive_node_id_mapping.clear();
+            m_autogen_ir_node_to_archive_node_id_mapping.clear();
+            curr_pos = log_event_end_pos;
+            m_archive_writer->increment_uncompressed_size(curr_pos - last_pos);
+            last_pos = curr_pos;
+            split_archive();
+            update_fields_after_archive_split();
+            if (false == initialize_fields_for_archive()) {
+                return false;
+            }
+        }
 
-            // Add log_event_idx field to metadata for record
-            if (m_record_log_order) {
-                m_current_parsed_message.add_value(
-                        log_event_idx_node_id,
-                        m_archive_writer->get_next_log_event_id()
+        m_current_parsed_message.clear();
+        return true;
+    };
+
+    std::optional<ParallelKvIrDeserializer> parallel_deserializer;
+    if (index.has_value()) {
+        parallel_deserializer = ParallelKvIrDeserializer::create(
+                path.path,
+                std::move(index.value()),
+                m_num_kv_ir_deserialization_threads
+        );
+    }
+    if (parallel_deserializer.has_value()) {
+        // Schema tree node IDs are the same in every chunk, so the log events of all chunks can be
+        // ingested as if they came from `deserializer`.
+        curr_pos = reader->get_pos();
+        while (true) {
+            auto chunk{parallel_deserializer->get_next_chunk()};
+            if (false == chunk.has_value()) {
+                break;
+            }
+            for (size_t i{0}; i < chunk->log_events.size(); ++i) {
+                if (false
+                    == ingest_log_event(chunk->log_events[i], chunk->log_event_end_offsets[i]))
+                {
+                    return false;
+                }
+            }
+            curr_pos = chunk->end_offset;
+            if (chunk->error.has_value()) {
+                auto const& err{chunk->error.value()};
+                SPDLOG_WARN(
+                        "Encountered error while deserializing kv-ir log event from stream \"{}\": "
+                        "({}) - {}",
+                        path.path,
+                        err.value(),
+                        err.message()
                 );
-                m_current_schema.insert_ordered(log_event_idx_node_id);
+                // Treat deserialization error as end of a truncated stream.
+                break;
             }
-
-            try {
-                parse_kv_log_event(*kv_log_event);
-            } catch (std::exception const& e) {
-                SPDLOG_ERROR("Encountered error while parsing a kv log event - {}", e.what());
-                return false;
+        }
+    } else {
+        while (true) {
+            auto const kv_log_event_result{deserializer.deserialize_next_ir_unit(*reader)};
+
+            if (kv_log_event_result.has_error()) {
+                auto err = kv_log_event_result.error();
+                SPDLOG_WARN(
+                        "Encountered error while deserializing kv-ir log event from stream \"{}\": "
+                        "({}) - {}",
+                        path.path,
+                        err.value(),
+                        err.message()
+                );
+                // Treat deserialization error as end of a truncated stream.
+                break;
             }
-
-            if (m_archive_writer->get_data_size() >= m_target_encoded_size) {
-                m_ir_node_to_archive_node_id_mapping.clear();
-                m_autogen_ir_node_to_archive_node_id_mapping.clear();
-                curr_pos = reader->get_pos();
-                m_archive_writer->increment_uncompressed_size(curr_pos - last_pos);
-                last_pos = curr_pos;
-                split_archive();
-                update_fields_after_archive_split();
-                if (false == initialize_fields_for_archive()) {
+            if (kv_log_event_result.value() == clp::ffi::ir_stream::IrUnitType::EndOfStream) {
+                break;
+            }
+            if (kv_log_event_result.value() == clp::ffi::ir_stream::IrUnitType::LogEvent) {
+                if (false
+                    == ingest_log_event(
+                            ir_unit_handler.get_deserialized_log_event().value(),
+                            reader->get_pos()
+                    ))
+                {
                     return false;
                 }
+                ir_unit_handler.clear();
+            } else if (kv_log_event_result.value()
+                       == clp::ffi::ir_stream::IrUnitType::SchemaTreeNodeInsertion)
+            {
+                continue;
+            } else {
+                SPDLOG_ERROR(
+                        "Encountered unknown IR unit type ({}) during deserialization.",
+                        static_cast<uint8_t>(kv_log_event_result.value())
+                );
+                return false;
             }
-
-            ir_unit_handler.clear();
-            m_current_parsed_message.clear();
-        } else if (kv_log_event_result.value()
-                   == clp::ffi::ir_stream::IrUnitType::SchemaTreeNodeInsertion)
-        {
-            continue;
-        } else {
-            SPDLOG_ERROR(
-                    "Encountered unknown IR unit type ({}) during deserialization.",
-                    static_cast<uint8_t>(kv_log_event_result.value())
-            );
-            return false;
         }
+        curr_pos = reader->get_pos();
     }
     m_ir_node_to_archive_node_id_mapping.clear();
     m_autogen_ir_node_to_archive_node_id_mapping.clear();
-    curr_pos = reader->get_pos();
     m_archive_writer->increment_uncompressed_size(curr_pos - last_pos);
 
     if (m_record_log_order) {
@@ -14,12 +14,14 @@
 #include <boost/uuid/random_generator.hpp>
 #include <simdjson.h>
 
+#include <clp/ffi/ir_stream/IrStreamIndex.hpp>
 #include <clp/ffi/KeyValuePairLogEvent.hpp>
 #include <clp/ffi/SchemaTree.hpp>
 #include <clp/ffi/Value.hpp>
 #include <clp/ReaderInterface.hpp>
 #include <clp_s/ArchiveWriter.hpp>
 #include <clp_s/ErrorCode.hpp>
+#include <clp_s/filter/FilterOptions.hpp>
 #include <clp_s/InputConfig.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/Schema.hpp>
@@ -34,6 +36,11 @@ struct JsonParserOption {
     size_t target_encoded_size{};
     size_t max_document_size{};
     size_t min_table_size{};
+    size_t num_compression_threads{1};
+    size_t table_memory_budget{0};
+    size_t num_kv_ir_deserialization_threads{1};
+    std::optional<filter::FilterType> var_dict_filter_type;
+    double var_dict_filter_false_positive_rate{cDefaultVarDictFilterFalsePositiveRate};
     int compression_level{};
     bool print_archive_stats{};
     bool structurize_arrays{};
@@ -64,6 +71,18 @@ public:
      */
     [[nodiscard]] auto ingest() -> bool;
 
+    /**
+     * Ingests a single input into the current archive, splitting the archive if it grows beyond the
+     * target encoded size.
+     *
+     * NOTE: On failure, the current archive is closed and this parser should no longer be used.
+     * @param path
+     * @param file_name_in_metadata
+     * @return Whether the input was ingested successfully.
+     */
+    [[nodiscard]] auto ingest_input(Path const& path, std::string const& file_name_in_metadata)
+            -> bool;
+
     /**
      * Writes the metadata and archive data to disk.
      * @return Statistics for every archive that was written without encountering an error.
@@ -90,17 +109,24 @@ private:
     /**
      * Parses KV-IR input and ingests it into the current archive, splitting the archive if it grows
      * beyond the target encoded size.
+     *
+     * If the input's index is given, the input is deserialized by up to
+     * `num_kv_ir_deserialization_threads` threads (see `ParallelKvIrDeserializer`). The log events
+     * are still ingested in stream order, so the resulting archives are the same as if the input
+     * were deserialized by a single thread.
      * @param reader
      * @param path
      * @param file_name_in_metadata
      * @param archive_creator_id
+     * @param index The index of the input, if the input is a file on the filesystem.
      * @return Whether ingestion was successful or not.
      */
     [[nodiscard]] auto ingest_kvir(
             std::shared_ptr<clp::ReaderInterface> reader,
             Path const& path,
             std::string const& file_name_in_metadata,
-            std::string const& archive_creator_id
+            std::string const& archive_creator_id,
+            std::optional<clp::ffi::ir_stream::IrStreamIndex> index = std::nullopt
     ) -> bool;
 
     /**
@@ -226,10 +252,12 @@ private:
     std::string m_timestamp_namespace;
 
     boost::uuids::random_generator m_generator;
+    std::string m_archive_creator_id;
     std::unique_ptr<ArchiveWriter> m_archive_writer;
     ArchiveWriterOption m_archive_options{};
     size_t m_target_encoded_size;
     size_t m_max_document_size;
+    size_t m_num_kv_ir_deserialization_threads{1};
     bool m_structurize_arrays{false};
     bool m_record_log_order{true};
     bool m_retain_float_format{false};
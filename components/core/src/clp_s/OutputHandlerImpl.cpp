@@ -1,8 +1,11 @@
 #include "OutputHandlerImpl.hpp"
 
+#include <cstddef>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <mongocxx/client.hpp>
@@ -12,13 +15,17 @@
 #include <mongocxx/uri.hpp>
 #include <msgpack.hpp>
 #include <nlohmann/json.hpp>
+#include <simdjson.h>
 #include <spdlog/spdlog.h>
 
 #include "../clp/networking/socket_utils.hpp"
 #include "../reducer/CountOperator.hpp"
 #include "../reducer/network_utils.hpp"
 #include "../reducer/Record.hpp"
+#include "../reducer/RecordTypedKeyIterator.hpp"
 #include "archive_constants.hpp"
+#include "search/ast/ColumnDescriptor.hpp"
+#include "search/ast/SearchUtils.hpp"
 #include "search/OutputHandler.hpp"
 #include "TraceableException.hpp"
 
@@ -237,6 +244,72 @@ auto CountByTimeReducerOutputHandler::finish() -> ErrorCode {
     return ErrorCode::ErrorCodeSuccess;
 }
 
+auto SynchronizedOutputHandler::write(
+        std::string_view message,
+        epochtime_t timestamp,
+        std::string_view archive_id,
+        int64_t log_event_idx
+) -> void {
+    if (false == m_should_buffer_results) {
+        m_handler->write(message, timestamp, archive_id, log_event_idx);
+        return;
+    }
+    if (m_archive_id.empty()) {
+        m_archive_id = archive_id;
+    }
+    m_buffered_results.emplace_back(std::string{message}, timestamp, log_event_idx, true);
+}
+
+auto SynchronizedOutputHandler::write(std::string_view message) -> void {
+    if (false == m_should_buffer_results) {
+        m_handler->write(message);
+        return;
+    }
+    m_buffered_results.emplace_back(std::string{message}, epochtime_t{}, int64_t{}, false);
+}
+
+auto SynchronizedOutputHandler::flush() -> ErrorCode {
+    std::lock_guard const lock{m_shared_state->m_mutex};
+    forward_buffered_results();
+    return m_handler->flush();
+}
+
+auto SynchronizedOutputHandler::finish() -> ErrorCode {
+    std::lock_guard const lock{m_shared_state->m_mutex};
+    forward_buffered_results();
+    return m_handler->finish();
+}
+
+auto SynchronizedOutputHandler::is_done() const -> bool {
+    if (m_shared_state->is_limit_reached()) {
+        return true;
+    }
+    // This archive alone has buffered enough results to reach the limit.
+    auto const& max_num_results{m_shared_state->m_max_num_results};
+    return max_num_results.has_value() && m_buffered_results.size() >= max_num_results.value();
+}
+
+auto SynchronizedOutputHandler::forward_buffered_results() -> void {
+    auto const& max_num_results{m_shared_state->m_max_num_results};
+    for (auto const& result : m_buffered_results) {
+        if (max_num_results.has_value()
+            && m_shared_state->m_num_results >= max_num_results.value())
+        {
+            break;
+        }
+        if (result.has_metadata) {
+            m_handler->write(result.message, result.timestamp, m_archive_id, result.log_event_idx);
+        } else {
+            m_handler->write(result.message);
+        }
+        ++m_shared_state->m_num_results;
+    }
+    if (max_num_results.has_value() && m_shared_state->m_num_results >= max_num_results.value()) {
+        m_shared_state->m_limit_reached = true;
+    }
+    m_buffered_results.clear();
+}
+
 auto CountStdoutOutputHandler::finish() -> ErrorCode {
     if (0 == m_count) {
         return ErrorCode::ErrorCodeSuccess;
@@ -260,6 +333,179 @@ auto CountByTimeStdoutOutputHandler::finish() -> ErrorCode {
     return ErrorCode::ErrorCodeSuccess;
 }
 
+FieldAggregationOutputHandler::FieldAggregationOutputHandler(
+        std::shared_ptr<reducer::Operator> aggregation_operator,
+        string const& value_key,
+        reducer::ValueType value_type,
+        string const& field,
+        std::vector<string> const& group_by_fields
+)
+        : search::OutputHandler{false, true},
+          m_pipeline{reducer::PipelineInputMode::InterStage},
+          m_value_type{value_type},
+          m_field_pointer{get_json_pointer(field)},
+          m_tags(group_by_fields.size()),
+          m_double_record{value_key},
+          m_string_record{value_key} {
+    m_group_by_pointers.reserve(group_by_fields.size());
+    for (auto const& group_by_field : group_by_fields) {
+        m_group_by_pointers.emplace_back(get_json_pointer(group_by_field));
+    }
+    m_pipeline.add_pipeline_stage(std::move(aggregation_operator));
+}
+
+auto FieldAggregationOutputHandler::write(string_view message) -> void {
+    static constexpr string_view cNullTag{"null"};
+
+    m_buffer.assign(message);
+    m_buffer.reserve(m_buffer.size() + simdjson::SIMDJSON_PADDING);
+    simdjson::ondemand::document document;
+    if (simdjson::SUCCESS != m_parser.iterate(m_buffer).get(document)) {
+        return;
+    }
+
+    // Each lookup rewinds the document, so string values must be copied before the next one.
+    double double_value{};
+    if (reducer::ValueType::Double == m_value_type) {
+        if (simdjson::SUCCESS
+            != document.at_pointer(m_field_pointer).get_double().get(double_value))
+        {
+            return;
+        }
+    } else if (false == get_value_as_string(document.at_pointer(m_field_pointer), m_string_value))
+    {
+        return;
+    }
+
+    for (size_t i{0}; i < m_group_by_pointers.size(); ++i) {
+        auto tag_value{document.at_pointer(m_group_by_pointers[i])};
+        if (simdjson::SUCCESS != tag_value.error()) {
+            m_tags[i].assign(cNullTag);
+        } else if (false == get_value_as_string(tag_value, m_tags[i])) {
+            return;
+        }
+    }
+
+    if (reducer::ValueType::Double == m_value_type) {
+        m_double_record.set_record_value(double_value);
+        reducer::SingleRecordIterator record_it{m_double_record};
+        m_pipeline.push_record_group(m_tags, record_it);
+    } else {
+        m_string_record.set_record_value(m_string_value);
+        reducer::SingleRecordIterator record_it{m_string_record};
+        m_pipeline.push_record_group(m_tags, record_it);
+    }
+}
+
+auto FieldAggregationOutputHandler::get_json_pointer(string const& field) -> string {
+    std::vector<string> tokens;
+    string descriptor_namespace;
+    if (false
+                == search::ast::tokenize_column_descriptor(field, tokens, descriptor_namespace)
+        || false == descriptor_namespace.empty())
+    {
+        SPDLOG_ERROR("Invalid field \"{}\".", field);
+        throw OperationFailed(ErrorCode::ErrorCodeBadParam, __FILENAME__, __LINE__);
+    }
+    auto const column{
+            search::ast::ColumnDescriptor::create_from_escaped_tokens(tokens, descriptor_namespace)
+    };
+    if (column->is_unresolved_descriptor()) {
+        SPDLOG_ERROR("Field \"{}\" can't contain wildcards.", field);
+        throw OperationFailed(ErrorCode::ErrorCodeBadParam, __FILENAME__, __LINE__);
+    }
+
+    string pointer;
+    for (auto it{column->descriptor_begin()}; column->descriptor_end() != it; ++it) {
+        pointer += '/';
+        for (auto const c : it->get_token()) {
+            if ('~' == c) {
+                pointer += "~0";
+            } else if ('/' == c) {
+                pointer += "~1";
+            } else {
+                pointer += c;
+            }
+        }
+    }
+    return pointer;
+}
+
+auto FieldAggregationOutputHandler::get_value_as_string(
+        simdjson::simdjson_result<simdjson::ondemand::value> value,
+        string& str
+) -> bool {
+    static constexpr string_view cWhitespace{" \t\r\n"};
+
+    simdjson::ondemand::json_type type{};
+    if (simdjson::SUCCESS != value.type().get(type)) {
+        return false;
+    }
+
+    string_view value_str;
+    if (simdjson::ondemand::json_type::string == type) {
+        if (simdjson::SUCCESS != value.get_string().get(value_str)) {
+            return false;
+        }
+        str.assign(value_str);
+        return true;
+    }
+
+    if (simdjson::SUCCESS != value.raw_json().get(value_str)) {
+        return false;
+    }
+    // Scalars' raw JSON includes any whitespace up to the next token
+    str.assign(value_str.substr(0, value_str.find_last_not_of(cWhitespace) + 1));
+    return true;
+}
+
+auto FieldAggregationReducerOutputHandler::finish() -> ErrorCode {
+    if (false == reducer::send_pipeline_results(m_reducer_socket_fd, m_pipeline.finish())) {
+        return ErrorCode::ErrorCodeFailureNetwork;
+    }
+    return ErrorCode::ErrorCodeSuccess;
+}
+
+auto FieldAggregationStdoutOutputHandler::finish() -> ErrorCode {
+    for (auto group_it = m_pipeline.finish(); false == group_it->done(); group_it->next()) {
+        auto& group = group_it->get();
+        auto const& tags = group.get_tags();
+
+        nlohmann::json group_by = nlohmann::json::object();
+        for (size_t i{0}; i < tags.size(); ++i) {
+            group_by[m_group_by_fields[i]] = tags[i];
+        }
+
+        for (auto& record_it = group.record_iter(); false == record_it.done(); record_it.next()) {
+            auto const& record = record_it.get();
+            nlohmann::json result;
+            result[constants::results_cache::search::cArchiveId] = m_archive_id;
+            result[constants::results_cache::search::cGroupBy] = group_by;
+            for (auto key_it = record.typed_key_iter(); false == key_it->done(); key_it->next())
+            {
+                auto const typed_key{key_it->get()};
+                auto const key{typed_key.get_key()};
+                auto& value = result[key];
+                switch (typed_key.get_type()) {
+                    case reducer::ValueType::String:
+                        value = record.get_string_view(key);
+                        break;
+                    case reducer::ValueType::Int64:
+                        value = record.get_int64_value(key);
+                        break;
+                    case reducer::ValueType::Double:
+                        value = record.get_double_value(key);
+                        break;
+                    default:
+                        break;
+                }
+            }
+            std::cout << result.dump() << '\n';
+        }
+    }
+    return ErrorCode::ErrorCodeSuccess;
+}
+
 CountResultsCacheOutputHandler::CountResultsCacheOutputHandler(
         string_view uri,
         string_view collection,
@@ -5,20 +5,31 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include <simdjson.h>
 
 #include <clp_s/CommandLineArguments.hpp>
 
+#include "../reducer/GroupTags.hpp"
+#include "../reducer/Operator.hpp"
 #include "../reducer/Pipeline.hpp"
+#include "../reducer/Record.hpp"
 #include "../reducer/RecordGroupIterator.hpp"
+#include "../reducer/RecordTypedKeyIterator.hpp"
 #include "Defs.hpp"
 #include "FileWriter.hpp"
 #include "search/OutputHandler.hpp"
@@ -462,6 +473,291 @@ private:
     std::map<int64_t, int64_t> m_bucket_counts;
 };
 
+/**
+ * Base class for output handlers that compute an aggregation of a field (e.g., stats or a sketch),
+ * separately for each distinct combination of values of zero or more group-by fields. The
+ * aggregation is computed by the given reducer operator, so derived classes output whatever the
+ * operator outputs for each group (e.g., a partial aggregate to be merged by the reducer).
+ *
+ * Results where the field is missing, or isn't a number when the operator expects numeric values,
+ * are ignored. Group-by fields that are missing are grouped as null, and field and group-by values
+ * that aren't strings are represented by their JSON representation.
+ */
+class FieldAggregationOutputHandler : public search::OutputHandler {
+public:
+    // Types
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+    };
+
+    // Constructors
+    /**
+     * @param aggregation_operator The operator that computes the aggregation from inter-stage
+     * records containing the field's value under `value_key`.
+     * @param value_key
+     * @param value_type The type of value the operator expects, either `ValueType::Double` or
+     * `ValueType::String`.
+     * @param field The KQL column descriptor of the field to aggregate.
+     * @param group_by_fields The KQL column descriptors of the fields to group by.
+     * @throw OperationFailed if any of the fields is invalid or contains a wildcard.
+     */
+    FieldAggregationOutputHandler(
+            std::shared_ptr<reducer::Operator> aggregation_operator,
+            std::string const& value_key,
+            reducer::ValueType value_type,
+            std::string const& field,
+            std::vector<std::string> const& group_by_fields
+    );
+
+    // Methods implementing OutputHandler
+    auto write(
+            std::string_view message,
+            epochtime_t timestamp,
+            std::string_view archive_id,
+            int64_t log_event_idx
+    ) -> void override {}
+
+    auto write(std::string_view message) -> void override;
+
+protected:
+    // Data members
+    reducer::Pipeline m_pipeline;
+
+private:
+    // Methods
+    /**
+     * Converts a KQL column descriptor into a JSON pointer.
+     * @param field
+     * @return The JSON pointer.
+     * @throw OperationFailed if the column descriptor is invalid or contains a wildcard.
+     */
+    [[nodiscard]] static auto get_json_pointer(std::string const& field) -> std::string;
+
+    /**
+     * Gets a value as a string: the string itself for strings, and the JSON representation for
+     * other types.
+     * @param value
+     * @param str Returns the string.
+     * @return Whether the value exists and could be read.
+     */
+    [[nodiscard]] static auto get_value_as_string(
+            simdjson::simdjson_result<simdjson::ondemand::value> value,
+            std::string& str
+    ) -> bool;
+
+    // Data members
+    reducer::ValueType m_value_type;
+    std::string m_field_pointer;
+    std::vector<std::string> m_group_by_pointers;
+    simdjson::ondemand::parser m_parser;
+    std::string m_buffer;
+    std::string m_string_value;
+    reducer::GroupTags m_tags;
+    reducer::SingleDoubleRecordAdapter m_double_record;
+    reducer::SingleStringRecordAdapter m_string_record;
+};
+
+/**
+ * Output handler that computes an aggregation of a field and sends the operator's output for each
+ * group to a reducer.
+ */
+class FieldAggregationReducerOutputHandler : public FieldAggregationOutputHandler {
+public:
+    // Constructors
+    FieldAggregationReducerOutputHandler(
+            int reducer_socket_fd,
+            std::shared_ptr<reducer::Operator> aggregation_operator,
+            std::string const& value_key,
+            reducer::ValueType value_type,
+            std::string const& field,
+            std::vector<std::string> const& group_by_fields
+    )
+            : FieldAggregationOutputHandler{
+                      std::move(aggregation_operator),
+                      value_key,
+                      value_type,
+                      field,
+                      group_by_fields
+              },
+              m_reducer_socket_fd{reducer_socket_fd} {}
+
+    // Methods overriding OutputHandler
+    /**
+     * Flushes the output of each group.
+     * @return ErrorCodeSuccess on success
+     * @return ErrorCodeFailureNetwork on network error
+     */
+    auto finish() -> ErrorCode override;
+
+private:
+    // Data members
+    int m_reducer_socket_fd;
+};
+
+/**
+ * Output handler that computes an aggregation of a field and writes each record the operator
+ * outputs for each group to standard output, as a JSON object.
+ */
+class FieldAggregationStdoutOutputHandler : public FieldAggregationOutputHandler {
+public:
+    // Constructors
+    FieldAggregationStdoutOutputHandler(
+            std::string_view archive_id,
+            std::shared_ptr<reducer::Operator> aggregation_operator,
+            std::string const& value_key,
+            reducer::ValueType value_type,
+            std::string const& field,
+            std::vector<std::string> const& group_by_fields
+    )
+            : FieldAggregationOutputHandler{
+                      std::move(aggregation_operator),
+                      value_key,
+                      value_type,
+                      field,
+                      group_by_fields
+              },
+              m_archive_id{archive_id},
+              m_group_by_fields{group_by_fields} {}
+
+    // Methods overriding OutputHandler
+    /**
+     * Flushes the output of each group.
+     * @return ErrorCodeSuccess on success
+     */
+    auto finish() -> ErrorCode override;
+
+private:
+    // Data members
+    std::string m_archive_id;
+    std::vector<std::string> m_group_by_fields;
+};
+
+/**
+ * Output handler that lets several archives be searched concurrently while forwarding their results
+ * to another output handler. Results are buffered for each table and then forwarded while holding a
+ * lock shared by every `SynchronizedOutputHandler` with the same `SharedState`, so the wrapped
+ * handlers never run concurrently and results from different archives are never interleaved.
+ *
+ * The handler can also enforce a limit on the total number of results forwarded across all
+ * archives, after which it reports that it's done so that searches can terminate early.
+ */
+class SynchronizedOutputHandler : public search::OutputHandler {
+public:
+    // Types
+    /**
+     * State shared by the handlers of every archive in a search.
+     */
+    class SharedState {
+    public:
+        // Constructors
+        /**
+         * @param shared_handler The handler that every archive's results should be forwarded to, or
+         * null if each archive has its own handler (e.g., for per-archive aggregations).
+         * @param max_num_results The maximum number of results to forward across all archives, or
+         * std::nullopt for no limit.
+         */
+        SharedState(
+                std::shared_ptr<search::OutputHandler> shared_handler,
+                std::optional<uint64_t> max_num_results
+        )
+                : m_shared_handler{std::move(shared_handler)},
+                  m_max_num_results{max_num_results} {}
+
+        // Methods
+        [[nodiscard]] auto get_shared_handler() const
+                -> std::shared_ptr<search::OutputHandler> const& {
+            return m_shared_handler;
+        }
+
+        /**
+         * @return Whether the maximum number of results has been forwarded.
+         */
+        [[nodiscard]] auto is_limit_reached() const -> bool { return m_limit_reached.load(); }
+
+    private:
+        friend class SynchronizedOutputHandler;
+
+        std::shared_ptr<search::OutputHandler> m_shared_handler;
+        std::optional<uint64_t> m_max_num_results;
+        std::mutex m_mutex;
+        uint64_t m_num_results{0};  // Guarded by `m_mutex`
+        std::atomic_bool m_limit_reached{false};
+    };
+
+    // Constructors
+    /**
+     * @param handler The handler to forward results to.
+     * @param shared_state
+     */
+    SynchronizedOutputHandler(
+            std::shared_ptr<search::OutputHandler> handler,
+            std::shared_ptr<SharedState> shared_state
+    )
+            : search::OutputHandler{
+                      handler->should_output_metadata(),
+                      handler->should_marshal_records()
+              },
+              m_handler{std::move(handler)},
+              m_shared_state{std::move(shared_state)},
+              m_should_buffer_results{
+                      m_handler == m_shared_state->m_shared_handler
+                      || m_shared_state->m_max_num_results.has_value()
+              } {}
+
+    // Methods implementing OutputHandler
+    auto write(
+            std::string_view message,
+            epochtime_t timestamp,
+            std::string_view archive_id,
+            int64_t log_event_idx
+    ) -> void override;
+
+    auto write(std::string_view message) -> void override;
+
+    // Methods overriding OutputHandler
+    /**
+     * Forwards the buffered results and then flushes the wrapped handler.
+     * @return ErrorCodeSuccess on success or the wrapped handler's error code on error
+     */
+    [[nodiscard]] auto flush() -> ErrorCode override;
+
+    /**
+     * Forwards the buffered results and then finishes the wrapped handler.
+     * @return ErrorCodeSuccess on success or the wrapped handler's error code on error
+     */
+    [[nodiscard]] auto finish() -> ErrorCode override;
+
+    [[nodiscard]] auto is_done() const -> bool override;
+
+private:
+    // Types
+    struct BufferedResult {
+        std::string message;
+        epochtime_t timestamp;
+        int64_t log_event_idx;
+        bool has_metadata;
+    };
+
+    // Methods
+    /**
+     * Forwards the buffered results to the wrapped handler, up to the shared result limit. The
+     * shared lock must be held by the caller.
+     */
+    auto forward_buffered_results() -> void;
+
+    // Data members
+    std::shared_ptr<search::OutputHandler> m_handler;
+    std::shared_ptr<SharedState> m_shared_state;
+    // Results only need to be buffered if the wrapped handler is shared or results are limited;
+    // otherwise, only `flush` and `finish` need to be synchronized.
+    bool m_should_buffer_results;
+    std::string m_archive_id;
+    std::vector<BufferedResult> m_buffered_results;
+};
+
 /**
  * Output handler that records all results in a provided vector.
  */
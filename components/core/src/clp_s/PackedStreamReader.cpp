@@ -2,6 +2,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include <ystdlib/error_handling/Result.hpp>
 
@@ -81,7 +88,32 @@ void PackedStreamReader::open_packed_streams(std::shared_ptr<ArchiveReaderAdapto
     }
 }
 
+void PackedStreamReader::prefetch_streams(
+        std::vector<size_t> stream_ids,
+        size_t max_num_prefetched_streams
+) {
+    if (PackedStreamReaderState::PackedStreamsOpened != m_state || m_prefetch_thread.joinable()) {
+        throw OperationFailed(ErrorCodeNotReady, __FILENAME__, __LINE__);
+    }
+    for (size_t i{0}; i < stream_ids.size(); ++i) {
+        if (stream_ids[i] >= m_stream_metadata.size()
+            || (i > 0 && stream_ids[i - 1] >= stream_ids[i]))
+        {
+            throw OperationFailed(ErrorCodeBadParam, __FILENAME__, __LINE__);
+        }
+    }
+    if (stream_ids.empty() || 0 == max_num_prefetched_streams) {
+        return;
+    }
+
+    m_prefetch_stream_ids = std::move(stream_ids);
+    m_max_num_prefetched_streams = max_num_prefetched_streams;
+    m_prefetch_thread = std::thread{&PackedStreamReader::prefetch_streams_in_background, this};
+}
+
 void PackedStreamReader::close() {
+    stop_prefetching();
+
     bool needs_checkin{false};
     switch (m_state) {
         case PackedStreamReaderState::PackedStreamsOpened:
@@ -104,7 +136,6 @@ void PackedStreamReader::close() {
 
 void
 PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf, size_t& buf_size) {
-    constexpr size_t cDecompressorFileReadBufferCapacity = 64 * 1024;  // 64 KiB
     if (stream_id >= m_stream_metadata.size()) {
         throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
     }
@@ -123,12 +154,22 @@ PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf,
     }
     m_prev_stream_id = stream_id;
 
-    auto& [file_offset, uncompressed_size] = m_stream_metadata[stream_id];
-    size_t adjusted_file_offset = m_begin_offset + file_offset;
-    if (auto error = m_packed_stream_reader->try_seek_from_begin(adjusted_file_offset);
-        clp::ErrorCode::ErrorCode_Success != error)
-    {
-        throw OperationFailed(static_cast<ErrorCode>(error), __FILENAME__, __LINE__);
+    if (m_prefetch_thread.joinable()) {
+        if (take_prefetched_stream(stream_id, buf, buf_size)) {
+            return;
+        }
+        // The stream wasn't prefetched, so the prefetch thread must release the packed stream
+        // reader before the stream can be read directly.
+        stop_prefetching();
+    }
+    decompress_stream(stream_id, buf, buf_size);
+}
+
+auto PackedStreamReader::get_stream_byte_range(size_t stream_id) const
+        -> std::pair<size_t, size_t> {
+    auto const begin_pos{m_begin_offset + m_stream_metadata[stream_id].file_offset};
+    if ((stream_id + 1) < m_stream_metadata.size()) {
+        return {begin_pos, m_begin_offset + m_stream_metadata[stream_id + 1].file_offset};
     }
 
     auto const end_pos_result{
@@ -137,10 +178,36 @@ PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf,
     if (end_pos_result.has_error()) {
         throw OperationFailed(ErrorCodeOutOfBounds, __FILENAME__, __LINE__);
     }
-    size_t end_pos{end_pos_result.value()};
+    return {begin_pos, end_pos_result.value()};
+}
 
-    if ((stream_id + 1) < m_stream_metadata.size()) {
-        end_pos = m_begin_offset + m_stream_metadata[stream_id + 1].file_offset;
+void PackedStreamReader::prefetch_stream_byte_ranges(std::vector<size_t> const& stream_ids) {
+    std::vector<std::pair<size_t, size_t>> byte_ranges;
+    byte_ranges.reserve(stream_ids.size());
+    try {
+        for (auto const stream_id : stream_ids) {
+            byte_ranges.emplace_back(get_stream_byte_range(stream_id));
+        }
+    } catch (OperationFailed const&) {
+        return;
+    }
+    std::ignore = m_adaptor->prefetch_byte_ranges(byte_ranges);
+}
+
+void PackedStreamReader::decompress_stream(
+        size_t stream_id,
+        std::shared_ptr<char[]>& buf,
+        size_t& buf_size
+) {
+    constexpr size_t cDecompressorFileReadBufferCapacity = 64 * 1024;  // 64 KiB
+    auto const uncompressed_size{m_stream_metadata[stream_id].uncompressed_size};
+    auto const [begin_pos, end_pos] = get_stream_byte_range(stream_id);
+    // Lets a remote archive fetch the whole stream with one request, if it isn't already cached
+    prefetch_stream_byte_ranges({stream_id});
+    if (auto error = m_packed_stream_reader->try_seek_from_begin(begin_pos);
+        clp::ErrorCode::ErrorCode_Success != error)
+    {
+        throw OperationFailed(static_cast<ErrorCode>(error), __FILENAME__, __LINE__);
     }
     clp::BoundedReader bounded_reader{m_packed_stream_reader.get(), end_pos};
 
@@ -159,4 +226,108 @@ PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf,
     }
     m_packed_stream_decompressor.close_for_reuse();
 }
+
+void PackedStreamReader::prefetch_streams_in_background() {
+    prefetch_stream_byte_ranges(m_prefetch_stream_ids);
+    for (auto const stream_id : m_prefetch_stream_ids) {
+        StreamBuffer buffer;
+        {
+            std::unique_lock lock{m_prefetch_mutex};
+            m_prefetcher_cv.wait(lock, [&]() -> bool {
+                return m_stop_prefetching
+                       || m_prefetched_streams.size() < m_max_num_prefetched_streams;
+            });
+            if (m_stop_prefetching) {
+                return;
+            }
+            if (false == m_free_buffers.empty()) {
+                buffer = std::move(m_free_buffers.back());
+                m_free_buffers.pop_back();
+            }
+        }
+
+        try {
+            decompress_stream(stream_id, buffer.buf, buffer.buf_size);
+        } catch (...) {
+            {
+                std::lock_guard const lock{m_prefetch_mutex};
+                m_prefetch_exception = std::current_exception();
+                m_prefetch_done = true;
+            }
+            m_reader_cv.notify_one();
+            return;
+        }
+
+        {
+            std::lock_guard const lock{m_prefetch_mutex};
+            m_prefetched_streams.emplace_back(stream_id, std::move(buffer));
+        }
+        m_reader_cv.notify_one();
+    }
+
+    {
+        std::lock_guard const lock{m_prefetch_mutex};
+        m_prefetch_done = true;
+    }
+    m_reader_cv.notify_one();
+}
+
+auto PackedStreamReader::take_prefetched_stream(
+        size_t stream_id,
+        std::shared_ptr<char[]>& buf,
+        size_t& buf_size
+) -> bool {
+    std::unique_lock lock{m_prefetch_mutex};
+    while (true) {
+        m_reader_cv.wait(lock, [&]() -> bool {
+            return m_prefetch_done || false == m_prefetched_streams.empty();
+        });
+        if (m_prefetched_streams.empty()) {
+            if (nullptr != m_prefetch_exception) {
+                std::rethrow_exception(std::exchange(m_prefetch_exception, nullptr));
+            }
+            return false;
+        }
+        if (m_prefetched_streams.front().stream_id > stream_id) {
+            return false;
+        }
+
+        auto prefetched_stream{std::move(m_prefetched_streams.front())};
+        m_prefetched_streams.pop_front();
+        m_prefetcher_cv.notify_one();
+        if (prefetched_stream.stream_id < stream_id) {
+            m_free_buffers.emplace_back(std::move(prefetched_stream.buffer));
+            continue;
+        }
+
+        // The caller's buffer would otherwise have been overwritten, so it can be reused to
+        // prefetch later streams.
+        if (nullptr != buf && m_free_buffers.size() < m_max_num_prefetched_streams) {
+            m_free_buffers.emplace_back(std::move(buf), buf_size);
+        }
+        buf = std::move(prefetched_stream.buffer.buf);
+        buf_size = prefetched_stream.buffer.buf_size;
+        return true;
+    }
+}
+
+void PackedStreamReader::stop_prefetching() {
+    if (false == m_prefetch_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard const lock{m_prefetch_mutex};
+        m_stop_prefetching = true;
+    }
+    m_prefetcher_cv.notify_one();
+    m_prefetch_thread.join();
+
+    m_prefetch_stream_ids.clear();
+    m_max_num_prefetched_streams = 0ULL;
+    m_prefetched_streams.clear();
+    m_free_buffers.clear();
+    m_prefetch_exception = nullptr;
+    m_prefetch_done = false;
+    m_stop_prefetching = false;
+}
 }  // namespace clp_s
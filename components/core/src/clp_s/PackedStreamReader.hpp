@@ -1,9 +1,15 @@
 #ifndef CLP_S_PACKEDSTREAMREADER_HPP
 #define CLP_S_PACKEDSTREAMREADER_HPP
 
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <ystdlib/error_handling/Result.hpp>
@@ -19,6 +25,9 @@ namespace clp_s {
  * read the tables section without loading the tables metadata, and any attempt to read tables
  * section out of order will throw. As well, any incorrect usage of this class (e.g. closing without
  * opening) will throw.
+ *
+ * Streams can optionally be prefetched, in which case they're decompressed on a background thread
+ * ahead of being requested so that I/O and decompression overlap with processing earlier streams.
  */
 class PackedStreamReader {
 public:
@@ -38,6 +47,18 @@ public:
         size_t uncompressed_size;
     };
 
+    // Constructors
+    PackedStreamReader() = default;
+
+    // Delete copy & move constructors and assignment operators
+    PackedStreamReader(PackedStreamReader const&) = delete;
+    PackedStreamReader(PackedStreamReader&&) = delete;
+    auto operator=(PackedStreamReader const&) -> PackedStreamReader& = delete;
+    auto operator=(PackedStreamReader&&) -> PackedStreamReader& = delete;
+
+    // Destructor
+    ~PackedStreamReader() { stop_prefetching(); }
+
     /**
      * Reads packed stream metadata from the provided compression stream. Must be invoked before
      * reading packed streams.
@@ -54,6 +75,20 @@ public:
      */
     void open_packed_streams(std::shared_ptr<ArchiveReaderAdaptor> adaptor);
 
+    /**
+     * Starts decompressing the given streams on a background thread so that they're ready by the
+     * time they're requested from `read_stream`. At most `max_num_prefetched_streams` decompressed
+     * streams are buffered at any time. Must be invoked after `open_packed_streams` and before
+     * reading any packed stream.
+     *
+     * Streams must still be requested in ascending stream_id order. Prefetched streams that are
+     * skipped over are discarded, and requesting a stream that wasn't prefetched stops prefetching.
+     *
+     * @param stream_ids The IDs of the streams that will be read, in ascending order.
+     * @param max_num_prefetched_streams
+     */
+    void prefetch_streams(std::vector<size_t> stream_ids, size_t max_num_prefetched_streams);
+
     /**
      * Closes the file reader for the tables section.
      */
@@ -69,7 +104,8 @@ public:
      * where the caller wants to re-use the same buffer for multiple streams to avoid allocations
      * when they already have a sufficiently large buffer. If no buffer is provided or the provided
      * buffer is too small calling read_stream will create a buffer exactly as large as the stream
-     * being decompressed.
+     * being decompressed. If the stream was prefetched, the prefetched buffer is returned instead
+     * and the provided buffer may be reused to prefetch later streams.
      *
      * @param stream_id
      * @param buf a shared ptr to the buffer where the stream will be read. The buffer gets resized
@@ -91,6 +127,65 @@ private:
         ReadingPackedStreams
     };
 
+    struct StreamBuffer {
+        std::shared_ptr<char[]> buf;
+        size_t buf_size{0ULL};
+    };
+
+    struct PrefetchedStream {
+        size_t stream_id;
+        StreamBuffer buffer;
+    };
+
+    /**
+     * @param stream_id
+     * @return The [begin, end) positions of the given compressed stream in
+     * `m_packed_stream_reader`.
+     * @throws OperationFailed if the end of the archive can't be represented as a size_t.
+     */
+    [[nodiscard]] auto get_stream_byte_range(size_t stream_id) const -> std::pair<size_t, size_t>;
+
+    /**
+     * Hints to the archive adaptor that the given compressed streams will be read soon, so that a
+     * remote archive only fetches the streams being read, with as few requests as possible.
+     * Failures are ignored since the streams are fetched on demand anyway.
+     * @param stream_ids
+     */
+    void prefetch_stream_byte_ranges(std::vector<size_t> const& stream_ids);
+
+    /**
+     * Seeks to and decompresses a stream without checking the order in which streams are read.
+     * @param stream_id
+     * @param buf
+     * @param buf_size
+     */
+    void decompress_stream(size_t stream_id, std::shared_ptr<char[]>& buf, size_t& buf_size);
+
+    /**
+     * Decompresses each stream in `m_prefetch_stream_ids` into the prefetched stream queue, waiting
+     * whenever the queue is full. Runs on the prefetch thread.
+     */
+    void prefetch_streams_in_background();
+
+    /**
+     * Waits for the given stream to be prefetched and hands its buffer to the caller, discarding
+     * any earlier prefetched streams.
+     * @param stream_id
+     * @param buf
+     * @param buf_size
+     * @return Whether the stream was prefetched.
+     * @throws The exception thrown while prefetching, if prefetching failed before the stream was
+     * decompressed.
+     */
+    [[nodiscard]] auto
+    take_prefetched_stream(size_t stream_id, std::shared_ptr<char[]>& buf, size_t& buf_size)
+            -> bool;
+
+    /**
+     * Stops the prefetch thread, if running, and releases all prefetched streams.
+     */
+    void stop_prefetching();
+
     std::vector<PackedStreamMetadata> m_stream_metadata;
     std::shared_ptr<ArchiveReaderAdaptor> m_adaptor;
     std::unique_ptr<clp::ReaderInterface> m_packed_stream_reader;
@@ -98,6 +193,19 @@ private:
     PackedStreamReaderState m_state{PackedStreamReaderState::Uninitialized};
     size_t m_begin_offset{};
     size_t m_prev_stream_id{0ULL};
+
+    // Prefetching state, which is guarded by `m_prefetch_mutex` while the prefetch thread runs
+    std::vector<size_t> m_prefetch_stream_ids;
+    size_t m_max_num_prefetched_streams{0ULL};
+    std::deque<PrefetchedStream> m_prefetched_streams;
+    std::vector<StreamBuffer> m_free_buffers;
+    std::exception_ptr m_prefetch_exception;
+    bool m_prefetch_done{false};
+    bool m_stop_prefetching{false};
+    std::mutex m_prefetch_mutex;
+    std::condition_variable m_prefetcher_cv;
+    std::condition_variable m_reader_cv;
+    std::thread m_prefetch_thread;
 };
 }  // namespace clp_s
 
@@ -0,0 +1,205 @@
+#include "ParallelKvIrDeserializer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <clp/ffi/ir_stream/Deserializer.hpp>
+#include <clp/ffi/ir_stream/IrStreamIndex.hpp>
+#include <clp/ffi/ir_stream/IrUnitType.hpp>
+#include <clp/ffi/KeyValuePairLogEvent.hpp>
+#include <clp/ffi/SchemaTree.hpp>
+#include <clp/FileReader.hpp>
+#include <clp/streaming_compression/zstd/Decompressor.hpp>
+#include <clp/time_types.hpp>
+#include <clp/TraceableException.hpp>
+
+namespace clp_s {
+namespace {
+using clp::ffi::ir_stream::Deserializer;
+using clp::ffi::ir_stream::IRErrorCode;
+using clp::ffi::ir_stream::IrStreamIndex;
+using clp::ffi::ir_stream::IrUnitType;
+using clp::ffi::KeyValuePairLogEvent;
+using clp::UtcOffset;
+
+constexpr size_t cDecompressorFileReadBufferCapacity{64 * 1024};  // 64 KiB
+
+/**
+ * Class that implements `clp::ffi::ir_stream::IrUnitHandlerInterface` to collect the log events of
+ * a chunk.
+ */
+class ChunkIrUnitHandler {
+public:
+    // Constructor
+    explicit ChunkIrUnitHandler(std::vector<KeyValuePairLogEvent>* log_events)
+            : m_log_events{log_events} {}
+
+    // Methods implementing `IrUnitHandlerInterface`
+    [[nodiscard]] auto
+    handle_log_event(KeyValuePairLogEvent&& log_event, [[maybe_unused]] size_t log_event_idx)
+            -> IRErrorCode {
+        m_log_events->emplace_back(std::move(log_event));
+        return IRErrorCode::IRErrorCode_Success;
+    }
+
+    [[nodiscard]] static auto handle_utc_offset_change(
+            [[maybe_unused]] UtcOffset utc_offset_old,
+            [[maybe_unused]] UtcOffset utc_offset_new
+    ) -> IRErrorCode {
+        return IRErrorCode::IRErrorCode_Decode_Error;
+    }
+
+    [[nodiscard]] static auto handle_schema_tree_node_insertion(
+            [[maybe_unused]] bool is_auto_generated,
+            [[maybe_unused]] clp::ffi::SchemaTree::NodeLocator schema_tree_node_locator,
+            [[maybe_unused]] std::shared_ptr<clp::ffi::SchemaTree const> const& schema_tree
+    ) -> IRErrorCode {
+        return IRErrorCode::IRErrorCode_Success;
+    }
+
+    [[nodiscard]] static auto handle_end_of_stream() -> IRErrorCode {
+        return IRErrorCode::IRErrorCode_Success;
+    }
+
+private:
+    std::vector<KeyValuePairLogEvent>* m_log_events;
+};
+
+/**
+ * Deserializes the log events between the given checkpoint and the next.
+ * @param stream_path
+ * @param index
+ * @param checkpoint_idx
+ * @return The deserialized chunk.
+ */
+[[nodiscard]] auto deserialize_chunk(
+        std::shared_ptr<std::string const> const& stream_path,
+        std::shared_ptr<IrStreamIndex const> const& index,
+        size_t checkpoint_idx
+) -> ParallelKvIrDeserializer::Chunk;
+
+auto deserialize_chunk(
+        std::shared_ptr<std::string const> const& stream_path,
+        std::shared_ptr<IrStreamIndex const> const& index,
+        size_t checkpoint_idx
+) -> ParallelKvIrDeserializer::Chunk {
+    ParallelKvIrDeserializer::Chunk chunk;
+    auto const& checkpoints{index->get_checkpoints()};
+    auto const& checkpoint{checkpoints[checkpoint_idx]};
+    try {
+        // The deserializer needs to read the stream's preamble before it can be resumed from the
+        // checkpoint.
+        clp::FileReader file_reader{*stream_path};
+        clp::streaming_compression::zstd::Decompressor decompressor;
+        decompressor.open(file_reader, cDecompressorFileReadBufferCapacity);
+        auto deserializer_result{Deserializer<ChunkIrUnitHandler>::create(
+                decompressor,
+                ChunkIrUnitHandler{&chunk.log_events}
+        )};
+        if (deserializer_result.has_error()) {
+            chunk.error = deserializer_result.error();
+            return chunk;
+        }
+        auto& deserializer{deserializer_result.value()};
+        if (auto const result{deserializer.resume_from_checkpoint(*index, checkpoint_idx)};
+            result.has_error())
+        {
+            chunk.error = result.error();
+            return chunk;
+        }
+
+        decompressor.close();
+        file_reader.seek_from_begin(checkpoint.compressed_offset.value());
+        decompressor.open(file_reader, cDecompressorFileReadBufferCapacity);
+
+        std::optional<size_t> end_log_event_idx;
+        if (checkpoint_idx + 1 < checkpoints.size()) {
+            end_log_event_idx = checkpoints[checkpoint_idx + 1].log_event_idx;
+        }
+        chunk.end_offset = checkpoint.ir_stream_offset;
+        while (false == end_log_event_idx.has_value()
+               || deserializer.get_num_log_events_deserialized() < end_log_event_idx.value())
+        {
+            auto const ir_unit_type_result{deserializer.deserialize_next_ir_unit(decompressor)};
+            if (ir_unit_type_result.has_error()) {
+                chunk.error = ir_unit_type_result.error();
+                break;
+            }
+            chunk.end_offset = checkpoint.ir_stream_offset + decompressor.get_pos();
+            if (IrUnitType::EndOfStream == ir_unit_type_result.value()) {
+                break;
+            }
+            if (IrUnitType::LogEvent == ir_unit_type_result.value()) {
+                chunk.log_event_end_offsets.push_back(chunk.end_offset);
+            }
+        }
+        decompressor.close();
+    } catch (clp::TraceableException const&) {
+        chunk.error = std::make_error_code(std::errc::io_error);
+    }
+    return chunk;
+}
+}  // namespace
+
+auto ParallelKvIrDeserializer::create(
+        std::string stream_path,
+        IrStreamIndex index,
+        size_t num_threads
+) -> std::optional<ParallelKvIrDeserializer> {
+    auto const& checkpoints{index.get_checkpoints()};
+    if (checkpoints.size() < 2 || 0 != checkpoints.front().log_event_idx
+        || std::ranges::any_of(
+                checkpoints,
+                [](IrStreamIndex::Checkpoint const& checkpoint) -> bool {
+                    return false == checkpoint.compressed_offset.has_value();
+                }
+        ))
+    {
+        return std::nullopt;
+    }
+
+    ParallelKvIrDeserializer deserializer{
+            std::make_shared<std::string const>(std::move(stream_path)),
+            std::make_shared<IrStreamIndex const>(std::move(index))
+    };
+    for (size_t i{0}; i < std::max(num_threads, size_t{1}); ++i) {
+        deserializer.schedule_next_chunk();
+    }
+    return deserializer;
+}
+
+auto ParallelKvIrDeserializer::get_next_chunk() -> std::optional<Chunk> {
+    if (m_pending_chunks.empty()) {
+        return std::nullopt;
+    }
+    auto chunk{m_pending_chunks.front().get()};
+    m_pending_chunks.pop_front();
+    if (chunk.error.has_value()) {
+        // Later chunks can't be ingested after a truncated one, so stop scheduling them
+        m_pending_chunks.clear();
+        m_next_checkpoint_idx = m_index->get_checkpoints().size();
+    } else {
+        schedule_next_chunk();
+    }
+    return chunk;
+}
+
+auto ParallelKvIrDeserializer::schedule_next_chunk() -> void {
+    if (m_next_checkpoint_idx >= m_index->get_checkpoints().size()) {
+        return;
+    }
+    m_pending_chunks.emplace_back(std::async(
+            std::launch::async,
+            [stream_path = m_stream_path, index = m_index, checkpoint_idx = m_next_checkpoint_idx]()
+                    -> Chunk { return deserialize_chunk(stream_path, index, checkpoint_idx); }
+    ));
+    ++m_next_checkpoint_idx;
+}
+}  // namespace clp_s
@@ -0,0 +1,104 @@
+#ifndef CLP_S_PARALLELKVIRDESERIALIZER_HPP
+#define CLP_S_PARALLELKVIRDESERIALIZER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <clp/ffi/ir_stream/IrStreamIndex.hpp>
+#include <clp/ffi/KeyValuePairLogEvent.hpp>
+
+namespace clp_s {
+/**
+ * Deserializes a zstd-compressed kv-pair IR stream on several threads, using the stream's
+ * checkpoint index to split it into chunks that can be deserialized independently.
+ *
+ * Each chunk contains the log events between two consecutive checkpoints. To deserialize a chunk, a
+ * worker opens the stream at the zstd frame that starts at the chunk's checkpoint and resumes a
+ * deserializer from the checkpoint, so chunks don't depend on each other. The schema trees at every
+ * checkpoint are prefixes of the stream's final trees, so a schema tree node has the same ID in
+ * every chunk; callers can therefore consume the log events of all chunks as if they came from a
+ * single deserializer.
+ *
+ * Chunks are returned in stream order. At most `num_threads` chunks are deserialized ahead of the
+ * caller, which bounds memory usage.
+ */
+class ParallelKvIrDeserializer {
+public:
+    // Types
+    struct Chunk {
+        std::vector<clp::ffi::KeyValuePairLogEvent> log_events;
+        // The offset in the (decompressed) IR stream right after each log event
+        std::vector<size_t> log_event_end_offsets;
+        // The offset in the (decompressed) IR stream right after the last IR unit deserialized
+        size_t end_offset{0};
+        // The error that stopped the deserialization of the chunk, if any. The chunk contains the
+        // log events deserialized before the error.
+        std::optional<std::error_code> error;
+    };
+
+    // Factory function
+    /**
+     * @param stream_path The path of the zstd-compressed kv-pair IR stream on the filesystem.
+     * @param index The stream's index.
+     * @param num_threads
+     * @return The created deserializer, or std::nullopt if the index can't be used to split the
+     * stream (i.e., it has fewer than two checkpoints, its first checkpoint isn't at the first log
+     * event, or any of its checkpoints doesn't start a zstd frame).
+     */
+    [[nodiscard]] static auto create(
+            std::string stream_path,
+            clp::ffi::ir_stream::IrStreamIndex index,
+            size_t num_threads
+    ) -> std::optional<ParallelKvIrDeserializer>;
+
+    // Delete copy constructor and assignment operator
+    ParallelKvIrDeserializer(ParallelKvIrDeserializer const&) = delete;
+    auto operator=(ParallelKvIrDeserializer const&) -> ParallelKvIrDeserializer& = delete;
+
+    // Default move constructor and assignment operator
+    ParallelKvIrDeserializer(ParallelKvIrDeserializer&&) = default;
+    auto operator=(ParallelKvIrDeserializer&&) -> ParallelKvIrDeserializer& = default;
+
+    // Destructor
+    ~ParallelKvIrDeserializer() = default;
+
+    // Methods
+    /**
+     * Waits for the next chunk to be deserialized.
+     *
+     * NOTE: Once a chunk with an error is returned, no more chunks are returned.
+     * @return The next chunk in stream order, or std::nullopt if there are no more chunks.
+     */
+    [[nodiscard]] auto get_next_chunk() -> std::optional<Chunk>;
+
+private:
+    // Constructor
+    ParallelKvIrDeserializer(
+            std::shared_ptr<std::string const> stream_path,
+            std::shared_ptr<clp::ffi::ir_stream::IrStreamIndex const> index
+    )
+            : m_stream_path{std::move(stream_path)},
+              m_index{std::move(index)} {}
+
+    // Methods
+    /**
+     * Starts deserializing the next chunk on a new thread, if there are chunks left.
+     */
+    auto schedule_next_chunk() -> void;
+
+    // Variables
+    // Shared with the worker threads, which may outlive a moved-from instance's members
+    std::shared_ptr<std::string const> m_stream_path;
+    std::shared_ptr<clp::ffi::ir_stream::IrStreamIndex const> m_index;
+    size_t m_next_checkpoint_idx{0};
+    std::deque<std::future<Chunk>> m_pending_chunks;
+};
+}  // namespace clp_s
+
+#endif  // CLP_S_PARALLELKVIRDESERIALIZER_HPP
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include "archive_constants.hpp"
 #include "FileWriter.hpp"
@@ -13,10 +14,21 @@ int32_t SchemaMap::add_schema(Schema const& schema) {
     if (m_schema_map.end() != schema_it) {
         return schema_it->second;
     }
-    m_schema_map.emplace(schema, m_current_schema_id);
+    auto const entry_it = m_schema_map.emplace(schema, m_current_schema_id).first;
+    m_schema_id_to_entry.emplace(m_current_schema_id, entry_it);
     return m_current_schema_id++;
 }
 
+void SchemaMap::retire_schema(int32_t schema_id) {
+    auto const entry_it = m_schema_id_to_entry.find(schema_id);
+    if (m_schema_id_to_entry.end() == entry_it) {
+        return;
+    }
+    auto node = m_schema_map.extract(entry_it->second);
+    m_schema_id_to_entry.erase(entry_it);
+    m_retired_schemas.emplace_back(std::move(node.key()), schema_id);
+}
+
 size_t SchemaMap::store(std::string const& archives_dir, int compression_level) {
     FileWriter schema_map_writer;
     ZstdCompressor schema_map_compressor;
@@ -27,15 +39,22 @@ size_t SchemaMap::store(std::string const& archives_dir, int compression_level)
             FileWriter::OpenMode::CreateForWriting
     );
     schema_map_compressor.open(schema_map_writer, compression_level);
-    schema_map_compressor.write_numeric_value(static_cast<uint64_t>(m_schema_map.size()));
-    for (auto const& schema_mapping : m_schema_map) {
-        auto const& schema = schema_mapping.first;
-        schema_map_compressor.write_numeric_value(schema_mapping.second);
+    auto write_schema = [&](Schema const& schema, int32_t schema_id) {
+        schema_map_compressor.write_numeric_value(schema_id);
         schema_map_compressor.write_numeric_value(static_cast<uint32_t>(schema.size()));
         schema_map_compressor.write_numeric_value(static_cast<uint32_t>(schema.get_num_ordered()));
         for (int32_t mst_node_id : schema) {
             schema_map_compressor.write_numeric_value(mst_node_id);
         }
+    };
+    schema_map_compressor.write_numeric_value(
+            static_cast<uint64_t>(m_schema_map.size() + m_retired_schemas.size())
+    );
+    for (auto const& [schema, schema_id] : m_schema_map) {
+        write_schema(schema, schema_id);
+    }
+    for (auto const& [schema, schema_id] : m_retired_schemas) {
+        write_schema(schema, schema_id);
     }
 
     schema_map_compressor.close();
@@ -1,8 +1,12 @@
 #ifndef CLP_S_SCHEMAMAP_HPP
 #define CLP_S_SCHEMAMAP_HPP
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Schema.hpp"
 
@@ -22,6 +26,16 @@ public:
      */
     int32_t add_schema(Schema const& schema);
 
+    /**
+     * Retires a schema's Id so that the next call to add_schema with the same schema assigns it a
+     * new Id. The retired Id is still written to the schema map file.
+     *
+     * Retiring an Id that isn't in the schema map, e.g., because it was already retired, does
+     * nothing.
+     * @param schema_id
+     */
+    void retire_schema(int32_t schema_id);
+
     /**
      * Write the contents of the SchemaMap to the schema map file
      * @param archives_dir
@@ -33,7 +47,11 @@ public:
     /**
      * Clear the schema map
      */
-    void clear() { m_schema_map.clear(); }
+    void clear() {
+        m_schema_map.clear();
+        m_schema_id_to_entry.clear();
+        m_retired_schemas.clear();
+    }
 
     /**
      * Get const iterators into the schema map
@@ -50,6 +68,10 @@ public:
 private:
     int32_t m_current_schema_id;
     schema_map_t m_schema_map;
+    // Maps each schema Id in m_schema_map to its entry, so that retiring a schema doesn't require
+    // scanning the schema map
+    std::unordered_map<int32_t, schema_map_t::iterator> m_schema_id_to_entry;
+    std::vector<std::pair<Schema, int32_t>> m_retired_schemas;
 };
 }  // namespace clp_s
 
@@ -230,8 +230,9 @@ bool SchemaReader::get_next_message(std::string& message) {
 }
 
 bool SchemaReader::get_next_message(std::string& message, FilterClass& filter) {
+    m_cur_message = filter.find_next_candidate(m_cur_message);
     while (m_cur_message < m_num_messages && false == filter.filter(m_cur_message)) {
-        ++m_cur_message;
+        m_cur_message = filter.find_next_candidate(m_cur_message + 1);
     }
 
     if (m_cur_message >= m_num_messages) {
@@ -288,8 +289,9 @@ bool SchemaReader::get_next_message_with_metadata(
 ) {
     // TODO: If we already get max_num_results messages, we can skip messages
     // with the timestamp less than the smallest timestamp in the priority queue
+    m_cur_message = filter.find_next_candidate(m_cur_message);
     while (m_cur_message < m_num_messages && false == filter.filter(m_cur_message)) {
-        ++m_cur_message;
+        m_cur_message = filter.find_next_candidate(m_cur_message + 1);
     }
 
     if (m_cur_message >= m_num_messages) {
@@ -45,6 +45,14 @@ public:
      * @return true if the message is accepted
      */
     virtual bool filter(uint64_t cur_message) = 0;
+
+    /**
+     * Finds the first message at or after `cur_message` that may be accepted by `filter`. Filters
+     * that can cheaply rule out runs of messages should override this to skip past them.
+     * @param cur_message
+     * @return The index of the next candidate message, which may be past the last message
+     */
+    virtual uint64_t find_next_candidate(uint64_t cur_message) { return cur_message; }
 };
 
 class SchemaReader {
@@ -1,13 +1,25 @@
 #include "SchemaWriter.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <utility>
 
+#include "ColumnValueRange.hpp"
+
 namespace clp_s {
 void SchemaWriter::append_column(std::unique_ptr<BaseColumnWriter> column_writer) {
     m_total_uncompressed_size += column_writer->get_total_header_size();
     m_columns.emplace_back(std::move(column_writer));
 }
 
+void SchemaWriter::append_column(
+        std::unique_ptr<BaseColumnWriter> column_writer,
+        int32_t column_id
+) {
+    m_ranged_columns.emplace_back(column_id, m_columns.size());
+    append_column(std::move(column_writer));
+}
+
 size_t SchemaWriter::append_message(ParsedMessage& message) {
     int count{};
     size_t total_size{};
@@ -26,6 +38,22 @@ size_t SchemaWriter::append_message(ParsedMessage& message) {
     return total_size;
 }
 
+void SchemaWriter::finalize_encodings() {
+    for (auto& writer : m_columns) {
+        m_total_uncompressed_size -= writer->finalize_encoding();
+    }
+}
+
+auto SchemaWriter::get_zone_map() const -> SchemaZoneMap {
+    SchemaZoneMap zone_map;
+    for (auto const& [column_id, column_idx] : m_ranged_columns) {
+        if (auto const range{m_columns[column_idx]->get_value_range()}; range.has_value()) {
+            zone_map.emplace(column_id, range.value());
+        }
+    }
+    return zone_map;
+}
+
 void SchemaWriter::store(ZstdCompressor& compressor) {
     for (auto& writer : m_columns) {
         writer->store(compressor);
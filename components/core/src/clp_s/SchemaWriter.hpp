@@ -1,9 +1,13 @@
 #ifndef CLP_S_SCHEMAWRITER_HPP
 #define CLP_S_SCHEMAWRITER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
+#include "ColumnValueRange.hpp"
 #include "ColumnWriter.hpp"
 #include "FileWriter.hpp"
 #include "ParsedMessage.hpp"
@@ -31,6 +35,14 @@ public:
      */
     void append_column(std::unique_ptr<BaseColumnWriter> column_writer);
 
+    /**
+     * Appends a column to the schema writer and records the range of values in the column under the
+     * given column ID. The column must hold exactly one value per message.
+     * @param column_writer
+     * @param column_id
+     */
+    void append_column(std::unique_ptr<BaseColumnWriter> column_writer, int32_t column_id);
+
     /**
      * Appends a message to the schema writer.
      * @param message
@@ -38,6 +50,12 @@ public:
      */
     size_t append_message(ParsedMessage& message);
 
+    /**
+     * Chooses the encoding of every column once all messages have been appended. Must be called
+     * before the table is laid out using get_total_uncompressed_size and stored.
+     */
+    void finalize_encodings();
+
     /**
      * Stores the columns to disk.
      * @param compressor
@@ -51,11 +69,19 @@ public:
      */
     size_t get_total_uncompressed_size() const { return m_total_uncompressed_size; }
 
+    /**
+     * @return The zone map of this schema table, containing the range of values in every column
+     * appended with a column ID that tracks its range.
+     */
+    [[nodiscard]] auto get_zone_map() const -> SchemaZoneMap;
+
 private:
     uint64_t m_num_messages;
     size_t m_total_uncompressed_size{};
 
     std::vector<std::unique_ptr<BaseColumnWriter>> m_columns;
+    // Pairs of (column ID, index into `m_columns`) for columns whose value range is recorded.
+    std::vector<std::pair<int32_t, size_t>> m_ranged_columns;
 };
 }  // namespace clp_s
 
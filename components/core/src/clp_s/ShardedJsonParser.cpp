@@ -0,0 +1,113 @@
+#include "ShardedJsonParser.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include <clp_s/ArchiveWriter.hpp>
+#include <clp_s/JsonParser.hpp>
+
+namespace clp_s {
+ShardedJsonParser::ShardedJsonParser(JsonParserOption const& option, size_t num_shards)
+        : m_input_paths_and_canonical_filenames{option.input_paths_and_canonical_filenames},
+          m_shard_option{option} {
+    m_shard_option.input_paths_and_canonical_filenames.clear();
+
+    // Each shard ingests at least one input, so there's no point in having more shards than inputs.
+    m_shards.resize(
+            std::max<size_t>(std::min(num_shards, m_input_paths_and_canonical_filenames.size()), 1)
+    );
+}
+
+auto ShardedJsonParser::ingest() -> bool {
+    // Each shard starts with the input at its own index, so that every shard ingests at least one
+    // input. The remaining inputs are claimed by whichever shard is free first.
+    std::atomic_size_t next_input_idx{m_shards.size()};
+    std::atomic_bool failed{false};
+    // NOTE: We avoid `std::vector<bool>` since its elements can't be written by different threads
+    // concurrently.
+    std::vector<uint8_t> shard_failed(m_shards.size(), 0);
+
+    auto ingest_shard = [&](size_t shard_idx) -> void {
+        auto& shard{m_shards[shard_idx]};
+        for (auto input_idx{shard_idx}; false == failed.load();
+             input_idx = next_input_idx.fetch_add(1))
+        {
+            if (input_idx >= m_input_paths_and_canonical_filenames.size()) {
+                return;
+            }
+            auto const& [path, file_name_in_metadata]
+                    = m_input_paths_and_canonical_filenames[input_idx];
+            bool ingestion_successful{false};
+            try {
+                // Shards are created lazily so that a shard which stops before its first input
+                // (because another shard failed) doesn't produce an empty archive.
+                if (nullptr == shard) {
+                    shard = std::make_unique<JsonParser>(m_shard_option);
+                }
+                ingestion_successful = shard->ingest_input(path, file_name_in_metadata);
+            } catch (std::exception const& e) {
+                SPDLOG_ERROR("Encountered error while ingesting {} - {}", path.path, e.what());
+            }
+            if (false == ingestion_successful) {
+                shard_failed[shard_idx] = 1;
+                failed = true;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(m_shards.size());
+    for (size_t i{0}; i < m_shards.size(); ++i) {
+        workers.emplace_back(ingest_shard, i);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (false == failed.load()) {
+        return true;
+    }
+
+    // Mirror `JsonParser::ingest`, which closes the current archive on failure: shards that failed
+    // have already closed their archive, so only the healthy shards need to be closed.
+    for (size_t i{0}; i < m_shards.size(); ++i) {
+        if (nullptr == m_shards[i] || 0 != shard_failed[i]) {
+            continue;
+        }
+        try {
+            std::ignore = m_shards[i]->store();
+        } catch (std::exception const& e) {
+            SPDLOG_ERROR("Failed to close archive after ingestion failure - {}", e.what());
+        }
+    }
+    return false;
+}
+
+auto ShardedJsonParser::store() -> std::vector<ArchiveStats> {
+    std::vector<ArchiveStats> archive_stats;
+    for (auto& shard : m_shards) {
+        if (nullptr == shard) {
+            continue;
+        }
+        auto shard_archive_stats{shard->store()};
+        archive_stats.insert(
+                archive_stats.end(),
+                std::make_move_iterator(shard_archive_stats.begin()),
+                std::make_move_iterator(shard_archive_stats.end())
+        );
+    }
+    return archive_stats;
+}
+}  // namespace clp_s
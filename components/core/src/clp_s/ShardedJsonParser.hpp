@@ -0,0 +1,68 @@
+#ifndef CLP_S_SHARDEDJSONPARSER_HPP
+#define CLP_S_SHARDEDJSONPARSER_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <clp_s/ArchiveWriter.hpp>
+#include <clp_s/InputConfig.hpp>
+#include <clp_s/JsonParser.hpp>
+
+namespace clp_s {
+/**
+ * Ingests inputs concurrently using several independent `JsonParser` shards. Each shard owns its
+ * own `ArchiveWriter` and repeatedly claims the next unclaimed input from a shared queue, so every
+ * input is ingested, in its entirety, into the archives of exactly one shard.
+ *
+ * Since shards don't share dictionaries or schema trees, ingesting with `N` shards produces at least
+ * `N` archives (when there are at least `N` inputs).
+ */
+class ShardedJsonParser {
+public:
+    // Constructor
+    /**
+     * @param option The options used to configure every shard. `option.input_paths_and_canonical_
+     * filenames` is the queue of inputs shared by the shards.
+     * @param num_shards
+     */
+    ShardedJsonParser(JsonParserOption const& option, size_t num_shards);
+
+    // Destructor
+    ~ShardedJsonParser() = default;
+
+    // Delete copy & move constructors and assignment operators
+    ShardedJsonParser(ShardedJsonParser const&) = delete;
+    ShardedJsonParser(ShardedJsonParser&&) = delete;
+    auto operator=(ShardedJsonParser const&) -> ShardedJsonParser& = delete;
+    auto operator=(ShardedJsonParser&&) -> ShardedJsonParser& = delete;
+
+    // Methods
+    /**
+     * Ingests every input using one thread per shard.
+     *
+     * Every shard ingests at least one input, so each shard produces at least one archive. The
+     * remaining inputs are claimed by whichever shard is free first.
+     *
+     * If any shard fails to ingest an input, the remaining shards stop claiming new inputs and every
+     * shard's current archive is closed.
+     * @return Whether all inputs were ingested successfully.
+     */
+    [[nodiscard]] auto ingest() -> bool;
+
+    /**
+     * Writes the metadata and archive data of every shard to disk.
+     * @return Statistics for every archive written by every shard.
+     */
+    [[nodiscard]] auto store() -> std::vector<ArchiveStats>;
+
+private:
+    std::vector<std::pair<Path, std::string>> m_input_paths_and_canonical_filenames;
+    JsonParserOption m_shard_option;
+    std::vector<std::unique_ptr<JsonParser>> m_shards;
+};
+}  // namespace clp_s
+
+#endif  // CLP_S_SHARDEDJSONPARSER_HPP
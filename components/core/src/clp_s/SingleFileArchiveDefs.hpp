@@ -43,7 +43,7 @@ constexpr auto decompose_archive_version(uint32_t archive_version)
 
 // define the version
 constexpr uint8_t cArchiveMajorVersion = 0;
-constexpr uint8_t cArchiveMinorVersion = 5;
+constexpr uint8_t cArchiveMinorVersion = 6;
 constexpr uint16_t cArchivePatchVersion = 0;
 constexpr uint32_t cArchiveVersion{
         make_archive_version(cArchiveMajorVersion, cArchiveMinorVersion, cArchivePatchVersion)
@@ -51,6 +51,7 @@ constexpr uint32_t cArchiveVersion{
 
 // Format version markers for backwards compatibility.
 constexpr uint32_t cDeprecatedDateStringFormatVersionMarker{make_archive_version(0, 5, 0)};
+constexpr uint32_t cEncodedIntegerColumnsVersionMarker{make_archive_version(0, 6, 0)};
 
 // define the magic number
 constexpr std::array<uint8_t, 4> cStructuredSFAMagicNumber{0xFD, 0x2F, 0xC5, 0x30};
@@ -85,6 +86,13 @@ struct ArchiveHeader {
         return version < cDeprecatedDateStringFormatVersionMarker;
     }
 
+    /**
+     * @return Whether integer columns in this archive are stored with an `IntegerEncoding`.
+     */
+    [[nodiscard]] auto has_encoded_integer_columns() const -> bool {
+        return version >= cEncodedIntegerColumnsVersionMarker;
+    }
+
     uint8_t magic_number[4]{};
     uint32_t version{};
     uint64_t uncompressed_size{};
@@ -87,9 +87,11 @@ bool is_multi_file_archive(std::string_view const path) {
             || constants::cArchiveSchemaTreeFile == formatted_name
             || constants::cArchiveSchemaMapFile == formatted_name
             || constants::cArchiveVarDictFile == formatted_name
+            || constants::cArchiveVarDictFilterFile == formatted_name
             || constants::cArchiveLogDictFile == formatted_name
             || constants::cArchiveArrayDictFile == formatted_name
-            || constants::cArchiveTableMetadataFile == formatted_name)
+            || constants::cArchiveTableMetadataFile == formatted_name
+            || constants::cArchiveTableZoneMapsFile == formatted_name)
         {
             continue;
         } else {
@@ -222,6 +222,11 @@ public:
 
     size_t size() const { return m_size; }
 
+    /**
+     * @return A pointer to the first byte of the span, which may not be aligned for type T.
+     */
+    char const* data() const { return m_begin; }
+
     T operator[](size_t i) const {
         T tmp;
         std::memcpy(&tmp, m_begin + i * sizeof(T), sizeof(T));
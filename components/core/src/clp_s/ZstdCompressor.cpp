@@ -3,6 +3,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "../clp/RuntimeMetrics.hpp"
+
 namespace clp_s {
 ZstdCompressor::ZstdCompressor()
         : Compressor{CompressorType::ZSTD},
@@ -67,6 +69,8 @@ void ZstdCompressor::write(char const* data, size_t data_length) {
         throw OperationFailed(ErrorCodeBadParam, __FILENAME__, __LINE__);
     }
 
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::Compress};
+    timer.add_bytes(data_length);
     ZSTD_inBuffer uncompressed_stream_block = {data, data_length, 0};
     while (uncompressed_stream_block.pos < uncompressed_stream_block.size) {
         m_compressed_stream_block.pos = 0;
@@ -100,6 +104,7 @@ void ZstdCompressor::flush() {
         return;
     }
 
+    clp::RuntimeMetrics::ScopedTimer const timer{clp::RuntimeMetrics::Stage::Compress};
     m_compressed_stream_block.pos = 0;
     auto end_stream_result = ZSTD_endStream(m_compression_stream, &m_compressed_stream_block);
     if (end_stream_result) {
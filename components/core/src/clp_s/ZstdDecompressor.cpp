@@ -7,6 +7,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include "../clp/RuntimeMetrics.hpp"
+
 namespace clp_s {
 ZstdDecompressor::ZstdDecompressor()
         : Decompressor(CompressorType::ZSTD),
@@ -45,6 +47,7 @@ ZstdDecompressor::try_read(char const* buf, size_t num_bytes_to_read, size_t& nu
 
     num_bytes_read = 0;
 
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::Decompress};
     ZSTD_outBuffer decompressed_stream_block = {(void*)buf, num_bytes_to_read, 0};
     while (decompressed_stream_block.pos < num_bytes_to_read) {
         // Check if there's data that can be decompressed
@@ -130,6 +133,7 @@ ZstdDecompressor::try_read(char const* buf, size_t num_bytes_to_read, size_t& nu
     m_decompressed_stream_pos += decompressed_stream_block.pos;
 
     num_bytes_read = decompressed_stream_block.pos;
+    timer.add_bytes(num_bytes_read);
     return ErrorCodeSuccess;
 }
 
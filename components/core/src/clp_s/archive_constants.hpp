@@ -17,12 +17,16 @@ constexpr char cArchiveSchemaTreeFile[] = "/schema_tree";
 
 // Encoded record table files
 constexpr char cArchiveTableMetadataFile[] = "/table_metadata";
+constexpr char cArchiveTableZoneMapsFile[] = "/table_zone_maps";
 constexpr char cArchiveTablesFile[] = "/0";
+constexpr char cArchiveTablesStreamFilePrefix[] = "/0.stream.";
+constexpr char cArchiveTablesSpillFile[] = "/0.spill";
 
 // Dictionary files
 constexpr char cArchiveArrayDictFile[] = "/array.dict";
 constexpr char cArchiveLogDictFile[] = "/log.dict";
 constexpr char cArchiveVarDictFile[] = "/var.dict";
+constexpr char cArchiveVarDictFilterFile[] = "/var.dict.filter";
 
 // Schema tree constants
 constexpr char cRootNodeName[] = "";
@@ -60,6 +64,7 @@ constexpr char cMessage[]{"message"};
 constexpr char cArchiveId[]{"archive_id"};
 constexpr std::string_view cDataset{"dataset"};
 constexpr char cCount[]{"count"};
+constexpr char cGroupBy[]{"group_by"};
 }  // namespace results_cache::search
 }  // namespace clp_s::constants
 #endif  // CLP_S_ARCHIVE_CONSTANTS_HPP
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
@@ -7,8 +10,10 @@
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <thread>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 #include <mongocxx/instance.hpp>
@@ -19,6 +24,7 @@
 #if CLP_BUILD_CLP_S_ENABLE_CURL
     #include "../clp/CurlGlobalInstance.hpp"
 #endif
+#include <clp/RuntimeMetrics.hpp>
 #include <clp/type_utils.hpp>
 #include <clp_s/search/SearchTelemetry.hpp>
 #include <clp_s/search/TelemetryContext.hpp>
@@ -26,6 +32,10 @@
 #include "../clp/ir/constants.hpp"
 #include "../clp/streaming_archive/ArchiveMetadata.hpp"
 #include "../reducer/network_utils.hpp"
+#include "../reducer/Operator.hpp"
+#include "../reducer/RecordTypedKeyIterator.hpp"
+#include "../reducer/SketchOperator.hpp"
+#include "../reducer/StatisticsOperator.hpp"
 #include "CommandLineArguments.hpp"
 #include "Defs.hpp"
 #include "JsonConstructor.hpp"
@@ -45,6 +55,7 @@
 #include "search/OutputHandler.hpp"
 #include "search/Projection.hpp"
 #include "search/SchemaMatch.hpp"
+#include "ShardedJsonParser.hpp"
 #include "SingleFileArchiveDefs.hpp"
 
 using namespace clp_s::search;
@@ -56,6 +67,16 @@ using clp_s::KvIrSearchError;
 using clp_s::KvIrSearchErrorEnum;
 
 namespace {
+/**
+ * The reducer operator that computes an aggregation of a field, along with the key and type of the
+ * field's value in the records the operator consumes.
+ */
+struct FieldAggregation {
+    std::shared_ptr<reducer::Operator> aggregation_operator;
+    std::string value_key;
+    reducer::ValueType value_type;
+};
+
 /**
  * Compresses the input files specified by the command line arguments into an archive.
  * @param command_line_arguments
@@ -69,6 +90,43 @@ bool compress(CommandLineArguments const& command_line_arguments);
  */
 void decompress_archive(clp_s::JsonConstructorOption const& json_constructor_option);
 
+/**
+ * Creates the reducer operator for the field aggregation specified by the command line arguments.
+ * @param command_line_arguments
+ * @param sketch_output_mode What sketch-based aggregations should output.
+ * @return The field aggregation, or std::nullopt if the requested aggregation isn't computed over a
+ * field.
+ */
+auto create_field_aggregation(
+        CommandLineArguments const& command_line_arguments,
+        reducer::SketchOutputMode sketch_output_mode
+) -> std::optional<FieldAggregation>;
+
+/**
+ * Creates the output handler specified by the command line arguments.
+ * @param command_line_arguments
+ * @param archive_id The ID of the archive whose results will be output.
+ * @param reducer_socket_fd
+ * @return The output handler, or null if the output handler options are unsupported.
+ */
+auto create_output_handler(
+        CommandLineArguments const& command_line_arguments,
+        std::string_view archive_id,
+        int reducer_socket_fd
+) -> std::unique_ptr<OutputHandler>;
+
+/**
+ * Gets the columns to project when searching an archive.
+ *
+ * Field aggregations only read the aggregated field and the group-by fields of each result, so for
+ * those, only these fields are projected (in place of any user-specified projection). This avoids
+ * marshalling every other field of each result only for the output handler to skip it.
+ * @param command_line_arguments
+ * @return The columns to project, or an empty vector if every column should be returned.
+ */
+auto get_projection_columns(CommandLineArguments const& command_line_arguments)
+        -> std::vector<std::string>;
+
 /**
  * Searches the given archive.
  *
@@ -77,6 +135,8 @@ void decompress_archive(clp_s::JsonConstructorOption const& json_constructor_opt
  * @param expr A copy of the search AST which may be modified.
  * @param reducer_socket_fd
  * @param telemetry_span The span to record search telemetry onto, or null if telemetry is disabled.
+ * @param shared_output_state The output state shared by archives that are searched concurrently, or
+ * null if only this archive is being searched.
  * @return Whether the search succeeded.
  */
 bool search_archive(
@@ -84,9 +144,27 @@ bool search_archive(
         std::shared_ptr<clp_s::ArchiveReader> const& archive_reader,
         std::shared_ptr<ast::Expression> expr,
         int reducer_socket_fd,
-        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span
+        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span,
+        std::shared_ptr<clp_s::SynchronizedOutputHandler::SharedState> const& shared_output_state
 );
 
+/**
+ * Searches the given archives on up to `get_num_search_threads()` threads. Each thread repeatedly
+ * claims the next unsearched archive until every archive has been searched, the result limit has
+ * been reached, or a search fails.
+ * @param command_line_arguments
+ * @param archive_paths
+ * @param expr
+ * @param reducer_socket_fd
+ * @return Whether every search succeeded.
+ */
+auto search_archives_concurrently(
+        CommandLineArguments const& command_line_arguments,
+        std::vector<clp_s::Path> const& archive_paths,
+        std::shared_ptr<ast::Expression> const& expr,
+        int reducer_socket_fd
+) -> bool;
+
 bool compress(CommandLineArguments const& command_line_arguments) {
     auto archives_dir = std::filesystem::path(command_line_arguments.get_archives_dir());
 
@@ -110,6 +188,13 @@ bool compress(CommandLineArguments const& command_line_arguments) {
     option.target_encoded_size = command_line_arguments.get_target_encoded_size();
     option.max_document_size = command_line_arguments.get_max_document_size();
     option.min_table_size = command_line_arguments.get_minimum_table_size();
+    option.num_compression_threads = command_line_arguments.get_num_compression_threads();
+    option.table_memory_budget = command_line_arguments.get_table_memory_budget();
+    option.num_kv_ir_deserialization_threads
+            = command_line_arguments.get_num_kv_ir_deserialization_threads();
+    option.var_dict_filter_type = command_line_arguments.get_var_dict_filter_type();
+    option.var_dict_filter_false_positive_rate
+            = command_line_arguments.get_var_dict_filter_false_positive_rate();
     option.compression_level = command_line_arguments.get_compression_level();
     option.timestamp_key = command_line_arguments.get_timestamp_key();
     option.print_archive_stats = command_line_arguments.print_archive_stats();
@@ -118,6 +203,18 @@ bool compress(CommandLineArguments const& command_line_arguments) {
     option.structurize_arrays = command_line_arguments.get_structurize_arrays();
     option.record_log_order = command_line_arguments.get_record_log_order();
 
+    if (auto const num_ingestion_threads{command_line_arguments.get_num_ingestion_threads()};
+        num_ingestion_threads > 1)
+    {
+        clp_s::ShardedJsonParser parser(option, num_ingestion_threads);
+        if (false == parser.ingest()) {
+            SPDLOG_ERROR("Encountered error while parsing input.");
+            return false;
+        }
+        std::ignore = parser.store();
+        return true;
+    }
+
     clp_s::JsonParser parser(option);
     if (false == parser.ingest()) {
         SPDLOG_ERROR("Encountered error while parsing input.");
@@ -132,12 +229,208 @@ void decompress_archive(clp_s::JsonConstructorOption const& json_constructor_opt
     constructor.store();
 }
 
+auto create_field_aggregation(
+        CommandLineArguments const& command_line_arguments,
+        reducer::SketchOutputMode sketch_output_mode
+) -> std::optional<FieldAggregation> {
+    auto const& aggregation_type = command_line_arguments.get_aggregation_type();
+    if (false == aggregation_type.has_value()) {
+        return std::nullopt;
+    }
+
+    auto create_sketch_aggregation = [&](reducer::SketchType sketch_type,
+                                         reducer::ValueType value_type) -> FieldAggregation {
+        return {std::make_shared<reducer::SketchOperator>(
+                        sketch_type,
+                        sketch_output_mode,
+                        command_line_arguments.get_top_k_size()
+                ),
+                reducer::SketchOperator::cValueKey,
+                value_type};
+    };
+    switch (aggregation_type.value()) {
+        case CommandLineArguments::AggregationType::Statistics:
+            return FieldAggregation{
+                    std::make_shared<reducer::StatisticsOperator>(),
+                    reducer::StatisticsOperator::cValueKey,
+                    reducer::ValueType::Double
+            };
+        case CommandLineArguments::AggregationType::DistinctCount:
+            return create_sketch_aggregation(
+                    reducer::SketchType::DistinctCount,
+                    reducer::ValueType::String
+            );
+        case CommandLineArguments::AggregationType::Quantiles:
+            return create_sketch_aggregation(
+                    reducer::SketchType::Quantiles,
+                    reducer::ValueType::Double
+            );
+        case CommandLineArguments::AggregationType::TopK:
+            return create_sketch_aggregation(reducer::SketchType::TopK, reducer::ValueType::String);
+        default:
+            return std::nullopt;
+    }
+}
+
+auto create_output_handler(
+        CommandLineArguments const& command_line_arguments,
+        std::string_view archive_id,
+        int reducer_socket_fd
+) -> std::unique_ptr<OutputHandler> {
+    std::unique_ptr<OutputHandler> output_handler;
+    std::visit(
+            clp::overloaded{
+                    [&](CommandLineArguments::FileOutputHandlerOptions const& options) -> void {
+                        output_handler = std::make_unique<clp_s::FileOutputHandler>(
+                                options.output_path,
+                                true
+                        );
+                    },
+                    [&](CommandLineArguments::NetworkOutputHandlerOptions const& options)
+                            -> void {
+                        output_handler = std::make_unique<clp_s::NetworkOutputHandler>(
+                                options.host,
+                                options.port
+                        );
+                    },
+                    [&](CommandLineArguments::ReducerOutputHandlerOptions const&) -> void {
+                        auto const& aggregation_type
+                                = command_line_arguments.get_aggregation_type();
+                        if (CommandLineArguments::AggregationType::Count == aggregation_type) {
+                            output_handler = std::make_unique<clp_s::CountReducerOutputHandler>(
+                                    reducer_socket_fd
+                            );
+                        } else if (CommandLineArguments::AggregationType::CountByTime
+                                   == aggregation_type) {
+                            output_handler
+                                    = std::make_unique<clp_s::CountByTimeReducerOutputHandler>(
+                                            reducer_socket_fd,
+                                            command_line_arguments
+                                                    .get_count_by_time_bucket_size_ms()
+                                    );
+                        } else if (auto field_aggregation{create_field_aggregation(
+                                           command_line_arguments,
+                                           reducer::SketchOutputMode::Sketch
+                                   )};
+                                   field_aggregation.has_value())
+                        {
+                            output_handler = std::make_unique<
+                                    clp_s::FieldAggregationReducerOutputHandler>(
+                                    reducer_socket_fd,
+                                    std::move(field_aggregation->aggregation_operator),
+                                    field_aggregation->value_key,
+                                    field_aggregation->value_type,
+                                    command_line_arguments.get_aggregation_field(),
+                                    command_line_arguments.get_group_by_keys()
+                            );
+                        } else {
+                            SPDLOG_ERROR("Unhandled aggregation type.");
+                            output_handler = nullptr;
+                        }
+                    },
+                    [&](CommandLineArguments::ResultsCacheOutputHandlerOptions const& options)
+                            -> void {
+                        auto const& aggregation_type
+                                = command_line_arguments.get_aggregation_type();
+                        if (false == aggregation_type.has_value()) {
+                            output_handler = std::make_unique<clp_s::ResultsCacheOutputHandler>(
+                                    options.uri,
+                                    options.collection,
+                                    options.batch_size,
+                                    options.max_num_results,
+                                    options.dataset
+                            );
+                        } else if (CommandLineArguments::AggregationType::Count
+                                   == aggregation_type.value()) {
+                            output_handler
+                                    = std::make_unique<clp_s::CountResultsCacheOutputHandler>(
+                                            options.uri,
+                                            options.collection,
+                                            archive_id
+                                    );
+                        } else if (CommandLineArguments::AggregationType::CountByTime
+                                   == aggregation_type.value())
+                        {
+                            output_handler = std::make_unique<
+                                    clp_s::CountByTimeResultsCacheOutputHandler
+                            >(options.uri,
+                              options.collection,
+                              archive_id,
+                              command_line_arguments.get_count_by_time_bucket_size_ms());
+                        } else {
+                            SPDLOG_ERROR("Unhandled aggregation type.");
+                            output_handler = nullptr;
+                        }
+                    },
+                    [&](CommandLineArguments::StdoutOutputHandlerOptions const&) -> void {
+                        auto const& aggregation_type
+                                = command_line_arguments.get_aggregation_type();
+                        if (false == aggregation_type.has_value()) {
+                            output_handler = std::make_unique<clp_s::StandardOutputHandler>();
+                        } else if (CommandLineArguments::AggregationType::Count
+                                   == aggregation_type.value()) {
+                            output_handler = std::make_unique<clp_s::CountStdoutOutputHandler>(
+                                    archive_id
+                            );
+                        } else if (CommandLineArguments::AggregationType::CountByTime
+                                   == aggregation_type.value())
+                        {
+                            output_handler
+                                    = std::make_unique<clp_s::CountByTimeStdoutOutputHandler>(
+                                            archive_id,
+                                            command_line_arguments
+                                                    .get_count_by_time_bucket_size_ms()
+                                    );
+                        } else if (auto field_aggregation{create_field_aggregation(
+                                           command_line_arguments,
+                                           reducer::SketchOutputMode::Estimates
+                                   )};
+                                   field_aggregation.has_value())
+                        {
+                            output_handler = std::make_unique<
+                                    clp_s::FieldAggregationStdoutOutputHandler>(
+                                    archive_id,
+                                    std::move(field_aggregation->aggregation_operator),
+                                    field_aggregation->value_key,
+                                    field_aggregation->value_type,
+                                    command_line_arguments.get_aggregation_field(),
+                                    command_line_arguments.get_group_by_keys()
+                            );
+                        } else {
+                            SPDLOG_ERROR("Unhandled aggregation type.");
+                            output_handler = nullptr;
+                        }
+                    }
+            },
+            command_line_arguments.get_output_handler_options()
+    );
+    return output_handler;
+}
+
+auto get_projection_columns(CommandLineArguments const& command_line_arguments)
+        -> std::vector<std::string> {
+    auto const& aggregation_field{command_line_arguments.get_aggregation_field()};
+    if (aggregation_field.empty()) {
+        return command_line_arguments.get_projection_columns();
+    }
+
+    std::vector<std::string> columns{aggregation_field};
+    for (auto const& group_by_key : command_line_arguments.get_group_by_keys()) {
+        // A projection can't contain duplicate columns.
+        if (columns.end() == std::find(columns.begin(), columns.end(), group_by_key)) {
+            columns.emplace_back(group_by_key);
+        }
+    }
+    return columns;
+}
+
 bool search_archive(
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<clp_s::ArchiveReader> const& archive_reader,
         std::shared_ptr<ast::Expression> expr,
         int reducer_socket_fd,
-        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span
+        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span,
+        std::shared_ptr<clp_s::SynchronizedOutputHandler::SharedState> const& shared_output_state
 ) {
     auto const& query = command_line_arguments.get_query();
     if (nullptr != telemetry_span) {
@@ -253,13 +546,13 @@ bool search_archive(
     }
 
     // Populate projection
+    auto const projection_columns{get_projection_columns(command_line_arguments)};
     auto projection = std::make_shared<Projection>(
-            command_line_arguments.get_projection_columns().empty()
-                    ? ProjectionMode::ReturnAllColumns
-                    : ProjectionMode::ReturnSelectedColumns
+            projection_columns.empty() ? ProjectionMode::ReturnAllColumns
+                                       : ProjectionMode::ReturnSelectedColumns
     );
     try {
-        for (auto const& column : command_line_arguments.get_projection_columns()) {
+        for (auto const& column : projection_columns) {
             std::vector<std::string> descriptor_tokens;
             std::string descriptor_namespace;
             if (false
@@ -291,102 +584,28 @@ bool search_archive(
 
     std::unique_ptr<OutputHandler> output_handler;
     try {
-        std::visit(
-                clp::overloaded{
-                        [&](CommandLineArguments::FileOutputHandlerOptions const& options) -> void {
-                            output_handler = std::make_unique<clp_s::FileOutputHandler>(
-                                    options.output_path,
-                                    true
-                            );
-                        },
-                        [&](CommandLineArguments::NetworkOutputHandlerOptions const& options)
-                                -> void {
-                            output_handler = std::make_unique<clp_s::NetworkOutputHandler>(
-                                    options.host,
-                                    options.port
-                            );
-                        },
-                        [&](CommandLineArguments::ReducerOutputHandlerOptions const&) -> void {
-                            auto const& aggregation_type
-                                    = command_line_arguments.get_aggregation_type();
-                            if (CommandLineArguments::AggregationType::Count == aggregation_type) {
-                                output_handler = std::make_unique<clp_s::CountReducerOutputHandler>(
-                                        reducer_socket_fd
-                                );
-                            } else if (CommandLineArguments::AggregationType::CountByTime
-                                       == aggregation_type) {
-                                output_handler
-                                        = std::make_unique<clp_s::CountByTimeReducerOutputHandler>(
-                                                reducer_socket_fd,
-                                                command_line_arguments
-                                                        .get_count_by_time_bucket_size_ms()
-                                        );
-                            } else {
-                                SPDLOG_ERROR("Unhandled aggregation type.");
-                                output_handler = nullptr;
-                            }
-                        },
-                        [&](CommandLineArguments::ResultsCacheOutputHandlerOptions const& options)
-                                -> void {
-                            auto const& aggregation_type
-                                    = command_line_arguments.get_aggregation_type();
-                            if (false == aggregation_type.has_value()) {
-                                output_handler = std::make_unique<clp_s::ResultsCacheOutputHandler>(
-                                        options.uri,
-                                        options.collection,
-                                        options.batch_size,
-                                        options.max_num_results,
-                                        options.dataset
-                                );
-                            } else if (CommandLineArguments::AggregationType::Count
-                                       == aggregation_type.value()) {
-                                output_handler
-                                        = std::make_unique<clp_s::CountResultsCacheOutputHandler>(
-                                                options.uri,
-                                                options.collection,
-                                                archive_reader->get_archive_id()
-                                        );
-                            } else if (CommandLineArguments::AggregationType::CountByTime
-                                       == aggregation_type.value())
-                            {
-                                output_handler = std::make_unique<
-                                        clp_s::CountByTimeResultsCacheOutputHandler
-                                >(options.uri,
-                                  options.collection,
-                                  archive_reader->get_archive_id(),
-                                  command_line_arguments.get_count_by_time_bucket_size_ms());
-                            } else {
-                                SPDLOG_ERROR("Unhandled aggregation type.");
-                                output_handler = nullptr;
-                            }
-                        },
-                        [&](CommandLineArguments::StdoutOutputHandlerOptions const&) -> void {
-                            auto const& aggregation_type
-                                    = command_line_arguments.get_aggregation_type();
-                            if (false == aggregation_type.has_value()) {
-                                output_handler = std::make_unique<clp_s::StandardOutputHandler>();
-                            } else if (CommandLineArguments::AggregationType::Count
-                                       == aggregation_type.value()) {
-                                output_handler = std::make_unique<clp_s::CountStdoutOutputHandler>(
-                                        archive_reader->get_archive_id()
-                                );
-                            } else if (CommandLineArguments::AggregationType::CountByTime
-                                       == aggregation_type.value())
-                            {
-                                output_handler
-                                        = std::make_unique<clp_s::CountByTimeStdoutOutputHandler>(
-                                                archive_reader->get_archive_id(),
-                                                command_line_arguments
-                                                        .get_count_by_time_bucket_size_ms()
-                                        );
-                            } else {
-                                SPDLOG_ERROR("Unhandled aggregation type.");
-                                output_handler = nullptr;
-                            }
-                        }
-                },
-                command_line_arguments.get_output_handler_options()
-        );
+        std::shared_ptr<OutputHandler> target_handler;
+        if (nullptr != shared_output_state) {
+            target_handler = shared_output_state->get_shared_handler();
+        }
+        if (nullptr == target_handler) {
+            output_handler = create_output_handler(
+                    command_line_arguments,
+                    archive_reader->get_archive_id(),
+                    reducer_socket_fd
+            );
+        }
+        if (nullptr != shared_output_state) {
+            if (nullptr == target_handler) {
+                target_handler = std::move(output_handler);
+            }
+            if (nullptr != target_handler) {
+                output_handler = std::make_unique<clp_s::SynchronizedOutputHandler>(
+                        std::move(target_handler),
+                        shared_output_state
+                );
+            }
+        }
         if (nullptr == output_handler) {
             record_error_and_log(
                     "output handler creation failed",
@@ -420,11 +639,118 @@ bool search_archive(
     }
     return success;
 }
+
+auto search_archives_concurrently(
+        CommandLineArguments const& command_line_arguments,
+        std::vector<clp_s::Path> const& archive_paths,
+        std::shared_ptr<ast::Expression> const& expr,
+        int reducer_socket_fd
+) -> bool {
+    if (archive_paths.empty()) {
+        return true;
+    }
+
+    // Results that are written straight to a sink are forwarded to a single shared handler so that
+    // the sink is only opened once. Aggregations, the reducer, and the results cache keep one
+    // handler per archive since their output is tied to the archive being searched.
+    std::shared_ptr<OutputHandler> shared_handler;
+    auto const& output_handler_options{command_line_arguments.get_output_handler_options()};
+    if (false == command_line_arguments.get_aggregation_type().has_value()
+        && (std::holds_alternative<CommandLineArguments::StdoutOutputHandlerOptions>(
+                    output_handler_options
+            )
+            || std::holds_alternative<CommandLineArguments::FileOutputHandlerOptions>(
+                    output_handler_options
+            )
+            || std::holds_alternative<CommandLineArguments::NetworkOutputHandlerOptions>(
+                    output_handler_options
+            )))
+    {
+        try {
+            shared_handler = create_output_handler(command_line_arguments, {}, reducer_socket_fd);
+        } catch (std::exception const& e) {
+            SPDLOG_ERROR("Failed to create output handler - {}", e.what());
+            return false;
+        }
+    }
+    auto const shared_output_state{std::make_shared<clp_s::SynchronizedOutputHandler::SharedState>(
+            shared_handler,
+            command_line_arguments.get_result_limit()
+    )};
+
+    std::atomic_size_t next_archive_idx{0};
+    std::atomic_bool failed{false};
+    auto search_next_archives = [&]() -> void {
+        auto const archive_reader{std::make_shared<clp_s::ArchiveReader>()};
+        while (false == failed.load() && false == shared_output_state->is_limit_reached()) {
+            auto const archive_idx{next_archive_idx.fetch_add(1)};
+            if (archive_idx >= archive_paths.size()) {
+                return;
+            }
+
+            std::shared_ptr<SearchTelemetrySpan> telemetry_span;
+            if (command_line_arguments.get_enable_telemetry()) {
+                telemetry_span = std::make_shared<SearchTelemetrySpan>();
+            }
+            try {
+                archive_reader->open(
+                        archive_paths[archive_idx],
+                        command_line_arguments.get_network_auth()
+                );
+            } catch (std::exception const& e) {
+                SPDLOG_ERROR("Failed to open archive - {}", e.what());
+                if (nullptr != telemetry_span) {
+                    telemetry_span->set_error("failed to open archive");
+                }
+                failed = true;
+                return;
+            }
+            try {
+                if (false
+                    == search_archive(
+                            command_line_arguments,
+                            archive_reader,
+                            expr->copy(),
+                            reducer_socket_fd,
+                            telemetry_span,
+                            shared_output_state
+                    ))
+                {
+                    failed = true;
+                    return;
+                }
+                archive_reader->close();
+            } catch (std::exception const& e) {
+                SPDLOG_ERROR(
+                        "Encountered error while searching archive '{}' - {}",
+                        archive_paths[archive_idx].path,
+                        e.what()
+                );
+                failed = true;
+                return;
+            }
+        }
+    };
+
+    auto const num_threads{
+            std::min(command_line_arguments.get_num_search_threads(), archive_paths.size())
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t i{0}; i < num_threads; ++i) {
+        workers.emplace_back(search_next_archives);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return false == failed.load();
+}
 }  // namespace
 
 int main(int argc, char const* argv[]) {
     try {
-        auto stderr_logger = spdlog::stderr_logger_st("stderr");
+        // NOTE: We use a thread-safe logger since compression may ingest inputs on several threads.
+        auto stderr_logger = spdlog::stderr_logger_mt("stderr");
         spdlog::set_default_logger(stderr_logger);
         spdlog::set_pattern("%Y-%m-%dT%H:%M:%S.%e%z [%l] %v");
     } catch (std::exception& e) {
@@ -454,6 +780,14 @@ int main(int argc, char const* argv[]) {
         telemetry_context.emplace();
     }
 
+    std::optional<clp::RuntimeMetrics::FileExporter> metrics_exporter;
+    if (false == command_line_arguments.get_metrics_file_path().empty()) {
+        metrics_exporter.emplace(
+                command_line_arguments.get_metrics_file_path(),
+                command_line_arguments.get_metrics_format()
+        );
+    }
+
     if (CommandLineArguments::Command::Compress == command_line_arguments.get_command()) {
         try {
             if (false == compress(command_line_arguments)) {
@@ -514,6 +848,13 @@ int main(int argc, char const* argv[]) {
             }
         }
 
+        // Archives are only collected (rather than searched immediately) if they may be searched
+        // concurrently or a result limit must be shared across them.
+        auto const should_collect_archives{
+                command_line_arguments.get_num_search_threads() > 1
+                || command_line_arguments.get_result_limit().has_value()
+        };
+        std::vector<clp_s::Path> archive_paths;
         auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
         for (auto const& input_path : command_line_arguments.get_input_paths()) {
             if (std::string::npos != input_path.path.find(clp::ir::cIrFileExtension)) {
@@ -564,6 +905,11 @@ int main(int argc, char const* argv[]) {
                 }
             }
 
+            if (should_collect_archives) {
+                archive_paths.emplace_back(input_path);
+                continue;
+            }
+
             std::shared_ptr<SearchTelemetrySpan> telemetry_span;
             if (command_line_arguments.get_enable_telemetry()) {
                 telemetry_span = std::make_shared<SearchTelemetrySpan>();
@@ -583,13 +929,25 @@ int main(int argc, char const* argv[]) {
                         archive_reader,
                         expr->copy(),
                         reducer_socket_fd,
-                        telemetry_span
+                        telemetry_span,
+                        nullptr
                 ))
             {
                 return 1;
             }
             archive_reader->close();
         }
+
+        if (false
+            == search_archives_concurrently(
+                    command_line_arguments,
+                    archive_paths,
+                    expr,
+                    reducer_socket_fd
+            ))
+        {
+            return 1;
+        }
     }
 
     return 0;
@@ -3,11 +3,14 @@
 #include <cerrno>
 #include <cstddef>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 #include <nlohmann/json_fwd.hpp>
@@ -17,6 +20,7 @@
 
 #include "../clp/ErrorCode.hpp"
 #include "../clp/ffi/ir_stream/Deserializer.hpp"
+#include "../clp/ffi/ir_stream/IrStreamIndex.hpp"
 #include "../clp/ffi/ir_stream/IrUnitType.hpp"
 #include "../clp/ffi/ir_stream/search/QueryHandler.hpp"
 #include "../clp/ffi/KeyValuePairLogEvent.hpp"
@@ -27,6 +31,7 @@
 #include "../clp/time_types.hpp"
 #include "../clp/TraceableException.hpp"
 #include "CommandLineArguments.hpp"
+#include "Defs.hpp"
 #include "InputConfig.hpp"
 #include "search/ast/Expression.hpp"
 #include "search/ast/SetTimestampLiteralPrecision.hpp"
@@ -46,6 +51,7 @@ using KvIrSearchErrorCategory = ystdlib::error_handling::ErrorCategory<KvIrSearc
 namespace clp_s {
 namespace {
 using clp::ffi::ir_stream::IRErrorCode;
+using clp::ffi::ir_stream::IrStreamIndex;
 using clp::ffi::ir_stream::IrUnitType;
 using clp::ffi::ir_stream::make_deserializer;
 using clp::ffi::KeyValuePairLogEvent;
@@ -80,7 +86,7 @@ public:
 
     // Methods implementing `IrUnitHandlerInterface`
     [[nodiscard]] auto
-    handle_log_event(KeyValuePairLogEvent log_event, [[maybe_unused]] size_t log_event_idx)
+    handle_log_event(KeyValuePairLogEvent&& log_event, [[maybe_unused]] size_t log_event_idx)
             -> IRErrorCode;
 
     [[nodiscard]] static auto handle_utc_offset_change(
@@ -108,8 +114,14 @@ private:
 };
 
 /**
- * Deserializes the kv-pair IR stream from the given stream reader and performs query search.
- * @param stream_reader The stream reader to read the kv-pair IR stream from.
+ * Deserializes the zstd-compressed kv-pair IR stream from the given reader and performs query
+ * search.
+ *
+ * If an index is given, only the parts of the stream starting at checkpoints whose timestamp ranges
+ * overlap the search's timestamp range are deserialized.
+ * @param raw_reader The reader to read the compressed kv-pair IR stream from. Must support seeking
+ * if an index is given.
+ * @param index
  * @param command_line_arguments
  * @param query
  * @param reducer_socket_fd
@@ -119,11 +131,14 @@ private:
  *   `clp::ffi::ir_stream::Deserializer::create`, allowing callers to identify cases where the input
  *   might not be a kv-pair IR stream.
  * - Forwards `clp::ffi::ir_stream::Deserializer::deserialize_next_ir_unit`'s return values.
+ * - Forwards `clp::ffi::ir_stream::Deserializer::resume_from_checkpoint`'s return values.
  * - Forwards `clp::ffi::ir_stream::search::QueryHandler::create`'s return values.
  * - Forwards `IrUnitHandler::create`'s return values.
+ * @throw clp::TraceableException if the stream can't be read or decompressed.
  */
 [[nodiscard]] auto deserialize_and_search_kv_ir_stream(
-        clp::ReaderInterface& stream_reader,
+        clp::ReaderInterface& raw_reader,
+        std::optional<IrStreamIndex> const& index,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
         int reducer_socket_fd
@@ -155,7 +170,7 @@ auto IrUnitHandler::create(
  */
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 auto IrUnitHandler::handle_log_event(
-        clp::ffi::KeyValuePairLogEvent log_event,
+        clp::ffi::KeyValuePairLogEvent&& log_event,
         [[maybe_unused]] size_t log_event_idx
 ) -> IRErrorCode {
     auto const serialize_result{log_event.serialize_to_json()};
@@ -193,11 +208,14 @@ auto IrUnitHandler::handle_log_event(
 }
 
 auto deserialize_and_search_kv_ir_stream(
-        clp::ReaderInterface& stream_reader,
+        clp::ReaderInterface& raw_reader,
+        std::optional<IrStreamIndex> const& index,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
         int reducer_socket_fd
 ) -> ystdlib::error_handling::Result<void> {
+    constexpr size_t cReaderBufferSize{64L * 1024L};  // 64 KiB
+
     auto trivial_new_projected_schema_tree_node_callback
             = []([[maybe_unused]] bool is_auto_generated,
                  [[maybe_unused]] SchemaTree::Node::id_t node_id,
@@ -218,8 +236,10 @@ auto deserialize_and_search_kv_ir_stream(
             )
     )};
 
+    clp::streaming_compression::zstd::Decompressor decompressor;
+    decompressor.open(raw_reader, cReaderBufferSize);
     auto deserializer_result{
-            make_deserializer(stream_reader, std::move(ir_unit_handler), std::move(query_handler))
+            make_deserializer(decompressor, std::move(ir_unit_handler), std::move(query_handler))
     };
 
     if (deserializer_result.has_error()) {
@@ -227,9 +247,67 @@ auto deserialize_and_search_kv_ir_stream(
     }
 
     auto& deserializer{deserializer_result.value()};
-    while (IrUnitType::EndOfStream
-           != YSTDLIB_ERROR_HANDLING_TRYX(deserializer.deserialize_next_ir_unit(stream_reader)))
-    {}
+    if (false == index.has_value()) {
+        while (IrUnitType::EndOfStream
+               != YSTDLIB_ERROR_HANDLING_TRYX(deserializer.deserialize_next_ir_unit(decompressor)))
+        {}
+        decompressor.close();
+        return ystdlib::error_handling::success();
+    }
+
+    auto const& checkpoints{index->get_checkpoints()};
+    auto const checkpoint_indices{index->find_checkpoints_in_time_range(
+            command_line_arguments.get_search_begin_ts().value_or(
+                    std::numeric_limits<epochtime_t>::min()
+            ),
+            command_line_arguments.get_search_end_ts().value_or(
+                    std::numeric_limits<epochtime_t>::max()
+            )
+    )};
+    // The offset in the (decompressed) IR stream at which the decompressor was last opened
+    size_t decompressor_base_offset{0};
+    size_t i{0};
+    while (i < checkpoint_indices.size()) {
+        // Deserialize the part of the stream covered by the run of consecutive checkpoints starting
+        // at `first_checkpoint_idx`.
+        auto const first_checkpoint_idx{checkpoint_indices[i]};
+        auto last_checkpoint_idx{first_checkpoint_idx};
+        ++i;
+        while (i < checkpoint_indices.size() && checkpoint_indices[i] == last_checkpoint_idx + 1) {
+            last_checkpoint_idx = checkpoint_indices[i];
+            ++i;
+        }
+
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                deserializer.resume_from_checkpoint(index.value(), first_checkpoint_idx)
+        );
+        auto const& checkpoint{checkpoints[first_checkpoint_idx]};
+        if (checkpoint.compressed_offset.has_value()) {
+            // The checkpoint starts a new zstd frame, so decompression can start from there.
+            decompressor.close();
+            raw_reader.seek_from_begin(checkpoint.compressed_offset.value());
+            decompressor.open(raw_reader, cReaderBufferSize);
+            decompressor_base_offset = checkpoint.ir_stream_offset;
+        } else {
+            decompressor.seek_from_begin(checkpoint.ir_stream_offset - decompressor_base_offset);
+        }
+
+        std::optional<size_t> end_log_event_idx;
+        if (last_checkpoint_idx + 1 < checkpoints.size()) {
+            end_log_event_idx = checkpoints[last_checkpoint_idx + 1].log_event_idx;
+        }
+        while (false == end_log_event_idx.has_value()
+               || deserializer.get_num_log_events_deserialized() < end_log_event_idx.value())
+        {
+            auto const ir_unit_type{
+                    YSTDLIB_ERROR_HANDLING_TRYX(deserializer.deserialize_next_ir_unit(decompressor))
+            };
+            if (IrUnitType::EndOfStream == ir_unit_type) {
+                break;
+            }
+        }
+    }
+    decompressor.close();
 
     return ystdlib::error_handling::success();
 }
@@ -251,36 +329,47 @@ auto search_kv_ir_stream(
         return KvIrSearchError{KvIrSearchErrorEnum::CountSupportNotImplemented};
     }
 
+    std::optional<IrStreamIndex> index;
+    if (command_line_arguments.get_search_begin_ts().has_value()
+        || command_line_arguments.get_search_end_ts().has_value())
+    {
+        index = try_read_ir_stream_index(stream_path);
+        if (index.has_value()) {
+            SPDLOG_WARN(
+                    "kv-ir search: Timestamp filters are only used to skip the parts of the stream"
+                    " that its index excludes. Log events in the remaining parts aren't filtered."
+            );
+        } else {
+            SPDLOG_WARN(
+                    "kv-ir search: Timestamp filters are currently not supported for streams"
+                    " without an index. Values will be ignored."
+            );
+        }
+    }
+
     auto const raw_reader{
-            try_create_reader(stream_path, command_line_arguments.get_network_auth())
+            index.has_value()
+                    ? try_create_seekable_reader(
+                              stream_path,
+                              command_line_arguments.get_network_auth()
+                      )
+                    : try_create_reader(stream_path, command_line_arguments.get_network_auth())
     };
     if (nullptr == raw_reader) {
         return KvIrSearchError{KvIrSearchErrorEnum::StreamReaderCreationFailure};
     }
 
-    if (command_line_arguments.get_search_begin_ts().has_value()
-        || command_line_arguments.get_search_end_ts().has_value())
-    {
-        SPDLOG_WARN(
-                "kv-ir search: Timestamp filters are currently not supported."
-                " Values will be ignored."
-        );
-    }
-
     SetTimestampLiteralPrecision date_precision_pass{TimestampLiteral::Precision::Milliseconds};
     query = date_precision_pass.run(query);
 
     try {
-        clp::streaming_compression::zstd::Decompressor decompressor;
-        constexpr size_t cReaderBufferSize{64L * 1024L};  // 64 KiB
-        decompressor.open(*raw_reader, cReaderBufferSize);
         YSTDLIB_ERROR_HANDLING_TRYV(deserialize_and_search_kv_ir_stream(
-                decompressor,
+                *raw_reader,
+                index,
                 command_line_arguments,
                 std::move(query),
                 reducer_socket_fd
         ));
-        decompressor.close();
     } catch (clp::TraceableException const& ex) {
         auto const err{ex.get_error_code()};
         if (clp::ErrorCode_errno == err) {
@@ -148,6 +148,11 @@ auto CommandLineArguments::parse_arguments(int argc, char const** argv)
                 "no-compress-converted-files",
                 po::bool_switch(&no_compress_converted_files),
                 "Disable compression on the converted KV-IR files."
+        )(
+                "write-index",
+                po::bool_switch(&m_write_index),
+                "Write a checkpoint index alongside each converted KV-IR file, allowing searches"
+                " with a time range to skip the parts of the file outside the range."
         );
         // clang-format on
 
@@ -41,6 +41,8 @@ public:
         return m_compress_converted_files;
     }
 
+    [[nodiscard]] auto get_write_index() const -> bool { return m_write_index; }
+
 private:
     // Methods
     void print_basic_usage() const;
@@ -52,6 +54,7 @@ private:
     std::string m_output_dir{"./"};
     size_t m_max_log_event_size{512ULL * 1024ULL * 1024ULL};  // 512 MiB
     bool m_compress_converted_files{true};
+    bool m_write_index{false};
 };
 }  // namespace clp_s::log_converter
 
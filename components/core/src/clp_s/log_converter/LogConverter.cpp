@@ -54,7 +54,8 @@ auto LogConverter::convert_file(
         clp_s::Path const& path,
         clp::ReaderInterface* reader,
         std::string_view output_dir,
-        bool compress_converted_file
+        bool compress_converted_file,
+        bool write_index
 ) -> ystdlib::error_handling::Result<void> {
     m_parser.reset();
 
@@ -63,7 +64,7 @@ auto LogConverter::convert_file(
     m_num_bytes_buffered = 0ULL;
 
     auto serializer{YSTDLIB_ERROR_HANDLING_TRYX(
-            LogSerializer::create(output_dir, path.path, compress_converted_file)
+            LogSerializer::create(output_dir, path.path, compress_converted_file, write_index)
     )};
 
     bool reached_end_of_stream{false};
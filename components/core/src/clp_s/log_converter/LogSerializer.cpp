@@ -1,8 +1,10 @@
 #include "LogSerializer.hpp"
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
@@ -22,18 +24,23 @@
 #include <clp/FileWriter.hpp>
 #include <clp/ir/constants.hpp>
 #include <clp/ir/types.hpp>
+#include <clp/streaming_compression/Compressor.hpp>
 #include <clp/streaming_compression/zstd/Compressor.hpp>
+#include <clp/type_utils.hpp>
+#include <clp_s/timestamp_parser/TimestampParser.hpp>
 
 namespace clp_s::log_converter {
 namespace {
 constexpr msgpack::object_map cEmptyMap{.size = 0U, .ptr = nullptr};
 constexpr std::string_view cUncompressedFileExtension{".clp"};
+constexpr clp::ir::epoch_time_ms_t cNanosecondsPerMillisecond{1'000'000};
 }  // namespace
 
 auto LogSerializer::create(
         std::string_view output_dir,
         std::string_view original_file_path,
-        bool compress_with_zstd
+        bool compress_with_zstd,
+        bool write_index
 ) -> ystdlib::error_handling::Result<LogSerializer> {
     nlohmann::json metadata;
     metadata.emplace(cOriginalFileMetadataKey, original_file_path);
@@ -60,18 +67,37 @@ auto LogSerializer::create(
         return std::errc::no_such_file_or_directory;
     }
 
-    if (false == compress_with_zstd) {
-        return LogSerializer{std::move(serializer), std::move(nested_writers)};
+    if (compress_with_zstd) {
+        try {
+            auto compressor{std::make_unique<clp::streaming_compression::zstd::Compressor>()};
+            compressor->open(*nested_writers.back().get());
+            nested_writers.emplace_back(std::move(compressor));
+        } catch (std::exception const&) {
+            return std::errc::protocol_error;
+        }
     }
 
-    try {
-        auto compressor{std::make_unique<clp::streaming_compression::zstd::Compressor>()};
-        compressor->open(*nested_writers.back().get());
-        nested_writers.emplace_back(std::move(compressor));
-    } catch (std::exception const&) {
-        return std::errc::protocol_error;
+    if (false == write_index) {
+        return LogSerializer{
+                std::move(serializer),
+                std::move(nested_writers),
+                std::nullopt,
+                {}
+        };
     }
-    return LogSerializer{std::move(serializer), std::move(nested_writers)};
+
+    auto timestamp_patterns{
+            YSTDLIB_ERROR_HANDLING_TRYX(timestamp_parser::get_all_default_timestamp_patterns())
+    };
+    LogSerializer log_serializer{
+            std::move(serializer),
+            std::move(nested_writers),
+            converted_path.string() + std::string{clp::ir::cIrStreamIndexFileExtension},
+            std::move(timestamp_patterns)
+    };
+    // Add a checkpoint right after the preamble so that every log event is covered by one.
+    log_serializer.add_checkpoint();
+    return log_serializer;
 }
 
 auto LogSerializer::add_message(std::string_view timestamp, std::string_view message)
@@ -87,10 +113,14 @@ auto LogSerializer::add_message(std::string_view timestamp, std::string_view mes
             .size = static_cast<uint32_t>(fields.size()),
             .ptr = fields.data()
     };
-    YSTDLIB_ERROR_HANDLING_TRYV(m_serializer.serialize_msgpack_map(cEmptyMap, record));
-    if (m_serializer.get_ir_buf_view().size() > cMaxIrBufSize) {
-        flush_buffer();
+    std::optional<clp::ir::epoch_time_ms_t> epoch_timestamp;
+    if (m_index_path.has_value()) {
+        epoch_timestamp = parse_timestamp(timestamp);
     }
+    YSTDLIB_ERROR_HANDLING_TRYV(
+            m_serializer.serialize_msgpack_map(cEmptyMap, record, epoch_timestamp)
+    );
+    handle_serialized_message();
     return ystdlib::error_handling::success();
 }
 
@@ -101,9 +131,79 @@ auto LogSerializer::add_message(std::string_view message) -> ystdlib::error_hand
     };
     msgpack::object_map const record{.size = 1U, .ptr = &message_field};
     YSTDLIB_ERROR_HANDLING_TRYV(m_serializer.serialize_msgpack_map(cEmptyMap, record));
+    handle_serialized_message();
+    return ystdlib::error_handling::success();
+}
+
+void LogSerializer::handle_serialized_message() {
+    if (m_index_path.has_value()
+        && m_serializer.get_ir_stream_offset() - m_last_checkpoint_ir_stream_offset
+                   >= cCheckpointInterval)
+    {
+        add_checkpoint();
+        return;
+    }
     if (m_serializer.get_ir_buf_view().size() > cMaxIrBufSize) {
         flush_buffer();
     }
-    return ystdlib::error_handling::success();
+}
+
+void LogSerializer::add_checkpoint() {
+    flush_buffer();
+    std::optional<size_t> compressed_offset;
+    if (auto compressor{
+                dynamic_cast<clp::streaming_compression::Compressor*>(m_nested_writers.back().get())
+        };
+        nullptr != compressor)
+    {
+        // Ending the frame writes all data before the checkpoint to the file writer
+        compressor->flush();
+        compressed_offset = m_nested_writers.front()->get_pos();
+    }
+    m_serializer.add_checkpoint(compressed_offset);
+    m_last_checkpoint_ir_stream_offset = m_serializer.get_ir_stream_offset();
+}
+
+auto LogSerializer::parse_timestamp(std::string_view timestamp)
+        -> std::optional<clp::ir::epoch_time_ms_t> {
+    if (m_last_timestamp_pattern.has_value()) {
+        auto const parsing_result{timestamp_parser::parse_timestamp(
+                timestamp,
+                m_last_timestamp_pattern.value(),
+                false,
+                m_generated_timestamp_pattern
+        )};
+        if (false == parsing_result.has_error()) {
+            return parsing_result.value().first / cNanosecondsPerMillisecond;
+        }
+    }
+
+    auto const parsing_result{timestamp_parser::search_known_timestamp_patterns(
+            timestamp,
+            m_timestamp_patterns,
+            false,
+            m_generated_timestamp_pattern
+    )};
+    if (false == parsing_result.has_value()) {
+        return std::nullopt;
+    }
+    auto const [epoch_timestamp, pattern]{parsing_result.value()};
+    if (auto pattern_result{timestamp_parser::TimestampPattern::create(pattern)};
+        false == pattern_result.has_error())
+    {
+        m_last_timestamp_pattern.emplace(std::move(pattern_result.value()));
+    }
+    return epoch_timestamp / cNanosecondsPerMillisecond;
+}
+
+void LogSerializer::write_index() {
+    auto const serialized_index{m_serializer.get_index().serialize()};
+    clp::FileWriter writer;
+    writer.open(m_index_path.value(), clp::FileWriter::OpenMode::CREATE_FOR_WRITING);
+    writer.write(
+            clp::size_checked_pointer_cast<char const>(serialized_index.data()),
+            serialized_index.size()
+    );
+    writer.close();
 }
 }  // namespace clp_s::log_converter
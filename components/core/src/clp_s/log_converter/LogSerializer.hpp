@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -16,6 +18,7 @@
 #include <clp/streaming_compression/Compressor.hpp>
 #include <clp/type_utils.hpp>
 #include <clp/WriterInterface.hpp>
+#include <clp_s/timestamp_parser/TimestampParser.hpp>
 
 namespace clp_s::log_converter {
 /**
@@ -29,16 +32,20 @@ public:
      * @param output_dir The destination directory for generated KV-IR.
      * @param original_file_path The original path for the file being converted to KV-IR.
      * @param compress_with_zstd Whether the output KV-IR should be zstd-compressed.
+     * @param write_index Whether to write a checkpoint index (see
+     * `clp::ffi::ir_stream::IrStreamIndex`) alongside the output KV-IR.
      * @return A result containing a `LogSerializer` on success, or an error code indicating the
      * failure:
      * - std::errc::no_such_file_or_directory if a `clp::FileWriter` fails to open an output file.
      * - std::errc::protocol_error if a `clp::zstd::Compressor` fails to open a compression stream.
      * - Forwards `clp::ffi::ir_stream::Serializer<>::create()`'s return values.
+     * - Forwards `clp_s::timestamp_parser::get_all_default_timestamp_patterns()`'s return values.
      */
     [[nodiscard]] static auto create(
             std::string_view output_dir,
             std::string_view original_file_path,
-            bool compress_with_zstd
+            bool compress_with_zstd,
+            bool write_index
     ) -> ystdlib::error_handling::Result<LogSerializer>;
 
     // Constructors
@@ -58,7 +65,10 @@ public:
      * Adds a message with a timestamp to the serialized output.
      *
      * The timestamp is serialized as a string so that the original timestamp format can be
-     * preserved during clp-s ingestion.
+     * preserved during clp-s ingestion. If an index is being written, the timestamp is also parsed
+     * so that the index can record the range of timestamps between checkpoints. Timestamps that
+     * can't be parsed with any of the default timestamp patterns are left out of the index, like
+     * messages without timestamps.
      *
      * @param timestamp
      * @param message
@@ -78,7 +88,8 @@ public:
             -> ystdlib::error_handling::Result<void>;
 
     /**
-     * Closes and flushes the serialized output.
+     * Closes and flushes the serialized output, and writes the index if necessary.
+     * @throw clp::FileWriter::OperationFailed if the index can't be written.
      */
     void close() {
         flush_buffer();
@@ -94,6 +105,9 @@ public:
                 file_writer->close();
             }
         }
+        if (m_index_path.has_value()) {
+            write_index();
+        }
     }
 
 private:
@@ -102,16 +116,50 @@ private:
     static constexpr std::string_view cTimestampKey{"timestamp"};
     static constexpr std::string_view cMessageKey{"message"};
     static constexpr size_t cMaxIrBufSize{64ULL * 1024ULL};  // 64 KiB
+    // The amount of (uncompressed) KV-IR between index checkpoints
+    static constexpr size_t cCheckpointInterval{4ULL * 1024ULL * 1024ULL};  // 4 MiB
 
     // Constructors
     explicit LogSerializer(
             clp::ffi::ir_stream::Serializer<clp::ir::eight_byte_encoded_variable_t>&& serializer,
-            std::vector<std::unique_ptr<clp::WriterInterface>>&& nested_writers
+            std::vector<std::unique_ptr<clp::WriterInterface>>&& nested_writers,
+            std::optional<std::string> index_path,
+            std::vector<timestamp_parser::TimestampPattern> timestamp_patterns
     )
             : m_serializer{std::move(serializer)},
-              m_nested_writers{std::move(nested_writers)} {}
+              m_nested_writers{std::move(nested_writers)},
+              m_index_path{std::move(index_path)},
+              m_timestamp_patterns{std::move(timestamp_patterns)} {}
 
     // Methods
+    /**
+     * Flushes the buffer from the serializer to the output file if it's full, or adds an index
+     * checkpoint if one is due.
+     */
+    void handle_serialized_message();
+
+    /**
+     * Adds an index checkpoint at the current end of the serialized output.
+     *
+     * When compressing, the current zstd frame is ended at the checkpoint, so that a reader can
+     * start decompressing from the checkpoint without decompressing anything before it.
+     */
+    void add_checkpoint();
+
+    /**
+     * @param timestamp
+     * @return The given timestamp in epoch milliseconds, or std::nullopt if it can't be parsed with
+     * any of the default timestamp patterns.
+     */
+    [[nodiscard]] auto parse_timestamp(std::string_view timestamp)
+            -> std::optional<clp::ir::epoch_time_ms_t>;
+
+    /**
+     * Writes the serializer's index to `m_index_path`.
+     * @throw clp::FileWriter::OperationFailed on failure.
+     */
+    void write_index();
+
     /**
      * Flushes the buffer from the serializer to the output file.
      */
@@ -130,6 +178,14 @@ private:
     // NOTE: This class depends on there being at least one writer in `m_nested_writers` at all
     // times.
     std::vector<std::unique_ptr<clp::WriterInterface>> m_nested_writers;
+
+    // Only set if an index should be written alongside the serialized output.
+    std::optional<std::string> m_index_path;
+    size_t m_last_checkpoint_ir_stream_offset{0};
+    std::vector<timestamp_parser::TimestampPattern> m_timestamp_patterns;
+    // The pattern of the last parsed timestamp, which is tried before any other pattern.
+    std::optional<timestamp_parser::TimestampPattern> m_last_timestamp_pattern;
+    std::string m_generated_timestamp_pattern;
 };
 }  // namespace clp_s::log_converter
 
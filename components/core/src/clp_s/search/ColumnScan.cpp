@@ -1,18 +1,20 @@
 #include "ColumnScan.hpp"
 
 #include <algorithm>
-#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <string_utils/string_utils.hpp>
 
 #include <clp/Query.hpp>
 #include <clp_s/ColumnReader.hpp>
+#include <clp_s/Utils.hpp>
 
 #include "ast/AndExpr.hpp"
 #include "ast/Expression.hpp"
@@ -20,6 +22,7 @@
 #include "ast/FilterOperation.hpp"
 #include "ast/Literal.hpp"
 #include "ast/OrExpr.hpp"
+#include "PackedBitmap.hpp"
 
 using clp_s::search::ast::AndExpr;
 using clp_s::search::ast::FilterExpr;
@@ -47,23 +50,35 @@ template <typename T>
 [[nodiscard]] auto is_equality_operation(FilterOperation operation) -> bool;
 
 /**
- * Inverts a bitmap in place.
- * @param bitmap Bitmap to invert.
+ * Gets a view of a reader's values when they're stored as a plain array of `T`, which allows them to
+ * be compared using the vectorized kernels in `PackedBitmap.hpp`.
+ * @param reader
+ * @return A view of the reader's values, or std::nullopt if the reader decodes its values on
+ * extraction.
  */
-auto invert(ColumnScan::Bitmap& bitmap) -> void;
+template <typename T>
+[[nodiscard]] auto get_plain_values(BaseColumnReader* reader) -> std::optional<UnalignedMemSpan<T>>;
+
+/**
+ * Invokes `callback` with the index of every set bit in `selection`.
+ * @param selection
+ * @param callback
+ */
+template <typename Callback>
+auto for_each_selected(ColumnScan::Bitmap const& selection, Callback callback) -> void;
 
 /**
  * Builds a bitmap for a filter over a basic typed column.
- * @param num_messages Number of messages represented by the bitmap.
+ * @param selection The messages to evaluate.
  * @param reader_map Column readers keyed by column ID.
  * @param column_id ID of the column to scan.
  * @param operation Filter operation to apply.
  * @param operand Operand from the filter expression.
- * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+ * @return A bitmap with set bits for the selected messages that match.
  */
 template <typename T>
 [[nodiscard]] auto build_basic_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::BasicReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
@@ -82,16 +97,17 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         -> bool;
 
 /**
- * Builds a bitmap for a filter over a CLP string column.
- * @param num_messages Number of messages represented by the bitmap.
+ * Builds a bitmap for a filter over a CLP string column. Values are only decoded for the selected
+ * messages.
+ * @param selection The messages to evaluate.
  * @param reader_map Column readers keyed by column ID.
  * @param column_id ID of the column to scan.
  * @param operation Equality operation to apply.
  * @param query Query to match against.
- * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+ * @return A bitmap with set bits for the selected messages that match.
  */
 [[nodiscard]] auto build_clp_string_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::ClpStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
@@ -100,15 +116,15 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
 
 /**
  * Builds a bitmap for a filter over a variable string column.
- * @param num_messages Number of messages represented by the bitmap.
+ * @param selection The messages to evaluate.
  * @param reader_map Column readers keyed by column ID.
  * @param column_id ID of the column to scan.
  * @param operation Equality operation to apply.
  * @param matching_vars Set of variable IDs that match the filter.
- * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+ * @return A bitmap with set bits for the selected messages that match.
  */
 [[nodiscard]] auto build_var_string_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::VarStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
@@ -117,15 +133,15 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
 
 /**
  * Builds a bitmap for a filter over a timestamp column.
- * @param num_messages Number of messages represented by the bitmap.
+ * @param selection The messages to evaluate.
  * @param reader_map Column readers keyed by column ID.
  * @param column_id ID of the column to scan.
  * @param operation Filter operation to apply.
  * @param operand Operand from the filter expression, encoded as epoch time.
- * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+ * @return A bitmap with set bits for the selected messages that match.
  */
 [[nodiscard]] auto build_timestamp_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::TimestampReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
@@ -134,14 +150,14 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
 
 /**
  * Builds a bitmap for a filter over a deprecated date-string column.
- * @param num_messages Number of messages represented by the bitmap.
+ * @param selection The messages to evaluate.
  * @param reader Deprecated date-string column reader to scan.
  * @param operation Filter operation to apply.
  * @param operand Operand from the filter expression, encoded as epoch time.
- * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+ * @return A bitmap with set bits for the selected messages that match.
  */
 [[nodiscard]] auto build_deprecated_datestring_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         DeprecatedDateStringColumnReader& reader,
         FilterOperation operation,
         int64_t operand
@@ -173,31 +189,68 @@ template <typename T>
     return FilterOperation::EQ == operation || FilterOperation::NEQ == operation;
 }
 
-auto invert(ColumnScan::Bitmap& bitmap) -> void {
-    for (auto& value : bitmap) {
-        value ^= 1;
+template <typename T>
+[[nodiscard]] auto get_plain_values(BaseColumnReader* reader) -> std::optional<UnalignedMemSpan<T>> {
+    if constexpr (std::is_same_v<T, int64_t>) {
+        if (auto* int_reader = dynamic_cast<Int64ColumnReader*>(reader); nullptr != int_reader) {
+            return int_reader->get_values();
+        }
+    } else if constexpr (std::is_same_v<T, double>) {
+        if (auto* float_reader = dynamic_cast<FloatColumnReader*>(reader); nullptr != float_reader)
+        {
+            return float_reader->get_values();
+        }
+        if (auto* formatted_float_reader = dynamic_cast<FormattedFloatColumnReader*>(reader);
+            nullptr != formatted_float_reader)
+        {
+            return formatted_float_reader->get_values();
+        }
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+        if (auto* bool_reader = dynamic_cast<BooleanColumnReader*>(reader); nullptr != bool_reader)
+        {
+            return bool_reader->get_values();
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename Callback>
+auto for_each_selected(ColumnScan::Bitmap const& selection, Callback callback) -> void {
+    for (auto message_index{selection.find_next(0)}; message_index < selection.size();
+         message_index = selection.find_next(message_index + 1))
+    {
+        callback(static_cast<uint64_t>(message_index));
     }
 }
 
 template <typename T>
 [[nodiscard]] auto build_basic_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::BasicReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
         T operand
 ) -> ColumnScan::Bitmap {
-    ColumnScan::Bitmap bitmap(num_messages, 0);
+    ColumnScan::Bitmap bitmap(selection.size(), false);
     auto const readers = reader_map.find(column_id);
     if (reader_map.end() == readers) {
         return bitmap;
     }
     for (auto* reader : readers->second) {
-        for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
-            auto const value = std::get<T>(reader->extract_value(message_index));
-            bitmap[message_index] |= compare(operation, value, operand) ? 1 : 0;
+        // Comparing every value with the vectorized kernels is cheaper than skipping around the
+        // selection, so unselected messages are only masked out afterwards.
+        if (auto const values = get_plain_values<T>(reader); values.has_value()) {
+            or_compare(bitmap, values.value(), operation, operand);
+            continue;
         }
+        for_each_selected(selection, [&](uint64_t message_index) {
+            auto const value = std::get<T>(reader->extract_value(message_index));
+            if (compare(operation, value, operand)) {
+                bitmap.set(message_index);
+            }
+        });
     }
+    bitmap.and_with(selection);
     return bitmap;
 }
 
@@ -236,88 +289,96 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
 }
 
 [[nodiscard]] auto build_clp_string_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::ClpStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
         clp::Query* query
 ) -> ColumnScan::Bitmap {
-    ColumnScan::Bitmap bitmap(num_messages, 0);
     if (nullptr == query) {
-        std::fill(bitmap.begin(), bitmap.end(), FilterOperation::NEQ == operation ? 1 : 0);
-        return bitmap;
+        return FilterOperation::NEQ == operation ? selection
+                                                 : ColumnScan::Bitmap(selection.size(), false);
     }
     if (query->search_string_matches_all()) {
-        std::fill(bitmap.begin(), bitmap.end(), FilterOperation::EQ == operation ? 1 : 0);
-        return bitmap;
+        return FilterOperation::EQ == operation ? selection
+                                                : ColumnScan::Bitmap(selection.size(), false);
     }
+    ColumnScan::Bitmap bitmap(selection.size(), false);
     auto const readers = reader_map.find(column_id);
     if (reader_map.end() == readers) {
         return bitmap;
     }
     for (auto* reader : readers->second) {
-        for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
+        for_each_selected(selection, [&](uint64_t message_index) {
             auto const matched = clp_string_matches(reader, *query, message_index);
-            bitmap[message_index] |= ((FilterOperation::EQ == operation) == matched) ? 1 : 0;
-        }
+            if ((FilterOperation::EQ == operation) == matched) {
+                bitmap.set(message_index);
+            }
+        });
     }
     return bitmap;
 }
 
 [[nodiscard]] auto build_var_string_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::VarStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
         std::unordered_set<int64_t> const& matching_vars
 ) -> ColumnScan::Bitmap {
-    ColumnScan::Bitmap bitmap(num_messages, 0);
+    ColumnScan::Bitmap bitmap(selection.size(), false);
     auto const readers = reader_map.find(column_id);
     if (reader_map.end() == readers) {
         return bitmap;
     }
     for (auto* reader : readers->second) {
-        for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
+        for_each_selected(selection, [&](uint64_t message_index) {
             auto const matched = matching_vars.contains(
                     static_cast<int64_t>(reader->get_variable_id(message_index))
             );
-            bitmap[message_index] |= ((FilterOperation::EQ == operation) == matched) ? 1 : 0;
-        }
+            if ((FilterOperation::EQ == operation) == matched) {
+                bitmap.set(message_index);
+            }
+        });
     }
     return bitmap;
 }
 
 [[nodiscard]] auto build_timestamp_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         ColumnScan::TimestampReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
         int64_t operand
 ) -> ColumnScan::Bitmap {
-    ColumnScan::Bitmap bitmap(num_messages, 0);
+    ColumnScan::Bitmap bitmap(selection.size(), false);
     auto const reader_it = reader_map.find(column_id);
     if (reader_map.end() == reader_it) {
         return bitmap;
     }
     auto* const reader = reader_it->second;
-    for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
+    for_each_selected(selection, [&](uint64_t message_index) {
         auto const value = reader->get_encoded_time(message_index);
-        bitmap[message_index] = compare(operation, value, operand) ? 1 : 0;
-    }
+        if (compare(operation, value, operand)) {
+            bitmap.set(message_index);
+        }
+    });
     return bitmap;
 }
 
 [[nodiscard]] auto build_deprecated_datestring_filter(
-        uint64_t num_messages,
+        ColumnScan::Bitmap const& selection,
         DeprecatedDateStringColumnReader& reader,
         FilterOperation operation,
         int64_t operand
 ) -> ColumnScan::Bitmap {
-    ColumnScan::Bitmap bitmap(num_messages, 0);
-    for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
+    ColumnScan::Bitmap bitmap(selection.size(), false);
+    for_each_selected(selection, [&](uint64_t message_index) {
         auto const value = reader.get_encoded_time(message_index);
-        bitmap[message_index] = compare(operation, value, operand) ? 1 : 0;
-    }
+        if (compare(operation, value, operand)) {
+            bitmap.set(message_index);
+        }
+    });
     return bitmap;
 }
 }  // namespace
@@ -338,24 +399,22 @@ auto ColumnScan::try_create(
     }
 
     return ColumnScan{
-            expression.get(),
-            basic_readers,
-            clp_string_readers,
-            var_string_readers,
-            timestamp_readers,
-            deprecated_datestring_reader,
-            clp_queries,
-            var_matches,
+            {expression.get()},
+            EvaluationContext{
+                    basic_readers,
+                    clp_string_readers,
+                    var_string_readers,
+                    timestamp_readers,
+                    deprecated_datestring_reader,
+                    clp_queries,
+                    var_matches
+            },
             num_messages
     };
 }
 
-auto ColumnScan::filter(uint64_t cur_message) -> bool {
-    return 0 != m_matches[cur_message];
-}
-
-ColumnScan::ColumnScan(
-        ast::Expression* expression,
+auto ColumnScan::try_create_prefilter(
+        std::shared_ptr<ast::Expression> const& expression,
         BasicReaderMap const& basic_readers,
         ClpStringReaderMap const& clp_string_readers,
         VarStringReaderMap const& var_string_readers,
@@ -364,18 +423,53 @@ ColumnScan::ColumnScan(
         ClpQueryMap const& clp_queries,
         VarMatchMap const& var_matches,
         uint64_t num_messages
+) -> std::optional<ColumnScan> {
+    auto* and_expr = dynamic_cast<AndExpr*>(expression.get());
+    if (nullptr == and_expr || and_expr->is_inverted()) {
+        return std::nullopt;
+    }
+
+    std::vector<ast::Expression*> conjuncts;
+    for (auto const& operand : and_expr->get_op_list()) {
+        auto* child = dynamic_cast<ast::Expression*>(operand.get());
+        if (can_build_node(child, clp_queries, var_matches)) {
+            conjuncts.push_back(child);
+        }
+    }
+    if (conjuncts.empty()) {
+        return std::nullopt;
+    }
+
+    return ColumnScan{
+            conjuncts,
+            EvaluationContext{
+                    basic_readers,
+                    clp_string_readers,
+                    var_string_readers,
+                    timestamp_readers,
+                    deprecated_datestring_reader,
+                    clp_queries,
+                    var_matches
+            },
+            num_messages
+    };
+}
+
+auto ColumnScan::filter(uint64_t cur_message) -> bool {
+    return m_matches.test(cur_message);
+}
+
+auto ColumnScan::find_next_candidate(uint64_t cur_message) -> uint64_t {
+    return m_matches.find_next(cur_message);
+}
+
+ColumnScan::ColumnScan(
+        std::vector<ast::Expression*> const& conjuncts,
+        EvaluationContext const& context,
+        uint64_t num_messages
 )
         : m_num_messages{num_messages},
-          m_matches{build_node(
-                  expression,
-                  basic_readers,
-                  clp_string_readers,
-                  var_string_readers,
-                  timestamp_readers,
-                  deprecated_datestring_reader,
-                  clp_queries,
-                  var_matches
-          )} {}
+          m_matches{build_operands(conjuncts, true, Bitmap(num_messages, true), context)} {}
 
 auto ColumnScan::can_build_node(
         ast::Expression* expr,
@@ -458,80 +552,119 @@ auto ColumnScan::can_build_filter(
     return false;
 }
 
-// can_build_node validates the AST iteratively before this recursive bitmap construction runs.
+// can_build_node validates the AST iteratively before the recursive methods below run.
 // NOLINTBEGIN(misc-no-recursion)
-auto ColumnScan::build_node(
-        ast::Expression* expr,
-        BasicReaderMap const& basic_readers,
-        ClpStringReaderMap const& clp_string_readers,
-        VarStringReaderMap const& var_string_readers,
-        TimestampReaderMap const& timestamp_readers,
-        DeprecatedDateStringColumnReader* deprecated_datestring_reader,
-        ClpQueryMap const& clp_queries,
-        VarMatchMap const& var_matches
-) const -> Bitmap {
-    Bitmap result;
-    if (auto* and_expr = dynamic_cast<AndExpr*>(expr); nullptr != and_expr) {
-        result = Bitmap(m_num_messages, 1);
-        for (auto const& operand : and_expr->get_op_list()) {
-            auto* child_expr = dynamic_cast<ast::Expression*>(operand.get());
-            auto child = build_node(
-                    child_expr,
-                    basic_readers,
-                    clp_string_readers,
-                    var_string_readers,
-                    timestamp_readers,
-                    deprecated_datestring_reader,
-                    clp_queries,
-                    var_matches
+auto ColumnScan::get_evaluation_cost(ast::Expression* expr) -> uint8_t {
+    // Costs are ordered by how much work each filter does per message: existence checks are free,
+    // primitive comparisons use vectorized kernels, timestamps and variable strings decode one
+    // value, and clp strings may need to be decompressed for wildcard matching.
+    constexpr uint8_t cExistenceCost{0};
+    constexpr uint8_t cPrimitiveCost{1};
+    constexpr uint8_t cTimestampCost{2};
+    constexpr uint8_t cVarStringCost{3};
+    constexpr uint8_t cClpStringCost{4};
+
+    auto* filter = dynamic_cast<FilterExpr*>(expr);
+    if (nullptr == filter) {
+        uint8_t max_cost{cExistenceCost};
+        for (auto const& operand : expr->get_op_list()) {
+            max_cost = std::max(
+                    max_cost,
+                    get_evaluation_cost(dynamic_cast<ast::Expression*>(operand.get()))
             );
-            uint8_t any_set{0};
-            for (size_t i{0}; i < result.size(); ++i) {
-                result[i] &= child[i];
-                any_set |= result[i];
-            }
-            if (0 == any_set) {
-                break;
-            }
         }
-    } else if (auto* or_expr = dynamic_cast<OrExpr*>(expr); nullptr != or_expr) {
-        result = Bitmap(m_num_messages, 0);
-        for (auto const& operand : or_expr->get_op_list()) {
-            auto* child_expr = dynamic_cast<ast::Expression*>(operand.get());
-            auto child = build_node(
-                    child_expr,
-                    basic_readers,
-                    clp_string_readers,
-                    var_string_readers,
-                    timestamp_readers,
-                    deprecated_datestring_reader,
-                    clp_queries,
-                    var_matches
-            );
-            uint8_t all_set{1};
-            for (size_t i{0}; i < result.size(); ++i) {
-                result[i] |= child[i];
-                all_set &= result[i];
+        return max_cost;
+    }
+
+    auto const operation = filter->get_operation();
+    if (FilterOperation::EXISTS == operation || FilterOperation::NEXISTS == operation) {
+        return cExistenceCost;
+    }
+    switch (filter->get_column()->get_literal_type()) {
+        case LiteralType::IntegerT:
+        case LiteralType::FloatT:
+        case LiteralType::BooleanT:
+            return cPrimitiveCost;
+        case LiteralType::TimestampT:
+            return cTimestampCost;
+        case LiteralType::VarStringT:
+            return cVarStringCost;
+        case LiteralType::ClpStringT:
+        case LiteralType::NullT:
+        case LiteralType::ArrayT:
+        case LiteralType::UnknownT:
+        case LiteralType::TypesEnd:
+            return cClpStringCost;
+    }
+    return cClpStringCost;
+}
+
+auto ColumnScan::build_operands(
+        std::vector<ast::Expression*> operands,
+        bool is_conjunction,
+        Bitmap const& selection,
+        EvaluationContext const& context
+) const -> Bitmap {
+    std::stable_sort(
+            operands.begin(),
+            operands.end(),
+            [](ast::Expression* lhs, ast::Expression* rhs) -> bool {
+                return get_evaluation_cost(lhs) < get_evaluation_cost(rhs);
             }
-            if (0 != all_set) {
+    );
+
+    if (is_conjunction) {
+        // Each operand only needs to be evaluated over the messages that matched every previous
+        // operand.
+        Bitmap result{selection};
+        for (auto* operand : operands) {
+            auto const operand_matches = build_node(operand, result, context);
+            if (false == result.and_with(operand_matches)) {
                 break;
             }
         }
-    } else if (auto* filter = dynamic_cast<FilterExpr*>(expr); nullptr != filter) {
-        result = build_filter(
-                filter,
-                basic_readers,
-                clp_string_readers,
-                var_string_readers,
-                timestamp_readers,
-                deprecated_datestring_reader,
-                clp_queries,
-                var_matches
+        return result;
+    }
+
+    // Each operand only needs to be evaluated over the messages that no previous operand matched.
+    Bitmap result(m_num_messages, false);
+    Bitmap unmatched{selection};
+    for (auto* operand : operands) {
+        auto const operand_matches = build_node(operand, unmatched, context);
+        result.or_with(operand_matches);
+        if (false == unmatched.and_not_with(operand_matches)) {
+            break;
+        }
+    }
+    return result;
+}
+
+auto ColumnScan::build_node(
+        ast::Expression* expr,
+        Bitmap const& selection,
+        EvaluationContext const& context
+) const -> Bitmap {
+    Bitmap result;
+    if (auto* filter = dynamic_cast<FilterExpr*>(expr); nullptr != filter) {
+        result = build_filter(filter, selection, context);
+    } else {
+        std::vector<ast::Expression*> operands;
+        for (auto const& operand : expr->get_op_list()) {
+            operands.push_back(dynamic_cast<ast::Expression*>(operand.get()));
+        }
+        result = build_operands(
+                std::move(operands),
+                nullptr != dynamic_cast<AndExpr*>(expr),
+                selection,
+                context
         );
     }
 
     if (expr->is_inverted()) {
-        invert(result);
+        // Only the selected messages are evaluated, so the inverse is relative to the selection.
+        Bitmap inverted{selection};
+        inverted.and_not_with(result);
+        return inverted;
     }
     return result;
 }
@@ -540,20 +673,14 @@ auto ColumnScan::build_node(
 
 auto ColumnScan::build_filter(
         FilterExpr* filter,
-        BasicReaderMap const& basic_readers,
-        ClpStringReaderMap const& clp_string_readers,
-        VarStringReaderMap const& var_string_readers,
-        TimestampReaderMap const& timestamp_readers,
-        DeprecatedDateStringColumnReader* deprecated_datestring_reader,
-        ClpQueryMap const& clp_queries,
-        VarMatchMap const& var_matches
+        Bitmap const& selection,
+        EvaluationContext const& context
 ) const -> Bitmap {
-    Bitmap bitmap(m_num_messages, 0);
+    Bitmap bitmap(m_num_messages, false);
     auto const column = filter->get_column();
     auto const operation = filter->get_operation();
     if (FilterOperation::EXISTS == operation || FilterOperation::NEXISTS == operation) {
-        std::fill(bitmap.begin(), bitmap.end(), 1);
-        return bitmap;
+        return selection;
     }
 
     auto const column_id = column->get_column_id();
@@ -566,8 +693,8 @@ auto ColumnScan::build_filter(
                 return bitmap;
             }
             return build_basic_filter(
-                    m_num_messages,
-                    basic_readers,
+                    selection,
+                    context.basic_readers,
                     column_id,
                     operation,
                     operand_value
@@ -579,8 +706,8 @@ auto ColumnScan::build_filter(
                 return bitmap;
             }
             return build_basic_filter(
-                    m_num_messages,
-                    basic_readers,
+                    selection,
+                    context.basic_readers,
                     column_id,
                     operation,
                     operand_value
@@ -592,28 +719,28 @@ auto ColumnScan::build_filter(
                 return bitmap;
             }
             return build_basic_filter(
-                    m_num_messages,
-                    basic_readers,
+                    selection,
+                    context.basic_readers,
                     column_id,
                     operation,
                     static_cast<uint8_t>(operand_value)
             );
         }
         case LiteralType::ClpStringT: {
-            auto* const query = clp_queries.at(filter);
+            auto* const query = context.clp_queries.at(filter);
             return build_clp_string_filter(
-                    m_num_messages,
-                    clp_string_readers,
+                    selection,
+                    context.clp_string_readers,
                     column_id,
                     operation,
                     query
             );
         }
         case LiteralType::VarStringT: {
-            auto const* matching_vars = var_matches.at(filter);
+            auto const* matching_vars = context.var_matches.at(filter);
             return build_var_string_filter(
-                    m_num_messages,
-                    var_string_readers,
+                    selection,
+                    context.var_string_readers,
                     column_id,
                     operation,
                     *matching_vars
@@ -624,19 +751,19 @@ auto ColumnScan::build_filter(
             if (false == operand->as_int(operand_value, operation)) {
                 return bitmap;
             }
-            if (nullptr != deprecated_datestring_reader
-                && column_id == deprecated_datestring_reader->get_id())
+            if (nullptr != context.deprecated_datestring_reader
+                && column_id == context.deprecated_datestring_reader->get_id())
             {
                 return build_deprecated_datestring_filter(
-                        m_num_messages,
-                        *deprecated_datestring_reader,
+                        selection,
+                        *context.deprecated_datestring_reader,
                         operation,
                         operand_value
                 );
             }
             return build_timestamp_filter(
-                    m_num_messages,
-                    timestamp_readers,
+                    selection,
+                    context.timestamp_readers,
                     column_id,
                     operation,
                     operand_value
@@ -13,11 +13,12 @@
 #include <clp_s/SchemaReader.hpp>
 #include <clp_s/search/ast/Expression.hpp>
 #include <clp_s/search/ast/FilterExpr.hpp>
+#include <clp_s/search/PackedBitmap.hpp>
 
 namespace clp_s::search {
 class ColumnScan : public FilterClass {
 public:
-    using Bitmap = std::vector<uint8_t>;
+    using Bitmap = PackedBitmap;
     using BasicReaderMap = std::unordered_map<int32_t, std::vector<BaseColumnReader*>>;
     using ClpStringReaderMap = std::unordered_map<int32_t, std::vector<ClpStringColumnReader*>>;
     using VarStringReaderMap
@@ -53,6 +54,38 @@ public:
             uint64_t num_messages
     ) -> std::optional<ColumnScan>;
 
+    /**
+     * Attempts to build a column scan over the operands of a top-level AND expression that
+     * ColumnScan supports, for an expression that ColumnScan can't evaluate in full.
+     *
+     * Every message matching `expression` is set in the resulting bitmap, but not every set message
+     * necessarily matches, so the scan can only be used to skip messages before evaluating
+     * `expression` on the remaining candidates.
+     *
+     * @param expression
+     * @param basic_readers
+     * @param clp_string_readers
+     * @param var_string_readers
+     * @param timestamp_readers
+     * @param deprecated_datestring_reader
+     * @param clp_queries
+     * @param var_matches
+     * @param num_messages
+     * @return A ColumnScan with a precomputed bitmap of candidate messages on success, or
+     * std::nullopt if `expression` isn't an AND expression with at least one supported operand.
+     */
+    [[nodiscard]] static auto try_create_prefilter(
+            std::shared_ptr<ast::Expression> const& expression,
+            BasicReaderMap const& basic_readers,
+            ClpStringReaderMap const& clp_string_readers,
+            VarStringReaderMap const& var_string_readers,
+            TimestampReaderMap const& timestamp_readers,
+            DeprecatedDateStringColumnReader* deprecated_datestring_reader,
+            ClpQueryMap const& clp_queries,
+            VarMatchMap const& var_matches,
+            uint64_t num_messages
+    ) -> std::optional<ColumnScan>;
+
     // Default move constructor
     ColumnScan(ColumnScan&&) = default;
 
@@ -70,16 +103,30 @@ public:
 
     [[nodiscard]] auto filter(uint64_t cur_message) -> bool override;
 
+    [[nodiscard]] auto find_next_candidate(uint64_t cur_message) -> uint64_t override;
+
 private:
+    /**
+     * The column readers and precomputed string searches that filters are evaluated against.
+     */
+    struct EvaluationContext {
+        BasicReaderMap const& basic_readers;
+        ClpStringReaderMap const& clp_string_readers;
+        VarStringReaderMap const& var_string_readers;
+        TimestampReaderMap const& timestamp_readers;
+        DeprecatedDateStringColumnReader* deprecated_datestring_reader;
+        ClpQueryMap const& clp_queries;
+        VarMatchMap const& var_matches;
+    };
+
+    /**
+     * @param conjuncts Expressions whose conjunction the scan evaluates.
+     * @param context
+     * @param num_messages
+     */
     ColumnScan(
-            ast::Expression* expression,
-            BasicReaderMap const& basic_readers,
-            ClpStringReaderMap const& clp_string_readers,
-            VarStringReaderMap const& var_string_readers,
-            TimestampReaderMap const& timestamp_readers,
-            DeprecatedDateStringColumnReader* deprecated_datestring_reader,
-            ClpQueryMap const& clp_queries,
-            VarMatchMap const& var_matches,
+            std::vector<ast::Expression*> const& conjuncts,
+            EvaluationContext const& context,
             uint64_t num_messages
     );
 
@@ -118,51 +165,58 @@ private:
     ) -> bool;
 
     /**
-     * Builds a bitmap for an expression tree using the supplied reader/query maps.
+     * Estimates the relative cost of evaluating an expression per message, so that cheap operands
+     * of AND and OR expressions can be evaluated first and shrink the set of messages that more
+     * expensive operands need to decode.
+     * @pre can_build_node has returned true for expr.
      * @param expr
-     * @param basic_readers
-     * @param clp_string_readers
-     * @param var_string_readers
-     * @param timestamp_readers
-     * @param deprecated_datestring_reader
-     * @param clp_queries
-     * @param var_matches
-     * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+     * @return The estimated cost, where larger values are more expensive.
+     */
+    [[nodiscard]] static auto get_evaluation_cost(ast::Expression* expr) -> uint8_t;
+
+    /**
+     * Builds a bitmap for the conjunction or disjunction of the given operands, evaluating cheaper
+     * operands first and only evaluating each operand over the messages whose result it can still
+     * change.
+     * @param operands
+     * @param is_conjunction Whether to build the conjunction rather than the disjunction.
+     * @param selection The messages to evaluate.
+     * @param context
+     * @return A bitmap with set bits for the selected messages that match.
+     */
+    [[nodiscard]] auto build_operands(
+            std::vector<ast::Expression*> operands,
+            bool is_conjunction,
+            Bitmap const& selection,
+            EvaluationContext const& context
+    ) const -> Bitmap;
+
+    /**
+     * Builds a bitmap for an expression tree over the selected messages.
+     * @param expr
+     * @param selection The messages to evaluate.
+     * @param context
+     * @return A bitmap with set bits for the selected messages that match.
      */
     [[nodiscard]] auto build_node(
             ast::Expression* expr,
-            BasicReaderMap const& basic_readers,
-            ClpStringReaderMap const& clp_string_readers,
-            VarStringReaderMap const& var_string_readers,
-            TimestampReaderMap const& timestamp_readers,
-            DeprecatedDateStringColumnReader* deprecated_datestring_reader,
-            ClpQueryMap const& clp_queries,
-            VarMatchMap const& var_matches
+            Bitmap const& selection,
+            EvaluationContext const& context
     ) const -> Bitmap;
 
     /**
-     * Builds a bitmap for a single filter using the supplied reader/query maps.
+     * Builds a bitmap for a single filter over the selected messages.
      * @pre can_build_filter has returned true for filter with the same query and variable-match
      * maps.
      * @param filter
-     * @param basic_readers
-     * @param clp_string_readers
-     * @param var_string_readers
-     * @param timestamp_readers
-     * @param deprecated_datestring_reader
-     * @param clp_queries
-     * @param var_matches
-     * @return A bitmap indexed by message number, with nonzero entries for matching messages.
+     * @param selection The messages to evaluate.
+     * @param context
+     * @return A bitmap with set bits for the selected messages that match.
      */
     [[nodiscard]] auto build_filter(
             ast::FilterExpr* filter,
-            BasicReaderMap const& basic_readers,
-            ClpStringReaderMap const& clp_string_readers,
-            VarStringReaderMap const& var_string_readers,
-            TimestampReaderMap const& timestamp_readers,
-            DeprecatedDateStringColumnReader* deprecated_datestring_reader,
-            ClpQueryMap const& clp_queries,
-            VarMatchMap const& var_matches
+            Bitmap const& selection,
+            EvaluationContext const& context
     ) const -> Bitmap;
 
     uint64_t m_num_messages{};
@@ -0,0 +1,84 @@
+#include "EvaluateVarDictFilter.hpp"
+
+#include <memory>
+#include <string>
+
+#include "ast/AndExpr.hpp"
+#include "ast/Expression.hpp"
+#include "ast/FilterExpr.hpp"
+#include "ast/FilterOperation.hpp"
+#include "ast/Literal.hpp"
+#include "ast/OrExpr.hpp"
+
+using clp_s::search::ast::AndExpr;
+using clp_s::search::ast::Expression;
+using clp_s::search::ast::FilterExpr;
+using clp_s::search::ast::FilterOperation;
+using clp_s::search::ast::LiteralType;
+using clp_s::search::ast::OrExpr;
+
+namespace clp_s::search {
+EvaluatedValue EvaluateVarDictFilter::run(std::shared_ptr<Expression> const& expr) {
+    if (std::dynamic_pointer_cast<OrExpr>(expr)) {
+        bool any_unknown = false;
+        for (auto it = expr->op_begin(); it != expr->op_end(); it++) {
+            auto sub_expr = std::static_pointer_cast<Expression>(*it);
+            EvaluatedValue ret = run(sub_expr);
+            if (ret == EvaluatedValue::True) {
+                return expr->is_inverted() ? EvaluatedValue::False : EvaluatedValue::True;
+            } else if (ret == EvaluatedValue::Unknown) {
+                any_unknown = true;
+            }
+        }
+
+        if (any_unknown) {
+            return EvaluatedValue::Unknown;
+        }
+        // must have been all false
+        return expr->is_inverted() ? EvaluatedValue::True : EvaluatedValue::False;
+    } else if (std::dynamic_pointer_cast<AndExpr>(expr)) {
+        bool any_unknown = false;
+        for (auto it = expr->op_begin(); it != expr->op_end(); it++) {
+            auto sub_expr = std::static_pointer_cast<Expression>(*it);
+            EvaluatedValue ret = run(sub_expr);
+            if (ret == EvaluatedValue::False) {
+                return expr->is_inverted() ? EvaluatedValue::True : EvaluatedValue::False;
+            } else if (ret == EvaluatedValue::Unknown) {
+                any_unknown = true;
+            }
+        }
+
+        if (any_unknown) {
+            return EvaluatedValue::Unknown;
+        }
+        // must have been all true
+        return expr->is_inverted() ? EvaluatedValue::False : EvaluatedValue::True;
+    } else if (auto filter = std::dynamic_pointer_cast<FilterExpr>(expr)) {
+        // A negated or non-equality filter can match values other than the operand, so the filter
+        // can't rule it out.
+        auto const op{filter->get_operation()};
+        if (filter->is_inverted() || FilterOperation::EQ != op) {
+            return EvaluatedValue::Unknown;
+        }
+
+        // Values in columns of other types (e.g., ClpStringT) aren't stored whole in the variable
+        // dictionary.
+        if (false == filter->get_column()->matches_exactly(LiteralType::VarStringT)) {
+            return EvaluatedValue::Unknown;
+        }
+
+        auto const literal{filter->get_operand()};
+        std::string query_string;
+        if (nullptr == literal || false == literal->as_var_string(query_string, op)) {
+            return EvaluatedValue::Unknown;
+        }
+
+        if (false == m_filter.possibly_contains_query_string(query_string)) {
+            return EvaluatedValue::False;
+        }
+        return EvaluatedValue::Unknown;
+    } else {
+        return EvaluatedValue::Unknown;
+    }
+}
+}  // namespace clp_s::search
@@ -0,0 +1,33 @@
+#ifndef CLP_S_SEARCH_EVALUATEVARDICTFILTER_HPP
+#define CLP_S_SEARCH_EVALUATEVARDICTFILTER_HPP
+
+#include <memory>
+
+#include "../filter/FilterReader.hpp"
+#include "../Utils.hpp"
+#include "ast/Expression.hpp"
+
+namespace clp_s::search {
+class EvaluateVarDictFilter {
+public:
+    // Constructors
+    explicit EvaluateVarDictFilter(filter::FilterReader const& filter) : m_filter(filter) {}
+
+    /**
+     * Takes an expression and attempts to prove that it's false based on a filter over every value
+     * in an archive's variable dictionary. Only equality filters on columns that exclusively hold
+     * variable strings can be evaluated, since such values are stored whole in the dictionary.
+     *
+     * Should only be run after column resolution.
+     *
+     * @param expr the expression to evaluate against the filter
+     * @return The evaluated value of the expression given the filter (True, False, Unknown)
+     */
+    EvaluatedValue run(std::shared_ptr<ast::Expression> const& expr);
+
+private:
+    filter::FilterReader const& m_filter;
+};
+}  // namespace clp_s::search
+
+#endif  // CLP_S_SEARCH_EVALUATEVARDICTFILTER_HPP
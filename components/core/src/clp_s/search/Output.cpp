@@ -1,10 +1,12 @@
 #include "Output.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
 #include <spdlog/spdlog.h>
 
+#include "../../clp/RuntimeMetrics.hpp"
 #include "../../clp/type_utils.hpp"
 #include "../SchemaTree.hpp"
 #include "../Utils.hpp"
@@ -16,6 +18,7 @@
 #include "ast/Literal.hpp"
 #include "ast/OrExpr.hpp"
 #include "EvaluateTimestampIndex.hpp"
+#include "EvaluateVarDictFilter.hpp"
 
 using clp_s::search::ast::AndExpr;
 using clp_s::search::ast::ColumnDescriptor;
@@ -33,6 +36,7 @@ using clp_s::search::ast::OrExpr;
 
 namespace clp_s::search {
 bool Output::filter() {
+    clp::RuntimeMetrics::ScopedTimer const filter_timer{clp::RuntimeMetrics::Stage::Filter};
     std::vector<int32_t> matched_schemas;
     bool has_array = false;
     bool has_array_search = false;
@@ -81,6 +85,19 @@ bool Output::filter() {
         return true;
     }
 
+    // Zone maps are stored before the variable dictionary filter, so they must be read first.
+    m_archive_reader->read_zone_maps();
+
+    // Skip reading the dictionaries if the archive's variable dictionary filter proves that some
+    // required value is absent.
+    if (auto const var_dict_filter{m_archive_reader->read_variable_dictionary_filter()};
+        var_dict_filter.has_value()
+        && EvaluatedValue::False == EvaluateVarDictFilter{var_dict_filter.value()}.run(m_expr))
+    {
+        m_termination_stage = cTerminationStageDictionaryFilter;
+        return true;
+    }
+
     m_archive_reader->read_variable_dictionary();
     m_archive_reader->read_log_type_dictionary();
 
@@ -93,12 +110,22 @@ bool Output::filter() {
     }
 
     m_query_runner.global_init();
+
+    // Drop tables that constant propagation (including the tables' zone maps) proves can't match,
+    // so that they're never prefetched or decompressed. The remaining tables' contexts are kept, so
+    // `schema_init` below doesn't initialize them again.
+    m_query_runner.prune_schemas(matched_schemas);
+
     m_archive_reader->open_packed_streams();
+    m_archive_reader->prefetch_schema_tables(matched_schemas);
 
     std::string message;
     auto const archive_id = m_archive_reader->get_archive_id();
     bool scanned_any_ert{false};
     for (int32_t schema_id : matched_schemas) {
+        if (m_output_handler->is_done()) {
+            break;
+        }
         if (EvaluatedValue::False == m_query_runner.schema_init(schema_id)) {
             continue;
         }
@@ -115,14 +142,22 @@ bool Output::filter() {
         if (m_output_handler->should_output_metadata()) {
             epochtime_t timestamp{};
             int64_t log_event_idx{};
-            while (reader.get_next_message_with_metadata(message, timestamp, log_event_idx, filter))
+            while (false == m_output_handler->is_done()
+                   && reader.get_next_message_with_metadata(
+                           message,
+                           timestamp,
+                           log_event_idx,
+                           filter
+                   ))
             {
                 schema_has_match = true;
                 ++m_result_metrics.num_archive_records_matching_query;
                 m_output_handler->write(message, timestamp, archive_id, log_event_idx);
             }
         } else {
-            while (reader.get_next_message(message, filter)) {
+            while (false == m_output_handler->is_done()
+                   && reader.get_next_message(message, filter))
+            {
                 schema_has_match = true;
                 ++m_result_metrics.num_archive_records_matching_query;
                 m_output_handler->write(message);
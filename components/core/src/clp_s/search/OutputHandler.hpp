@@ -54,6 +54,12 @@ public:
      */
     [[nodiscard]] virtual auto finish() -> ErrorCode { return ErrorCode::ErrorCodeSuccess; }
 
+    /**
+     * @return Whether the output handler won't accept any more results, in which case the search
+     * can terminate early.
+     */
+    [[nodiscard]] virtual auto is_done() const -> bool { return false; }
+
     [[nodiscard]] auto should_output_metadata() const -> bool { return m_should_output_metadata; }
 
     [[nodiscard]] auto should_marshal_records() const -> bool { return m_should_marshal_records; }
@@ -0,0 +1,500 @@
+#include "PackedBitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <clp_s/search/ast/FilterOperation.hpp>
+#include <clp_s/Utils.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define CLP_S_SEARCH_PACKED_BITMAP_X86_KERNELS 1
+    #include <immintrin.h>
+#endif
+
+using clp_s::search::ast::FilterOperation;
+
+namespace clp_s::search {
+namespace {
+using Word = PackedBitmap::Word;
+constexpr size_t cBitsPerWord{PackedBitmap::cBitsPerWord};
+constexpr Word cAllBitsSet{~Word{0}};
+
+/**
+ * @param size
+ * @return The number of words needed to hold `size` bits.
+ */
+[[nodiscard]] constexpr auto get_num_words(size_t size) -> size_t {
+    return (size + cBitsPerWord - 1) / cBitsPerWord;
+}
+
+/**
+ * Invokes `callback` with the given filter operation as a compile-time constant.
+ * @param operation
+ * @param callback
+ */
+template <typename Callback>
+auto dispatch_operation(FilterOperation operation, Callback callback) -> void {
+    switch (operation) {
+        case FilterOperation::EQ:
+            callback(std::integral_constant<FilterOperation, FilterOperation::EQ>{});
+            break;
+        case FilterOperation::NEQ:
+            callback(std::integral_constant<FilterOperation, FilterOperation::NEQ>{});
+            break;
+        case FilterOperation::LT:
+            callback(std::integral_constant<FilterOperation, FilterOperation::LT>{});
+            break;
+        case FilterOperation::GT:
+            callback(std::integral_constant<FilterOperation, FilterOperation::GT>{});
+            break;
+        case FilterOperation::LTE:
+            callback(std::integral_constant<FilterOperation, FilterOperation::LTE>{});
+            break;
+        case FilterOperation::GTE:
+            callback(std::integral_constant<FilterOperation, FilterOperation::GTE>{});
+            break;
+        case FilterOperation::EXISTS:
+            callback(std::integral_constant<FilterOperation, FilterOperation::EXISTS>{});
+            break;
+        case FilterOperation::NEXISTS:
+            callback(std::integral_constant<FilterOperation, FilterOperation::NEXISTS>{});
+            break;
+    }
+}
+
+/**
+ * Compares a value against an operand using a compile-time filter operation.
+ * @param value
+ * @param operand
+ * @return The result of the comparison.
+ */
+template <FilterOperation cOperation, typename T>
+[[nodiscard]] auto compare(T value, T operand) -> bool {
+    if constexpr (FilterOperation::EQ == cOperation) {
+        return value == operand;
+    } else if constexpr (FilterOperation::NEQ == cOperation) {
+        return value != operand;
+    } else if constexpr (FilterOperation::LT == cOperation) {
+        return value < operand;
+    } else if constexpr (FilterOperation::GT == cOperation) {
+        return value > operand;
+    } else if constexpr (FilterOperation::LTE == cOperation) {
+        return value <= operand;
+    } else if constexpr (FilterOperation::GTE == cOperation) {
+        return value >= operand;
+    } else {
+        return true;
+    }
+}
+
+/**
+ * Portable kernel that evaluates the comparison for values [`begin`, `values.size()`), where
+ * `begin` must be a multiple of `cBitsPerWord`.
+ * @param words
+ * @param values
+ * @param begin
+ * @param operand
+ */
+template <FilterOperation cOperation, typename T>
+auto or_compare_scalar(Word* words, UnalignedMemSpan<T> values, size_t begin, T operand) -> void {
+    auto const num_values{values.size()};
+    for (auto word_begin{begin}; word_begin < num_values; word_begin += cBitsPerWord) {
+        auto const word_end{std::min(num_values, word_begin + cBitsPerWord)};
+        Word word{0};
+        for (auto i{word_begin}; i < word_end; ++i) {
+            word |= static_cast<Word>(compare<cOperation>(values[i], operand)) << (i - word_begin);
+        }
+        words[word_begin / cBitsPerWord] |= word;
+    }
+}
+
+#ifdef CLP_S_SEARCH_PACKED_BITMAP_X86_KERNELS
+/*
+ * Each SIMD kernel below evaluates the comparison for the first `num_words * cBitsPerWord` values
+ * and leaves the tail to the scalar kernel. `_mm*_loadu_*` are used since column data is not
+ * guaranteed to be aligned (see `UnalignedMemSpan`).
+ */
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+template <FilterOperation cOperation>
+__attribute__((target("avx2"))) auto
+or_compare_int64_avx2(Word* words, char const* values, size_t num_words, int64_t operand)
+        -> void {
+    constexpr size_t cLanes{4};
+    constexpr bool cNegate{
+            FilterOperation::NEQ == cOperation || FilterOperation::LTE == cOperation
+            || FilterOperation::GTE == cOperation
+    };
+    auto const operands{_mm256_set1_epi64x(operand)};
+    auto const* cur{values};
+    for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+        Word word{0};
+        for (size_t bit{0}; bit < cBitsPerWord; bit += cLanes, cur += cLanes * sizeof(int64_t)) {
+            auto const lanes{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(cur))};
+            __m256i matches{};
+            if constexpr (FilterOperation::EQ == cOperation || FilterOperation::NEQ == cOperation)
+            {
+                matches = _mm256_cmpeq_epi64(lanes, operands);
+            } else if constexpr (FilterOperation::GT == cOperation
+                                 || FilterOperation::LTE == cOperation)
+            {
+                matches = _mm256_cmpgt_epi64(lanes, operands);
+            } else {
+                matches = _mm256_cmpgt_epi64(operands, lanes);
+            }
+            auto mask{static_cast<Word>(_mm256_movemask_pd(_mm256_castsi256_pd(matches)))};
+            if constexpr (cNegate) {
+                mask ^= 0xFULL;
+            }
+            word |= mask << bit;
+        }
+        words[word_idx] |= word;
+    }
+}
+
+/**
+ * @return The `_mm256_cmp_pd`/`_mm512_cmp_pd_mask` predicate matching the semantics of the scalar
+ * C++ comparison for `cOperation`.
+ */
+template <FilterOperation cOperation>
+consteval auto get_double_predicate() -> int {
+    if constexpr (FilterOperation::EQ == cOperation) {
+        return _CMP_EQ_OQ;
+    } else if constexpr (FilterOperation::NEQ == cOperation) {
+        return _CMP_NEQ_UQ;
+    } else if constexpr (FilterOperation::LT == cOperation) {
+        return _CMP_LT_OQ;
+    } else if constexpr (FilterOperation::GT == cOperation) {
+        return _CMP_GT_OQ;
+    } else if constexpr (FilterOperation::LTE == cOperation) {
+        return _CMP_LE_OQ;
+    } else {
+        return _CMP_GE_OQ;
+    }
+}
+
+template <FilterOperation cOperation>
+__attribute__((target("avx2"))) auto
+or_compare_double_avx2(Word* words, char const* values, size_t num_words, double operand)
+        -> void {
+    constexpr size_t cLanes{4};
+    auto const operands{_mm256_set1_pd(operand)};
+    auto const* cur{values};
+    for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+        Word word{0};
+        for (size_t bit{0}; bit < cBitsPerWord; bit += cLanes, cur += cLanes * sizeof(double)) {
+            auto const lanes{_mm256_loadu_pd(reinterpret_cast<double const*>(cur))};
+            auto const matches{
+                    _mm256_cmp_pd(lanes, operands, get_double_predicate<cOperation>())
+            };
+            word |= static_cast<Word>(_mm256_movemask_pd(matches)) << bit;
+        }
+        words[word_idx] |= word;
+    }
+}
+
+template <FilterOperation cOperation>
+__attribute__((target("avx2"))) auto
+or_compare_uint8_avx2(Word* words, char const* values, size_t num_words, uint8_t operand)
+        -> void {
+    static_assert(FilterOperation::EQ == cOperation || FilterOperation::NEQ == cOperation);
+    constexpr size_t cLanes{32};
+    auto const operands{_mm256_set1_epi8(static_cast<char>(operand))};
+    auto const* cur{values};
+    for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+        Word word{0};
+        for (size_t bit{0}; bit < cBitsPerWord; bit += cLanes, cur += cLanes) {
+            auto const lanes{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(cur))};
+            auto mask{static_cast<Word>(
+                    static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lanes, operands)))
+            )};
+            if constexpr (FilterOperation::NEQ == cOperation) {
+                mask ^= 0xFFFF'FFFFULL;
+            }
+            word |= mask << bit;
+        }
+        words[word_idx] |= word;
+    }
+}
+
+/**
+ * @return The `_mm512_cmp_epi64_mask` predicate for `cOperation`.
+ */
+template <FilterOperation cOperation>
+consteval auto get_int64_predicate() -> int {
+    if constexpr (FilterOperation::EQ == cOperation) {
+        return _MM_CMPINT_EQ;
+    } else if constexpr (FilterOperation::NEQ == cOperation) {
+        return _MM_CMPINT_NE;
+    } else if constexpr (FilterOperation::LT == cOperation) {
+        return _MM_CMPINT_LT;
+    } else if constexpr (FilterOperation::GT == cOperation) {
+        return _MM_CMPINT_NLE;
+    } else if constexpr (FilterOperation::LTE == cOperation) {
+        return _MM_CMPINT_LE;
+    } else {
+        return _MM_CMPINT_NLT;
+    }
+}
+
+template <FilterOperation cOperation>
+__attribute__((target("avx512f"))) auto
+or_compare_int64_avx512(Word* words, char const* values, size_t num_words, int64_t operand)
+        -> void {
+    constexpr size_t cLanes{8};
+    auto const operands{_mm512_set1_epi64(operand)};
+    auto const* cur{values};
+    for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+        Word word{0};
+        for (size_t bit{0}; bit < cBitsPerWord; bit += cLanes, cur += cLanes * sizeof(int64_t)) {
+            auto const lanes{_mm512_loadu_si512(cur)};
+            auto const mask{
+                    _mm512_cmp_epi64_mask(lanes, operands, get_int64_predicate<cOperation>())
+            };
+            word |= static_cast<Word>(mask) << bit;
+        }
+        words[word_idx] |= word;
+    }
+}
+
+template <FilterOperation cOperation>
+__attribute__((target("avx512f"))) auto
+or_compare_double_avx512(Word* words, char const* values, size_t num_words, double operand)
+        -> void {
+    constexpr size_t cLanes{8};
+    auto const operands{_mm512_set1_pd(operand)};
+    auto const* cur{values};
+    for (size_t word_idx{0}; word_idx < num_words; ++word_idx) {
+        Word word{0};
+        for (size_t bit{0}; bit < cBitsPerWord; bit += cLanes, cur += cLanes * sizeof(double)) {
+            auto const lanes{_mm512_loadu_pd(cur)};
+            auto const mask{
+                    _mm512_cmp_pd_mask(lanes, operands, get_double_predicate<cOperation>())
+            };
+            word |= static_cast<Word>(mask) << bit;
+        }
+        words[word_idx] |= word;
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#endif
+
+/**
+ * Evaluates a comparison over `values` using the widest kernel available at `simd_level`, falling
+ * back to the scalar kernel for any values that don't fill a whole word.
+ * @param bitmap
+ * @param values
+ * @param operation
+ * @param operand
+ * @param simd_level
+ */
+template <typename T>
+auto or_compare_impl(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<T> values,
+        FilterOperation operation,
+        T operand,
+        SimdLevel simd_level
+) -> void {
+    auto const num_values{std::min(values.size(), bitmap.size())};
+    values = values.sub_span(0, num_values);
+    auto* const words{bitmap.get_words().data()};
+    simd_level = std::min(simd_level, get_supported_simd_level());
+
+    dispatch_operation(operation, [&](auto operation_constant) {
+        constexpr FilterOperation cOperation{decltype(operation_constant)::value};
+        size_t num_simd_words{0};
+#ifdef CLP_S_SEARCH_PACKED_BITMAP_X86_KERNELS
+        constexpr bool cIsComparison{
+                FilterOperation::EXISTS != cOperation && FilterOperation::NEXISTS != cOperation
+        };
+        if constexpr (cIsComparison) {
+            num_simd_words = num_values / cBitsPerWord;
+            if constexpr (std::is_same_v<T, int64_t>) {
+                if (SimdLevel::Avx512 == simd_level) {
+                    or_compare_int64_avx512<cOperation>(
+                            words,
+                            values.data(),
+                            num_simd_words,
+                            operand
+                    );
+                } else if (SimdLevel::Avx2 == simd_level) {
+                    or_compare_int64_avx2<cOperation>(
+                            words,
+                            values.data(),
+                            num_simd_words,
+                            operand
+                    );
+                } else {
+                    num_simd_words = 0;
+                }
+            } else if constexpr (std::is_same_v<T, double>) {
+                if (SimdLevel::Avx512 == simd_level) {
+                    or_compare_double_avx512<cOperation>(
+                            words,
+                            values.data(),
+                            num_simd_words,
+                            operand
+                    );
+                } else if (SimdLevel::Avx2 == simd_level) {
+                    or_compare_double_avx2<cOperation>(
+                            words,
+                            values.data(),
+                            num_simd_words,
+                            operand
+                    );
+                } else {
+                    num_simd_words = 0;
+                }
+            } else if constexpr (FilterOperation::EQ == cOperation
+                                 || FilterOperation::NEQ == cOperation)
+            {
+                if (SimdLevel::Scalar != simd_level) {
+                    or_compare_uint8_avx2<cOperation>(
+                            words,
+                            values.data(),
+                            num_simd_words,
+                            operand
+                    );
+                } else {
+                    num_simd_words = 0;
+                }
+            } else {
+                num_simd_words = 0;
+            }
+        }
+#endif
+        or_compare_scalar<cOperation>(words, values, num_simd_words * cBitsPerWord, operand);
+    });
+}
+
+/**
+ * @return The widest SIMD level supported by the build and the current CPU.
+ */
+[[nodiscard]] auto detect_simd_level() -> SimdLevel {
+#ifdef CLP_S_SEARCH_PACKED_BITMAP_X86_KERNELS
+    __builtin_cpu_init();
+    if (0 != __builtin_cpu_supports("avx512f")) {
+        return SimdLevel::Avx512;
+    }
+    if (0 != __builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+}  // namespace
+
+PackedBitmap::PackedBitmap(size_t size, bool value)
+        : m_words(get_num_words(size), value ? cAllBitsSet : Word{0}),
+          m_size{size} {
+    clear_padding_bits();
+}
+
+auto PackedBitmap::fill(bool value) -> void {
+    std::fill(m_words.begin(), m_words.end(), value ? cAllBitsSet : Word{0});
+    clear_padding_bits();
+}
+
+auto PackedBitmap::invert() -> void {
+    for (auto& word : m_words) {
+        word = ~word;
+    }
+    clear_padding_bits();
+}
+
+auto PackedBitmap::and_with(PackedBitmap const& other) -> bool {
+    Word any_set{0};
+    for (size_t i{0}; i < m_words.size(); ++i) {
+        m_words[i] &= other.m_words[i];
+        any_set |= m_words[i];
+    }
+    return 0 != any_set;
+}
+
+auto PackedBitmap::and_not_with(PackedBitmap const& other) -> bool {
+    Word any_set{0};
+    for (size_t i{0}; i < m_words.size(); ++i) {
+        m_words[i] &= ~other.m_words[i];
+        any_set |= m_words[i];
+    }
+    return 0 != any_set;
+}
+
+auto PackedBitmap::or_with(PackedBitmap const& other) -> bool {
+    for (size_t i{0}; i < m_words.size(); ++i) {
+        m_words[i] |= other.m_words[i];
+    }
+    return count() == m_size;
+}
+
+auto PackedBitmap::count() const -> size_t {
+    size_t num_set{0};
+    for (auto const word : m_words) {
+        num_set += static_cast<size_t>(std::popcount(word));
+    }
+    return num_set;
+}
+
+auto PackedBitmap::find_next(size_t index) const -> size_t {
+    if (index >= m_size) {
+        return m_size;
+    }
+    auto word_idx{index / cBitsPerWord};
+    auto word{m_words[word_idx] & (cAllBitsSet << (index % cBitsPerWord))};
+    while (0 == word) {
+        if (++word_idx == m_words.size()) {
+            return m_size;
+        }
+        word = m_words[word_idx];
+    }
+    return word_idx * cBitsPerWord + static_cast<size_t>(std::countr_zero(word));
+}
+
+auto PackedBitmap::clear_padding_bits() -> void {
+    auto const num_padding_bits{m_words.size() * cBitsPerWord - m_size};
+    if (0 != num_padding_bits) {
+        m_words.back() &= cAllBitsSet >> num_padding_bits;
+    }
+}
+
+auto get_supported_simd_level() -> SimdLevel {
+    static SimdLevel const cSupportedSimdLevel{detect_simd_level()};
+    return cSupportedSimdLevel;
+}
+
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<int64_t> values,
+        FilterOperation operation,
+        int64_t operand,
+        SimdLevel simd_level
+) -> void {
+    or_compare_impl(bitmap, values, operation, operand, simd_level);
+}
+
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<double> values,
+        FilterOperation operation,
+        double operand,
+        SimdLevel simd_level
+) -> void {
+    or_compare_impl(bitmap, values, operation, operand, simd_level);
+}
+
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<uint8_t> values,
+        FilterOperation operation,
+        uint8_t operand,
+        SimdLevel simd_level
+) -> void {
+    or_compare_impl(bitmap, values, operation, operand, simd_level);
+}
+}  // namespace clp_s::search
@@ -0,0 +1,158 @@
+#ifndef CLP_S_SEARCH_PACKEDBITMAP_HPP
+#define CLP_S_SEARCH_PACKEDBITMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <clp_s/search/ast/FilterOperation.hpp>
+#include <clp_s/Utils.hpp>
+
+namespace clp_s::search {
+/**
+ * A fixed-size bitmap that packs one bit per message into 64-bit words.
+ *
+ * Bits past `size()` in the last word are always kept clear so that word-level operations (e.g.,
+ * counting and searching) never observe them.
+ */
+class PackedBitmap {
+public:
+    using Word = uint64_t;
+
+    static constexpr size_t cBitsPerWord{sizeof(Word) * 8};
+
+    // Constructors
+    PackedBitmap() = default;
+
+    /**
+     * @param size Number of bits in the bitmap.
+     * @param value Initial value of every bit.
+     */
+    explicit PackedBitmap(size_t size, bool value = false);
+
+    // Methods
+    [[nodiscard]] auto size() const -> size_t { return m_size; }
+
+    [[nodiscard]] auto test(size_t index) const -> bool {
+        return 0 != ((m_words[index / cBitsPerWord] >> (index % cBitsPerWord)) & 1ULL);
+    }
+
+    auto set(size_t index) -> void {
+        m_words[index / cBitsPerWord] |= (1ULL << (index % cBitsPerWord));
+    }
+
+    [[nodiscard]] auto get_words() const -> std::vector<Word> const& { return m_words; }
+
+    [[nodiscard]] auto get_words() -> std::vector<Word>& { return m_words; }
+
+    /**
+     * Sets every bit to `value`.
+     * @param value
+     */
+    auto fill(bool value) -> void;
+
+    /**
+     * Flips every bit.
+     */
+    auto invert() -> void;
+
+    /**
+     * Intersects this bitmap with `other` in place.
+     * @param other A bitmap with the same size as this one.
+     * @return Whether any bit remains set.
+     */
+    auto and_with(PackedBitmap const& other) -> bool;
+
+    /**
+     * Clears every bit in this bitmap that is set in `other`.
+     * @param other A bitmap with the same size as this one.
+     * @return Whether any bit remains set.
+     */
+    auto and_not_with(PackedBitmap const& other) -> bool;
+
+    /**
+     * Unions this bitmap with `other` in place.
+     * @param other A bitmap with the same size as this one.
+     * @return Whether every bit is now set.
+     */
+    auto or_with(PackedBitmap const& other) -> bool;
+
+    /**
+     * @return The number of set bits.
+     */
+    [[nodiscard]] auto count() const -> size_t;
+
+    /**
+     * Finds the first set bit at or after `index`, skipping over entire zero words.
+     * @param index
+     * @return The index of the next set bit, or `size()` if there is none.
+     */
+    [[nodiscard]] auto find_next(size_t index) const -> size_t;
+
+private:
+    /**
+     * Clears the bits in the last word that lie past `m_size`.
+     */
+    auto clear_padding_bits() -> void;
+
+    std::vector<Word> m_words;
+    size_t m_size{0};
+};
+
+/**
+ * The widest instruction set that the compare kernels below can use.
+ */
+enum class SimdLevel : uint8_t {
+    Scalar = 0,
+    Avx2,
+    Avx512
+};
+
+/**
+ * @return The widest SIMD level supported by both this build and the CPU it's running on.
+ */
+[[nodiscard]] auto get_supported_simd_level() -> SimdLevel;
+
+/**
+ * Compares every value in `values` against `operand` and sets the bit for each index where the
+ * comparison holds. Bits that are already set are left unchanged.
+ * @param bitmap A bitmap with at least `values.size()` bits.
+ * @param values
+ * @param operation
+ * @param operand
+ * @param simd_level The widest SIMD level to use, which must not exceed
+ * `get_supported_simd_level()`.
+ */
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<int64_t> values,
+        ast::FilterOperation operation,
+        int64_t operand,
+        SimdLevel simd_level = get_supported_simd_level()
+) -> void;
+
+/**
+ * Same as the `int64_t` overload, but for double-precision values. As with scalar C++ comparisons,
+ * NaN only compares unequal.
+ */
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<double> values,
+        ast::FilterOperation operation,
+        double operand,
+        SimdLevel simd_level = get_supported_simd_level()
+) -> void;
+
+/**
+ * Same as the `int64_t` overload, but for boolean values stored one per byte.
+ */
+auto or_compare(
+        PackedBitmap& bitmap,
+        UnalignedMemSpan<uint8_t> values,
+        ast::FilterOperation operation,
+        uint8_t operand,
+        SimdLevel simd_level = get_supported_simd_level()
+) -> void;
+}  // namespace clp_s::search
+
+#endif  // CLP_S_SEARCH_PACKEDBITMAP_HPP
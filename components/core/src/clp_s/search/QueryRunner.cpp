@@ -1,7 +1,9 @@
 #include "QueryRunner.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <log_surgeon/Lexer.hpp>
@@ -11,6 +13,7 @@
 #include "../../clp/GrepCore.hpp"
 #include "../../clp/Query.hpp"
 #include "../../clp/type_utils.hpp"
+#include "../ColumnValueRange.hpp"
 #include "../SchemaTree.hpp"
 #include "../Utils.hpp"
 #include "ast/AndExpr.hpp"
@@ -39,18 +42,95 @@ using clp_s::search::ast::OrExpr;
 #define eval(op, a, b) (((op) == FilterOperation::EQ) ? ((a) == (b)) : ((a) != (b)))
 
 namespace clp_s::search {
+namespace {
+/**
+ * Decides a non-inverted filter for every value in a range.
+ * @param op
+ * @param range
+ * @param operand
+ * @return EvaluatedValue::True if every value in the range matches the filter,
+ * EvaluatedValue::False if no value does, EvaluatedValue::Unknown otherwise
+ */
+template <typename T>
+auto evaluate_range(FilterOperation op, ValueRange<T> const& range, T operand) -> EvaluatedValue;
+
+template <typename T>
+auto evaluate_range(FilterOperation op, ValueRange<T> const& range, T operand) -> EvaluatedValue {
+    switch (op) {
+        case FilterOperation::EQ:
+            if (operand < range.min || operand > range.max) {
+                return EvaluatedValue::False;
+            }
+            if (operand == range.min && operand == range.max) {
+                return EvaluatedValue::True;
+            }
+            break;
+        case FilterOperation::NEQ:
+            if (operand < range.min || operand > range.max) {
+                return EvaluatedValue::True;
+            }
+            if (operand == range.min && operand == range.max) {
+                return EvaluatedValue::False;
+            }
+            break;
+        case FilterOperation::LT:
+            if (range.max < operand) {
+                return EvaluatedValue::True;
+            }
+            if (range.min >= operand) {
+                return EvaluatedValue::False;
+            }
+            break;
+        case FilterOperation::GT:
+            if (range.min > operand) {
+                return EvaluatedValue::True;
+            }
+            if (range.max <= operand) {
+                return EvaluatedValue::False;
+            }
+            break;
+        case FilterOperation::LTE:
+            if (range.max <= operand) {
+                return EvaluatedValue::True;
+            }
+            if (range.min > operand) {
+                return EvaluatedValue::False;
+            }
+            break;
+        case FilterOperation::GTE:
+            if (range.min >= operand) {
+                return EvaluatedValue::True;
+            }
+            if (range.max < operand) {
+                return EvaluatedValue::False;
+            }
+            break;
+        default:
+            break;
+    }
+    return EvaluatedValue::Unknown;
+}
+}  // namespace
+
 void QueryRunner::global_init() {
     populate_internal_columns();
     populate_string_queries(m_expr);
 }
 
 auto QueryRunner::schema_init(int32_t schema_id) -> EvaluatedValue {
+    if (auto it{m_kept_schema_contexts.find(schema_id)}; m_kept_schema_contexts.end() != it) {
+        restore_schema_context(schema_id, std::move(it->second));
+        m_kept_schema_contexts.erase(it);
+        return m_expression_value;
+    }
+
     m_expr_clp_query.clear();
     m_expr_var_match_map.clear();
     m_wildcard_to_searched_basic_columns.clear();
     m_wildcard_columns.clear();
     m_expr = m_match->get_query_for_schema(schema_id)->copy();
     m_schema = schema_id;
+    m_zone_map = m_archive_reader->get_zone_map(schema_id);
     populate_searched_wildcard_columns(m_expr);
 
     m_expression_value = constant_propagate(m_expr);
@@ -62,6 +142,41 @@ auto QueryRunner::schema_init(int32_t schema_id) -> EvaluatedValue {
     return m_expression_value;
 }
 
+auto QueryRunner::prune_schemas(std::vector<int32_t>& schema_ids) -> void {
+    std::erase_if(schema_ids, [&](int32_t schema_id) -> bool {
+        if (EvaluatedValue::False == schema_init(schema_id)) {
+            return true;
+        }
+        m_kept_schema_contexts.insert_or_assign(schema_id, take_schema_context());
+        return false;
+    });
+}
+
+auto QueryRunner::take_schema_context() -> SchemaContext {
+    return SchemaContext{
+            .expr = std::move(m_expr),
+            .zone_map = m_zone_map,
+            .expr_clp_query = std::move(m_expr_clp_query),
+            .expr_var_match_map = std::move(m_expr_var_match_map),
+            .wildcard_columns = std::move(m_wildcard_columns),
+            .wildcard_to_searched_basic_columns = std::move(m_wildcard_to_searched_basic_columns),
+            .wildcard_type_mask = m_wildcard_type_mask,
+            .expression_value = m_expression_value
+    };
+}
+
+void QueryRunner::restore_schema_context(int32_t schema_id, SchemaContext&& context) {
+    m_schema = schema_id;
+    m_expr = std::move(context.expr);
+    m_zone_map = context.zone_map;
+    m_expr_clp_query = std::move(context.expr_clp_query);
+    m_expr_var_match_map = std::move(context.expr_var_match_map);
+    m_wildcard_columns = std::move(context.wildcard_columns);
+    m_wildcard_to_searched_basic_columns = std::move(context.wildcard_to_searched_basic_columns);
+    m_wildcard_type_mask = context.wildcard_type_mask;
+    m_expression_value = context.expression_value;
+}
+
 void QueryRunner::clear_readers() {
     m_clp_string_readers.clear();
     m_var_string_readers.clear();
@@ -114,6 +229,7 @@ void QueryRunner::init(SchemaReader* reader, std::vector<BaseColumnReader*> cons
 
 auto QueryRunner::prepare_filter(SchemaReader& reader) -> FilterClass& {
     m_column_scan.reset();
+    m_column_prefilter.reset();
     if (EvaluatedValue::Unknown != m_expression_value) {
         return *this;
     }
@@ -136,9 +252,32 @@ auto QueryRunner::prepare_filter(SchemaReader& reader) -> FilterClass& {
         return *m_column_scan;
     }
 
+    // Otherwise, scan the operands of a top-level AND that ColumnScan supports so that the full
+    // expression only needs to be evaluated on messages that can still match.
+    auto column_prefilter = ColumnScan::try_create_prefilter(
+            m_expr,
+            m_basic_readers,
+            m_clp_string_readers,
+            m_var_string_readers,
+            m_timestamp_readers,
+            m_deprecated_datestring_reader,
+            m_expr_clp_query,
+            m_expr_var_match_map,
+            reader.get_num_messages()
+    );
+    if (column_prefilter.has_value()) {
+        m_column_prefilter = std::make_unique<ColumnScan>(std::move(column_prefilter.value()));
+    }
     return *this;
 }
 
+auto QueryRunner::find_next_candidate(uint64_t cur_message) -> uint64_t {
+    if (nullptr == m_column_prefilter) {
+        return cur_message;
+    }
+    return m_column_prefilter->find_next_candidate(cur_message);
+}
+
 std::string& QueryRunner::get_cached_decompressed_unstructured_array(int32_t column_id) {
     auto it = m_extracted_unstructured_arrays.find(column_id);
     if (m_extracted_unstructured_arrays.end() != it) {
@@ -1208,13 +1347,50 @@ EvaluatedValue QueryRunner::constant_propagate(std::shared_ptr<Expression> const
                 return EvaluatedValue::Unknown;
             }
         } else {
-            return EvaluatedValue::Unknown;
+            return evaluate_zone_map(filter.get());
         }
     }
 
     return EvaluatedValue::Unknown;
 }
 
+auto QueryRunner::evaluate_zone_map(FilterExpr* filter) const -> EvaluatedValue {
+    auto* column = filter->get_column().get();
+    if (nullptr == m_zone_map || column->is_pure_wildcard()) {
+        return EvaluatedValue::Unknown;
+    }
+    auto const it{m_zone_map->find(column->get_column_id())};
+    if (m_zone_map->end() == it) {
+        return EvaluatedValue::Unknown;
+    }
+
+    // Operands are converted the same way as in `evaluate_int_filter` and `evaluate_float_filter`
+    // so that the zone map never disagrees with evaluating each message.
+    auto const op{filter->get_operation()};
+    auto result{EvaluatedValue::Unknown};
+    if (auto const* int_range{std::get_if<ValueRange<int64_t>>(&it->second)};
+        nullptr != int_range
+        && column->matches_any(LiteralType::IntegerT | LiteralType::TimestampT))
+    {
+        int64_t operand{};
+        if (filter->get_operand()->as_int(operand, op)) {
+            result = evaluate_range(op, *int_range, operand);
+        }
+    } else if (auto const* float_range{std::get_if<ValueRange<double>>(&it->second)};
+               nullptr != float_range && column->matches_type(LiteralType::FloatT))
+    {
+        double operand{};
+        if (filter->get_operand()->as_float(operand, op)) {
+            result = evaluate_range(op, *float_range, operand);
+        }
+    }
+
+    if (EvaluatedValue::Unknown == result || false == filter->is_inverted()) {
+        return result;
+    }
+    return EvaluatedValue::True == result ? EvaluatedValue::False : EvaluatedValue::True;
+}
+
 bool QueryRunner::evaluate_epoch_date_filter(
         FilterOperation op,
         DeprecatedDateStringColumnReader* reader,
@@ -21,6 +21,7 @@
 #include "../../clp/Query.hpp"
 #include "../ArchiveReader.hpp"
 #include "../ColumnReader.hpp"
+#include "../ColumnValueRange.hpp"
 #include "../DictionaryReader.hpp"
 #include "../ReaderUtils.hpp"
 #include "../SchemaReader.hpp"
@@ -84,10 +85,21 @@ public:
      * the expression. If the expression evaluates to false, it returns EvaluatedValue::False.
      * Otherwise, it sets the wildcard matching type mask.
      *
+     * If the schema's context was kept by `prune_schemas`, the kept context is restored instead.
+     *
      * @param schema_id
      */
     auto schema_init(int32_t schema_id) -> EvaluatedValue;
 
+    /**
+     * Initializes the query processing context for each of the given schemas, and removes the
+     * schemas whose expression evaluates to false. The contexts of the remaining schemas are kept
+     * so that the following `schema_init` call for each of them doesn't repeat the work.
+     *
+     * @param schema_ids
+     */
+    auto prune_schemas(std::vector<int32_t>& schema_ids) -> void;
+
     /**
      * Selects a filtering implementation, and prepares a filter on a given ERT.
      *
@@ -102,6 +114,8 @@ protected:
     // Methods inherited from FilterClass
     auto filter(uint64_t cur_message) -> bool override;
 
+    [[nodiscard]] auto find_next_candidate(uint64_t cur_message) -> uint64_t override;
+
     /**
      * Clears all column readers.
      */
@@ -122,6 +136,18 @@ private:
         Filter
     };
 
+    // The query processing context that `schema_init` initializes for a schema
+    struct SchemaContext {
+        std::shared_ptr<ast::Expression> expr;
+        SchemaZoneMap const* zone_map{nullptr};
+        std::unordered_map<ast::Expression*, clp::Query*> expr_clp_query;
+        std::unordered_map<ast::Expression*, std::unordered_set<int64_t>*> expr_var_match_map;
+        std::vector<ast::ColumnDescriptor*> wildcard_columns;
+        std::map<ast::ColumnDescriptor*, std::set<int32_t>> wildcard_to_searched_basic_columns;
+        ast::literal_type_bitmask_t wildcard_type_mask{0};
+        EvaluatedValue expression_value{EvaluatedValue::Unknown};
+    };
+
     std::shared_ptr<ArchiveReader> m_archive_reader;
     std::shared_ptr<ast::Expression> m_expr;
     std::shared_ptr<SchemaMatch> m_match;
@@ -130,6 +156,7 @@ private:
     // variables for the current schema being filtered
     int32_t m_schema{-1};
     SchemaReader* m_reader{nullptr};
+    SchemaZoneMap const* m_zone_map{nullptr};
 
     std::shared_ptr<SchemaTree> m_schema_tree;
     std::shared_ptr<VariableDictionaryReader> m_var_dict;
@@ -167,6 +194,23 @@ private:
     bool m_maybe_string{false};
     bool m_maybe_number{false};
     std::unique_ptr<ColumnScan> m_column_scan;
+    // Narrows the messages that `filter` is evaluated on when `m_column_scan` can't be used
+    std::unique_ptr<ColumnScan> m_column_prefilter;
+    // Contexts kept by `prune_schemas`, keyed by schema ID
+    std::unordered_map<int32_t, SchemaContext> m_kept_schema_contexts;
+
+    /**
+     * Moves the current schema's query processing context out of the runner.
+     * @return The context.
+     */
+    auto take_schema_context() -> SchemaContext;
+
+    /**
+     * Makes the given context the current schema's query processing context.
+     * @param schema_id
+     * @param context
+     */
+    void restore_schema_context(int32_t schema_id, SchemaContext&& context);
 
     /**
      * Initializes the variables. Init is called once for each schema after which filter is called
@@ -435,6 +479,15 @@ private:
      */
     auto constant_propagate(std::shared_ptr<ast::Expression> const& expr) -> EvaluatedValue;
 
+    /**
+     * Uses the zone map of the current schema table to try to decide a numeric or timestamp filter
+     * for every message in the table.
+     * @param filter
+     * @return EvaluatedValue::True if every message in the table matches the filter,
+     * EvaluatedValue::False if no message does, EvaluatedValue::Unknown otherwise
+     */
+    [[nodiscard]] auto evaluate_zone_map(ast::FilterExpr* filter) const -> EvaluatedValue;
+
     /**
      * Populates searched wildcard columns
      * @param expr
@@ -16,6 +16,7 @@ constexpr std::string_view cTerminationStageTimeRangeMatchingAfterColumnResoluti
         "time_range_matching_after_column_resolution"
 };
 constexpr std::string_view cTerminationStageSchemaMatching{"schema_matching"};
+constexpr std::string_view cTerminationStageDictionaryFilter{"dictionary_filter"};
 constexpr std::string_view cTerminationStageErtScan{"ert_scan"};
 constexpr std::string_view cTerminationStageDictionarySearch{"dictionary_search"};
 
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <exception>
+#include <initializer_list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -33,6 +34,7 @@ namespace {
 constexpr std::string_view cServiceNameKey{"service.name"};
 constexpr std::string_view cDefaultServiceName{"clp-search"};
 constexpr std::string_view cTracesPath{"/v1/traces"};
+constexpr std::string_view cJsonProtocol{"http/json"};
 
 /**
  * Bound on how long the destructor blocks while draining buffered spans on exit.
@@ -56,6 +58,15 @@ constexpr std::chrono::seconds cShutdownTimeout{1};
  */
 [[nodiscard]] auto resolve_clp_endpoint() -> std::optional<std::string>;
 
+/**
+ * Spans are exported as binary protobuf unless the standard `OTEL_EXPORTER_OTLP_TRACES_PROTOCOL`/
+ * `OTEL_EXPORTER_OTLP_PROTOCOL` variables request JSON (e.g., so that a collector-less consumer
+ * like the throughput benchmark can read them).
+ *
+ * @return Whether spans should be exported as JSON.
+ */
+[[nodiscard]] auto is_json_protocol_requested() -> bool;
+
 /**
  * @return A resource describing this process; a default `service.name` of `clp-search`
  * (used only when `OTEL_SERVICE_NAME` is unset) merged with the attributes detected from the
@@ -90,6 +101,15 @@ auto resolve_clp_endpoint() -> std::optional<std::string> {
     return endpoint;
 }
 
+auto is_json_protocol_requested() -> bool {
+    for (auto const* name : {"OTEL_EXPORTER_OTLP_TRACES_PROTOCOL", "OTEL_EXPORTER_OTLP_PROTOCOL"}) {
+        if (is_env_set(name)) {
+            return cJsonProtocol == std::getenv(name);
+        }
+    }
+    return false;
+}
+
 auto make_resource() -> resource::Resource {
     resource::ResourceAttributes attributes{};
     if (false == is_env_set("OTEL_SERVICE_NAME")) {
@@ -108,7 +128,9 @@ public:
             if (auto const endpoint{resolve_clp_endpoint()}; endpoint.has_value()) {
                 exporter_options.url = *endpoint;
             }
-            exporter_options.content_type = otlp::HttpRequestContentType::kBinary;
+            exporter_options.content_type = is_json_protocol_requested()
+                                                    ? otlp::HttpRequestContentType::kJson
+                                                    : otlp::HttpRequestContentType::kBinary;
             auto exporter{otlp::OtlpHttpExporterFactory::Create(exporter_options)};
 
             trace_sdk::BatchSpanProcessorOptions const processor_options{};
@@ -1,5 +1,6 @@
 #include "clp_s_test_utils.hpp"
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -8,6 +9,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../src/clp_s/ArchiveWriter.hpp"
+#include "../src/clp_s/filter/FilterOptions.hpp"
 #include "../src/clp_s/InputConfig.hpp"
 #include "../src/clp_s/JsonParser.hpp"
 #include "../src/clp_s/TimestampPattern.hpp"
@@ -18,7 +20,11 @@ auto compress_archive(
         std::optional<std::string> timestamp_key,
         bool retain_float_format,
         bool single_file_archive,
-        bool structurize_arrays
+        bool structurize_arrays,
+        std::optional<size_t> min_table_size,
+        size_t num_compression_threads,
+        std::optional<clp_s::filter::FilterType> var_dict_filter_type,
+        size_t table_memory_budget
 ) -> std::vector<clp_s::ArchiveStats> {
     constexpr auto cDefaultTargetEncodedSize{8ULL * 1024 * 1024 * 1024};  // 8 GiB
     constexpr auto cDefaultMaxDocumentSize{512ULL * 1024 * 1024};  // 512 MiB
@@ -37,7 +43,10 @@ auto compress_archive(
     parser_option.archives_dir = archive_directory;
     parser_option.target_encoded_size = cDefaultTargetEncodedSize;
     parser_option.max_document_size = cDefaultMaxDocumentSize;
-    parser_option.min_table_size = cDefaultMinTableSize;
+    parser_option.min_table_size = min_table_size.value_or(cDefaultMinTableSize);
+    parser_option.num_compression_threads = num_compression_threads;
+    parser_option.table_memory_budget = table_memory_budget;
+    parser_option.var_dict_filter_type = var_dict_filter_type;
     parser_option.compression_level = cDefaultCompressionLevel;
     parser_option.print_archive_stats = cDefaultPrintArchiveStats;
     parser_option.retain_float_format = retain_float_format;
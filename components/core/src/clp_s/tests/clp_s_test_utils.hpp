@@ -1,11 +1,13 @@
 #ifndef CLP_S_TEST_UTILS_HPP
 #define CLP_S_TEST_UTILS_HPP
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include "../src/clp_s/ArchiveWriter.hpp"
+#include "../src/clp_s/filter/FilterOptions.hpp"
 #include "../src/clp_s/InputConfig.hpp"
 
 /**
@@ -19,6 +21,11 @@
  * @param retain_float_format
  * @param single_file_archive
  * @param structurize_arrays
+ * @param min_table_size The minimum packed table size, or std::nullopt to use the default.
+ * @param num_compression_threads
+ * @param var_dict_filter_type The type of filter to store over the variable dictionary, or
+ * std::nullopt to store no filter.
+ * @param table_memory_budget The limit on the size of in-memory schema tables, or 0 for no limit.
  * @return Statistics for every compressed archive.
  */
 [[nodiscard]] auto compress_archive(
@@ -27,6 +34,10 @@
         std::optional<std::string> timestamp_key,
         bool retain_float_format,
         bool single_file_archive,
-        bool structurize_arrays
+        bool structurize_arrays,
+        std::optional<size_t> min_table_size = std::nullopt,
+        size_t num_compression_threads = 1,
+        std::optional<clp_s::filter::FilterType> var_dict_filter_type = std::nullopt,
+        size_t table_memory_budget = 0
 ) -> std::vector<clp_s::ArchiveStats>;
 #endif  // CLP_S_TEST_UTILS_HPP
@@ -1,7 +1,9 @@
 #include <sys/wait.h>
 
+#include <cstddef>
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <optional>
 #include <set>
 #include <string>
@@ -18,7 +20,9 @@
 #include "../src/clp_s/CommandLineArguments.hpp"
 #include "../src/clp_s/InputConfig.hpp"
 #include "../src/clp_s/JsonConstructor.hpp"
+#include "../src/clp_s/JsonParser.hpp"
 #include "../src/clp_s/SchemaTree.hpp"
+#include "../src/clp_s/ShardedJsonParser.hpp"
 #include "../src/clp_s/SingleFileArchiveDefs.hpp"
 #include "clp_s_test_utils.hpp"
 #include "TestOutputCleaner.hpp"
@@ -38,6 +42,7 @@ constexpr std::string_view cTestEndToEndInvalidFormattedFloatInputFile{
         "test_invalid_formatted_float.jsonl"
 };
 constexpr std::string_view cTestEndToEndTimestampInputFile{"test_timestamp.jsonl"};
+constexpr std::string_view cTestEndToEndSplitInputDirectory{"test-end-to-end-split-input"};
 
 namespace {
 auto get_test_input_path_relative_to_tests_dir(std::string_view const test_input_path)
@@ -245,6 +250,139 @@ TEST_CASE("clp-s-compress-extract-no-floats", "[clp-s][end-to-end]") {
     compare(extracted_json_path);
 }
 
+/**
+ * Tests that archives whose packed streams are compressed by several threads round-trip correctly.
+ * A minimum table size of zero places every schema table in its own packed stream.
+ */
+TEST_CASE("clp-s-compress-extract-parallel-table-compression", "[clp-s][end-to-end]") {
+    constexpr size_t cMinTableSize{0};
+    constexpr size_t cNumCompressionThreads{4};
+    auto single_file_archive = GENERATE(true, false);
+
+    TestOutputCleaner const test_cleanup{
+            {std::string{cTestEndToEndArchiveDirectory},
+             std::string{cTestEndToEndOutputDirectory},
+             std::string{cTestEndToEndOutputSortedJson}}
+    };
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestEndToEndInputFile),
+                    std::string{cTestEndToEndArchiveDirectory},
+                    std::nullopt,
+                    false,
+                    single_file_archive,
+                    false,
+                    cMinTableSize,
+                    cNumCompressionThreads
+            )
+    );
+    validate_archive_header();
+
+    auto extracted_json_path = extract();
+
+    compare(extracted_json_path);
+}
+
+/**
+ * Tests that archives whose schema tables are spilled to disk during ingestion round-trip
+ * correctly. A tiny table memory budget spills tables after nearly every message, so most schemas
+ * end up split across several tables.
+ */
+TEST_CASE("clp-s-compress-extract-spilled-tables", "[clp-s][end-to-end]") {
+    constexpr size_t cTableMemoryBudget{4 * 1024};
+    auto single_file_archive = GENERATE(true, false);
+
+    TestOutputCleaner const test_cleanup{
+            {std::string{cTestEndToEndArchiveDirectory},
+             std::string{cTestEndToEndOutputDirectory},
+             std::string{cTestEndToEndOutputSortedJson}}
+    };
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestEndToEndInputFile),
+                    std::string{cTestEndToEndArchiveDirectory},
+                    std::nullopt,
+                    false,
+                    single_file_archive,
+                    false,
+                    std::nullopt,
+                    1,
+                    std::nullopt,
+                    cTableMemoryBudget
+            )
+    );
+    validate_archive_header();
+
+    auto extracted_json_path = extract();
+
+    compare(extracted_json_path);
+}
+
+/**
+ * Tests that splitting the input across several files and ingesting them with several shards
+ * produces one archive per shard, and that the archives together contain every record.
+ */
+TEST_CASE("clp-s-compress-extract-sharded-ingestion", "[clp-s][end-to-end]") {
+    constexpr size_t cNumInputFiles{4};
+    constexpr size_t cNumShards{2};
+    auto single_file_archive = GENERATE(true, false);
+
+    TestOutputCleaner const test_cleanup{
+            {std::string{cTestEndToEndArchiveDirectory},
+             std::string{cTestEndToEndOutputDirectory},
+             std::string{cTestEndToEndOutputSortedJson},
+             std::string{cTestEndToEndSplitInputDirectory}}
+    };
+
+    // Distribute the records of the input file round-robin across several input files.
+    std::filesystem::create_directory(cTestEndToEndSplitInputDirectory);
+    std::vector<std::string> split_input_paths;
+    {
+        std::vector<std::ofstream> split_inputs;
+        for (size_t i{0}; i < cNumInputFiles; ++i) {
+            auto const path{
+                    std::filesystem::path{cTestEndToEndSplitInputDirectory}
+                    / fmt::format("{}.jsonl", i)
+            };
+            split_input_paths.emplace_back(path.string());
+            split_inputs.emplace_back(path);
+        }
+        std::ifstream input{get_test_input_local_path(cTestEndToEndInputFile)};
+        std::string line;
+        for (size_t line_idx{0}; std::getline(input, line); ++line_idx) {
+            split_inputs[line_idx % cNumInputFiles] << line << '\n';
+        }
+    }
+
+    std::filesystem::create_directory(cTestEndToEndArchiveDirectory);
+    clp_s::JsonParserOption parser_option{};
+    for (auto const& path : split_input_paths) {
+        parser_option.input_paths_and_canonical_filenames.emplace_back(
+                clp_s::Path{.source = clp_s::InputSource::Filesystem, .path = path},
+                path
+        );
+    }
+    parser_option.archives_dir = cTestEndToEndArchiveDirectory;
+    parser_option.target_encoded_size = 8ULL * 1024 * 1024 * 1024;
+    parser_option.max_document_size = 512ULL * 1024 * 1024;
+    parser_option.min_table_size = 1ULL * 1024 * 1024;
+    parser_option.compression_level = 3;
+    parser_option.single_file_archive = single_file_archive;
+
+    clp_s::ShardedJsonParser parser{parser_option, cNumShards};
+    REQUIRE(parser.ingest());
+    std::vector<clp_s::ArchiveStats> archive_stats;
+    REQUIRE_NOTHROW(archive_stats = parser.store());
+    REQUIRE((cNumShards == archive_stats.size()));
+    validate_archive_header();
+
+    auto extracted_json_path = extract();
+
+    compare(extracted_json_path);
+}
+
 /**
  * Tests that floats that can be represented as a `FormattedFloat` are retained accurately.
  */
@@ -0,0 +1,147 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "../src/clp_s/BufferViewReader.hpp"
+#include "../src/clp_s/ErrorCode.hpp"
+#include "../src/clp_s/FileWriter.hpp"
+#include "../src/clp_s/IntegerEncoding.hpp"
+#include "../src/clp_s/ZstdCompressor.hpp"
+#include "../src/clp_s/ZstdDecompressor.hpp"
+
+using clp_s::IntegerEncoding;
+using clp_s::IntegerEncodingParameters;
+
+namespace {
+constexpr std::string_view cTestIntegerEncodingFile{"test-integer-encoding.zst"};
+
+/**
+ * Encodes values with the encoding chosen for them, decodes them, and checks that the decoded
+ * values match the original values.
+ * @param values
+ * @return The parameters the values were encoded with.
+ */
+auto check_round_trip(std::vector<int64_t> const& values) -> IntegerEncodingParameters;
+
+auto check_round_trip(std::vector<int64_t> const& values) -> IntegerEncodingParameters {
+    auto const parameters{clp_s::choose_integer_encoding(values)};
+    auto const encoded_size{clp_s::get_encoded_integers_size(parameters, values.size())};
+    REQUIRE((encoded_size <= clp_s::get_encoded_integers_size({}, values.size())));
+
+    std::string const path{cTestIntegerEncodingFile};
+    clp_s::FileWriter file_writer;
+    file_writer.open(path, clp_s::FileWriter::OpenMode::CreateForWriting);
+    clp_s::ZstdCompressor compressor;
+    compressor.open(file_writer);
+    clp_s::write_encoded_integers(compressor, values, parameters);
+    compressor.close();
+    file_writer.close();
+
+    std::vector<char> buffer(encoded_size);
+    clp_s::ZstdDecompressor decompressor;
+    REQUIRE((clp_s::ErrorCodeSuccess == decompressor.open(path)));
+    REQUIRE(
+            (clp_s::ErrorCodeSuccess
+             == decompressor.try_read_exact_length(buffer.data(), buffer.size()))
+    );
+    char trailing_byte{};
+    size_t num_bytes_read{};
+    REQUIRE(
+            (clp_s::ErrorCodeEndOfFile
+             == decompressor.try_read(&trailing_byte, sizeof(trailing_byte), num_bytes_read))
+    );
+    decompressor.close();
+    std::filesystem::remove(path);
+
+    clp_s::BufferViewReader reader{buffer.data(), encoded_size};
+    std::vector<int64_t> decoded_values;
+    auto const decoded{clp_s::read_encoded_integers(reader, values.size(), decoded_values)};
+    REQUIRE((values.size() == decoded.size()));
+    for (size_t i{0}; i < values.size(); ++i) {
+        REQUIRE((values[i] == decoded[i]));
+    }
+    return parameters;
+}
+}  // namespace
+
+TEST_CASE("clp-s-integer-encoding-round-trip", "[clp-s][IntegerEncoding]") {
+    auto const num_values = GENERATE(
+            static_cast<size_t>(0),
+            static_cast<size_t>(1),
+            static_cast<size_t>(63),
+            static_cast<size_t>(64),
+            static_cast<size_t>(65),
+            static_cast<size_t>(1000)
+    );
+
+    SECTION("Constant values") {
+        std::vector<int64_t> const values(num_values, -42);
+        auto const parameters{check_round_trip(values)};
+        if (num_values > 1) {
+            REQUIRE((0 == parameters.bit_width));
+        }
+    }
+
+    SECTION("Values in a small range") {
+        std::vector<int64_t> values(num_values);
+        for (size_t i{0}; i < num_values; ++i) {
+            values[i] = 1'000'000 + static_cast<int64_t>((i * 37) % 100);
+        }
+        auto const parameters{check_round_trip(values)};
+        if (num_values > 1) {
+            REQUIRE((IntegerEncoding::FrameOfReference == parameters.encoding));
+            REQUIRE((parameters.bit_width <= 7));
+        }
+    }
+
+    SECTION("Monotonic timestamps") {
+        std::vector<int64_t> values(num_values);
+        int64_t timestamp{1'700'000'000'000};
+        for (size_t i{0}; i < num_values; ++i) {
+            timestamp += 1000 + static_cast<int64_t>(i % 3);
+            values[i] = timestamp;
+        }
+        auto const parameters{check_round_trip(values)};
+        if (num_values > 2) {
+            REQUIRE((IntegerEncoding::Delta == parameters.encoding));
+            REQUIRE((parameters.bit_width <= 2));
+        }
+    }
+
+    SECTION("Extreme values") {
+        std::vector<int64_t> values(num_values);
+        for (size_t i{0}; i < num_values; ++i) {
+            values[i] = (0 == i % 2) ? std::numeric_limits<int64_t>::min()
+                                     : std::numeric_limits<int64_t>::max();
+        }
+        // The values span every bit, so only their deltas can be packed.
+        auto const parameters{check_round_trip(values)};
+        REQUIRE((IntegerEncoding::FrameOfReference != parameters.encoding));
+    }
+
+    SECTION("Values spanning every bit width") {
+        std::vector<int64_t> values(num_values);
+        for (size_t i{0}; i < num_values; ++i) {
+            auto const shift{static_cast<int>(i % 63)};
+            values[i] = (int64_t{1} << shift) - static_cast<int64_t>(i % 5);
+        }
+        check_round_trip(values);
+    }
+}
+
+TEST_CASE("clp-s-integer-encoding-corrupt", "[clp-s][IntegerEncoding]") {
+    std::vector<char> buffer{static_cast<char>(3)};
+    clp_s::BufferViewReader reader{buffer.data(), buffer.size()};
+    std::vector<int64_t> decoded_values;
+    REQUIRE_THROWS_AS(
+            clp_s::read_encoded_integers(reader, 1, decoded_values),
+            clp_s::BufferViewReader::OperationFailed
+    );
+}
@@ -0,0 +1,163 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "../src/clp_s/search/ast/FilterOperation.hpp"
+#include "../src/clp_s/search/PackedBitmap.hpp"
+#include "../src/clp_s/Utils.hpp"
+
+using clp_s::search::PackedBitmap;
+using clp_s::search::SimdLevel;
+using clp_s::search::ast::FilterOperation;
+using clp_s::UnalignedMemSpan;
+
+namespace {
+/**
+ * Compares a value against an operand the same way `ColumnScan` does for a scalar column.
+ * @param operation
+ * @param value
+ * @param operand
+ * @return The result of the comparison.
+ */
+template <typename T>
+[[nodiscard]] auto reference_compare(FilterOperation operation, T value, T operand) -> bool;
+
+/**
+ * Checks that every supported SIMD level produces the same bitmap as a reference comparison.
+ * Values are copied to a deliberately misaligned buffer to exercise unaligned loads.
+ * @param values
+ * @param operation
+ * @param operand
+ */
+template <typename T>
+auto check_or_compare(std::vector<T> const& values, FilterOperation operation, T operand) -> void;
+
+template <typename T>
+auto reference_compare(FilterOperation operation, T value, T operand) -> bool {
+    switch (operation) {
+        case FilterOperation::EQ:
+            return value == operand;
+        case FilterOperation::NEQ:
+            return value != operand;
+        case FilterOperation::LT:
+            return value < operand;
+        case FilterOperation::GT:
+            return value > operand;
+        case FilterOperation::LTE:
+            return value <= operand;
+        case FilterOperation::GTE:
+            return value >= operand;
+        case FilterOperation::EXISTS:
+        case FilterOperation::NEXISTS:
+            return true;
+    }
+    return false;
+}
+
+template <typename T>
+auto check_or_compare(std::vector<T> const& values, FilterOperation operation, T operand) -> void {
+    std::vector<char> buffer(values.size() * sizeof(T) + 1);
+    std::memcpy(buffer.data() + 1, values.data(), values.size() * sizeof(T));
+    UnalignedMemSpan<T> const span{buffer.data() + 1, values.size()};
+
+    size_t num_expected_matches{0};
+    for (auto const value : values) {
+        if (reference_compare(operation, value, operand)) {
+            ++num_expected_matches;
+        }
+    }
+
+    auto const max_simd_level{static_cast<uint8_t>(clp_s::search::get_supported_simd_level())};
+    for (uint8_t simd_level{0}; simd_level <= max_simd_level; ++simd_level) {
+        PackedBitmap bitmap{values.size()};
+        clp_s::search::or_compare(
+                bitmap,
+                span,
+                operation,
+                operand,
+                static_cast<SimdLevel>(simd_level)
+        );
+        REQUIRE((num_expected_matches == bitmap.count()));
+        for (size_t i{0}; i < values.size(); ++i) {
+            REQUIRE((reference_compare(operation, values[i], operand) == bitmap.test(i)));
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("PackedBitmap word operations", "[clp_s][search][PackedBitmap]") {
+    constexpr size_t cSize{130};
+    PackedBitmap bitmap{cSize, true};
+    REQUIRE((cSize == bitmap.count()));
+    bitmap.invert();
+    REQUIRE((0 == bitmap.count()));
+    REQUIRE((cSize == bitmap.find_next(0)));
+
+    bitmap.set(3);
+    bitmap.set(127);
+    bitmap.set(cSize - 1);
+    REQUIRE((3 == bitmap.count()));
+    REQUIRE((3 == bitmap.find_next(0)));
+    REQUIRE((127 == bitmap.find_next(4)));
+    REQUIRE((cSize - 1 == bitmap.find_next(128)));
+    REQUIRE((cSize == bitmap.find_next(cSize)));
+
+    PackedBitmap other{cSize};
+    other.set(127);
+    REQUIRE(bitmap.and_with(other));
+    REQUIRE((1 == bitmap.count()));
+    REQUIRE(bitmap.test(127));
+    REQUIRE_FALSE(bitmap.and_with(PackedBitmap{cSize}));
+
+    REQUIRE_FALSE(bitmap.or_with(other));
+    REQUIRE(bitmap.or_with(PackedBitmap{cSize, true}));
+    REQUIRE((cSize == bitmap.count()));
+
+    REQUIRE(bitmap.and_not_with(other));
+    REQUIRE((cSize - 1 == bitmap.count()));
+    REQUIRE_FALSE(bitmap.test(127));
+    REQUIRE_FALSE(bitmap.and_not_with(PackedBitmap{cSize, true}));
+    REQUIRE((0 == bitmap.count()));
+}
+
+TEST_CASE("PackedBitmap compare kernels", "[clp_s][search][PackedBitmap]") {
+    auto const num_values = GENERATE(
+            static_cast<size_t>(0),
+            static_cast<size_t>(1),
+            static_cast<size_t>(63),
+            static_cast<size_t>(64),
+            static_cast<size_t>(65),
+            static_cast<size_t>(1000)
+    );
+    auto const operation = GENERATE(
+            FilterOperation::EQ,
+            FilterOperation::NEQ,
+            FilterOperation::LT,
+            FilterOperation::GT,
+            FilterOperation::LTE,
+            FilterOperation::GTE
+    );
+
+    std::vector<int64_t> int_values(num_values);
+    std::vector<double> float_values(num_values);
+    std::vector<uint8_t> bool_values(num_values);
+    for (size_t i{0}; i < num_values; ++i) {
+        auto const value{static_cast<int64_t>((i * 7) % 5) - 2};
+        int_values[i] = value;
+        float_values[i] = (0 == i % 11) ? std::numeric_limits<double>::quiet_NaN()
+                                        : static_cast<double>(value) + 0.5;
+        bool_values[i] = static_cast<uint8_t>(value > 0);
+    }
+
+    check_or_compare<int64_t>(int_values, operation, 0);
+    check_or_compare<double>(float_values, operation, 0.5);
+    if (FilterOperation::EQ == operation || FilterOperation::NEQ == operation) {
+        check_or_compare<uint8_t>(bool_values, operation, 1);
+    }
+}
@@ -0,0 +1,211 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <msgpack.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/ffi/ir_stream/IrStreamIndex.hpp"
+#include "../src/clp/ffi/ir_stream/protocol_constants.hpp"
+#include "../src/clp/ffi/ir_stream/Serializer.hpp"
+#include "../src/clp/FileWriter.hpp"
+#include "../src/clp/ir/types.hpp"
+#include "../src/clp/streaming_compression/zstd/Compressor.hpp"
+#include "../src/clp/type_utils.hpp"
+#include "../src/clp_s/ParallelKvIrDeserializer.hpp"
+#include "TestOutputCleaner.hpp"
+
+namespace {
+using clp::ffi::ir_stream::IrStreamIndex;
+using clp_s::ParallelKvIrDeserializer;
+
+constexpr std::string_view cTestStreamPath{"test-parallel-kv-ir-deserializer.clp.zst"};
+constexpr size_t cNumLogEvents{1000};
+constexpr size_t cNumLogEventsPerCheckpoint{64};
+constexpr size_t cNumKeys{13};
+
+/**
+ * Writes a zstd-compressed kv-pair IR stream to `cTestStreamPath`, adding a checkpoint that starts
+ * a new zstd frame every `cNumLogEventsPerCheckpoint` log events. New keys keep getting added to the
+ * schema tree throughout the stream.
+ * @param expected_user_gen_objs Returns the user-generated kv-pairs of each log event.
+ * @param stream_size Returns the size of the (decompressed) stream.
+ * @return The stream's index.
+ */
+[[nodiscard]] auto write_test_stream(
+        std::vector<nlohmann::json>& expected_user_gen_objs,
+        size_t& stream_size
+) -> IrStreamIndex;
+
+/**
+ * Deserializes all chunks of the test stream.
+ * @param index
+ * @param num_threads
+ * @return The deserialized chunks.
+ */
+[[nodiscard]] auto deserialize_test_stream(IrStreamIndex index, size_t num_threads)
+        -> std::vector<ParallelKvIrDeserializer::Chunk>;
+
+auto write_test_stream(std::vector<nlohmann::json>& expected_user_gen_objs, size_t& stream_size)
+        -> IrStreamIndex {
+    auto serializer_result{
+            clp::ffi::ir_stream::Serializer<clp::ir::eight_byte_encoded_variable_t>::create()
+    };
+    REQUIRE_FALSE(serializer_result.has_error());
+    auto& serializer{serializer_result.value()};
+
+    clp::FileWriter file_writer;
+    file_writer.open(std::string{cTestStreamPath}, clp::FileWriter::OpenMode::CREATE_FOR_WRITING);
+    clp::streaming_compression::zstd::Compressor compressor;
+    compressor.open(file_writer);
+    auto flush_ir_buf = [&]() -> void {
+        auto const ir_buf_view{serializer.get_ir_buf_view()};
+        compressor.write(
+                clp::size_checked_pointer_cast<char const>(ir_buf_view.data()),
+                ir_buf_view.size()
+        );
+        serializer.clear_ir_buf();
+    };
+
+    msgpack::object_map const empty_map{.size = 0U, .ptr = nullptr};
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        if (0 == i % cNumLogEventsPerCheckpoint) {
+            flush_ir_buf();
+            compressor.flush();
+            serializer.add_checkpoint(file_writer.get_pos());
+        }
+
+        auto const key{"key_" + std::to_string(i % cNumKeys) + "_" + std::to_string(i / cNumKeys)};
+        auto const value{static_cast<int64_t>(i)};
+        std::array<msgpack::object_kv, 2> fields{
+                msgpack::object_kv{
+                        .key = msgpack::object{std::string_view{"idx"}},
+                        .val = msgpack::object{value}
+                },
+                msgpack::object_kv{
+                        .key = msgpack::object{std::string_view{key}},
+                        .val = msgpack::object{std::string_view{"value"}}
+                }
+        };
+        msgpack::object_map const user_gen_map{
+                .size = static_cast<uint32_t>(fields.size()),
+                .ptr = fields.data()
+        };
+        REQUIRE_FALSE(serializer.serialize_msgpack_map(empty_map, user_gen_map).has_error());
+        expected_user_gen_objs.emplace_back(nlohmann::json{{"idx", value}, {key, "value"}});
+    }
+    flush_ir_buf();
+    constexpr char cEof{clp::ffi::ir_stream::cProtocol::Eof};
+    compressor.write(&cEof, sizeof(cEof));
+    compressor.close();
+    file_writer.close();
+
+    stream_size = serializer.get_ir_stream_offset() + sizeof(cEof);
+    return serializer.get_index();
+}
+
+auto deserialize_test_stream(IrStreamIndex index, size_t num_threads)
+        -> std::vector<ParallelKvIrDeserializer::Chunk> {
+    auto deserializer{ParallelKvIrDeserializer::create(
+            std::string{cTestStreamPath},
+            std::move(index),
+            num_threads
+    )};
+    REQUIRE(deserializer.has_value());
+
+    std::vector<ParallelKvIrDeserializer::Chunk> chunks;
+    while (true) {
+        auto chunk{deserializer->get_next_chunk()};
+        if (false == chunk.has_value()) {
+            break;
+        }
+        chunks.emplace_back(std::move(chunk.value()));
+    }
+    return chunks;
+}
+}  // namespace
+
+TEST_CASE("clp-s-parallel-kv-ir-deserializer", "[clp-s][ParallelKvIrDeserializer]") {
+    TestOutputCleaner const test_cleanup{{std::string{cTestStreamPath}}};
+    auto const num_threads{GENERATE(size_t{1}, size_t{2}, size_t{5})};
+
+    std::vector<nlohmann::json> expected_user_gen_objs;
+    size_t stream_size{};
+    auto const index{write_test_stream(expected_user_gen_objs, stream_size)};
+    auto const num_checkpoints{index.get_checkpoints().size()};
+    REQUIRE((cNumLogEvents / cNumLogEventsPerCheckpoint + 1 == num_checkpoints));
+
+    SECTION("Chunks contain every log event in stream order") {
+        auto const chunks{deserialize_test_stream(index, num_threads)};
+        REQUIRE((num_checkpoints == chunks.size()));
+
+        size_t log_event_idx{0};
+        size_t last_offset{0};
+        for (auto const& chunk : chunks) {
+            REQUIRE_FALSE(chunk.error.has_value());
+            REQUIRE((chunk.log_events.size() == chunk.log_event_end_offsets.size()));
+            for (size_t i{0}; i < chunk.log_events.size(); ++i) {
+                auto const serialized_json_result{chunk.log_events[i].serialize_to_json()};
+                REQUIRE_FALSE(serialized_json_result.has_error());
+                REQUIRE((expected_user_gen_objs.at(log_event_idx)
+                         == serialized_json_result.value().second));
+                REQUIRE((chunk.log_event_end_offsets[i] > last_offset));
+                last_offset = chunk.log_event_end_offsets[i];
+                ++log_event_idx;
+            }
+        }
+        REQUIRE((cNumLogEvents == log_event_idx));
+        REQUIRE((stream_size == chunks.back().end_offset));
+    }
+
+    SECTION("Deserialization stops at the first chunk that fails") {
+        std::filesystem::resize_file(
+                cTestStreamPath,
+                index.get_checkpoints().at(num_checkpoints / 2).compressed_offset.value() / 2
+        );
+        auto const chunks{deserialize_test_stream(index, num_threads)};
+        REQUIRE_FALSE(chunks.empty());
+        REQUIRE(chunks.back().error.has_value());
+        REQUIRE((chunks.size() <= num_checkpoints / 2));
+
+        size_t log_event_idx{0};
+        for (auto const& chunk : chunks) {
+            for (auto const& log_event : chunk.log_events) {
+                auto const serialized_json_result{log_event.serialize_to_json()};
+                REQUIRE_FALSE(serialized_json_result.has_error());
+                REQUIRE((expected_user_gen_objs.at(log_event_idx)
+                         == serialized_json_result.value().second));
+                ++log_event_idx;
+            }
+        }
+    }
+}
+
+TEST_CASE("clp-s-parallel-kv-ir-deserializer-unusable-index", "[clp-s][ParallelKvIrDeserializer]") {
+    constexpr size_t cNumThreads{2};
+
+    IrStreamIndex empty_index;
+    REQUIRE_FALSE(ParallelKvIrDeserializer::create(
+                          std::string{cTestStreamPath},
+                          std::move(empty_index),
+                          cNumThreads
+    )
+                          .has_value());
+
+    // Checkpoints that don't start a zstd frame
+    IrStreamIndex index;
+    index.add_checkpoint({.ir_stream_offset = 0, .log_event_idx = 0});
+    index.add_checkpoint({.ir_stream_offset = 1, .log_event_idx = 1});
+    REQUIRE_FALSE(
+            ParallelKvIrDeserializer::create(std::string{cTestStreamPath}, std::move(index), 1)
+                    .has_value()
+    );
+}
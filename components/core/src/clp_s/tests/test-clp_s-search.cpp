@@ -1,4 +1,5 @@
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <memory>
@@ -17,6 +18,7 @@
 
 #include "../src/clp_s/archive_constants.hpp"
 #include "../src/clp_s/ArchiveReader.hpp"
+#include "../src/clp_s/filter/FilterOptions.hpp"
 #include "../src/clp_s/InputConfig.hpp"
 #include "../src/clp_s/OutputHandlerImpl.hpp"
 #include "../src/clp_s/search/ast/ColumnDescriptor.hpp"
@@ -229,7 +231,10 @@ TEST_CASE("clp-s-search", "[clp-s][search]") {
             {R"aa(ambiguous_varstring: "a*e")aa", {10, 11, 12}},
             {R"aa(ambiguous_varstring: "a\*e")aa", {12}},
             {R"aa(idx: * AND NOT idx: null AND idx: 0)aa", {0}},
-            {R"aa(one > 0.9 AND one < 1.1 AND one: 1.0)aa", {13}}
+            {R"aa(one > 0.9 AND one < 1.1 AND one: 1.0)aa", {13}},
+            {R"aa(msg: "*Abc123*" AND idx > 1 AND NOT idx: 4)aa", {2, 3, 5, 6}},
+            {R"aa(msg: "Msg 2*" OR idx: 1 OR idx: 2)aa", {1, 2}},
+            {R"aa(idx < 3 AND *: "*Abc123*")aa", {1, 2}}
     };
     auto structurize_arrays = GENERATE(true, false);
     auto single_file_archive = GENERATE(true, false);
@@ -257,6 +262,157 @@ TEST_CASE("clp-s-search", "[clp-s][search]") {
     REQUIRE_NOTHROW(search(expr, false, {0}));
 }
 
+TEST_CASE("clp-s-search-var-dict-filter", "[clp-s][search]") {
+    std::vector<std::pair<std::string, std::vector<int64_t>>> case_sensitive_queries_and_results{
+            {R"aa(var_string: a)aa", {9}},
+            {R"aa(var_string: A)aa", {}},
+            {R"aa(var_string: b)aa", {}},
+            {R"aa(var_string: "a*")aa", {9}},
+            {R"aa(ambiguous_varstring: "a\*e")aa", {12}},
+            {R"aa(ambiguous_varstring: abcde OR var_string: b)aa", {10}},
+            {R"aa(ambiguous_varstring: abcde AND var_string: b)aa", {}},
+            {R"aa(NOT var_string: b AND idx: 9)aa", {9}}
+    };
+    std::vector<std::pair<std::string, std::vector<int64_t>>> case_insensitive_queries_and_results{
+            {R"aa(var_string: A)aa", {9}},
+            {R"aa(ambiguous_varstring: ABCDE)aa", {10}}
+    };
+    auto single_file_archive = GENERATE(true, false);
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchInputFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    single_file_archive,
+                    false,
+                    std::nullopt,
+                    1,
+                    clp_s::filter::FilterType::Bloom
+            )
+    );
+
+    for (auto const& entry : std::filesystem::directory_iterator(cTestSearchArchiveDirectory)) {
+        auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
+        archive_reader->open(
+                clp_s::Path{.source{clp_s::InputSource::Filesystem}, .path{entry.path().string()}},
+                clp_s::NetworkAuthOption{}
+        );
+        REQUIRE_FALSE(archive_reader->read_metadata().has_error());
+        REQUIRE(archive_reader->read_variable_dictionary_filter().has_value());
+        archive_reader->close();
+    }
+
+    for (auto const& [query, expected_results] : case_sensitive_queries_and_results) {
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, false, expected_results));
+    }
+    for (auto const& [query, expected_results] : case_insensitive_queries_and_results) {
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, true, expected_results));
+    }
+}
+
+TEST_CASE("clp-s-search-column-scan-clp-string", "[clp-s][search]") {
+    // Filters on CLP strings are evaluated by `ColumnScan`, which decodes and matches the values of
+    // the messages it selects.
+    std::vector<std::pair<std::string, std::vector<int64_t>>> case_sensitive_queries_and_results{
+            {R"aa(clp_string: "a b")aa", {9}},
+            {R"aa(clp_string: "a*")aa", {9}},
+            {R"aa(clp_string: "*b")aa", {9}},
+            {R"aa(clp_string: "a c")aa", {}},
+            {R"aa(NOT clp_string: "x*" AND idx: 9)aa", {9}},
+            {R"aa(a: "clp*" OR clp_string: "* b")aa", {0, 9}},
+            {R"aa(msg: "Msg 1*" OR msg: "Msg 6*")aa", {1, 6}},
+            {R"aa(msg: "*abc123*")aa", {}},
+            {R"aa(idx > 2 AND msg: "*Abc123*")aa", {3, 4, 5, 6}}
+    };
+    std::vector<std::pair<std::string, std::vector<int64_t>>> case_insensitive_queries_and_results{
+            {R"aa(msg: "*abc123*")aa", {1, 2, 3, 4, 5, 6}},
+            {R"aa(clp_string: "A*")aa", {9}}
+    };
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchInputFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    false,
+                    false
+            )
+    );
+
+    for (auto const& [query, expected_results] : case_sensitive_queries_and_results) {
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, false, expected_results));
+    }
+    for (auto const& [query, expected_results] : case_insensitive_queries_and_results) {
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, true, expected_results));
+    }
+}
+
+TEST_CASE("clp-s-search-zone-maps", "[clp-s][search]") {
+    std::vector<std::pair<std::string, std::vector<int64_t>>> queries_and_results{
+            {R"aa(idx > 12)aa", {13}},
+            {R"aa(idx >= 7 AND idx <= 8)aa", {7, 8}},
+            {R"aa(NOT idx < 13)aa", {13}},
+            {R"aa(idx < 1 OR idx > 12)aa", {0, 13}},
+            {R"aa(float > 1.0 AND float < 1.2)aa", {9}},
+            {R"aa(float: 1.1)aa", {9}},
+            {R"aa(float > 1.1)aa", {}},
+            {R"aa(int: 2)aa", {}},
+            {R"aa(NOT int: 2 AND idx: 9)aa", {9}},
+            {R"aa(int <= 1 AND one >= 1)aa", {}},
+            {R"aa(one < 1 OR int >= 1)aa", {9}},
+            {R"aa(arr.b > 1000)aa", {7, 8}}
+    };
+    auto structurize_arrays = GENERATE(true, false);
+    auto single_file_archive = GENERATE(true, false);
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchInputFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    single_file_archive,
+                    structurize_arrays
+            )
+    );
+
+    // Every record has a timestamp, so every schema table has a zone map covering at least the
+    // timestamp column.
+    for (auto const& entry : std::filesystem::directory_iterator(cTestSearchArchiveDirectory)) {
+        auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
+        archive_reader->open(
+                clp_s::Path{.source{clp_s::InputSource::Filesystem}, .path{entry.path().string()}},
+                clp_s::NetworkAuthOption{}
+        );
+        REQUIRE_FALSE(archive_reader->read_metadata().has_error());
+        archive_reader->read_zone_maps();
+        for (auto const schema_id : archive_reader->get_schema_ids()) {
+            auto const* zone_map{archive_reader->get_zone_map(schema_id)};
+            REQUIRE((nullptr != zone_map));
+            REQUIRE_FALSE(zone_map->empty());
+        }
+        archive_reader->close();
+    }
+
+    for (auto const& [query, expected_results] : queries_and_results) {
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, false, expected_results));
+    }
+}
+
 TEST_CASE("clp-s-search-formatted-float", "[clp-s][search]") {
     std::vector<std::pair<std::string, std::vector<int64_t>>> queries_and_results{
             {R"aa(NOT formattedFloatValue: 0)aa", {0, 1, 2, 6, 7, 8, 9, 10, 11, 12}},
@@ -355,3 +511,32 @@ TEST_CASE("clp-s-search-epoch-timestamp", "[clp-s][search]") {
         REQUIRE_NOTHROW(search(query, false, expected_results));
     }
 }
+
+TEST_CASE("clp-s-search-synchronized-output-limit", "[clp-s][search]") {
+    constexpr uint64_t cMaxNumResults{3};
+    std::vector<clp_s::VectorOutputHandler::QueryResult> results;
+    auto const shared_handler{std::make_shared<clp_s::VectorOutputHandler>(results)};
+    auto const shared_state{std::make_shared<clp_s::SynchronizedOutputHandler::SharedState>(
+            shared_handler,
+            cMaxNumResults
+    )};
+    clp_s::SynchronizedOutputHandler first_archive_handler{shared_handler, shared_state};
+    clp_s::SynchronizedOutputHandler second_archive_handler{shared_handler, shared_state};
+
+    first_archive_handler.write("a", 0, "first", 0);
+    first_archive_handler.write("b", 0, "first", 1);
+    second_archive_handler.write("c", 0, "second", 0);
+    second_archive_handler.write("d", 0, "second", 1);
+    REQUIRE(results.empty());
+
+    REQUIRE((clp_s::ErrorCode::ErrorCodeSuccess == first_archive_handler.flush()));
+    REQUIRE((2 == results.size()));
+    REQUIRE_FALSE(first_archive_handler.is_done());
+
+    REQUIRE((clp_s::ErrorCode::ErrorCodeSuccess == second_archive_handler.finish()));
+    REQUIRE((cMaxNumResults == results.size()));
+    REQUIRE(("second" == results.back().archive_id));
+    REQUIRE(shared_state->is_limit_reached());
+    REQUIRE(first_archive_handler.is_done());
+    REQUIRE(second_archive_handler.is_done());
+}
@@ -9,6 +9,8 @@
 
 #include <boost/filesystem.hpp>
 
+#include "../clp/RuntimeMetrics.hpp"
+
 using std::string;
 
 namespace glt {
@@ -25,7 +27,9 @@ ErrorCode FileReader::try_read(char* buf, size_t num_bytes_to_read, size_t& num_
         return ErrorCode_BadParam;
     }
 
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::IoWait};
     num_bytes_read = fread(buf, sizeof(*buf), num_bytes_to_read, m_file);
+    timer.add_bytes(num_bytes_read);
     if (num_bytes_read < num_bytes_to_read) {
         if (ferror(m_file)) {
             return ErrorCode_errno;
@@ -6,6 +6,7 @@
 #include <cassert>
 #include <cerrno>
 
+#include "../clp/RuntimeMetrics.hpp"
 #include "Defs.h"
 #include "Platform.hpp"
 #include "spdlog_with_specializations.hpp"
@@ -31,7 +32,9 @@ void FileWriter::write(char const* data, size_t data_length) {
     } else if (nullptr == data) {
         error_code = ErrorCode_BadParam;
     } else {
+        clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::IoWait};
         size_t num_bytes_written = fwrite(data, sizeof(*data), data_length, m_file);
+        timer.add_bytes(num_bytes_written);
         if (num_bytes_written < data_length) {
             error_code = ErrorCode_errno;
         }
@@ -6,14 +6,17 @@
 
 #include <date/date.h>
 
+#include "../clp/TimestampPrefixMatcher.hpp"
 #include "spdlog_with_specializations.hpp"
 
+using clp::TimestampPrefixMatcher;
 using std::string;
 using std::to_string;
 using std::vector;
 
 // Static member default initialization
 std::unique_ptr<glt::TimestampPattern[]> glt::TimestampPattern::m_known_ts_patterns = nullptr;
+std::unique_ptr<std::string[]> glt::TimestampPattern::m_known_ts_pattern_prefix_shapes = nullptr;
 size_t glt::TimestampPattern::m_known_ts_patterns_len = 0;
 
 namespace {
@@ -194,8 +197,11 @@ void TimestampPattern::init() {
     // Initialize m_known_ts_patterns with vector's contents
     m_known_ts_patterns_len = patterns.size();
     m_known_ts_patterns = std::make_unique<TimestampPattern[]>(m_known_ts_patterns_len);
+    m_known_ts_pattern_prefix_shapes = std::make_unique<string[]>(m_known_ts_patterns_len);
     for (size_t i = 0; i < patterns.size(); ++i) {
         m_known_ts_patterns[i] = patterns[i];
+        m_known_ts_pattern_prefix_shapes[i]
+                = TimestampPrefixMatcher::get_prefix_shape(patterns[i].m_format);
     }
 }
 
@@ -205,11 +211,19 @@ TimestampPattern const* TimestampPattern::search_known_ts_patterns(
         size_t& timestamp_begin_pos,
         size_t& timestamp_end_pos
 ) {
+    TimestampPrefixMatcher prefix_matcher{line};
     for (size_t i = 0; i < m_known_ts_patterns_len; ++i) {
-        if (m_known_ts_patterns[i]
-                    .parse_timestamp(line, timestamp, timestamp_begin_pos, timestamp_end_pos))
+        auto const& pattern = m_known_ts_patterns[i];
+        if (false
+            == prefix_matcher.matches(
+                    pattern.m_num_spaces_before_ts,
+                    m_known_ts_pattern_prefix_shapes[i]
+            ))
         {
-            return &m_known_ts_patterns[i];
+            continue;
+        }
+        if (pattern.parse_timestamp(line, timestamp, timestamp_begin_pos, timestamp_end_pos)) {
+            return &pattern;
         }
     }
 
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "Defs.h"
 #include "FileWriter.hpp"
@@ -74,7 +75,9 @@ public:
 
     /**
      * Searches for a known timestamp pattern which can parse the timestamp from the given line, and
-     * if found, parses the timestamp
+     * if found, parses the timestamp. Patterns are tried in order, but a pattern is only parsed if
+     * the line has the shape (the fixed characters and the digit/letter positions) its timestamps
+     * must start with.
      * @param line
      * @param timestamp Parsed timestamp
      * @param timestamp_begin_pos
@@ -150,6 +153,9 @@ public:
 private:
     // Variables
     static std::unique_ptr<TimestampPattern[]> m_known_ts_patterns;
+    // The prefix shape of each known pattern, used to skip patterns that can't match a line
+    // without parsing it
+    static std::unique_ptr<std::string[]> m_known_ts_pattern_prefix_shapes;
     static size_t m_known_ts_patterns_len;
 
     // The number of spaces before the timestamp in a message
@@ -1,10 +1,13 @@
 #include "VariableDictionaryWriter.hpp"
 
+#include "../clp/RuntimeMetrics.hpp"
 #include "dictionary_utils.hpp"
 #include "spdlog_with_specializations.hpp"
 
 namespace glt {
 bool VariableDictionaryWriter::add_entry(std::string const& value, variable_dictionary_id_t& id) {
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::DictionaryInsert};
+    timer.add_bytes(value.size());
     bool new_entry = false;
 
     auto const ix = m_value_to_id.find(value);
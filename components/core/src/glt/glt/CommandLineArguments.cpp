@@ -43,6 +43,7 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
     }
     config_file_path += cDefaultConfigFilename;
     string global_metadata_db_config_file_path;
+    string metrics_format_input{"json"};
     options_general.add_options()
             ("help,h", "Print help")
             ("version,V", "Print version")
@@ -59,6 +60,18 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                             ->value_name("FILE")
                             ->default_value(global_metadata_db_config_file_path),
                     "Global metadata DB YAML config"
+            )
+            (
+                    "metrics-file",
+                    po::value<string>(&m_metrics_file_path)->value_name("FILE"),
+                    "Write runtime metrics (per-stage timings) to FILE when the command ends"
+            )
+            (
+                    "metrics-format",
+                    po::value<string>(&metrics_format_input)
+                            ->value_name("FORMAT")
+                            ->default_value(metrics_format_input),
+                    "Format of the runtime metrics (json | prometheus)"
             );
 
     po::options_description general_positional_options;
@@ -121,6 +134,12 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             }
         }
 
+        auto const metrics_format{clp::RuntimeMetrics::parse_output_format(metrics_format_input)};
+        if (false == metrics_format.has_value()) {
+            throw invalid_argument("Unknown --metrics-format specified.");
+        }
+        m_metrics_format = metrics_format.value();
+
         // Validate command
         if (parsed_command_line_options.count("command") == 0) {
             // Handle --help
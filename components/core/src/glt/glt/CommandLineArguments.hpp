@@ -6,6 +6,7 @@
 
 #include <boost/asio.hpp>
 
+#include "../../clp/RuntimeMetrics.hpp"
 #include "../CommandLineArgumentsBase.hpp"
 #include "../Defs.h"
 #include "../GlobalMetadataDBConfig.hpp"
@@ -91,6 +92,10 @@ public:
 
     epochtime_t get_search_end_ts() const { return m_search_end_ts; }
 
+    std::string const& get_metrics_file_path() const { return m_metrics_file_path; }
+
+    clp::RuntimeMetrics::OutputFormat get_metrics_format() const { return m_metrics_format; }
+
 private:
     // Methods
     void print_basic_usage() const override;
@@ -121,6 +126,8 @@ private:
     std::string m_file_path;
     OutputMethod m_output_method;
     epochtime_t m_search_begin_ts, m_search_end_ts;
+    std::string m_metrics_file_path;
+    clp::RuntimeMetrics::OutputFormat m_metrics_format{clp::RuntimeMetrics::OutputFormat::Json};
 };
 }  // namespace glt::glt
 
@@ -8,6 +8,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem/path.hpp>
 
+#include "../../clp/RuntimeMetrics.hpp"
 #include "../ffi/ir_stream/decoding_methods.hpp"
 #include "../ir/types.hpp"
 #include "../ir/utils.hpp"
@@ -112,6 +113,7 @@ bool FileCompressor::compress_file(
 
     PROFILER_SPDLOG_INFO("Start parsing {}", file_name)
     Profiler::start_continuous_measurement<Profiler::ContinuousMeasurementIndex::ParseLogFile>();
+    clp::RuntimeMetrics::ScopedTimer const parse_timer{clp::RuntimeMetrics::Stage::Parse};
 
     m_file_reader.open(file_to_compress.get_path());
 
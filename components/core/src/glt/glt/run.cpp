@@ -1,9 +1,11 @@
 #include "run.hpp"
 
+#include <optional>
 #include <unordered_set>
 
 #include <spdlog/sinks/stdout_sinks.h>
 
+#include "../../clp/RuntimeMetrics.hpp"
 #include "../Profiler.hpp"
 #include "../spdlog_with_specializations.hpp"
 #include "../Utils.hpp"
@@ -55,6 +57,14 @@ int run(int argc, char const* argv[]) {
             break;
     }
 
+    std::optional<clp::RuntimeMetrics::FileExporter> metrics_exporter;
+    if (false == command_line_args.get_metrics_file_path().empty()) {
+        metrics_exporter.emplace(
+                command_line_args.get_metrics_file_path(),
+                command_line_args.get_metrics_format()
+        );
+    }
+
     Profiler::start_continuous_measurement<Profiler::ContinuousMeasurementIndex::Execution>();
 
     if (CommandLineArguments::Command::Compress == command_line_args.get_command()) {
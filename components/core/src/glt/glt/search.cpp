@@ -8,6 +8,7 @@
 
 #include <spdlog/sinks/stdout_sinks.h>
 
+#include "../../clp/RuntimeMetrics.hpp"
 #include "../GlobalMySQLMetadataDB.hpp"
 #include "../GlobalSQLiteMetadataDB.hpp"
 #include "../Grep.hpp"
@@ -25,6 +26,7 @@ using glt::Grep;
 using glt::LogtypeQueries;
 using glt::Profiler;
 using glt::Query;
+using clp::RuntimeMetrics;
 using glt::segment_id_t;
 using glt::streaming_archive::MetadataDB;
 using glt::streaming_archive::reader::Archive;
@@ -337,6 +339,7 @@ static size_t search_segments(
         Archive& archive,
         size_t segment_id
 ) {
+    RuntimeMetrics::ScopedTimer const filter_timer{RuntimeMetrics::Stage::Filter};
     size_t num_matches = 0;
 
     // Setup output method
@@ -1,7 +1,5 @@
 #include "parsing.hpp"
 
-#include <string_utils/string_utils.hpp>
-
 #include "../type_utils.hpp"
 #include "types.hpp"
 
@@ -36,59 +34,6 @@ bool is_var(std::string_view value) {
     }
 }
 
-bool get_bounds_of_next_var(string_view const str, size_t& begin_pos, size_t& end_pos) {
-    auto const msg_length = str.length();
-    if (msg_length <= end_pos) {
-        return false;
-    }
-
-    while (true) {
-        begin_pos = end_pos;
-
-        // Find next non-delimiter
-        for (; begin_pos < msg_length; ++begin_pos) {
-            auto c = str[begin_pos];
-            if (false == is_delim(c)) {
-                break;
-            }
-        }
-        if (msg_length == begin_pos) {
-            // Early exit for performance
-            return false;
-        }
-
-        bool contains_decimal_digit = false;
-        bool contains_alphabet = false;
-
-        // Find next delimiter
-        end_pos = begin_pos;
-        for (; end_pos < msg_length; ++end_pos) {
-            auto c = str[end_pos];
-            if (clp::string_utils::is_decimal_digit(c)) {
-                contains_decimal_digit = true;
-            } else if (clp::string_utils::is_alphabet(c)) {
-                contains_alphabet = true;
-            } else if (is_delim(c)) {
-                break;
-            }
-        }
-
-        auto variable = str.substr(begin_pos, end_pos - begin_pos);
-        // Treat token as variable if:
-        // - it contains a decimal digit, or
-        // - it's directly preceded by '=' and contains an alphabet char, or
-        // - it could be a multi-digit hex value
-        if (contains_decimal_digit
-            || (0 < begin_pos && '=' == str[begin_pos - 1] && contains_alphabet)
-            || could_be_multi_digit_hex_value(variable))
-        {
-            break;
-        }
-    }
-
-    return (msg_length != begin_pos);
-}
-
 void escape_and_append_const_to_logtype(string_view constant, string& logtype) {
     // clang-format off
     auto escape_handler = [&](
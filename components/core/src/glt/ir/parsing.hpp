@@ -12,6 +12,8 @@
 #include <string_view>
 #include <vector>
 
+#include "../../clp/ir/parsing.hpp"
+
 namespace glt::ir {
 /**
  * Checks if the given character is a delimiter
@@ -54,18 +56,8 @@ inline bool could_be_multi_digit_hex_value(std::string_view str) {
  */
 bool is_var(std::string_view value);
 
-/**
- * Gets the bounds of the next variable in the given string
- * A variable is a token (word between two delimiters) that matches one of these schemas:
- * - ".*[0-9].*"
- * - "=(.*[a-zA-Z].*)" (the variable is within the capturing group)
- * - "[a-fA-F0-9]{2,}"
- * @param str String to search within
- * @param begin_pos Begin position of last variable, changes to begin position of next variable
- * @param end_pos End position of last variable, changes to end position of next variable
- * @return true if a variable was found, false otherwise
- */
-bool get_bounds_of_next_var(std::string_view str, size_t& begin_pos, size_t& end_pos);
+// glt tokenizes messages the same way as clp, so it shares clp's implementation
+using clp::ir::get_bounds_of_next_var;
 
 /**
  * Appends a constant to the logtype, escaping any variable placeholders.
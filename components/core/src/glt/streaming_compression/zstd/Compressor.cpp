@@ -1,5 +1,6 @@
 #include "Compressor.hpp"
 
+#include "../../../clp/RuntimeMetrics.hpp"
 #include "../../Defs.h"
 #include "../../spdlog_with_specializations.hpp"
 
@@ -67,6 +68,8 @@ void Compressor::write(char const* data, size_t data_length) {
         throw OperationFailed(ErrorCode_BadParam, __FILENAME__, __LINE__);
     }
 
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::Compress};
+    timer.add_bytes(data_length);
     ZSTD_inBuffer uncompressed_stream_block = {data, data_length, 0};
     while (uncompressed_stream_block.pos < uncompressed_stream_block.size) {
         m_compressed_stream_block.pos = 0;
@@ -101,6 +104,7 @@ void Compressor::flush() {
         return;
     }
 
+    clp::RuntimeMetrics::ScopedTimer const timer{clp::RuntimeMetrics::Stage::Compress};
     m_compressed_stream_block.pos = 0;
     auto end_stream_result = ZSTD_endStream(m_compression_stream, &m_compressed_stream_block);
     if (end_stream_result) {
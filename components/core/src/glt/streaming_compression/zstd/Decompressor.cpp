@@ -4,6 +4,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include "../../../clp/RuntimeMetrics.hpp"
 #include "../../Defs.h"
 #include "../../spdlog_with_specializations.hpp"
 
@@ -44,6 +45,7 @@ ErrorCode Decompressor::try_read(char* buf, size_t num_bytes_to_read, size_t& nu
 
     num_bytes_read = 0;
 
+    clp::RuntimeMetrics::ScopedTimer timer{clp::RuntimeMetrics::Stage::Decompress};
     ZSTD_outBuffer decompressed_stream_block = {buf, num_bytes_to_read, 0};
     while (decompressed_stream_block.pos < num_bytes_to_read) {
         // Check if there's data that can be decompressed
@@ -107,6 +109,7 @@ ErrorCode Decompressor::try_read(char* buf, size_t num_bytes_to_read, size_t& nu
     m_decompressed_stream_pos += decompressed_stream_block.pos;
 
     num_bytes_read = decompressed_stream_block.pos;
+    timer.add_bytes(num_bytes_read);
     return ErrorCode_Success;
 }
 
@@ -0,0 +1,369 @@
+#include "BinaryRecordGroup.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+
+namespace reducer {
+namespace {
+constexpr size_t cHeaderSize{sizeof(uint8_t) * 2 + sizeof(uint16_t) + sizeof(uint32_t) * 4};
+constexpr size_t cStringRefSize{sizeof(uint64_t)};
+constexpr size_t cColumnDescriptorSize{cStringRefSize + sizeof(uint32_t) * 2};
+constexpr size_t cValueSize{sizeof(uint64_t)};
+
+/**
+ * A column of a record group that's being serialized.
+ */
+struct ColumnBuilder {
+    std::string key;
+    ValueType type;
+    std::vector<uint64_t> values;
+    std::vector<uint8_t> presence_bitmap;
+};
+
+/**
+ * @tparam T
+ * @param buf
+ * @return The value of type `T` stored at `buf`, which doesn't need to be aligned.
+ */
+template <typename T>
+[[nodiscard]] auto load(char const* buf) -> T;
+
+/**
+ * Appends a value to `buf` in host byte order.
+ * @tparam T
+ * @param value
+ * @param buf
+ */
+template <typename T>
+void append(T value, std::vector<uint8_t>& buf);
+
+/**
+ * @param num_records
+ * @return The size of a presence bitmap for the given number of records.
+ */
+[[nodiscard]] constexpr auto get_bitmap_size(size_t num_records) -> size_t {
+    return (num_records + 7) / 8;
+}
+
+/**
+ * Appends a string to the string heap.
+ * @param str
+ * @param string_heap
+ * @return A reference to the string in the heap.
+ * @throw BinaryRecordGroup::OperationFailed if the heap would grow too large to be referenced.
+ */
+[[nodiscard]] auto add_string(std::string_view str, std::string& string_heap) -> uint64_t;
+
+template <typename T>
+auto load(char const* buf) -> T {
+    T value{};
+    std::memcpy(&value, buf, sizeof(value));
+    return value;
+}
+
+template <typename T>
+void append(T value, std::vector<uint8_t>& buf) {
+    auto const size{buf.size()};
+    buf.resize(size + sizeof(value));
+    std::memcpy(&buf[size], &value, sizeof(value));
+}
+
+auto add_string(std::string_view str, std::string& string_heap) -> uint64_t {
+    auto const offset{string_heap.size()};
+    if (str.size() > std::numeric_limits<uint32_t>::max() - offset) {
+        throw BinaryRecordGroup::OperationFailed(
+                clp::ErrorCode_OutOfBounds,
+                __FILENAME__,
+                __LINE__
+        );
+    }
+    string_heap.append(str);
+    return (static_cast<uint64_t>(str.size()) << 32) | offset;
+}
+}  // namespace
+
+/**
+ * A RecordTypedKeyIterator over the columns in which a record has a value.
+ */
+class BinaryRecordGroup::TypedKeyIterator : public RecordTypedKeyIterator {
+public:
+    TypedKeyIterator(std::vector<Column> const& columns, size_t record_idx)
+            : m_columns{&columns},
+              m_record_idx{record_idx} {
+        skip_absent_columns();
+    }
+
+    TypedRecordKey get() override {
+        auto const& column{(*m_columns)[m_column_idx]};
+        return {column.key, column.type};
+    }
+
+    void next() override {
+        ++m_column_idx;
+        skip_absent_columns();
+    }
+
+    bool done() override { return m_column_idx >= m_columns->size(); }
+
+private:
+    void skip_absent_columns() {
+        while (m_column_idx < m_columns->size()
+               && false == has_value((*m_columns)[m_column_idx], m_record_idx))
+        {
+            ++m_column_idx;
+        }
+    }
+
+    std::vector<Column> const* m_columns;
+    size_t m_record_idx;
+    size_t m_column_idx{0};
+};
+
+BinaryRecordGroup::BinaryRecordGroup(char const* buf, size_t len) : m_record_it{*this} {
+    if (len < cHeaderSize || cMagic != static_cast<uint8_t>(buf[0])
+        || cVersion != static_cast<uint8_t>(buf[1]))
+    {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    size_t offset{sizeof(uint8_t) * 2 + sizeof(uint16_t)};
+    auto const num_tags{load<uint32_t>(buf + offset)};
+    offset += sizeof(uint32_t);
+    auto const num_columns{load<uint32_t>(buf + offset)};
+    offset += sizeof(uint32_t);
+    auto const num_records{load<uint32_t>(buf + offset)};
+    offset += sizeof(uint32_t);
+    auto const string_heap_size{load<uint32_t>(buf + offset)};
+    offset += sizeof(uint32_t);
+
+    // Every count is at most 32 bits, so only the size of the per-column sections can overflow
+    auto const column_data_size{
+            size_t{num_records} * cValueSize + get_bitmap_size(num_records)
+    };
+    auto const remaining_size{len - cHeaderSize};
+    if (0 != num_columns && column_data_size > remaining_size / num_columns) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    auto const tags_offset{offset};
+    auto const columns_offset{tags_offset + size_t{num_tags} * cStringRefSize};
+    auto const values_offset{columns_offset + size_t{num_columns} * cColumnDescriptorSize};
+    auto const bitmaps_offset{values_offset + size_t{num_columns} * num_records * cValueSize};
+    auto const string_heap_offset{
+            bitmaps_offset + size_t{num_columns} * get_bitmap_size(num_records)
+    };
+    if (string_heap_offset + string_heap_size != len) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    m_string_heap = std::string_view{buf + string_heap_offset, string_heap_size};
+    m_num_records = num_records;
+
+    m_tags.reserve(num_tags);
+    for (size_t i{0}; i < num_tags; ++i) {
+        auto const tag_ref{load<uint64_t>(buf + tags_offset + i * cStringRefSize)};
+        if (false == is_valid_string_ref(tag_ref)) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        m_tags.emplace_back(get_string(tag_ref));
+    }
+
+    m_columns.reserve(num_columns);
+    for (size_t i{0}; i < num_columns; ++i) {
+        auto const* descriptor{buf + columns_offset + i * cColumnDescriptorSize};
+        auto const key_ref{load<uint64_t>(descriptor)};
+        auto const type{load<uint32_t>(descriptor + cStringRefSize)};
+        if (false == is_valid_string_ref(key_ref)
+            || type > static_cast<uint32_t>(ValueType::Double))
+        {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        auto const& column{m_columns.emplace_back(
+                get_string(key_ref),
+                static_cast<ValueType>(type),
+                buf + values_offset + i * num_records * cValueSize,
+                buf + bitmaps_offset + i * get_bitmap_size(num_records)
+        )};
+
+        // Validate string references up front so that they can be read without checks
+        if (ValueType::String != column.type) {
+            continue;
+        }
+        for (size_t record_idx{0}; record_idx < num_records; ++record_idx) {
+            if (false == is_valid_string_ref(get_raw_value(column, record_idx))) {
+                throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+            }
+        }
+    }
+}
+
+auto BinaryRecordGroup::has_value(Column const& column, size_t record_idx) -> bool {
+    auto const bitmap_byte{static_cast<uint8_t>(column.presence_bitmap[record_idx / 8])};
+    return 0 != (bitmap_byte & (1U << (record_idx % 8)));
+}
+
+auto BinaryRecordGroup::get_raw_value(Column const& column, size_t record_idx) -> uint64_t {
+    return load<uint64_t>(column.values + record_idx * cValueSize);
+}
+
+auto BinaryRecordGroup::get_string(uint64_t string_ref) const -> std::string_view {
+    return m_string_heap.substr(
+            string_ref & std::numeric_limits<uint32_t>::max(),
+            string_ref >> 32
+    );
+}
+
+auto BinaryRecordGroup::is_valid_string_ref(uint64_t string_ref) const -> bool {
+    auto const offset{string_ref & std::numeric_limits<uint32_t>::max()};
+    auto const length{string_ref >> 32};
+    return offset + length <= m_string_heap.size();
+}
+
+std::string_view BinaryRecordGroup::BinaryRecord::get_string_view(std::string_view key) const {
+    auto const* column{find_column(key, ValueType::String)};
+    if (nullptr == column) {
+        return {};
+    }
+    return m_group->get_string(get_raw_value(*column, m_record_idx));
+}
+
+int64_t BinaryRecordGroup::BinaryRecord::get_int64_value(std::string_view key) const {
+    if (auto const* column{find_column(key, ValueType::Int64)}; nullptr != column) {
+        return std::bit_cast<int64_t>(get_raw_value(*column, m_record_idx));
+    }
+    // Like the msgpack format, allow numbers to be read as either numeric type
+    if (auto const* column{find_column(key, ValueType::Double)}; nullptr != column) {
+        return static_cast<int64_t>(std::bit_cast<double>(get_raw_value(*column, m_record_idx)));
+    }
+    return 0;
+}
+
+double BinaryRecordGroup::BinaryRecord::get_double_value(std::string_view key) const {
+    if (auto const* column{find_column(key, ValueType::Double)}; nullptr != column) {
+        return std::bit_cast<double>(get_raw_value(*column, m_record_idx));
+    }
+    if (auto const* column{find_column(key, ValueType::Int64)}; nullptr != column) {
+        return static_cast<double>(std::bit_cast<int64_t>(get_raw_value(*column, m_record_idx)));
+    }
+    return 0.0;
+}
+
+std::unique_ptr<RecordTypedKeyIterator> BinaryRecordGroup::BinaryRecord::typed_key_iter() const {
+    return std::make_unique<TypedKeyIterator>(m_group->m_columns, m_record_idx);
+}
+
+auto BinaryRecordGroup::BinaryRecord::find_column(std::string_view key, ValueType type) const
+        -> Column const* {
+    for (auto const& column : m_group->m_columns) {
+        if (type == column.type && key == column.key && has_value(column, m_record_idx)) {
+            return &column;
+        }
+    }
+    return nullptr;
+}
+
+auto serialize_binary(GroupTags const& tags, ConstRecordIterator& record_it)
+        -> std::vector<uint8_t> {
+    std::string string_heap;
+    std::vector<uint64_t> tag_refs;
+    tag_refs.reserve(tags.size());
+    for (auto const& tag : tags) {
+        tag_refs.emplace_back(add_string(tag, string_heap));
+    }
+
+    std::vector<ColumnBuilder> columns;
+    std::vector<uint64_t> key_refs;
+    size_t num_records{0};
+    for (; false == record_it.done(); record_it.next(), ++num_records) {
+        auto const& record = record_it.get();
+        for (auto typed_key_it = record.typed_key_iter(); false == typed_key_it->done();
+             typed_key_it->next())
+        {
+            auto const typed_key{typed_key_it->get()};
+            auto const key{typed_key.get_key()};
+            auto const type{typed_key.get_type()};
+            auto column_it{std::ranges::find_if(columns, [&](ColumnBuilder const& column) {
+                return type == column.type && key == column.key;
+            })};
+            if (columns.end() == column_it) {
+                key_refs.emplace_back(add_string(key, string_heap));
+                column_it = columns.insert(
+                        columns.end(),
+                        ColumnBuilder{std::string{key}, type, {}, {}}
+                );
+            }
+
+            auto& column{*column_it};
+            column.values.resize(num_records + 1, 0);
+            column.presence_bitmap.resize(get_bitmap_size(num_records + 1), 0);
+            column.presence_bitmap[num_records / 8]
+                    |= static_cast<uint8_t>(1U << (num_records % 8));
+            switch (type) {
+                case ValueType::Int64:
+                    column.values[num_records]
+                            = std::bit_cast<uint64_t>(record.get_int64_value(key));
+                    break;
+                case ValueType::Double:
+                    column.values[num_records]
+                            = std::bit_cast<uint64_t>(record.get_double_value(key));
+                    break;
+                case ValueType::String:
+                    column.values[num_records]
+                            = add_string(record.get_string_view(key), string_heap);
+                    break;
+            }
+        }
+    }
+    if (tags.size() > std::numeric_limits<uint32_t>::max()
+        || columns.size() > std::numeric_limits<uint32_t>::max()
+        || num_records > std::numeric_limits<uint32_t>::max())
+    {
+        throw BinaryRecordGroup::OperationFailed(
+                clp::ErrorCode_OutOfBounds,
+                __FILENAME__,
+                __LINE__
+        );
+    }
+
+    std::vector<uint8_t> buf;
+    buf.reserve(
+            cHeaderSize + tags.size() * cStringRefSize + columns.size() * cColumnDescriptorSize
+            + columns.size() * (num_records * cValueSize + get_bitmap_size(num_records))
+            + string_heap.size()
+    );
+    append(BinaryRecordGroup::cMagic, buf);
+    append(BinaryRecordGroup::cVersion, buf);
+    append(uint16_t{0}, buf);
+    append(static_cast<uint32_t>(tags.size()), buf);
+    append(static_cast<uint32_t>(columns.size()), buf);
+    append(static_cast<uint32_t>(num_records), buf);
+    append(static_cast<uint32_t>(string_heap.size()), buf);
+    for (auto const tag_ref : tag_refs) {
+        append(tag_ref, buf);
+    }
+    for (size_t i{0}; i < columns.size(); ++i) {
+        append(key_refs[i], buf);
+        append(static_cast<uint32_t>(columns[i].type), buf);
+        append(uint32_t{0}, buf);
+    }
+    for (auto& column : columns) {
+        column.values.resize(num_records, 0);
+        for (auto const value : column.values) {
+            append(value, buf);
+        }
+    }
+    for (auto& column : columns) {
+        column.presence_bitmap.resize(get_bitmap_size(num_records), 0);
+        buf.insert(buf.end(), column.presence_bitmap.cbegin(), column.presence_bitmap.cend());
+    }
+    buf.insert(buf.end(), string_heap.cbegin(), string_heap.cend());
+    return buf;
+}
+}  // namespace reducer
@@ -0,0 +1,219 @@
+#ifndef REDUCER_BINARYRECORDGROUP_HPP
+#define REDUCER_BINARYRECORDGROUP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+#include "ConstRecordIterator.hpp"
+#include "GroupTags.hpp"
+#include "Record.hpp"
+#include "RecordGroup.hpp"
+#include "RecordTypedKeyIterator.hpp"
+
+namespace reducer {
+/**
+ * The formats in which record groups can be serialized for sending to the reducer.
+ */
+enum class RecordGroupFormat : uint8_t {
+    // The format written by `serialize_binary` and read by `BinaryRecordGroup`
+    Binary,
+    // The msgpack format written by `serialize` and read by `DeserializedRecordGroup`, for
+    // compatibility with older senders
+    Msgpack
+};
+
+/**
+ * Class which exposes a record group serialized by `serialize_binary` directly from the serialized
+ * buffer, without copying or parsing the records. The buffer must outlive this object.
+ *
+ * The serialized group stores each distinct (key, value type) pair of its records as a column, so
+ * that the values of a column are stored contiguously and strings are stored as offsets into a
+ * single string heap. All integers are stored in host byte order since the reducer protocol already
+ * assumes senders and the reducer share a byte order. The layout is:
+ * - Header: u8 magic, u8 version, u16 reserved, u32 num_tags, u32 num_columns, u32 num_records,
+ *   u32 string_heap_size.
+ * - Tags: A string reference for each tag.
+ * - Column descriptors: A string reference for the key, then a u32 value type and u32 reserved.
+ * - Values: For each column, an 8-byte value per record: an int64, a double, or a string reference.
+ * - Presence bitmaps: For each column, a bit per record indicating whether the record has a value
+ *   in the column.
+ * - String heap.
+ *
+ * A string reference is a u64 containing the string's offset in the heap in its low 32 bits and its
+ * length in its high 32 bits.
+ */
+class BinaryRecordGroup : public RecordGroup {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::BinaryRecordGroup operation failed";
+        }
+    };
+
+    // Constants
+    // Never used as the first byte of a msgpack value, so the formats can be told apart
+    static constexpr uint8_t cMagic{0xc1};
+    static constexpr uint8_t cVersion{1};
+
+    // Constructors
+    /**
+     * @param buf
+     * @param len
+     * @throw OperationFailed if the buffer isn't a valid serialized record group.
+     */
+    BinaryRecordGroup(char const* buf, size_t len);
+
+    /**
+     * @param serialized_data
+     * @throw OperationFailed if the buffer isn't a valid serialized record group.
+     */
+    explicit BinaryRecordGroup(std::vector<uint8_t> const& serialized_data)
+            : BinaryRecordGroup{
+                      reinterpret_cast<char const*>(serialized_data.data()),
+                      serialized_data.size()
+              } {}
+
+    // Disable copy and move construction/assignment since the record iterator references this
+    // object
+    BinaryRecordGroup(BinaryRecordGroup const&) = delete;
+    BinaryRecordGroup(BinaryRecordGroup&&) = delete;
+    auto operator=(BinaryRecordGroup const&) -> BinaryRecordGroup& = delete;
+    auto operator=(BinaryRecordGroup&&) -> BinaryRecordGroup& = delete;
+
+    // Destructor
+    ~BinaryRecordGroup() override = default;
+
+    // Methods implementing RecordGroup
+    [[nodiscard]] GroupTags const& get_tags() const override { return m_tags; }
+
+    [[nodiscard]] ConstRecordIterator& record_iter() override { return m_record_it; }
+
+    /**
+     * @param buf
+     * @param len
+     * @return Whether the buffer contains a record group serialized by `serialize_binary` rather
+     * than by `serialize`.
+     */
+    [[nodiscard]] static auto is_binary_record_group(char const* buf, size_t len) -> bool {
+        return len > 0 && cMagic == static_cast<uint8_t>(buf[0]);
+    }
+
+private:
+    // Types
+    struct Column {
+        std::string_view key;
+        ValueType type;
+        char const* values;
+        char const* presence_bitmap;
+    };
+
+    /**
+     * A record in the group, identified by its index.
+     */
+    class BinaryRecord : public Record {
+    public:
+        explicit BinaryRecord(BinaryRecordGroup const& group) : m_group{&group} {}
+
+        void set_record_idx(size_t record_idx) { m_record_idx = record_idx; }
+
+        [[nodiscard]] std::string_view get_string_view(std::string_view key) const override;
+
+        [[nodiscard]] int64_t get_int64_value(std::string_view key) const override;
+
+        [[nodiscard]] double get_double_value(std::string_view key) const override;
+
+        [[nodiscard]] std::unique_ptr<RecordTypedKeyIterator> typed_key_iter() const override;
+
+    private:
+        /**
+         * @param key
+         * @param type
+         * @return The column with the given key and type if this record has a value in it, or
+         * nullptr otherwise.
+         */
+        [[nodiscard]] auto find_column(std::string_view key, ValueType type) const
+                -> Column const*;
+
+        BinaryRecordGroup const* m_group;
+        size_t m_record_idx{0};
+    };
+
+    class RecordIterator : public ConstRecordIterator {
+    public:
+        explicit RecordIterator(BinaryRecordGroup const& group)
+                : m_group{&group},
+                  m_record{group} {}
+
+        [[nodiscard]] Record const& get() const override { return m_record; }
+
+        void next() override { m_record.set_record_idx(++m_record_idx); }
+
+        bool done() override { return m_record_idx >= m_group->m_num_records; }
+
+    private:
+        BinaryRecordGroup const* m_group;
+        size_t m_record_idx{0};
+        BinaryRecord m_record;
+    };
+
+    class TypedKeyIterator;
+
+    // Methods
+    /**
+     * @param column
+     * @param record_idx
+     * @return Whether the given record has a value in the given column.
+     */
+    [[nodiscard]] static auto has_value(Column const& column, size_t record_idx) -> bool;
+
+    /**
+     * @param column
+     * @param record_idx
+     * @return The raw 8-byte value of the given record in the given column.
+     */
+    [[nodiscard]] static auto get_raw_value(Column const& column, size_t record_idx) -> uint64_t;
+
+    /**
+     * @param string_ref
+     * @return The string referenced by `string_ref`.
+     */
+    [[nodiscard]] auto get_string(uint64_t string_ref) const -> std::string_view;
+
+    /**
+     * @param string_ref
+     * @return Whether `string_ref` references a string within the string heap.
+     */
+    [[nodiscard]] auto is_valid_string_ref(uint64_t string_ref) const -> bool;
+
+    // Variables
+    std::string_view m_string_heap;
+    size_t m_num_records{0};
+    GroupTags m_tags;
+    std::vector<Column> m_columns;
+    RecordIterator m_record_it;
+};
+
+/**
+ * Serializes a record group into the format read by BinaryRecordGroup.
+ * @param tags The tags in the record group.
+ * @param record_it An iterator for the records in the record group.
+ * @return The serialized data.
+ * @throw BinaryRecordGroup::OperationFailed if the group is too large to serialize.
+ */
+[[nodiscard]] auto serialize_binary(GroupTags const& tags, ConstRecordIterator& record_it)
+        -> std::vector<uint8_t>;
+}  // namespace reducer
+
+#endif  // REDUCER_BINARYRECORDGROUP_HPP
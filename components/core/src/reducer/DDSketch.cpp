@@ -0,0 +1,217 @@
+#include "DDSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../clp/ErrorCode.hpp"
+#include "sketch_serialization.hpp"
+
+namespace reducer {
+namespace {
+/**
+ * @param value
+ * @return `value` zigzag-encoded so that small negative values have small encodings.
+ */
+[[nodiscard]] auto zigzag_encode(int32_t value) -> uint64_t;
+
+/**
+ * @param value
+ * @return The zigzag-decoded value.
+ */
+[[nodiscard]] auto zigzag_decode(uint64_t value) -> int64_t;
+
+auto zigzag_encode(int32_t value) -> uint64_t {
+    auto const wide_value{static_cast<int64_t>(value)};
+    return (static_cast<uint64_t>(wide_value) << 1) ^ static_cast<uint64_t>(wide_value >> 63);
+}
+
+auto zigzag_decode(uint64_t value) -> int64_t {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+}  // namespace
+
+DDSketch::DDSketch(double relative_accuracy, uint32_t max_num_bins)
+        : m_relative_accuracy{relative_accuracy},
+          m_gamma{(1.0 + relative_accuracy) / (1.0 - relative_accuracy)},
+          m_log_gamma{std::log(m_gamma)},
+          m_min_indexable_value{std::numeric_limits<double>::min() * m_gamma},
+          m_max_num_bins{max_num_bins} {
+    // The negated comparison also rejects NaN
+    if (false == (relative_accuracy > 0.0 && relative_accuracy < 1.0) || 0 == max_num_bins) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+}
+
+void DDSketch::add(double value) {
+    if (std::isnan(value)) {
+        return;
+    }
+
+    auto const magnitude{std::min(std::abs(value), std::numeric_limits<double>::max())};
+    if (magnitude <= m_min_indexable_value) {
+        ++m_zero_count;
+    } else if (value > 0) {
+        m_positive_bins.add(get_index(magnitude), 1, m_max_num_bins);
+    } else {
+        m_negative_bins.add(get_index(magnitude), 1, m_max_num_bins);
+    }
+    ++m_count;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+void DDSketch::merge(DDSketch const& other) {
+    if (other.m_relative_accuracy != m_relative_accuracy) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+
+    for (auto [bins, other_bins] :
+         {std::pair{&m_positive_bins, &other.m_positive_bins},
+          std::pair{&m_negative_bins, &other.m_negative_bins}})
+    {
+        for (size_t i{0}; i < other_bins->counts.size(); ++i) {
+            if (0 != other_bins->counts[i]) {
+                bins->add(
+                        other_bins->offset + static_cast<int32_t>(i),
+                        other_bins->counts[i],
+                        m_max_num_bins
+                );
+            }
+        }
+    }
+    m_zero_count += other.m_zero_count;
+    m_count += other.m_count;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+auto DDSketch::get_quantile(double quantile) const -> std::optional<double> {
+    if (0 == m_count) {
+        return std::nullopt;
+    }
+
+    auto const rank{std::clamp(quantile, 0.0, 1.0) * static_cast<double>(m_count - 1)};
+    auto const clamp_value = [&](double value) { return std::clamp(value, m_min, m_max); };
+
+    // Visit the bins in ascending order of their values: negative bins by descending magnitude,
+    // then zero, then positive bins by ascending magnitude.
+    uint64_t num_values_seen{0};
+    auto const& negative_counts{m_negative_bins.counts};
+    for (auto i{negative_counts.size()}; i > 0; --i) {
+        num_values_seen += negative_counts[i - 1];
+        if (static_cast<double>(num_values_seen) > rank) {
+            return clamp_value(
+                    -get_value(m_negative_bins.offset + static_cast<int32_t>(i - 1))
+            );
+        }
+    }
+    num_values_seen += m_zero_count;
+    if (static_cast<double>(num_values_seen) > rank) {
+        return clamp_value(0.0);
+    }
+    auto const& positive_counts{m_positive_bins.counts};
+    for (size_t i{0}; i < positive_counts.size(); ++i) {
+        num_values_seen += positive_counts[i];
+        if (static_cast<double>(num_values_seen) > rank) {
+            return clamp_value(get_value(m_positive_bins.offset + static_cast<int32_t>(i)));
+        }
+    }
+    return m_max;
+}
+
+auto DDSketch::serialize() const -> std::string {
+    std::string buf;
+    append_fixed_width(m_relative_accuracy, buf);
+    append_varint(m_max_num_bins, buf);
+    append_fixed_width(m_min, buf);
+    append_fixed_width(m_max, buf);
+    append_varint(m_zero_count, buf);
+    for (auto const* bins : {&m_positive_bins, &m_negative_bins}) {
+        append_varint(bins->counts.size(), buf);
+        append_varint(zigzag_encode(bins->offset), buf);
+        for (auto const count : bins->counts) {
+            append_varint(count, buf);
+        }
+    }
+    return buf;
+}
+
+auto DDSketch::deserialize(std::string_view buf) -> DDSketch {
+    SketchReader reader{buf};
+    auto const relative_accuracy{reader.read_fixed_width<double>()};
+    auto const max_num_bins{reader.read_varint()};
+    if (max_num_bins > std::numeric_limits<uint32_t>::max()) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    DDSketch sketch{relative_accuracy, static_cast<uint32_t>(max_num_bins)};
+    sketch.m_min = reader.read_fixed_width<double>();
+    sketch.m_max = reader.read_fixed_width<double>();
+    sketch.m_zero_count = reader.read_varint();
+    sketch.m_count = sketch.m_zero_count;
+    for (auto* bins : {&sketch.m_positive_bins, &sketch.m_negative_bins}) {
+        auto const num_bins{reader.read_varint()};
+        auto const offset{zigzag_decode(reader.read_varint())};
+        // Each bin's count takes at least one byte, so a corrupt number of bins is rejected before
+        // it's used to allocate the bins.
+        if (num_bins > max_num_bins || num_bins > reader.get_num_remaining_bytes()
+            || offset < std::numeric_limits<int32_t>::min()
+            || offset + static_cast<int64_t>(num_bins) > std::numeric_limits<int32_t>::max())
+        {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        bins->offset = static_cast<int32_t>(offset);
+        bins->counts.resize(num_bins);
+        for (auto& count : bins->counts) {
+            count = reader.read_varint();
+        }
+        sketch.m_count += std::accumulate(bins->counts.cbegin(), bins->counts.cend(), uint64_t{0});
+    }
+    if (false == reader.done()) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    return sketch;
+}
+
+void DDSketch::Bins::add(int32_t index, uint64_t count, uint32_t max_num_bins) {
+    if (counts.empty()) {
+        offset = index;
+        counts.assign(1, count);
+        return;
+    }
+
+    if (index < offset) {
+        counts.insert(counts.begin(), static_cast<size_t>(offset - index), 0);
+        offset = index;
+    } else if (auto const idx{static_cast<size_t>(index - offset)}; idx >= counts.size()) {
+        counts.resize(idx + 1, 0);
+    }
+    counts[static_cast<size_t>(index - offset)] += count;
+
+    if (counts.size() > max_num_bins) {
+        auto const num_excess_bins{static_cast<ptrdiff_t>(counts.size() - max_num_bins)};
+        auto const collapsed_count{std::accumulate(
+                counts.cbegin(),
+                counts.cbegin() + num_excess_bins,
+                uint64_t{0}
+        )};
+        counts.erase(counts.begin(), counts.begin() + num_excess_bins);
+        counts.front() += collapsed_count;
+        offset += static_cast<int32_t>(num_excess_bins);
+    }
+}
+
+auto DDSketch::get_index(double magnitude) const -> int32_t {
+    return static_cast<int32_t>(std::ceil(std::log(magnitude) / m_log_gamma));
+}
+
+auto DDSketch::get_value(int32_t index) const -> double {
+    return 2.0 * std::exp(static_cast<double>(index) * m_log_gamma) / (m_gamma + 1.0);
+}
+}  // namespace reducer
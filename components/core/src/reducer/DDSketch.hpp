@@ -0,0 +1,139 @@
+#ifndef REDUCER_DDSKETCH_HPP
+#define REDUCER_DDSKETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+
+namespace reducer {
+/**
+ * DDSketch (Masson et al., VLDB 2019) that estimates quantiles of the numeric values added to it.
+ * Each value is counted in a bin whose bounds are within the sketch's relative accuracy of each
+ * other, so every quantile estimate is within that relative accuracy of a value at the requested
+ * rank. Sketches with the same relative accuracy can be merged.
+ *
+ * To bound the sketch's size, the bins with the smallest magnitudes are collapsed together once
+ * there are more than the maximum number of them, losing accuracy only for those values.
+ */
+class DDSketch {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::DDSketch operation failed";
+        }
+    };
+
+    // Constants
+    static constexpr double cDefaultRelativeAccuracy{0.01};
+    static constexpr uint32_t cDefaultMaxNumBins{2048};
+
+    // Constructors
+    /**
+     * @param relative_accuracy
+     * @param max_num_bins The maximum number of bins for each of the positive and negative values.
+     * @throw OperationFailed if either parameter is out of range.
+     */
+    explicit DDSketch(
+            double relative_accuracy = cDefaultRelativeAccuracy,
+            uint32_t max_num_bins = cDefaultMaxNumBins
+    );
+
+    // Methods
+    /**
+     * Adds a value to the sketch. NaNs are ignored.
+     * @param value
+     */
+    void add(double value);
+
+    /**
+     * Merges another sketch into this one.
+     * @param other
+     * @throw OperationFailed if the sketches' relative accuracies differ.
+     */
+    void merge(DDSketch const& other);
+
+    [[nodiscard]] auto get_count() const -> uint64_t { return m_count; }
+
+    /**
+     * @param quantile A number in [0, 1].
+     * @return An estimate of the value at the given quantile, or std::nullopt if the sketch is
+     * empty.
+     */
+    [[nodiscard]] auto get_quantile(double quantile) const -> std::optional<double>;
+
+    /**
+     * @return The serialized sketch.
+     */
+    [[nodiscard]] auto serialize() const -> std::string;
+
+    /**
+     * @param buf
+     * @return The sketch serialized in `buf`.
+     * @throw OperationFailed or SketchReader::OperationFailed if `buf` is corrupt.
+     */
+    [[nodiscard]] static auto deserialize(std::string_view buf) -> DDSketch;
+
+private:
+    // Types
+    /**
+     * Contiguous range of bins, indexed from `offset`.
+     */
+    struct Bins {
+        /**
+         * Adds a count to the bin with the given index, then collapses the lowest bins if there
+         * are more than `max_num_bins`.
+         * @param index
+         * @param count
+         * @param max_num_bins
+         */
+        void add(int32_t index, uint64_t count, uint32_t max_num_bins);
+
+        int32_t offset{0};
+        std::vector<uint64_t> counts;
+    };
+
+    // Methods
+    /**
+     * @param magnitude A positive value larger than `m_min_indexable_value`.
+     * @return The index of the bin containing `magnitude`.
+     */
+    [[nodiscard]] auto get_index(double magnitude) const -> int32_t;
+
+    /**
+     * @param index
+     * @return The representative value of the bin with the given index, which is within the
+     * relative accuracy of every value in the bin.
+     */
+    [[nodiscard]] auto get_value(int32_t index) const -> double;
+
+    // Variables
+    double m_relative_accuracy;
+    double m_gamma;
+    double m_log_gamma;
+    double m_min_indexable_value;
+    uint32_t m_max_num_bins;
+
+    Bins m_positive_bins;
+    Bins m_negative_bins;
+    uint64_t m_zero_count{0};
+    uint64_t m_count{0};
+    double m_min{std::numeric_limits<double>::infinity()};
+    double m_max{-std::numeric_limits<double>::infinity()};
+};
+}  // namespace reducer
+
+#endif  // REDUCER_DDSKETCH_HPP
@@ -0,0 +1,158 @@
+#include "HyperLogLog.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../clp/ErrorCode.hpp"
+#include "sketch_serialization.hpp"
+
+namespace reducer {
+namespace {
+enum class RegisterFormat : uint8_t {
+    Dense = 0,
+    Sparse = 1,
+};
+
+// Every set register takes up to three bytes in the sparse format
+constexpr size_t cMaxSparseEntrySize{3};
+}  // namespace
+
+HyperLogLog::HyperLogLog(uint8_t precision) : m_precision{precision} {
+    if (precision < cMinPrecision || precision > cMaxPrecision) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+    m_registers.resize(size_t{1} << precision, 0);
+}
+
+void HyperLogLog::add(std::string_view value) {
+    auto const hashed_value{hash(value)};
+    auto const register_idx{static_cast<size_t>(hashed_value >> (64 - m_precision))};
+    // The rank is the position of the first set bit in the remaining bits, capped so that the
+    // register still fits when every remaining bit is zero.
+    auto const remaining_bits{hashed_value << m_precision};
+    auto const rank{static_cast<uint8_t>(
+            std::min(std::countl_zero(remaining_bits), 64 - m_precision) + 1
+    )};
+    auto& reg{m_registers[register_idx]};
+    reg = std::max(reg, rank);
+}
+
+void HyperLogLog::merge(HyperLogLog const& other) {
+    if (other.m_precision != m_precision) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+    for (size_t i{0}; i < m_registers.size(); ++i) {
+        m_registers[i] = std::max(m_registers[i], other.m_registers[i]);
+    }
+}
+
+auto HyperLogLog::estimate() const -> double {
+    auto const num_registers{static_cast<double>(m_registers.size())};
+    double harmonic_sum{0.0};
+    size_t num_zero_registers{0};
+    for (auto const reg : m_registers) {
+        harmonic_sum += std::ldexp(1.0, -static_cast<int>(reg));
+        if (0 == reg) {
+            ++num_zero_registers;
+        }
+    }
+
+    // Bias-correction constant for 2^4 registers and more, from Flajolet et al.
+    auto const alpha{0.7213 / (1.0 + 1.079 / num_registers)};
+    auto const raw_estimate{alpha * num_registers * num_registers / harmonic_sum};
+    // Linear counting is more accurate for small cardinalities. Since hashes are 64 bits, there's
+    // no need for a large-range correction.
+    if (raw_estimate <= 2.5 * num_registers && num_zero_registers > 0) {
+        return num_registers * std::log(num_registers / static_cast<double>(num_zero_registers));
+    }
+    return raw_estimate;
+}
+
+auto HyperLogLog::serialize() const -> std::string {
+    auto const num_set_registers{static_cast<size_t>(
+            std::ranges::count_if(m_registers, [](uint8_t reg) { return 0 != reg; })
+    )};
+
+    std::string buf;
+    if (num_set_registers * cMaxSparseEntrySize < m_registers.size()) {
+        append_fixed_width(RegisterFormat::Sparse, buf);
+        append_fixed_width(m_precision, buf);
+        append_varint(num_set_registers, buf);
+        size_t prev_idx{0};
+        for (size_t i{0}; i < m_registers.size(); ++i) {
+            if (0 == m_registers[i]) {
+                continue;
+            }
+            append_varint(i - prev_idx, buf);
+            append_fixed_width(m_registers[i], buf);
+            prev_idx = i;
+        }
+    } else {
+        append_fixed_width(RegisterFormat::Dense, buf);
+        append_fixed_width(m_precision, buf);
+        buf.append(reinterpret_cast<char const*>(m_registers.data()), m_registers.size());
+    }
+    return buf;
+}
+
+auto HyperLogLog::deserialize(std::string_view buf) -> HyperLogLog {
+    SketchReader reader{buf};
+    auto const format{reader.read_fixed_width<RegisterFormat>()};
+    HyperLogLog sketch{reader.read_fixed_width<uint8_t>()};
+    auto& registers{sketch.m_registers};
+    uint8_t const max_rank{static_cast<uint8_t>(64 - sketch.m_precision + 1)};
+
+    if (RegisterFormat::Dense == format) {
+        auto const bytes{reader.read_bytes(registers.size())};
+        std::ranges::copy(bytes, reinterpret_cast<char*>(registers.data()));
+    } else if (RegisterFormat::Sparse == format) {
+        auto const num_set_registers{reader.read_varint()};
+        if (num_set_registers > registers.size()) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        uint64_t idx{0};
+        for (uint64_t i{0}; i < num_set_registers; ++i) {
+            idx += reader.read_varint();
+            if (idx >= registers.size()) {
+                throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+            }
+            registers[idx] = reader.read_fixed_width<uint8_t>();
+        }
+    } else {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    if (false == reader.done()
+        || std::ranges::any_of(registers, [&](uint8_t reg) { return reg > max_rank; }))
+    {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    return sketch;
+}
+
+auto HyperLogLog::hash(std::string_view value) -> uint64_t {
+    // FNV-1a followed by MurmurHash3's 64-bit finalizer, which spreads FNV-1a's weak high bits
+    // across the whole hash.
+    constexpr uint64_t cFnvOffsetBasis{0xcbf2'9ce4'8422'2325};
+    constexpr uint64_t cFnvPrime{0x100'0000'01b3};
+    constexpr uint64_t cMix1{0xff51'afd7'ed55'8ccd};
+    constexpr uint64_t cMix2{0xc4ce'b9fe'1a85'ec53};
+
+    uint64_t hashed_value{cFnvOffsetBasis};
+    for (auto const c : value) {
+        hashed_value ^= static_cast<uint8_t>(c);
+        hashed_value *= cFnvPrime;
+    }
+    hashed_value ^= hashed_value >> 33;
+    hashed_value *= cMix1;
+    hashed_value ^= hashed_value >> 33;
+    hashed_value *= cMix2;
+    hashed_value ^= hashed_value >> 33;
+    return hashed_value;
+}
+}  // namespace reducer
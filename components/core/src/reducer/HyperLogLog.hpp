@@ -0,0 +1,94 @@
+#ifndef REDUCER_HYPERLOGLOG_HPP
+#define REDUCER_HYPERLOGLOG_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+
+namespace reducer {
+/**
+ * HyperLogLog sketch that estimates the number of distinct values added to it. Sketches with the
+ * same precision can be merged, giving the same estimate as a single sketch that all of their
+ * values were added to.
+ *
+ * The standard error of the estimate is about 1.04 / sqrt(2^precision), e.g., 1.6% for the default
+ * precision, and each sketch uses 2^precision bytes.
+ */
+class HyperLogLog {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::HyperLogLog operation failed";
+        }
+    };
+
+    // Constants
+    static constexpr uint8_t cMinPrecision{4};
+    static constexpr uint8_t cMaxPrecision{18};
+    static constexpr uint8_t cDefaultPrecision{12};
+
+    // Constructors
+    /**
+     * @param precision The number of hash bits used to select a register.
+     * @throw OperationFailed if the precision is out of range.
+     */
+    explicit HyperLogLog(uint8_t precision = cDefaultPrecision);
+
+    // Methods
+    /**
+     * Adds a value to the sketch.
+     * @param value
+     */
+    void add(std::string_view value);
+
+    /**
+     * Merges another sketch into this one.
+     * @param other
+     * @throw OperationFailed if the sketches' precisions differ.
+     */
+    void merge(HyperLogLog const& other);
+
+    /**
+     * @return The estimated number of distinct values added to the sketch.
+     */
+    [[nodiscard]] auto estimate() const -> double;
+
+    /**
+     * Serializes the sketch. Registers are stored sparsely if few of them are set.
+     * @return The serialized sketch.
+     */
+    [[nodiscard]] auto serialize() const -> std::string;
+
+    /**
+     * @param buf
+     * @return The sketch serialized in `buf`.
+     * @throw OperationFailed or SketchReader::OperationFailed if `buf` is corrupt.
+     */
+    [[nodiscard]] static auto deserialize(std::string_view buf) -> HyperLogLog;
+
+private:
+    // Methods
+    /**
+     * @param value
+     * @return A 64-bit hash of `value` that's stable across processes and platforms.
+     */
+    [[nodiscard]] static auto hash(std::string_view value) -> uint64_t;
+
+    // Variables
+    uint8_t m_precision;
+    std::vector<uint8_t> m_registers;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_HYPERLOGLOG_HPP
@@ -94,6 +94,34 @@ private:
     int64_t m_value{};
 };
 
+/**
+ * Record implementation which exposes a single double key-value pair.
+ *
+ * The value associated with the key can be updated allowing this class to act as an adapter for a
+ * larger set of data.
+ */
+class SingleDoubleRecordAdapter : public Record {
+public:
+    explicit SingleDoubleRecordAdapter(std::string key_name) : m_key_name{std::move(key_name)} {}
+
+    void set_record_value(double value) { m_value = value; }
+
+    [[nodiscard]] double get_double_value(std::string_view key) const override {
+        if (key == m_key_name) {
+            return m_value;
+        }
+        return 0.0;
+    }
+
+    [[nodiscard]] std::unique_ptr<RecordTypedKeyIterator> typed_key_iter() const override {
+        return std::make_unique<SingleTypedKeyIterator>(m_key_name, ValueType::Double);
+    }
+
+private:
+    std::string m_key_name;
+    double m_value{};
+};
+
 /**
  * Record implementation for an empty record.
  */
@@ -3,6 +3,7 @@
 #include <cstring>
 
 #include "../clp/spdlog_with_specializations.hpp"
+#include "BinaryRecordGroup.hpp"
 #include "DeserializedRecordGroup.hpp"
 #include "types.hpp"
 
@@ -63,8 +64,22 @@ bool RecordReceiverContext::read_record_groups_packet() {
         }
         read_head += sizeof(record_size);
 
-        auto record_group = DeserializedRecordGroup{read_head, record_size};
-        m_server_ctx->push_record_group(record_group.get_tags(), record_group.record_iter());
+        if (BinaryRecordGroup::is_binary_record_group(read_head, record_size)) {
+            try {
+                BinaryRecordGroup record_group{read_head, record_size};
+                m_server_ctx->push_record_group(
+                        record_group.get_tags(),
+                        record_group.record_iter()
+                );
+            } catch (BinaryRecordGroup::OperationFailed const& e) {
+                SPDLOG_ERROR("Failed to read record group - {}", e.what());
+                return false;
+            }
+        } else {
+            // Senders that predate the binary format send msgpack
+            auto record_group = DeserializedRecordGroup{read_head, record_size};
+            m_server_ctx->push_record_group(record_group.get_tags(), record_group.record_iter());
+        }
         m_buf_num_bytes_occupied -= (record_size + sizeof(record_size));
         read_head += record_size;
     }
@@ -72,7 +87,7 @@ bool RecordReceiverContext::read_record_groups_packet() {
     if (m_buf_num_bytes_occupied > 0) {
         if (m_buf.size() < record_size + sizeof(record_size)) {
             std::vector<char> new_buf(sizeof(record_size) + record_size);
-            std::copy(m_buf.begin(), m_buf.end(), new_buf.begin());
+            std::copy(read_head, read_head + m_buf_num_bytes_occupied, new_buf.begin());
             m_buf.swap(new_buf);
         } else {
             std::memmove(m_buf.data(), read_head, m_buf_num_bytes_occupied);
@@ -11,10 +11,14 @@
 #include <msgpack.hpp>
 #include <nlohmann/json.hpp>
 
+#include "../clp/ErrorCode.hpp"
 #include "../clp/spdlog_with_specializations.hpp"
 #include "CommandLineArguments.hpp"
 #include "CountOperator.hpp"
 #include "DeserializedRecordGroup.hpp"
+#include "SketchOperator.hpp"
+#include "StatisticsOperator.hpp"
+#include "TopKSketch.hpp"
 
 using boost::asio::ip::tcp;
 using std::vector;
@@ -47,6 +51,36 @@ vector<uint8_t> serialize_timeline_result(GroupTags const& tags, ConstRecordIter
 
     return nlohmann::json::to_bson(json);
 }
+
+/**
+ * @param query_config
+ * @return The sketch operator requested by the job's sketch type.
+ * @throw ServerContext::OperationFailed if the sketch type or top-k size is invalid.
+ */
+std::shared_ptr<SketchOperator> create_sketch_operator(nlohmann::json const& query_config);
+
+std::shared_ptr<SketchOperator> create_sketch_operator(nlohmann::json const& query_config) {
+    auto const& sketch_type_name = query_config[cJobAttributes::SketchType];
+    SketchType sketch_type{};
+    if ("count-distinct" == sketch_type_name) {
+        sketch_type = SketchType::DistinctCount;
+    } else if ("quantiles" == sketch_type_name) {
+        sketch_type = SketchType::Quantiles;
+    } else if ("top-k" == sketch_type_name) {
+        sketch_type = SketchType::TopK;
+    } else {
+        SPDLOG_ERROR("Unknown sketch type {}", sketch_type_name.dump());
+        throw ServerContext::OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+
+    uint32_t top_k{TopKSketch::cDefaultK};
+    if (query_config.count(cJobAttributes::TopKSize) > 0
+        && false == query_config[cJobAttributes::TopKSize].is_null())
+    {
+        top_k = query_config[cJobAttributes::TopKSize].get<uint32_t>();
+    }
+    return std::make_shared<SketchOperator>(sketch_type, SketchOutputMode::Estimates, top_k);
+}
 }  // namespace
 
 // TODO: We should use tcp::v6 and set ip::v6_only to false, but this isn't guaranteed to work; so
@@ -145,12 +179,22 @@ void ServerContext::set_up_pipeline(nlohmann::json const& query_config) {
 
     SPDLOG_INFO("Setting up pipeline for job {}", m_job_id);
 
-    // For now, all pipelines only perform count and optionally, group-by time and count for the
-    // timeline aggregation.
+    // For now, pipelines either compute statistics or a sketch over a field, or perform count and
+    // optionally, group-by time and count for the timeline aggregation.
     // TODO: We'll need to implement more general pipeline initialization once more operators are
     // needed.
     m_pipeline = std::make_unique<Pipeline>(PipelineInputMode::IntraStage);
-    m_pipeline->add_pipeline_stage(std::make_shared<CountOperator>());
+    if (query_config.count(cJobAttributes::StatisticsField) > 0
+        && false == query_config[cJobAttributes::StatisticsField].is_null())
+    {
+        m_pipeline->add_pipeline_stage(std::make_shared<StatisticsOperator>());
+    } else if (query_config.count(cJobAttributes::SketchType) > 0
+               && false == query_config[cJobAttributes::SketchType].is_null())
+    {
+        m_pipeline->add_pipeline_stage(create_sketch_operator(query_config));
+    } else {
+        m_pipeline->add_pipeline_stage(std::make_shared<CountOperator>());
+    }
 
     if (query_config.count(cJobAttributes::TimeBucketSize) > 0
         && false == query_config[cJobAttributes::TimeBucketSize].is_null())
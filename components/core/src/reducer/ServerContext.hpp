@@ -26,6 +26,9 @@ enum class ServerStatus : uint8_t {
 namespace cJobAttributes {
 constexpr char JobId[] = "job_id";
 constexpr char TimeBucketSize[] = "count_by_time_bucket_size";
+constexpr char StatisticsField[] = "statistics_field";
+constexpr char SketchType[] = "sketch_type";
+constexpr char TopKSize[] = "top_k_size";
 }  // namespace cJobAttributes
 
 /**
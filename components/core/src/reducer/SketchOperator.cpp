@@ -0,0 +1,173 @@
+#include "SketchOperator.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "../clp/type_utils.hpp"
+
+namespace reducer {
+namespace {
+/**
+ * A RecordTypedKeyIterator over the elements of a KeyValueRecord.
+ */
+class KeyValueTypedKeyIterator : public RecordTypedKeyIterator {
+public:
+    explicit KeyValueTypedKeyIterator(
+            std::vector<std::pair<std::string_view, KeyValueRecord::Value>> const& elements
+    )
+            : m_elements{&elements} {}
+
+    TypedRecordKey get() override {
+        auto const& [key, value] = (*m_elements)[m_idx];
+        return {key,
+                std::visit(
+                        clp::overloaded{
+                                [](std::string const&) { return ValueType::String; },
+                                [](int64_t) { return ValueType::Int64; },
+                                [](double) { return ValueType::Double; }
+                        },
+                        value
+                )};
+    }
+
+    void next() override { ++m_idx; }
+
+    bool done() override { return m_idx >= m_elements->size(); }
+
+private:
+    std::vector<std::pair<std::string_view, KeyValueRecord::Value>> const* m_elements;
+    size_t m_idx{0};
+};
+}  // namespace
+
+void SketchOperator::push_intra_stage_record_group(
+        GroupTags const& tags,
+        ConstRecordIterator& record_it
+) {
+    auto& sketch = get_sketch(tags);
+
+    for (; false == record_it.done(); record_it.next()) {
+        auto const serialized_sketch{
+                record_it.get().get_string_view(static_cast<char const*>(cSketchKey))
+        };
+        std::visit(
+                [&]<typename SketchT>(SketchT& typed_sketch) {
+                    typed_sketch.merge(SketchT::deserialize(serialized_sketch));
+                },
+                sketch
+        );
+    }
+}
+
+void SketchOperator::push_inter_stage_record_group(
+        GroupTags const& tags,
+        ConstRecordIterator& record_it
+) {
+    auto& sketch = get_sketch(tags);
+
+    for (; false == record_it.done(); record_it.next()) {
+        auto const& record = record_it.get();
+        std::visit(
+                clp::overloaded{
+                        [&](DDSketch& typed_sketch) {
+                            typed_sketch.add(
+                                    record.get_double_value(static_cast<char const*>(cValueKey))
+                            );
+                        },
+                        [&](auto& typed_sketch) {
+                            typed_sketch.add(
+                                    record.get_string_view(static_cast<char const*>(cValueKey))
+                            );
+                        }
+                },
+                sketch
+        );
+    }
+}
+
+std::unique_ptr<RecordGroupIterator> SketchOperator::get_stored_result_iterator() {
+    return std::make_unique<SketchMapRecordGroupIterator>(m_group_sketches, m_output_mode);
+}
+
+auto SketchOperator::get_sketch(GroupTags const& tags) -> Sketch& {
+    if (auto it{m_group_sketches.find(tags)}; m_group_sketches.end() != it) {
+        return it->second;
+    }
+
+    switch (m_type) {
+        case SketchType::DistinctCount:
+            return m_group_sketches.emplace(tags, HyperLogLog{}).first->second;
+        case SketchType::Quantiles:
+            return m_group_sketches.emplace(tags, DDSketch{}).first->second;
+        case SketchType::TopK:
+        default:
+            return m_group_sketches.emplace(tags, TopKSketch{m_top_k}).first->second;
+    }
+}
+
+std::unique_ptr<RecordTypedKeyIterator> KeyValueRecord::typed_key_iter() const {
+    return std::make_unique<KeyValueTypedKeyIterator>(m_elements);
+}
+
+RecordGroup& SketchMapRecordGroupIterator::get() {
+    auto const& sketch{m_map_it->second};
+    m_records.clear();
+
+    if (SketchOutputMode::Sketch == m_output_mode) {
+        auto& record{m_records.emplace_back()};
+        record.emplace(
+                SketchOperator::cSketchKey,
+                std::visit(
+                        [](auto const& typed_sketch) { return typed_sketch.serialize(); },
+                        sketch
+                )
+        );
+    } else {
+        std::visit(
+                clp::overloaded{
+                        [&](HyperLogLog const& typed_sketch) {
+                            auto& record{m_records.emplace_back()};
+                            record.emplace(
+                                    SketchOperator::cDistinctCountKey,
+                                    static_cast<int64_t>(std::llround(typed_sketch.estimate()))
+                            );
+                        },
+                        [&](DDSketch const& typed_sketch) {
+                            auto& record{m_records.emplace_back()};
+                            record.emplace(
+                                    SketchOperator::cCountKey,
+                                    static_cast<int64_t>(typed_sketch.get_count())
+                            );
+                            for (auto const& [quantile, key] : SketchOperator::cQuantiles) {
+                                record.emplace(
+                                        key,
+                                        typed_sketch.get_quantile(quantile).value_or(0.0)
+                                );
+                            }
+                        },
+                        [&](TopKSketch const& typed_sketch) {
+                            for (auto& [value, count] : typed_sketch.get_top_k()) {
+                                auto& record{m_records.emplace_back()};
+                                record.emplace(SketchOperator::cValueKey, std::move(value));
+                                record.emplace(
+                                        SketchOperator::cCountKey,
+                                        static_cast<int64_t>(count)
+                                );
+                            }
+                        }
+                },
+                sketch
+        );
+    }
+
+    m_group.reset_record_iterator();
+    return m_group;
+}
+}  // namespace reducer
@@ -0,0 +1,252 @@
+#ifndef REDUCER_SKETCHOPERATOR_HPP
+#define REDUCER_SKETCHOPERATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "ConstRecordIterator.hpp"
+#include "DDSketch.hpp"
+#include "GroupTags.hpp"
+#include "HyperLogLog.hpp"
+#include "Operator.hpp"
+#include "Record.hpp"
+#include "RecordGroup.hpp"
+#include "RecordGroupIterator.hpp"
+#include "RecordTypedKeyIterator.hpp"
+#include "TopKSketch.hpp"
+
+namespace reducer {
+/**
+ * The approximate aggregations that can be computed with mergeable sketches.
+ */
+enum class SketchType : uint8_t {
+    DistinctCount,
+    Quantiles,
+    TopK
+};
+
+/**
+ * What a SketchOperator outputs for each record group.
+ */
+enum class SketchOutputMode : uint8_t {
+    // The serialized sketch, for merging by a later stage
+    Sketch,
+    // The estimates derived from the sketch
+    Estimates
+};
+
+/**
+ * Operator that accumulates a mergeable sketch per record group, so that approximate distinct
+ * counts, quantiles, and most frequent values can be computed with bounded memory and network cost.
+ *
+ * Inter-stage records must contain the value to add to the sketch under `cValueKey`, as a string
+ * for distinct counts and top-k, or as a double for quantiles. Intra-stage records contain a
+ * serialized sketch under `cSketchKey`, as output in `SketchOutputMode::Sketch`.
+ *
+ * In `SketchOutputMode::Estimates`, each group is output as:
+ * - DistinctCount: One record containing `cDistinctCountKey`.
+ * - Quantiles: One record containing `cCountKey` and the estimate of each of `cQuantiles`.
+ * - TopK: One record per most frequent value, containing `cValueKey` and `cCountKey`, in
+ *   descending order of count.
+ */
+class SketchOperator : public Operator {
+public:
+    // Types
+    using Sketch = std::variant<HyperLogLog, DDSketch, TopKSketch>;
+
+    // Constants
+    static constexpr char cValueKey[] = "value";
+    static constexpr char cSketchKey[] = "sketch";
+    static constexpr char cCountKey[] = "count";
+    static constexpr char cDistinctCountKey[] = "distinct_count";
+    static constexpr std::array<std::pair<double, std::string_view>, 5> cQuantiles{{
+            {0.5, "p50"},
+            {0.9, "p90"},
+            {0.95, "p95"},
+            {0.99, "p99"},
+            {0.999, "p999"},
+    }};
+
+    // Constructors
+    /**
+     * @param type
+     * @param output_mode
+     * @param top_k The number of most frequent values to keep for `SketchType::TopK`.
+     */
+    SketchOperator(
+            SketchType type,
+            SketchOutputMode output_mode,
+            uint32_t top_k = TopKSketch::cDefaultK
+    )
+            : m_type{type},
+              m_output_mode{output_mode},
+              m_top_k{top_k} {}
+
+    // Methods implementing Operator
+    void
+    push_intra_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
+
+    void
+    push_inter_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
+
+    std::unique_ptr<RecordGroupIterator> get_stored_result_iterator() override;
+
+private:
+    // Methods
+    /**
+     * @param tags
+     * @return The sketch for the given group, created if it doesn't exist.
+     */
+    [[nodiscard]] auto get_sketch(GroupTags const& tags) -> Sketch&;
+
+    // Variables
+    SketchType m_type;
+    SketchOutputMode m_output_mode;
+    uint32_t m_top_k;
+    std::map<GroupTags, Sketch> m_group_sketches;
+};
+
+/**
+ * Record implementation with any number of key-value pairs, whose keys must outlive the record.
+ */
+class KeyValueRecord : public Record {
+public:
+    // Types
+    using Value = std::variant<std::string, int64_t, double>;
+
+    // Methods
+    void clear() { m_elements.clear(); }
+
+    void emplace(std::string_view key, Value value) {
+        m_elements.emplace_back(key, std::move(value));
+    }
+
+    [[nodiscard]] std::string_view get_string_view(std::string_view key) const override {
+        auto const* value{find(key)};
+        if (nullptr == value || false == std::holds_alternative<std::string>(*value)) {
+            return {};
+        }
+        return std::get<std::string>(*value);
+    }
+
+    [[nodiscard]] int64_t get_int64_value(std::string_view key) const override {
+        auto const* value{find(key)};
+        if (nullptr == value || false == std::holds_alternative<int64_t>(*value)) {
+            return 0;
+        }
+        return std::get<int64_t>(*value);
+    }
+
+    [[nodiscard]] double get_double_value(std::string_view key) const override {
+        auto const* value{find(key)};
+        if (nullptr == value || false == std::holds_alternative<double>(*value)) {
+            return 0.0;
+        }
+        return std::get<double>(*value);
+    }
+
+    [[nodiscard]] std::unique_ptr<RecordTypedKeyIterator> typed_key_iter() const override;
+
+private:
+    [[nodiscard]] auto find(std::string_view key) const -> Value const* {
+        for (auto const& [element_key, value] : m_elements) {
+            if (element_key == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<std::pair<std::string_view, Value>> m_elements;
+};
+
+/**
+ * A ConstRecordIterator over a vector of KeyValueRecords.
+ */
+class KeyValueRecordIterator : public ConstRecordIterator {
+public:
+    explicit KeyValueRecordIterator(std::vector<KeyValueRecord> const& records)
+            : m_records{&records} {}
+
+    [[nodiscard]] Record const& get() const override { return (*m_records)[m_idx]; }
+
+    void next() override { ++m_idx; }
+
+    bool done() override { return m_idx >= m_records->size(); }
+
+    void reset() { m_idx = 0; }
+
+private:
+    std::vector<KeyValueRecord> const* m_records;
+    size_t m_idx{0};
+};
+
+/**
+ * A RecordGroupIterator that exposes a map which maps GroupTags to sketches, either as serialized
+ * sketches or as the estimates derived from them.
+ */
+class SketchMapRecordGroupIterator : public RecordGroupIterator {
+public:
+    SketchMapRecordGroupIterator(
+            std::map<GroupTags, SketchOperator::Sketch> const& map,
+            SketchOutputMode output_mode
+    )
+            : m_map_it{map.cbegin()},
+              m_map_end_it{map.cend()},
+              m_output_mode{output_mode},
+              m_group{*this} {}
+
+    // Disable copy and move construction/assignment since m_group references this object
+    SketchMapRecordGroupIterator(SketchMapRecordGroupIterator const&) = delete;
+    SketchMapRecordGroupIterator(SketchMapRecordGroupIterator&&) = delete;
+    auto operator=(SketchMapRecordGroupIterator const&) -> SketchMapRecordGroupIterator& = delete;
+    auto operator=(SketchMapRecordGroupIterator&&) -> SketchMapRecordGroupIterator& = delete;
+
+    // Destructor
+    ~SketchMapRecordGroupIterator() override = default;
+
+    RecordGroup& get() override;
+
+    void next() override { ++m_map_it; }
+
+    bool done() override { return m_map_it == m_map_end_it; }
+
+private:
+    // Types
+    class Group : public RecordGroup {
+    public:
+        explicit Group(SketchMapRecordGroupIterator const& parent)
+                : m_parent{&parent},
+                  m_record_it{parent.m_records} {}
+
+        [[nodiscard]] GroupTags const& get_tags() const override {
+            return m_parent->m_map_it->first;
+        }
+
+        [[nodiscard]] ConstRecordIterator& record_iter() override { return m_record_it; }
+
+        void reset_record_iterator() { m_record_it.reset(); }
+
+    private:
+        SketchMapRecordGroupIterator const* m_parent;
+        KeyValueRecordIterator m_record_it;
+    };
+
+    // Variables
+    std::map<GroupTags, SketchOperator::Sketch>::const_iterator m_map_it;
+    std::map<GroupTags, SketchOperator::Sketch>::const_iterator m_map_end_it;
+    SketchOutputMode m_output_mode;
+    std::vector<KeyValueRecord> m_records;
+    Group m_group;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_SKETCHOPERATOR_HPP
@@ -0,0 +1,37 @@
+#include "StatisticsOperator.hpp"
+
+#include <memory>
+
+namespace reducer {
+void StatisticsOperator::push_intra_stage_record_group(
+        GroupTags const& tags,
+        ConstRecordIterator& record_it
+) {
+    auto& partial = m_group_partials[tags];
+
+    for (; false == record_it.done(); record_it.next()) {
+        auto const& record = record_it.get();
+        partial.merge(
+                {record.get_int64_value(static_cast<char const*>(cCountKey)),
+                 record.get_double_value(static_cast<char const*>(cSumKey)),
+                 record.get_double_value(static_cast<char const*>(cMinKey)),
+                 record.get_double_value(static_cast<char const*>(cMaxKey))}
+        );
+    }
+}
+
+void StatisticsOperator::push_inter_stage_record_group(
+        GroupTags const& tags,
+        ConstRecordIterator& record_it
+) {
+    auto& partial = m_group_partials[tags];
+
+    for (; false == record_it.done(); record_it.next()) {
+        partial.add(record_it.get().get_double_value(static_cast<char const*>(cValueKey)));
+    }
+}
+
+std::unique_ptr<RecordGroupIterator> StatisticsOperator::get_stored_result_iterator() {
+    return std::make_unique<StatisticsMapRecordGroupIterator>(m_group_partials);
+}
+}  // namespace reducer
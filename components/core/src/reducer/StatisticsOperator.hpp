@@ -0,0 +1,186 @@
+#ifndef REDUCER_STATISTICSOPERATOR_HPP
+#define REDUCER_STATISTICSOPERATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string_view>
+
+#include "ConstRecordIterator.hpp"
+#include "GroupTags.hpp"
+#include "Operator.hpp"
+#include "Record.hpp"
+#include "RecordGroup.hpp"
+#include "RecordGroupIterator.hpp"
+#include "RecordTypedKeyIterator.hpp"
+
+namespace reducer {
+/**
+ * Partial aggregate of a group's numeric values. Partials computed over disjoint sets of values can
+ * be merged, and the sum, minimum, maximum, and average of the values can be derived from them.
+ */
+struct StatisticsPartial {
+    /**
+     * Adds a value to the partial.
+     * @param value
+     */
+    void add(double value) {
+        ++count;
+        sum += value;
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+    }
+
+    /**
+     * Merges another partial into this one.
+     * @param other
+     */
+    void merge(StatisticsPartial const& other) {
+        count += other.count;
+        sum += other.sum;
+        min = other.min < min ? other.min : min;
+        max = other.max > max ? other.max : max;
+    }
+
+    [[nodiscard]] auto get_average() const -> double {
+        return 0 == count ? 0.0 : sum / static_cast<double>(count);
+    }
+
+    int64_t count{0};
+    double sum{0.0};
+    double min{std::numeric_limits<double>::infinity()};
+    double max{-std::numeric_limits<double>::infinity()};
+};
+
+/**
+ * Operator that accumulates the count, sum, minimum, maximum, and average of a numeric value per
+ * record group.
+ *
+ * Inter-stage records must contain the value to aggregate under `cValueKey`. Intra-stage records
+ * are the partials output by other instances of this operator, so only the partials (rather than
+ * the records) need to be sent between stages.
+ */
+class StatisticsOperator : public Operator {
+public:
+    static constexpr char cValueKey[] = "value";
+    static constexpr char cCountKey[] = "count";
+    static constexpr char cSumKey[] = "sum";
+    static constexpr char cMinKey[] = "min";
+    static constexpr char cMaxKey[] = "max";
+    static constexpr char cAverageKey[] = "avg";
+
+    void
+    push_intra_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
+
+    void
+    push_inter_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
+
+    std::unique_ptr<RecordGroupIterator> get_stored_result_iterator() override;
+
+private:
+    std::map<GroupTags, StatisticsPartial> m_group_partials;
+};
+
+/**
+ * Record implementation which exposes a StatisticsPartial as a record with a count, sum, minimum,
+ * maximum, and average.
+ *
+ * The partial can be updated allowing this class to act as an adapter for a larger set of data.
+ */
+class StatisticsRecordAdapter : public Record {
+public:
+    void set_record_value(StatisticsPartial const& partial) { m_partial = partial; }
+
+    [[nodiscard]] int64_t get_int64_value(std::string_view key) const override {
+        if (key == StatisticsOperator::cCountKey) {
+            return m_partial.count;
+        }
+        return 0;
+    }
+
+    [[nodiscard]] double get_double_value(std::string_view key) const override {
+        if (key == StatisticsOperator::cSumKey) {
+            return m_partial.sum;
+        }
+        if (key == StatisticsOperator::cMinKey) {
+            return m_partial.min;
+        }
+        if (key == StatisticsOperator::cMaxKey) {
+            return m_partial.max;
+        }
+        if (key == StatisticsOperator::cAverageKey) {
+            return m_partial.get_average();
+        }
+        return 0.0;
+    }
+
+    [[nodiscard]] std::unique_ptr<RecordTypedKeyIterator> typed_key_iter() const override;
+
+private:
+    StatisticsPartial m_partial;
+};
+
+/**
+ * A RecordTypedKeyIterator over the elements of a StatisticsRecordAdapter.
+ */
+class StatisticsTypedKeyIterator : public RecordTypedKeyIterator {
+public:
+    TypedRecordKey get() override {
+        if (0 == m_idx) {
+            return {StatisticsOperator::cCountKey, ValueType::Int64};
+        }
+        return {cDoubleKeys[m_idx - 1], ValueType::Double};
+    }
+
+    void next() override { ++m_idx; }
+
+    bool done() override { return m_idx > cDoubleKeys.size(); }
+
+private:
+    static constexpr std::array<std::string_view, 4> cDoubleKeys{
+            StatisticsOperator::cSumKey,
+            StatisticsOperator::cMinKey,
+            StatisticsOperator::cMaxKey,
+            StatisticsOperator::cAverageKey
+    };
+
+    size_t m_idx{0};
+};
+
+inline std::unique_ptr<RecordTypedKeyIterator> StatisticsRecordAdapter::typed_key_iter() const {
+    return std::make_unique<StatisticsTypedKeyIterator>();
+}
+
+/**
+ * A RecordGroupIterator that exposes a map which maps GroupTags to StatisticsPartial values.
+ */
+class StatisticsMapRecordGroupIterator : public RecordGroupIterator {
+public:
+    explicit StatisticsMapRecordGroupIterator(std::map<GroupTags, StatisticsPartial> const& map)
+            : m_map_it{map.cbegin()},
+              m_map_end_it{map.cend()},
+              m_group{nullptr, m_record} {}
+
+    RecordGroup& get() override {
+        m_record.set_record_value(m_map_it->second);
+        m_group.set_tags(&m_map_it->first);
+        m_group.reset_record_iterator();
+        return m_group;
+    }
+
+    void next() override { ++m_map_it; }
+
+    bool done() override { return m_map_it == m_map_end_it; }
+
+private:
+    StatisticsRecordAdapter m_record;
+    SingleRecordGroup m_group;
+    std::map<GroupTags, StatisticsPartial>::const_iterator m_map_it;
+    std::map<GroupTags, StatisticsPartial>::const_iterator m_map_end_it;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_STATISTICSOPERATOR_HPP
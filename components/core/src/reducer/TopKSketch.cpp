@@ -0,0 +1,130 @@
+#include "TopKSketch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "sketch_serialization.hpp"
+
+namespace reducer {
+namespace {
+using counter_t = std::pair<std::string_view, uint64_t>;
+
+/**
+ * Applies the Misra-Gries decrement to the given counters: if there are more than
+ * `num_counters`, every counter is decremented by the count of the largest counter that doesn't
+ * fit, and the counters that drop to zero are removed.
+ * @param num_counters
+ * @param counters
+ */
+void prune_counters(size_t num_counters, std::vector<counter_t>& counters);
+
+void prune_counters(size_t num_counters, std::vector<counter_t>& counters) {
+    if (counters.size() <= num_counters) {
+        return;
+    }
+    auto const nth{counters.begin() + static_cast<ptrdiff_t>(num_counters)};
+    std::ranges::nth_element(counters, nth, std::ranges::greater{}, &counter_t::second);
+    auto const decrement{nth->second};
+    counters.erase(nth, counters.end());
+    for (auto& counter : counters) {
+        counter.second -= decrement;
+    }
+    std::erase_if(counters, [](counter_t const& counter) { return 0 == counter.second; });
+}
+}  // namespace
+
+TopKSketch::TopKSketch(uint32_t k) : m_k{k}, m_num_counters{size_t{k} * cCountersPerItem} {
+    if (0 == k || k > cMaxK) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+}
+
+void TopKSketch::add(std::string_view value, uint64_t count) {
+    if (auto it{m_counts.find(value)}; m_counts.end() != it) {
+        it->second += count;
+        return;
+    }
+    m_counts.emplace(value, count);
+    if (m_counts.size() > 2 * m_num_counters) {
+        prune();
+    }
+}
+
+void TopKSketch::merge(TopKSketch const& other) {
+    for (auto const& [value, count] : other.m_counts) {
+        add(value, count);
+    }
+}
+
+auto TopKSketch::get_top_k() const -> std::vector<std::pair<std::string, uint64_t>> {
+    std::vector<counter_t> counters(m_counts.cbegin(), m_counts.cend());
+    prune_counters(m_num_counters, counters);
+    std::ranges::sort(counters, [](counter_t const& lhs, counter_t const& rhs) {
+        return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+    });
+
+    std::vector<std::pair<std::string, uint64_t>> top_k;
+    top_k.reserve(std::min(counters.size(), size_t{m_k}));
+    for (size_t i{0}; i < counters.size() && i < m_k; ++i) {
+        top_k.emplace_back(counters[i].first, counters[i].second);
+    }
+    return top_k;
+}
+
+auto TopKSketch::serialize() const -> std::string {
+    std::vector<counter_t> counters(m_counts.cbegin(), m_counts.cend());
+    prune_counters(m_num_counters, counters);
+
+    std::string buf;
+    append_varint(m_k, buf);
+    append_varint(counters.size(), buf);
+    for (auto const& [value, count] : counters) {
+        append_varint(value.size(), buf);
+        buf.append(value);
+        append_varint(count, buf);
+    }
+    return buf;
+}
+
+auto TopKSketch::deserialize(std::string_view buf) -> TopKSketch {
+    SketchReader reader{buf};
+    auto const k{reader.read_varint()};
+    if (k > cMaxK) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    TopKSketch sketch{static_cast<uint32_t>(k)};
+    auto const num_counters{reader.read_varint()};
+    if (num_counters > sketch.m_num_counters) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    for (uint64_t i{0}; i < num_counters; ++i) {
+        auto const value{reader.read_bytes(reader.read_varint())};
+        auto const count{reader.read_varint()};
+        if (false == sketch.m_counts.emplace(value, count).second) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+    }
+    if (false == reader.done()) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+    return sketch;
+}
+
+void TopKSketch::prune() {
+    std::vector<counter_t> counters(m_counts.cbegin(), m_counts.cend());
+    prune_counters(m_num_counters, counters);
+
+    std::unordered_map<std::string, uint64_t, StringHash, std::equal_to<>> pruned_counts;
+    pruned_counts.reserve(2 * m_num_counters + 1);
+    for (auto const& [value, count] : counters) {
+        pruned_counts.emplace(value, count);
+    }
+    m_counts = std::move(pruned_counts);
+}
+}  // namespace reducer
@@ -0,0 +1,111 @@
+#ifndef REDUCER_TOPKSKETCH_HPP
+#define REDUCER_TOPKSKETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+
+namespace reducer {
+/**
+ * Misra-Gries summary that estimates the most frequent values added to it. The summary keeps a
+ * counter for at most `cCountersPerItem * k` values, and merging summaries (Agarwal et al., PODS
+ * 2012) keeps the same guarantee: each value's estimated count is at most its true count, and at
+ * least its true count minus (total count) / (number of counters + 1).
+ */
+class TopKSketch {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::TopKSketch operation failed";
+        }
+    };
+
+    // Constants
+    static constexpr uint32_t cDefaultK{10};
+    static constexpr uint32_t cMaxK{10'000};
+    static constexpr uint32_t cCountersPerItem{8};
+
+    // Constructors
+    /**
+     * @param k The number of most frequent values the sketch should report.
+     * @throw OperationFailed if `k` is zero or larger than `cMaxK`.
+     */
+    explicit TopKSketch(uint32_t k = cDefaultK);
+
+    // Methods
+    /**
+     * Adds a value to the sketch.
+     * @param value
+     * @param count
+     */
+    void add(std::string_view value, uint64_t count = 1);
+
+    /**
+     * Merges another sketch into this one, keeping this sketch's `k`.
+     * @param other
+     */
+    void merge(TopKSketch const& other);
+
+    [[nodiscard]] auto get_k() const -> uint32_t { return m_k; }
+
+    /**
+     * @return Up to `k` values with the largest estimated counts, with their estimated counts, in
+     * descending order of count and then ascending order of value.
+     */
+    [[nodiscard]] auto get_top_k() const -> std::vector<std::pair<std::string, uint64_t>>;
+
+    /**
+     * @return The serialized sketch.
+     */
+    [[nodiscard]] auto serialize() const -> std::string;
+
+    /**
+     * @param buf
+     * @return The sketch serialized in `buf`.
+     * @throw OperationFailed or SketchReader::OperationFailed if `buf` is corrupt.
+     */
+    [[nodiscard]] static auto deserialize(std::string_view buf) -> TopKSketch;
+
+private:
+    // Types
+    struct StringHash {
+        using is_transparent = void;
+
+        [[nodiscard]] auto operator()(std::string_view value) const -> size_t {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    // Methods
+    /**
+     * Decrements every counter by the size of the largest counter that doesn't fit in the summary,
+     * and removes the counters that drop to zero.
+     *
+     * Pruning is deferred until there are twice as many counters as the summary keeps so that its
+     * cost is amortized across many additions.
+     */
+    void prune();
+
+    // Variables
+    uint32_t m_k;
+    size_t m_num_counters;
+    std::unordered_map<std::string, uint64_t, StringHash, std::equal_to<>> m_counts;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_TOPKSKETCH_HPP
@@ -8,6 +8,7 @@
 
 #include "../clp/ErrorCode.hpp"
 #include "../clp/networking/socket_utils.hpp"
+#include "BinaryRecordGroup.hpp"
 #include "BufferedSocketWriter.hpp"
 #include "DeserializedRecordGroup.hpp"
 #include "RecordGroupIterator.hpp"
@@ -44,13 +45,19 @@ int connect_to_reducer(std::string const& host, int port, job_id_t job_id) {
     return reducer_socket_fd;
 }
 
-bool send_pipeline_results(int reducer_socket_fd, std::unique_ptr<RecordGroupIterator> results) {
+bool send_pipeline_results(
+        int reducer_socket_fd,
+        std::unique_ptr<RecordGroupIterator> results,
+        RecordGroupFormat format
+) {
     constexpr int cBufSize = 1024;
     BufferedSocketWriter buffered_writer{reducer_socket_fd, cBufSize};
 
     for (; false == results->done(); results->next()) {
         auto& group = results->get();
-        auto serialized_result = serialize(group.get_tags(), group.record_iter());
+        auto serialized_result = RecordGroupFormat::Binary == format
+                                         ? serialize_binary(group.get_tags(), group.record_iter())
+                                         : serialize(group.get_tags(), group.record_iter());
         auto serialized_result_size = serialized_result.size();
 
         // Send size
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 
+#include "BinaryRecordGroup.hpp"
 #include "RecordGroupIterator.hpp"
 #include "types.hpp"
 
@@ -22,9 +23,14 @@ int connect_to_reducer(std::string const& host, int port, job_id_t job_id);
  * Sends results to the reducer.
  * @param reducer_socket_fd
  * @param results
+ * @param format The format to serialize each record group in. The reducer accepts either format.
  * @return Whether the results were sent successfully.
  */
-bool send_pipeline_results(int reducer_socket_fd, std::unique_ptr<RecordGroupIterator> results);
+bool send_pipeline_results(
+        int reducer_socket_fd,
+        std::unique_ptr<RecordGroupIterator> results,
+        RecordGroupFormat format = RecordGroupFormat::Binary
+);
 }  // namespace reducer
 
 #endif  // REDUCER_NETWORK_UTILS_HPP
@@ -0,0 +1,131 @@
+#ifndef REDUCER_SKETCH_SERIALIZATION_HPP
+#define REDUCER_SKETCH_SERIALIZATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+
+namespace reducer {
+/**
+ * Appends an unsigned integer to the given buffer as a LEB128 varint.
+ * @param value
+ * @param buf
+ */
+inline void append_varint(uint64_t value, std::string& buf) {
+    constexpr uint64_t cPayloadMask{0x7f};
+    constexpr uint8_t cContinuationBit{0x80};
+    while (value > cPayloadMask) {
+        buf.push_back(static_cast<char>((value & cPayloadMask) | cContinuationBit));
+        value >>= 7;
+    }
+    buf.push_back(static_cast<char>(value));
+}
+
+/**
+ * Appends a fixed-width value to the given buffer in native byte order.
+ * @tparam T
+ * @param value
+ * @param buf
+ */
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+void append_fixed_width(T value, std::string& buf) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buf.append(bytes, sizeof(T));
+}
+
+/**
+ * Reader for the values written by `append_varint` and `append_fixed_width`.
+ */
+class SketchReader {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::SketchReader operation failed";
+        }
+    };
+
+    // Constructors
+    explicit SketchReader(std::string_view buf) : m_buf{buf} {}
+
+    // Methods
+    /**
+     * @return The next varint in the buffer.
+     * @throw OperationFailed if the buffer ends before the varint does.
+     */
+    [[nodiscard]] auto read_varint() -> uint64_t {
+        constexpr uint8_t cPayloadMask{0x7f};
+        constexpr uint8_t cContinuationBit{0x80};
+        constexpr int cMaxShift{63};
+        uint64_t value{0};
+        for (int shift{0}; shift <= cMaxShift; shift += 7) {
+            if (m_buf.empty()) {
+                break;
+            }
+            auto const byte{static_cast<uint8_t>(m_buf.front())};
+            m_buf.remove_prefix(1);
+            value |= static_cast<uint64_t>(byte & cPayloadMask) << shift;
+            if (0 == (byte & cContinuationBit)) {
+                return value;
+            }
+        }
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    /**
+     * @tparam T
+     * @return The next fixed-width value in the buffer.
+     * @throw OperationFailed if the buffer is too short.
+     */
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] auto read_fixed_width() -> T {
+        T value;
+        std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    /**
+     * @param num_bytes
+     * @return A view of the next `num_bytes` bytes in the buffer.
+     * @throw OperationFailed if the buffer is too short.
+     */
+    [[nodiscard]] auto read_bytes(size_t num_bytes) -> std::string_view {
+        if (num_bytes > m_buf.size()) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        auto const bytes{m_buf.substr(0, num_bytes)};
+        m_buf.remove_prefix(num_bytes);
+        return bytes;
+    }
+
+    /**
+     * @return The number of bytes in the buffer that haven't been read.
+     */
+    [[nodiscard]] auto get_num_remaining_bytes() const -> size_t { return m_buf.size(); }
+
+    /**
+     * @return Whether the whole buffer has been read.
+     */
+    [[nodiscard]] auto done() const -> bool { return m_buf.empty(); }
+
+private:
+    std::string_view m_buf;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_SKETCH_SERIALIZATION_HPP
@@ -0,0 +1,136 @@
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/reducer/BinaryRecordGroup.hpp"
+#include "../src/reducer/DeserializedRecordGroup.hpp"
+#include "../src/reducer/GroupTags.hpp"
+#include "../src/reducer/Record.hpp"
+#include "../src/reducer/RecordTypedKeyIterator.hpp"
+#include "../src/reducer/SketchOperator.hpp"
+
+using reducer::BinaryRecordGroup;
+using reducer::GroupTags;
+using reducer::KeyValueRecord;
+using reducer::ValueType;
+
+namespace {
+/**
+ * @param record
+ * @return A map from each of the record's keys to the key's value type.
+ */
+auto get_key_types(reducer::Record const& record) -> std::map<std::string, ValueType>;
+
+auto get_key_types(reducer::Record const& record) -> std::map<std::string, ValueType> {
+    std::map<std::string, ValueType> key_types;
+    for (auto key_it = record.typed_key_iter(); false == key_it->done(); key_it->next()) {
+        auto const typed_key{key_it->get()};
+        key_types.emplace(typed_key.get_key(), typed_key.get_type());
+    }
+    return key_types;
+}
+}  // namespace
+
+TEST_CASE("BinaryRecordGroup", "[reducer][BinaryRecordGroup]") {
+    GroupTags const tags{"api", "", "null"};
+    std::string const binary_value{"sketch\0bytes\xff", 13};
+
+    std::vector<KeyValueRecord> records(3);
+    records[0].emplace("count", int64_t{-42});
+    records[0].emplace("name", std::string{"first"});
+    // Records don't need to share the same keys
+    records[1].emplace("name", std::string{});
+    records[1].emplace("avg", 2.5);
+    records[2].emplace("sketch", binary_value);
+
+    SECTION("Round trip") {
+        reducer::KeyValueRecordIterator record_it{records};
+        auto const serialized{reducer::serialize_binary(tags, record_it)};
+        REQUIRE(BinaryRecordGroup::is_binary_record_group(
+                reinterpret_cast<char const*>(serialized.data()),
+                serialized.size()
+        ));
+
+        BinaryRecordGroup group{serialized};
+        REQUIRE((tags == group.get_tags()));
+
+        auto& deserialized_it = group.record_iter();
+        REQUIRE_FALSE(deserialized_it.done());
+        auto const& first = deserialized_it.get();
+        REQUIRE((std::map<std::string, ValueType>{
+                         {"count", ValueType::Int64},
+                         {"name", ValueType::String}
+                 }
+                 == get_key_types(first)));
+        REQUIRE((-42 == first.get_int64_value("count")));
+        // Numbers can be read as either numeric type, like in the msgpack format
+        REQUIRE((-42.0 == first.get_double_value("count")));
+        REQUIRE(("first" == first.get_string_view("name")));
+        REQUIRE(first.get_string_view("missing").empty());
+
+        deserialized_it.next();
+        REQUIRE_FALSE(deserialized_it.done());
+        auto const& second = deserialized_it.get();
+        REQUIRE((std::map<std::string, ValueType>{
+                         {"avg", ValueType::Double},
+                         {"name", ValueType::String}
+                 }
+                 == get_key_types(second)));
+        REQUIRE((2.5 == second.get_double_value("avg")));
+        REQUIRE((0 == second.get_int64_value("count")));
+        REQUIRE(second.get_string_view("name").empty());
+
+        deserialized_it.next();
+        REQUIRE_FALSE(deserialized_it.done());
+        REQUIRE((binary_value == deserialized_it.get().get_string_view("sketch")));
+
+        deserialized_it.next();
+        REQUIRE(deserialized_it.done());
+    }
+
+    SECTION("Empty group") {
+        std::vector<KeyValueRecord> const no_records;
+        reducer::KeyValueRecordIterator record_it{no_records};
+        auto const serialized{reducer::serialize_binary({}, record_it)};
+        BinaryRecordGroup group{serialized};
+        REQUIRE(group.get_tags().empty());
+        REQUIRE(group.record_iter().done());
+    }
+
+    SECTION("Msgpack compatibility") {
+        reducer::KeyValueRecordIterator record_it{records};
+        auto serialized{reducer::serialize(tags, record_it)};
+        REQUIRE_FALSE(BinaryRecordGroup::is_binary_record_group(
+                reinterpret_cast<char const*>(serialized.data()),
+                serialized.size()
+        ));
+        reducer::DeserializedRecordGroup group{serialized};
+        REQUIRE((tags == group.get_tags()));
+        REQUIRE((-42 == group.record_iter().get().get_int64_value("count")));
+    }
+
+    SECTION("Corrupt groups") {
+        reducer::KeyValueRecordIterator record_it{records};
+        auto const serialized{reducer::serialize_binary(tags, record_it)};
+
+        auto truncated{serialized};
+        truncated.pop_back();
+        REQUIRE_THROWS_AS(BinaryRecordGroup{truncated}, BinaryRecordGroup::OperationFailed);
+
+        auto wrong_version{serialized};
+        wrong_version[1] = BinaryRecordGroup::cVersion + 1;
+        REQUIRE_THROWS_AS(BinaryRecordGroup{wrong_version}, BinaryRecordGroup::OperationFailed);
+
+        // Point the first tag past the end of the string heap
+        constexpr size_t cFirstTagOffset{20};
+        auto bad_tag{serialized};
+        bad_tag[cFirstTagOffset + sizeof(uint32_t)] = static_cast<uint8_t>(0xff);
+        REQUIRE_THROWS_AS(BinaryRecordGroup{bad_tag}, BinaryRecordGroup::OperationFailed);
+    }
+}
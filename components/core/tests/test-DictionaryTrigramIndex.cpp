@@ -0,0 +1,139 @@
+#include <unistd.h>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "../src/clp/Defs.h"
+#include "../src/clp/DictionaryTrigramIndex.hpp"
+#include "../src/clp/VariableDictionaryEntry.hpp"
+#include "../src/clp/VariableDictionaryReader.hpp"
+#include "../src/clp/VariableDictionaryWriter.hpp"
+
+using clp::cVariableDictionaryIdMax;
+using clp::variable_dictionary_id_t;
+using clp::VariableDictionaryEntry;
+using clp::VariableDictionaryReader;
+using clp::VariableDictionaryWriter;
+
+namespace {
+constexpr std::string_view cVarDictPath{"var.dict"};
+constexpr std::string_view cVarSegmentIndexPath{"var.segindex"};
+constexpr std::string_view cVarDictTrigramIndexPath{"var.dict.trigrams"};
+
+/**
+ * @param reader
+ * @param wildcard_string
+ * @param ignore_case
+ * @return The values of the dictionary entries matching the given wildcard string.
+ */
+auto get_matching_values(
+        VariableDictionaryReader const& reader,
+        std::string_view wildcard_string,
+        bool ignore_case
+) -> std::unordered_set<std::string>;
+
+auto get_matching_values(
+        VariableDictionaryReader const& reader,
+        std::string_view wildcard_string,
+        bool ignore_case
+) -> std::unordered_set<std::string> {
+    std::unordered_set<VariableDictionaryEntry const*> entries;
+    reader.get_entries_matching_wildcard_string(wildcard_string, ignore_case, entries);
+    std::unordered_set<std::string> values;
+    for (auto const* entry : entries) {
+        values.emplace(entry->get_value());
+    }
+    return values;
+}
+}  // namespace
+
+TEST_CASE("DictionaryTrigramIndex", "[DictionaryTrigramIndex]") {
+    std::vector<std::string> const values{
+            "conn_id=ab12cd",
+            "conn_id=AB12EF",
+            "conn_id=zz99",
+            "session=ab12",
+            "ab",
+            "a*b",
+            "x?yz",
+            "user-0001",
+            "user-0002",
+            "USER-0003"
+    };
+
+    SECTION("Candidate IDs") {
+        absl::flat_hash_map<std::string, variable_dictionary_id_t> value_to_id;
+        for (size_t i{0}; i < values.size(); ++i) {
+            value_to_id.emplace(values[i], i);
+        }
+        auto const index{clp::DictionaryTrigramIndex<variable_dictionary_id_t>::build(value_to_id)};
+        REQUIRE((values.size() == index.get_num_indexed_entries()));
+
+        // Wildcard strings without a literal of at least three characters can't be filtered
+        REQUIRE_FALSE(index.get_candidate_ids("*").has_value());
+        REQUIRE_FALSE(index.get_candidate_ids("ab*").has_value());
+        REQUIRE_FALSE(index.get_candidate_ids("a?b?c").has_value());
+
+        REQUIRE((std::vector<variable_dictionary_id_t>{0, 1, 3}
+                 == index.get_candidate_ids("*ab12*").value()));
+        REQUIRE((std::vector<variable_dictionary_id_t>{7, 8, 9}
+                 == index.get_candidate_ids("user-000?").value()));
+        REQUIRE((std::vector<variable_dictionary_id_t>{5}
+                 == index.get_candidate_ids(R"(a\*b)").value()));
+        REQUIRE(index.get_candidate_ids("*missing*").value().empty());
+    }
+
+    SECTION("Wildcard search with and without the index") {
+        auto const use_index = GENERATE(true, false);
+
+        VariableDictionaryWriter writer;
+        writer.open(
+                std::string{cVarDictPath},
+                std::string{cVarSegmentIndexPath},
+                cVariableDictionaryIdMax
+        );
+        writer.enable_trigram_index(std::string{cVarDictTrigramIndexPath});
+        variable_dictionary_id_t id{};
+        for (auto const& value : values) {
+            writer.add_entry(value, id);
+        }
+        writer.close();
+
+        VariableDictionaryReader reader;
+        reader.open(std::string{cVarDictPath}, std::string{cVarSegmentIndexPath});
+        reader.read_new_entries();
+        if (use_index) {
+            reader.load_trigram_index(std::string{cVarDictTrigramIndexPath});
+        }
+
+        REQUIRE((std::unordered_set<std::string>{"conn_id=ab12cd", "session=ab12"}
+                 == get_matching_values(reader, "*ab12*", false)));
+        REQUIRE((std::unordered_set<std::string>{
+                         "conn_id=ab12cd",
+                         "conn_id=AB12EF",
+                         "session=ab12"
+                 }
+                 == get_matching_values(reader, "*ab12*", true)));
+        REQUIRE((std::unordered_set<std::string>{"user-0001", "user-0002"}
+                 == get_matching_values(reader, "user-000?", false)));
+        REQUIRE((std::unordered_set<std::string>{"a*b"}
+                 == get_matching_values(reader, R"(a\*b)", false)));
+        REQUIRE((std::unordered_set<std::string>{"x?yz"}
+                 == get_matching_values(reader, R"(x\?yz)", false)));
+        REQUIRE((values.size() == get_matching_values(reader, "*", false).size()));
+        REQUIRE(get_matching_values(reader, "*missing*", true).empty());
+
+        reader.close();
+
+        REQUIRE((0 == unlink(cVarDictPath.data())));
+        REQUIRE((0 == unlink(cVarSegmentIndexPath.data())));
+        REQUIRE((0 == unlink(cVarDictTrigramIndexPath.data())));
+    }
+}
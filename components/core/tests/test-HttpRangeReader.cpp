@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp/CurlGlobalInstance.hpp"
+#include "../src/clp/CurlRangeFetcher.hpp"
+#include "../src/clp/ErrorCode.hpp"
+#include "../src/clp/FileReader.hpp"
+#include "../src/clp/HttpRangeReader.hpp"
+#include "../src/clp/ReaderInterface.hpp"
+
+namespace {
+constexpr size_t cBlockSize{256};
+constexpr size_t cMaxNumCachedBlocks{8};
+constexpr size_t cDataSize{10'000};
+constexpr size_t cReadBufSize{100};
+
+/**
+ * A stand-in for a remote server that serves ranges of an in-memory buffer.
+ */
+class InMemoryRangeFetcher : public clp::HttpRangeReader::RangeFetcher {
+public:
+    // Constructors
+    explicit InMemoryRangeFetcher(std::vector<char> data, bool fail = false)
+            : m_data{std::move(data)},
+              m_fail{fail} {}
+
+    // Methods implementing `clp::HttpRangeReader::RangeFetcher`
+    [[nodiscard]] auto fetch(size_t begin, std::span<char> dst, size_t& num_bytes_fetched)
+            -> clp::ErrorCode override {
+        num_bytes_fetched = 0;
+        if (m_fail) {
+            return clp::ErrorCode_Failure;
+        }
+        if (begin >= m_data.size()) {
+            return clp::ErrorCode_EndOfFile;
+        }
+        num_bytes_fetched = std::min(dst.size(), m_data.size() - begin);
+        std::memcpy(dst.data(), m_data.data() + begin, num_bytes_fetched);
+        return clp::ErrorCode_Success;
+    }
+
+private:
+    std::vector<char> m_data;
+    bool m_fail;
+};
+
+[[nodiscard]] auto get_test_data() -> std::vector<char>;
+
+/**
+ * @param data
+ * @return An `HttpRangeReader` that reads `data` through an `InMemoryRangeFetcher`.
+ */
+[[nodiscard]] auto create_reader(std::vector<char> const& data) -> clp::HttpRangeReader;
+
+/**
+ * @param reader
+ * @param read_buf_size The size of the buffer to use for individual reads from the reader.
+ * @return All data read from the given reader, starting from its current position.
+ */
+[[nodiscard]] auto get_content(clp::ReaderInterface& reader, size_t read_buf_size = cReadBufSize)
+        -> std::vector<char>;
+
+[[nodiscard]] auto get_test_input_local_path() -> std::string;
+
+auto get_test_data() -> std::vector<char> {
+    std::vector<char> data(cDataSize);
+    for (size_t i{0}; i < data.size(); ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+        data[i] = static_cast<char>((i * 31) % 251);
+    }
+    return data;
+}
+
+auto create_reader(std::vector<char> const& data) -> clp::HttpRangeReader {
+    return clp::HttpRangeReader{
+            std::make_unique<InMemoryRangeFetcher>(data),
+            cBlockSize,
+            cMaxNumCachedBlocks
+    };
+}
+
+auto get_content(clp::ReaderInterface& reader, size_t read_buf_size) -> std::vector<char> {
+    std::vector<char> content;
+    std::vector<char> read_buf(read_buf_size);
+    size_t num_bytes_read{0};
+    while (clp::ErrorCode_Success
+           == reader.try_read(read_buf.data(), read_buf_size, num_bytes_read))
+    {
+        content.insert(content.cend(), read_buf.cbegin(), read_buf.cbegin() + num_bytes_read);
+    }
+    return content;
+}
+
+auto get_test_input_local_path() -> std::string {
+    std::filesystem::path const current_file_path{__FILE__};
+    return (current_file_path.parent_path() / "test_network_reader_src" / "random.log").string();
+}
+}  // namespace
+
+TEST_CASE("http_range_reader_sequential_read", "[HttpRangeReader]") {
+    auto const data{get_test_data()};
+    auto reader{create_reader(data)};
+
+    REQUIRE((get_content(reader) == data));
+    REQUIRE((reader.get_pos() == data.size()));
+    REQUIRE((reader.get_num_requests() == (data.size() + cBlockSize - 1) / cBlockSize));
+    REQUIRE((reader.get_num_bytes_fetched() == data.size()));
+
+    char c{};
+    size_t num_bytes_read{0};
+    REQUIRE((clp::ErrorCode_EndOfFile == reader.try_read(&c, 1, num_bytes_read)));
+    REQUIRE((0 == num_bytes_read));
+    REQUIRE((clp::ErrorCode_OutOfBounds == reader.try_seek_from_begin(data.size() + 1)));
+}
+
+TEST_CASE("http_range_reader_backward_seek", "[HttpRangeReader]") {
+    auto const data{get_test_data()};
+    auto reader{create_reader(data)};
+    constexpr size_t cOffset{300};
+    constexpr size_t cNumBytesToRead{1000};
+
+    std::vector<char> buf(cNumBytesToRead);
+    reader.seek_from_begin(cOffset);
+    REQUIRE((clp::ErrorCode_Success == reader.try_read_exact_length(buf.data(), buf.size())));
+    auto const num_requests{reader.get_num_requests()};
+
+    // Seeking backwards within the cached blocks shouldn't make any requests
+    reader.seek_from_begin(cOffset);
+    std::vector<char> reread_buf(cNumBytesToRead);
+    REQUIRE(
+            (clp::ErrorCode_Success
+             == reader.try_read_exact_length(reread_buf.data(), reread_buf.size()))
+    );
+    REQUIRE((reread_buf == buf));
+    REQUIRE((std::equal(buf.cbegin(), buf.cend(), data.cbegin() + cOffset)));
+    REQUIRE((reader.get_num_requests() == num_requests));
+
+    // Reading the rest of the data evicts the earlier blocks, so they have to be fetched again
+    std::ignore = get_content(reader);
+    auto const num_requests_after_eviction{reader.get_num_requests()};
+    reader.seek_from_begin(0);
+    REQUIRE((get_content(reader) == data));
+    REQUIRE((reader.get_num_requests() > num_requests_after_eviction));
+}
+
+TEST_CASE("http_range_reader_prefetch", "[HttpRangeReader]") {
+    auto const data{get_test_data()};
+
+    SECTION("Adjacent ranges are coalesced into one request") {
+        auto reader{create_reader(data)};
+        std::vector<std::pair<size_t, size_t>> const byte_ranges{{0, 1000}, {1000, 2000}};
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((1 == reader.get_num_requests()));
+
+        std::vector<char> buf(2000);
+        REQUIRE((clp::ErrorCode_Success == reader.try_read_exact_length(buf.data(), buf.size())));
+        REQUIRE((std::equal(buf.cbegin(), buf.cend(), data.cbegin())));
+        REQUIRE((1 == reader.get_num_requests()));
+
+        // Prefetching cached ranges shouldn't make any requests
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((1 == reader.get_num_requests()));
+    }
+
+    SECTION("Disjoint ranges are fetched separately, skipping the gap") {
+        auto reader{create_reader(data)};
+        std::vector<std::pair<size_t, size_t>> const byte_ranges{{5000, 5100}, {0, 100}};
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((2 == reader.get_num_requests()));
+        REQUIRE((2 * cBlockSize == reader.get_num_bytes_fetched()));
+    }
+
+    SECTION("At most the cache's capacity is prefetched") {
+        auto reader{create_reader(data)};
+        std::vector<std::pair<size_t, size_t>> const byte_ranges{{0, data.size()}};
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((1 == reader.get_num_requests()));
+        REQUIRE((cMaxNumCachedBlocks * cBlockSize == reader.get_num_bytes_fetched()));
+
+        REQUIRE((get_content(reader) == data));
+    }
+
+    SECTION("Ranges beyond the end of the data are ignored") {
+        auto reader{create_reader(data)};
+        std::vector<std::pair<size_t, size_t>> const byte_ranges{
+                {data.size() - 10, data.size() + 1000}
+        };
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((clp::ErrorCode_Success == reader.prefetch(byte_ranges)));
+        REQUIRE((1 == reader.get_num_requests()));
+    }
+}
+
+TEST_CASE("http_range_reader_fetch_failure", "[HttpRangeReader]") {
+    clp::HttpRangeReader reader{std::make_unique<InMemoryRangeFetcher>(get_test_data(), true)};
+    char c{};
+    size_t num_bytes_read{0};
+    REQUIRE((clp::ErrorCode_Failure == reader.try_read(&c, 1, num_bytes_read)));
+    REQUIRE_THROWS_AS(
+            clp::HttpRangeReader(nullptr, cBlockSize, cMaxNumCachedBlocks),
+            clp::HttpRangeReader::OperationFailed
+    );
+}
+
+TEST_CASE("http_range_reader_curl", "[HttpRangeReader]") {
+    constexpr size_t cOffset{319};
+    auto const local_path{get_test_input_local_path()};
+    clp::FileReader ref_reader{local_path};
+    auto const expected{get_content(ref_reader)};
+
+    // A file:// URL stands in for a server that supports range requests
+    clp::CurlGlobalInstance const curl_global_instance;
+    clp::HttpRangeReader reader{
+            std::make_unique<clp::CurlRangeFetcher>(
+                    "file://" + std::filesystem::absolute(local_path).string()
+            ),
+            cBlockSize * cBlockSize,
+            cMaxNumCachedBlocks
+    };
+    REQUIRE((get_content(reader) == expected));
+
+    reader.seek_from_begin(cOffset);
+    auto const actual{get_content(reader)};
+    REQUIRE((std::equal(actual.cbegin(), actual.cend(), expected.cbegin() + cOffset)));
+    REQUIRE((actual.size() == expected.size() - cOffset));
+}
@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/ErrorCode.hpp"
+#include "../src/clp/RuntimeMetrics.hpp"
+#include "../src/clp/type_utils.hpp"
+#include "TestOutputCleaner.hpp"
+
+using clp::RuntimeMetrics;
+using Stage = clp::RuntimeMetrics::Stage;
+
+TEST_CASE("RuntimeMetrics", "[RuntimeMetrics]") {
+    RuntimeMetrics::reset();
+
+    SECTION("Disabled timers record nothing") {
+        if (false == RuntimeMetrics::is_enabled()) {
+            {
+                RuntimeMetrics::ScopedTimer timer{Stage::Parse};
+                timer.add_bytes(10);
+            }
+            auto const snapshot{RuntimeMetrics::get_snapshot()};
+            REQUIRE((0 == snapshot[clp::enum_to_underlying_type(Stage::Parse)].num_operations));
+        }
+    }
+
+    RuntimeMetrics::enable();
+    REQUIRE(RuntimeMetrics::is_enabled());
+
+    SECTION("Timers record operations, durations, bytes, and histograms") {
+        for (size_t i{0}; i < 3; ++i) {
+            RuntimeMetrics::ScopedTimer timer{Stage::Compress};
+            timer.add_bytes(100);
+        }
+        RuntimeMetrics::record(Stage::Compress, std::chrono::milliseconds{5}, 1);
+        RuntimeMetrics::record(Stage::Compress, std::chrono::seconds{1000}, 0);
+
+        auto const snapshot{RuntimeMetrics::get_snapshot()};
+        auto const& compress{snapshot[clp::enum_to_underlying_type(Stage::Compress)]};
+        REQUIRE((5 == compress.num_operations));
+        REQUIRE((301 == compress.num_bytes));
+        REQUIRE((compress.total_duration_ns >= 1'000'005'000'000ULL));
+
+        size_t num_bucketed_operations{0};
+        for (auto const count : compress.histogram_bucket_counts) {
+            num_bucketed_operations += count;
+        }
+        REQUIRE((5 == num_bucketed_operations));
+        // 5 ms falls in the (1 ms, 10 ms] bucket and 1000 s in the unbounded bucket
+        REQUIRE((compress.histogram_bucket_counts[4] >= 1));
+        REQUIRE((1 == compress.histogram_bucket_counts.back()));
+
+        auto const& parse{snapshot[clp::enum_to_underlying_type(Stage::Parse)]};
+        REQUIRE((0 == parse.num_operations));
+    }
+
+    SECTION("Counts of exited threads are retained") {
+        constexpr size_t cNumThreads{4};
+        constexpr size_t cNumOperationsPerThread{1000};
+        std::vector<std::thread> threads;
+        for (size_t i{0}; i < cNumThreads; ++i) {
+            threads.emplace_back([]() {
+                for (size_t j{0}; j < cNumOperationsPerThread; ++j) {
+                    RuntimeMetrics::record(
+                            Stage::DictionaryInsert,
+                            std::chrono::nanoseconds{10},
+                            1
+                    );
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto const snapshot{RuntimeMetrics::get_snapshot()};
+        auto const& dictionary_insert{
+                snapshot[clp::enum_to_underlying_type(Stage::DictionaryInsert)]
+        };
+        REQUIRE((cNumThreads * cNumOperationsPerThread == dictionary_insert.num_operations));
+        REQUIRE((cNumThreads * cNumOperationsPerThread * 10
+                 == dictionary_insert.total_duration_ns));
+        REQUIRE((cNumThreads * cNumOperationsPerThread
+                 == dictionary_insert.histogram_bucket_counts.front()));
+    }
+
+    SECTION("Exports") {
+        RuntimeMetrics::record(Stage::IoWait, std::chrono::microseconds{50}, 4096);
+        auto const snapshot{RuntimeMetrics::get_snapshot()};
+
+        auto const json = RuntimeMetrics::to_json(snapshot);
+        auto const& io_wait{json.at("stages").at("io_wait")};
+        REQUIRE((1 == io_wait.at("num_operations").get<size_t>()));
+        REQUIRE((4096 == io_wait.at("num_bytes").get<size_t>()));
+        REQUIRE((RuntimeMetrics::cNumHistogramBuckets
+                 == io_wait.at("histogram").at("bucket_counts").size()));
+        REQUIRE(json.at("stages").contains("filter"));
+
+        auto const text{RuntimeMetrics::to_prometheus_text(snapshot)};
+        for (auto const* line :
+             {R"(clp_stage_duration_seconds_bucket{stage="io_wait",le="1e-05"} 0)",
+              R"(clp_stage_duration_seconds_bucket{stage="io_wait",le="0.0001"} 1)",
+              R"(clp_stage_duration_seconds_bucket{stage="io_wait",le="+Inf"} 1)",
+              R"(clp_stage_duration_seconds_count{stage="io_wait"} 1)",
+              R"(clp_stage_bytes_total{stage="io_wait"} 4096)"})
+        {
+            REQUIRE((std::string::npos != text.find(std::string{line} + '\n')));
+        }
+
+        std::string const metrics_path{"test-RuntimeMetrics.json"};
+        TestOutputCleaner const test_cleanup{{metrics_path}};
+        REQUIRE((clp::ErrorCode_Success
+                 == RuntimeMetrics::write_to_file(
+                         metrics_path,
+                         RuntimeMetrics::OutputFormat::Json
+                 )));
+        std::ifstream metrics_file{metrics_path};
+        auto const written_json = nlohmann::json::parse(metrics_file);
+        REQUIRE((4096 == written_json.at("stages").at("io_wait").at("num_bytes").get<size_t>()));
+    }
+
+    SECTION("Output format names") {
+        REQUIRE((RuntimeMetrics::OutputFormat::Json
+                 == RuntimeMetrics::parse_output_format("json")));
+        REQUIRE((RuntimeMetrics::OutputFormat::Prometheus
+                 == RuntimeMetrics::parse_output_format("prometheus")));
+        REQUIRE_FALSE(RuntimeMetrics::parse_output_format("xml").has_value());
+    }
+
+    RuntimeMetrics::reset();
+}
@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/reducer/ConstRecordIterator.hpp"
+#include "../src/reducer/DeserializedRecordGroup.hpp"
+#include "../src/reducer/GroupTags.hpp"
+#include "../src/reducer/Pipeline.hpp"
+#include "../src/reducer/Record.hpp"
+#include "../src/reducer/RecordGroupIterator.hpp"
+#include "../src/reducer/StatisticsOperator.hpp"
+
+using reducer::GroupTags;
+using reducer::StatisticsOperator;
+using reducer::StatisticsPartial;
+
+namespace {
+/**
+ * Pushes each value into an inter-stage pipeline as a record in the given group.
+ * @param pipeline
+ * @param tags
+ * @param values
+ */
+auto push_values(reducer::Pipeline& pipeline, GroupTags const& tags, std::vector<double> values)
+        -> void;
+
+/**
+ * @param results
+ * @return A map from each group's tags to the partial that the group's record exposes.
+ */
+auto get_partials(reducer::RecordGroupIterator& results) -> std::map<GroupTags, StatisticsPartial>;
+
+auto push_values(reducer::Pipeline& pipeline, GroupTags const& tags, std::vector<double> values)
+        -> void {
+    reducer::SingleDoubleRecordAdapter record{StatisticsOperator::cValueKey};
+    for (auto const value : values) {
+        record.set_record_value(value);
+        reducer::SingleRecordIterator record_it{record};
+        pipeline.push_record_group(tags, record_it);
+    }
+}
+
+auto get_partials(reducer::RecordGroupIterator& results) -> std::map<GroupTags, StatisticsPartial> {
+    std::map<GroupTags, StatisticsPartial> partials;
+    for (; false == results.done(); results.next()) {
+        auto& group = results.get();
+        auto& record_it = group.record_iter();
+        REQUIRE_FALSE(record_it.done());
+        auto const& record = record_it.get();
+        auto& partial = partials[group.get_tags()];
+        partial.count = record.get_int64_value(StatisticsOperator::cCountKey);
+        partial.sum = record.get_double_value(StatisticsOperator::cSumKey);
+        partial.min = record.get_double_value(StatisticsOperator::cMinKey);
+        partial.max = record.get_double_value(StatisticsOperator::cMaxKey);
+        REQUIRE(
+                (partial.get_average()
+                 == record.get_double_value(StatisticsOperator::cAverageKey))
+        );
+        record_it.next();
+        REQUIRE(record_it.done());
+    }
+    return partials;
+}
+}  // namespace
+
+TEST_CASE("StatisticsOperator", "[reducer][StatisticsOperator]") {
+    GroupTags const api_tags{"api", "GET"};
+    GroupTags const db_tags{"db", "null"};
+
+    reducer::Pipeline first_stage{reducer::PipelineInputMode::InterStage};
+    first_stage.add_pipeline_stage(std::make_shared<StatisticsOperator>());
+    push_values(first_stage, api_tags, {12.0, -3.5, 40.0});
+    push_values(first_stage, db_tags, {7.0});
+
+    reducer::Pipeline second_stage{reducer::PipelineInputMode::InterStage};
+    second_stage.add_pipeline_stage(std::make_shared<StatisticsOperator>());
+    push_values(second_stage, api_tags, {100.0, 0.5});
+
+    SECTION("Inter-stage partials") {
+        auto results{first_stage.finish()};
+        auto const partials{get_partials(*results)};
+        REQUIRE((2 == partials.size()));
+
+        auto const& api_partial{partials.at(api_tags)};
+        REQUIRE((3 == api_partial.count));
+        REQUIRE((48.5 == api_partial.sum));
+        REQUIRE((-3.5 == api_partial.min));
+        REQUIRE((40.0 == api_partial.max));
+
+        auto const& db_partial{partials.at(db_tags)};
+        REQUIRE((1 == db_partial.count));
+        REQUIRE((7.0 == db_partial.sum));
+        REQUIRE((7.0 == db_partial.min));
+        REQUIRE((7.0 == db_partial.max));
+        REQUIRE((7.0 == db_partial.get_average()));
+    }
+
+    SECTION("Merging serialized partials") {
+        reducer::Pipeline reducer_stage{reducer::PipelineInputMode::IntraStage};
+        reducer_stage.add_pipeline_stage(std::make_shared<StatisticsOperator>());
+        for (auto* stage : {&first_stage, &second_stage}) {
+            for (auto results{stage->finish()}; false == results->done(); results->next()) {
+                auto& group = results->get();
+                auto serialized_group{reducer::serialize(group.get_tags(), group.record_iter())};
+                reducer::DeserializedRecordGroup deserialized_group{serialized_group};
+                reducer_stage.push_record_group(
+                        deserialized_group.get_tags(),
+                        deserialized_group.record_iter()
+                );
+            }
+        }
+
+        auto results{reducer_stage.finish()};
+        auto const partials{get_partials(*results)};
+        REQUIRE((2 == partials.size()));
+
+        auto const& api_partial{partials.at(api_tags)};
+        REQUIRE((5 == api_partial.count));
+        REQUIRE((149.0 == api_partial.sum));
+        REQUIRE((-3.5 == api_partial.min));
+        REQUIRE((100.0 == api_partial.max));
+        REQUIRE((29.8 == api_partial.get_average()));
+
+        auto const& db_partial{partials.at(db_tags)};
+        REQUIRE((1 == db_partial.count));
+        REQUIRE((7.0 == db_partial.min));
+        REQUIRE((7.0 == db_partial.max));
+    }
+}
@@ -1,9 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../src/clp/TimestampPattern.hpp"
+#include "../src/clp/TimestampPrefixMatcher.hpp"
 
 using clp::epochtime_t;
 using clp::TimestampPattern;
+using clp::TimestampPrefixMatcher;
 using std::string;
 
 TEST_CASE("Test known timestamp patterns", "[KnownTimestampPatterns]") {
@@ -549,3 +551,80 @@ TEST_CASE("Test known timestamp patterns", "[KnownTimestampPatterns]") {
     specific_pattern.insert_formatted_timestamp(timestamp, content);
     REQUIRE(line == content);
 }
+
+TEST_CASE("Test known timestamp pattern search", "[KnownTimestampPatterns]") {
+    TimestampPattern::init();
+
+    epochtime_t timestamp;
+    size_t timestamp_begin_pos;
+    size_t timestamp_end_pos;
+
+    // Lines that resemble a known pattern without matching it
+    for (string const line :
+         {"",
+          "[2015-01-31T15:50",
+          "[2015-01-31 15:50:45.085]",
+          "INFO [main] 2015-01-31X15:50:45",
+          "Jan  1 15:50:45",
+          "0123 leading zero"})
+    {
+        REQUIRE(nullptr
+                == TimestampPattern::search_known_ts_patterns(
+                        line,
+                        timestamp,
+                        timestamp_begin_pos,
+                        timestamp_end_pos
+                ));
+        REQUIRE(string::npos == timestamp_begin_pos);
+        REQUIRE(string::npos == timestamp_end_pos);
+    }
+
+    // The first matching pattern is found regardless of how many patterns are ruled out before it
+    string line = "Start-Date: 2015-01-31  15:50:45";
+    auto const* pattern = TimestampPattern::search_known_ts_patterns(
+            line,
+            timestamp,
+            timestamp_begin_pos,
+            timestamp_end_pos
+    );
+    REQUIRE(nullptr != pattern);
+    REQUIRE(pattern->get_num_spaces_before_ts() == 1);
+    REQUIRE(pattern->get_format() == "%Y-%m-%d  %H:%M:%S");
+    REQUIRE(12 == timestamp_begin_pos);
+    REQUIRE(32 == timestamp_end_pos);
+
+    line = "Jan 01, 2016  3:50:17 PM content after";
+    pattern = TimestampPattern::search_known_ts_patterns(
+            line,
+            timestamp,
+            timestamp_begin_pos,
+            timestamp_end_pos
+    );
+    REQUIRE(nullptr != pattern);
+    REQUIRE(pattern->get_format() == "%b %d, %Y %l:%M:%S %p");
+    REQUIRE(1'451'663'417'000 == timestamp);
+}
+
+TEST_CASE("Test timestamp prefix matcher", "[KnownTimestampPatterns]") {
+    auto const iso_shape{TimestampPrefixMatcher::get_prefix_shape("[%Y-%m-%dT%H:%M:%S")};
+    auto const syslog_shape{TimestampPrefixMatcher::get_prefix_shape("%b %e %H:%M:%S")};
+    // The shape ends at the first variable-width field
+    auto const month_name_shape{TimestampPrefixMatcher::get_prefix_shape("%d %B %Y")};
+
+    string const line{"host INFO [2015-01-31T15:50:45] Jan  1 00:00:00"};
+    TimestampPrefixMatcher matcher{line};
+    REQUIRE(matcher.matches(2, iso_shape));
+    REQUIRE(false == matcher.matches(0, iso_shape));
+    REQUIRE(false == matcher.matches(2, syslog_shape));
+    REQUIRE(matcher.matches(3, syslog_shape));
+    // Positions found for more spaces don't affect matches for fewer spaces
+    REQUIRE(matcher.matches(2, iso_shape));
+    // The line doesn't have 10 spaces
+    REQUIRE(false == matcher.matches(10, iso_shape));
+
+    string const month_name_line{"31 January 2015"};
+    TimestampPrefixMatcher month_name_matcher{month_name_line};
+    REQUIRE(month_name_matcher.matches(0, month_name_shape));
+    REQUIRE(false == month_name_matcher.matches(0, syslog_shape));
+    REQUIRE(false == TimestampPrefixMatcher{""}.matches(0, iso_shape));
+}
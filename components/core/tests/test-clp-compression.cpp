@@ -0,0 +1,186 @@
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <clp/clp/run.hpp>
+
+#include "TestOutputCleaner.hpp"
+
+namespace {
+constexpr std::string_view cTestInputDirectory{"test-clp-compression-input"};
+constexpr std::string_view cTestSingleThreadedArchiveDirectory{"test-clp-compression-archives-1"};
+constexpr std::string_view cTestMultiThreadedArchiveDirectory{"test-clp-compression-archives-n"};
+constexpr std::string_view cTestSingleThreadedOutputDirectory{"test-clp-compression-out-1"};
+constexpr std::string_view cTestMultiThreadedOutputDirectory{"test-clp-compression-out-n"};
+constexpr std::string_view cEmptyDirectoryName{"empty-dir"};
+constexpr size_t cNumInputFiles{8};
+
+/**
+ * @return The path of the test log directory.
+ */
+[[nodiscard]] auto get_test_log_dir() -> std::filesystem::path;
+
+/**
+ * @param path
+ * @return The contents of the file at `path`.
+ */
+[[nodiscard]] auto read_file(std::filesystem::path const& path) -> std::string;
+
+/**
+ * Creates an input directory containing `cNumInputFiles` distinct log files (each based on the test
+ * log file) and an empty directory.
+ * @return The names of the log files, relative to the input directory.
+ */
+[[nodiscard]] auto create_input_directory() -> std::vector<std::string>;
+
+/**
+ * Runs `clp::clp::run` with the given arguments.
+ * @param args The arguments, excluding the program name.
+ * @return The value returned by `clp::clp::run`.
+ */
+auto run_clp(std::vector<std::string> const& args) -> int;
+
+/**
+ * Compresses the input directory using the given number of threads and then decompresses the
+ * resulting archives.
+ * @param num_threads
+ * @param archives_dir
+ * @param output_dir
+ */
+void compress_and_decompress(
+        size_t num_threads,
+        std::string_view archives_dir,
+        std::string_view output_dir
+);
+
+auto get_test_log_dir() -> std::filesystem::path {
+    std::filesystem::path const current_file_path{__FILE__};
+    return std::filesystem::canonical(current_file_path.parent_path()) / "test_log_files";
+}
+
+auto read_file(std::filesystem::path const& path) -> std::string {
+    std::ifstream file{path, std::ios::binary};
+    REQUIRE(file.is_open());
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+auto create_input_directory() -> std::vector<std::string> {
+    auto const log_file_contents{read_file(get_test_log_dir() / "log.txt")};
+    std::filesystem::create_directories(
+            std::filesystem::path{cTestInputDirectory} / cEmptyDirectoryName
+    );
+
+    std::vector<std::string> file_names;
+    for (size_t i{0}; i < cNumInputFiles; ++i) {
+        auto const& file_name{file_names.emplace_back(fmt::format("log-{}.txt", i))};
+        std::ofstream file{std::filesystem::path{cTestInputDirectory} / file_name};
+        REQUIRE(file.is_open());
+        for (size_t j{0}; j <= i; ++j) {
+            file << log_file_contents;
+        }
+        // Give each file a unique variable so that the archives' dictionaries differ.
+        file << fmt::format("2016-05-08 07:34:05.254 Finished writing file_{}\n", i);
+    }
+    return file_names;
+}
+
+auto run_clp(std::vector<std::string> const& args) -> int {
+    std::vector<char const*> argv{"clp"};
+    for (auto const& arg : args) {
+        argv.push_back(arg.c_str());
+    }
+    argv.push_back(nullptr);
+    // `clp::clp::run` registers a logger for `spdlog` that persists across runs. `spdlog` will
+    // error if a logger with the same name already exists. `spdlog::drop_all` clears all loggers,
+    // ensuring `clp::clp::run` can safely create a fresh logger for each new call.
+    spdlog::drop_all();
+    return clp::clp::run(static_cast<int>(argv.size() - 1), argv.data());
+}
+
+void compress_and_decompress(
+        size_t num_threads,
+        std::string_view archives_dir,
+        std::string_view output_dir
+) {
+    auto const input_dir{std::filesystem::absolute(cTestInputDirectory).string()};
+    // A tiny dictionary size target makes each thread split its archive before every file, so that
+    // threads concurrently update the shared global metadata DB.
+    REQUIRE((0
+             == run_clp(
+                     {"c",
+                      "--threads",
+                      std::to_string(num_threads),
+                      "--target-dictionaries-size",
+                      "1",
+                      "--remove-path-prefix",
+                      input_dir,
+                      std::string{archives_dir},
+                      input_dir}
+             )));
+    REQUIRE((0 == run_clp({"x", std::string{archives_dir}, std::string{output_dir}})));
+}
+}  // namespace
+
+TEST_CASE("Test multi-threaded compression matches single-threaded compression", "[Compression]") {
+    auto const num_threads{GENERATE(as<size_t>{}, 2, 4, cNumInputFiles + 1)};
+    TestOutputCleaner const cleaner{
+            {std::string{cTestInputDirectory},
+             std::string{cTestSingleThreadedArchiveDirectory},
+             std::string{cTestMultiThreadedArchiveDirectory},
+             std::string{cTestSingleThreadedOutputDirectory},
+             std::string{cTestMultiThreadedOutputDirectory}}
+    };
+    auto const file_names{create_input_directory()};
+
+    compress_and_decompress(
+            1,
+            cTestSingleThreadedArchiveDirectory,
+            cTestSingleThreadedOutputDirectory
+    );
+    compress_and_decompress(
+            num_threads,
+            cTestMultiThreadedArchiveDirectory,
+            cTestMultiThreadedOutputDirectory
+    );
+
+    for (auto const& file_name : file_names) {
+        auto const expected{read_file(std::filesystem::path{cTestInputDirectory} / file_name)};
+        auto const single_threaded_output{
+                read_file(std::filesystem::path{cTestSingleThreadedOutputDirectory} / file_name)
+        };
+        auto const multi_threaded_output{
+                read_file(std::filesystem::path{cTestMultiThreadedOutputDirectory} / file_name)
+        };
+        REQUIRE((expected == single_threaded_output));
+        REQUIRE((expected == multi_threaded_output));
+    }
+    REQUIRE(std::filesystem::is_directory(
+            std::filesystem::path{cTestSingleThreadedOutputDirectory} / cEmptyDirectoryName
+    ));
+    REQUIRE(std::filesystem::is_directory(
+            std::filesystem::path{cTestMultiThreadedOutputDirectory} / cEmptyDirectoryName
+    ));
+
+    // Each decompressed tree must contain exactly the entries of the input directory.
+    auto const count_entries = [](std::string_view dir) -> size_t {
+        return static_cast<size_t>(std::distance(
+                std::filesystem::recursive_directory_iterator{dir},
+                std::filesystem::recursive_directory_iterator{}
+        ));
+    };
+    auto const num_input_entries{count_entries(cTestInputDirectory)};
+    REQUIRE((num_input_entries == count_entries(cTestSingleThreadedOutputDirectory)));
+    REQUIRE((num_input_entries == count_entries(cTestMultiThreadedOutputDirectory)));
+}
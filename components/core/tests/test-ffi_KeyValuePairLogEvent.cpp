@@ -250,6 +250,58 @@ TEST_CASE("ffi_Value_basic", "[ffi][Value]") {
     );
 }
 
+TEST_CASE("ffi_NodeIdValuePairs_basic", "[ffi][NodeIdValuePairs]") {
+    constexpr value_int_t cIntVal{1000};
+    constexpr std::string_view cStringVal{"This is a test string message"};
+
+    KeyValuePairLogEvent::NodeIdValuePairs node_id_value_pairs;
+    REQUIRE(node_id_value_pairs.empty());
+    REQUIRE(node_id_value_pairs.emplace(3, Value{string{cStringVal}}));
+    REQUIRE(node_id_value_pairs.emplace(1, Value{cIntVal}));
+    REQUIRE(node_id_value_pairs.emplace(2, std::nullopt));
+
+    // Duplicate node IDs are ignored
+    REQUIRE_FALSE(node_id_value_pairs.emplace(1, Value{}));
+    REQUIRE((nullptr == node_id_value_pairs.try_emplace_recycled(3)));
+    REQUIRE((3 == node_id_value_pairs.size()));
+
+    // Pairs are iterated in insertion order
+    vector<SchemaTree::Node::id_t> node_ids;
+    for (auto const& [node_id, value] : node_id_value_pairs) {
+        node_ids.push_back(node_id);
+    }
+    REQUIRE((vector<SchemaTree::Node::id_t>{3, 1, 2} == node_ids));
+
+    REQUIRE(node_id_value_pairs.contains(1));
+    REQUIRE_FALSE(node_id_value_pairs.contains(0));
+    REQUIRE((node_id_value_pairs.end() == node_id_value_pairs.find(4)));
+    REQUIRE((cIntVal == node_id_value_pairs.at(1).value().get_immutable_view<value_int_t>()));
+    REQUIRE_FALSE(node_id_value_pairs.at(2).has_value());
+    REQUIRE_THROWS_AS(
+            node_id_value_pairs.at(4),
+            KeyValuePairLogEvent::NodeIdValuePairs::OperationFailed
+    );
+
+    // Clearing keeps the pairs' values so that their buffers can be reused
+    node_id_value_pairs.clear();
+    REQUIRE(node_id_value_pairs.empty());
+    REQUIRE_FALSE(node_id_value_pairs.contains(3));
+    auto* recycled_value{node_id_value_pairs.try_emplace_recycled(5)};
+    REQUIRE((nullptr != recycled_value));
+    REQUIRE(recycled_value->has_value());
+    auto const released_string{recycled_value->value().release<string>()};
+    REQUIRE((released_string == string{cStringVal}));
+    REQUIRE(recycled_value->value().is_null());
+    REQUIRE_FALSE(recycled_value->value().release<string>().has_value());
+    REQUIRE((node_id_value_pairs.find(5) == node_id_value_pairs.begin()));
+
+    // Moving leaves the moved-from instance empty
+    auto moved_node_id_value_pairs{std::move(node_id_value_pairs)};
+    REQUIRE((1 == moved_node_id_value_pairs.size()));
+    // NOLINTNEXTLINE(bugprone-use-after-move, hicpp-invalid-access-moved)
+    REQUIRE(node_id_value_pairs.empty());
+}
+
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
 TEST_CASE("ffi_KeyValuePairLogEvent_create", "[ffi]") {
     /*
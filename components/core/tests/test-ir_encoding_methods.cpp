@@ -1,8 +1,10 @@
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -24,16 +26,23 @@
 #include "../src/clp/ffi/ir_stream/decoding_methods.hpp"
 #include "../src/clp/ffi/ir_stream/Deserializer.hpp"
 #include "../src/clp/ffi/ir_stream/encoding_methods.hpp"
+#include "../src/clp/ffi/ir_stream/IrStreamIndex.hpp"
 #include "../src/clp/ffi/ir_stream/IrUnitType.hpp"
 #include "../src/clp/ffi/ir_stream/protocol_constants.hpp"
 #include "../src/clp/ffi/ir_stream/search/test/utils.hpp"
 #include "../src/clp/ffi/ir_stream/Serializer.hpp"
+#include "../src/clp/ffi/ir_stream/StreamingSerializer.hpp"
 #include "../src/clp/ffi/ir_stream/utils.hpp"
 #include "../src/clp/ffi/KeyValuePairLogEvent.hpp"
 #include "../src/clp/ffi/SchemaTree.hpp"
+#include "../src/clp/FileReader.hpp"
+#include "../src/clp/FileWriter.hpp"
 #include "../src/clp/ir/LogEventDeserializer.hpp"
 #include "../src/clp/ir/types.hpp"
+#include "../src/clp/ReaderInterface.hpp"
+#include "../src/clp/streaming_compression/zstd/Decompressor.hpp"
 #include "../src/clp/time_types.hpp"
+#include "TestOutputCleaner.hpp"
 
 using clp::BufferReader;
 using clp::enum_to_underlying_type;
@@ -51,10 +60,15 @@ using clp::ffi::ir_stream::deserialize_utc_offset_change;
 using clp::ffi::ir_stream::Deserializer;
 using clp::ffi::ir_stream::encoded_tag_t;
 using clp::ffi::ir_stream::get_encoding_type;
+using clp::ffi::ir_stream::ColumnarLogEvents;
 using clp::ffi::ir_stream::IRErrorCode;
+using clp::ffi::ir_stream::IrStreamIndex;
+using clp::ffi::ir_stream::LogEventColumn;
+using clp::ffi::ir_stream::MsgpackLogEvent;
 using clp::ffi::ir_stream::search::test::unpack_and_serialize_msgpack_bytes;
 using clp::ffi::ir_stream::serialize_utc_offset_change;
 using clp::ffi::ir_stream::Serializer;
+using clp::ffi::ir_stream::StreamingSerializer;
 using clp::ffi::ir_stream::validate_protocol_version;
 using clp::ffi::KeyValuePairLogEvent;
 using clp::ffi::wildcard_query_matches_any_encoded_var;
@@ -250,6 +264,15 @@ template <typename encoded_variable_t>
         Serializer<encoded_variable_t>& serializer
 ) -> bool;
 
+/**
+ * Deserializes all key-value pair log events from the given IR stream, asserting that the stream is
+ * valid and complete.
+ * @param reader
+ * @return The auto-generated and user-generated kv-pairs of each log event, as JSON objects.
+ */
+[[nodiscard]] auto deserialize_kv_pair_log_events(clp::ReaderInterface& reader)
+        -> vector<std::pair<nlohmann::json, nlohmann::json>>;
+
 template <typename encoded_variable_t>
 [[nodiscard]] auto serialize_log_events(
         vector<UnstructuredLogEvent> const& log_events,
@@ -428,6 +451,28 @@ auto unpack_and_assert_serialization_failure(
     }
     return true;
 }
+
+auto deserialize_kv_pair_log_events(clp::ReaderInterface& reader)
+        -> vector<std::pair<nlohmann::json, nlohmann::json>> {
+    auto deserializer_result{Deserializer<IrUnitHandler>::create(reader, IrUnitHandler{})};
+    REQUIRE_FALSE(deserializer_result.has_error());
+    auto& deserializer{deserializer_result.value()};
+    while (true) {
+        auto const result{deserializer.deserialize_next_ir_unit(reader)};
+        REQUIRE_FALSE(result.has_error());
+        if (clp::ffi::ir_stream::IrUnitType::EndOfStream == result.value()) {
+            break;
+        }
+    }
+
+    vector<std::pair<nlohmann::json, nlohmann::json>> auto_gen_and_user_gen_object_pairs;
+    for (auto const& log_event : deserializer.get_ir_unit_handler().get_deserialized_log_events()) {
+        auto serialized_json_result{log_event.serialize_to_json()};
+        REQUIRE_FALSE(serialized_json_result.has_error());
+        auto_gen_and_user_gen_object_pairs.emplace_back(std::move(serialized_json_result.value()));
+    }
+    return auto_gen_and_user_gen_object_pairs;
+}
 }  // namespace
 
 /**
@@ -1364,6 +1409,448 @@ TEMPLATE_TEST_CASE(
     REQUIRE((eof_result.has_error() && std::errc::operation_not_permitted == eof_result.error()));
 }
 
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_kv_pair_resume_from_checkpoint",
+        "[clp][ffi][ir_stream]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    constexpr size_t cNumLogEvents{40};
+    constexpr size_t cNumLogEventsPerCheckpoint{10};
+    constexpr size_t cNumKeys{7};
+    constexpr epoch_time_ms_t cTimestampInterval{1000};
+
+    vector<int8_t> ir_buf;
+    vector<nlohmann::json> expected_user_gen_objs;
+    auto result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(result.has_error());
+    auto& serializer{result.value()};
+
+    auto const empty_obj = nlohmann::json::parse("{}");
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        if (0 == i % cNumLogEventsPerCheckpoint) {
+            serializer.add_checkpoint();
+        }
+        // New keys keep getting added to the schema tree throughout the stream
+        nlohmann::json const user_gen_obj
+                = {{"idx", i}, {"key_" + std::to_string(i % cNumKeys), {{"value", "str"}}}};
+        auto const timestamp{static_cast<epoch_time_ms_t>(i) * cTimestampInterval};
+        REQUIRE_FALSE(unpack_and_serialize_msgpack_bytes(
+                              nlohmann::json::to_msgpack(empty_obj),
+                              nlohmann::json::to_msgpack(user_gen_obj),
+                              serializer,
+                              timestamp
+        )
+                              .has_error());
+        expected_user_gen_objs.emplace_back(user_gen_obj);
+    }
+    flush_and_clear_serializer_buffer(serializer, ir_buf);
+    ir_buf.push_back(clp::ffi::ir_stream::cProtocol::Eof);
+
+    auto const index_result{IrStreamIndex::deserialize(serializer.get_index().serialize())};
+    REQUIRE_FALSE(index_result.has_error());
+    auto const& index{index_result.value()};
+    auto const& checkpoints{index.get_checkpoints()};
+    REQUIRE((cNumLogEvents / cNumLogEventsPerCheckpoint == checkpoints.size()));
+
+    // Each checkpoint's timestamp range covers the log events until the next checkpoint
+    constexpr auto cCheckpointDuration{
+            static_cast<epoch_time_ms_t>(cNumLogEventsPerCheckpoint) * cTimestampInterval
+    };
+    REQUIRE((vector<size_t>{1, 2}
+             == index.find_checkpoints_in_time_range(cCheckpointDuration, 2 * cCheckpointDuration)
+    ));
+    REQUIRE(index.find_checkpoints_in_time_range(-2, -1).empty());
+
+    for (size_t checkpoint_idx{0}; checkpoint_idx < checkpoints.size(); ++checkpoint_idx) {
+        auto const& checkpoint{checkpoints.at(checkpoint_idx)};
+        REQUIRE((checkpoint_idx * cNumLogEventsPerCheckpoint == checkpoint.log_event_idx));
+        REQUIRE(checkpoint.timestamp_range.has_value());
+
+        BufferReader reader{size_checked_pointer_cast<char>(ir_buf.data()), ir_buf.size()};
+        auto deserializer_result{Deserializer<IrUnitHandler>::create(reader, IrUnitHandler{})};
+        REQUIRE_FALSE(deserializer_result.has_error());
+        auto& deserializer{deserializer_result.value()};
+        REQUIRE_FALSE(deserializer.resume_from_checkpoint(index, checkpoint_idx).has_error());
+        reader.seek_from_begin(checkpoint.ir_stream_offset);
+
+        while (true) {
+            auto const ir_unit_type_result{deserializer.deserialize_next_ir_unit(reader)};
+            REQUIRE_FALSE(ir_unit_type_result.has_error());
+            if (clp::ffi::ir_stream::IrUnitType::EndOfStream == ir_unit_type_result.value()) {
+                break;
+            }
+        }
+
+        auto const& ir_unit_handler{deserializer.get_ir_unit_handler()};
+        auto const& deserialized_log_events{ir_unit_handler.get_deserialized_log_events()};
+        auto const& deserialized_log_event_indices{
+                ir_unit_handler.get_deserialized_log_event_indices()
+        };
+        REQUIRE((cNumLogEvents - checkpoint.log_event_idx == deserialized_log_events.size()));
+        for (size_t i{0}; i < deserialized_log_events.size(); ++i) {
+            auto const log_event_idx{checkpoint.log_event_idx + i};
+            REQUIRE((log_event_idx == deserialized_log_event_indices.at(i)));
+            auto const serialized_json_result{deserialized_log_events.at(i).serialize_to_json()};
+            REQUIRE_FALSE(serialized_json_result.has_error());
+            REQUIRE((expected_user_gen_objs.at(log_event_idx)
+                     == serialized_json_result.value().second));
+        }
+    }
+
+    // Deserialization can't resume from a checkpoint before the current position
+    BufferReader reader{size_checked_pointer_cast<char>(ir_buf.data()), ir_buf.size()};
+    auto deserializer_result{Deserializer<IrUnitHandler>::create(reader, IrUnitHandler{})};
+    REQUIRE_FALSE(deserializer_result.has_error());
+    auto& deserializer{deserializer_result.value()};
+    REQUIRE_FALSE(deserializer.resume_from_checkpoint(index, 2).has_error());
+    auto const resume_result{deserializer.resume_from_checkpoint(index, 1)};
+    REQUIRE((resume_result.has_error() && std::errc::invalid_argument == resume_result.error()));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_kv_pair_batch_serde",
+        "[clp][ffi][ir_stream][Serializer]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    constexpr size_t cNumLogEvents{20};
+    constexpr size_t cNumKeys{3};
+
+    vector<std::pair<nlohmann::json, nlohmann::json>> expected_auto_gen_and_user_gen_object_pairs;
+    vector<msgpack::object_handle> msgpack_obj_handles;
+    auto to_msgpack_map = [&](nlohmann::json const& obj) -> msgpack::object_map {
+        auto const msgpack_bytes{nlohmann::json::to_msgpack(obj)};
+        msgpack_obj_handles.emplace_back(msgpack::unpack(
+                size_checked_pointer_cast<char const>(msgpack_bytes.data()),
+                msgpack_bytes.size()
+        ));
+        return msgpack_obj_handles.back().get().via.map;
+    };
+
+    vector<MsgpackLogEvent> log_events;
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        nlohmann::json const auto_gen_obj = {{"level", 0 == i % 2 ? "INFO" : "WARN"}};
+        nlohmann::json const user_gen_obj
+                = {{"idx", i}, {"key_" + std::to_string(i % cNumKeys), {{"value", 1.5}}}};
+        expected_auto_gen_and_user_gen_object_pairs.emplace_back(auto_gen_obj, user_gen_obj);
+        log_events.emplace_back(MsgpackLogEvent{
+                .auto_gen_kv_pairs_map = to_msgpack_map(auto_gen_obj),
+                .user_gen_kv_pairs_map = to_msgpack_map(user_gen_obj),
+                .timestamp = static_cast<epoch_time_ms_t>(i)
+        });
+    }
+
+    auto batch_serializer_result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(batch_serializer_result.has_error());
+    auto& batch_serializer{batch_serializer_result.value()};
+    auto single_serializer_result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(single_serializer_result.has_error());
+    auto& single_serializer{single_serializer_result.value()};
+
+    std::span<MsgpackLogEvent const> const log_events_view{log_events};
+    REQUIRE_FALSE(
+            batch_serializer.serialize_msgpack_maps(log_events_view.first(cNumLogEvents / 2))
+                    .has_error()
+    );
+    REQUIRE_FALSE(
+            batch_serializer.serialize_msgpack_maps(log_events_view.subspan(cNumLogEvents / 2))
+                    .has_error()
+    );
+    for (auto const& log_event : log_events) {
+        REQUIRE_FALSE(single_serializer
+                              .serialize_msgpack_map(
+                                      log_event.auto_gen_kv_pairs_map,
+                                      log_event.user_gen_kv_pairs_map,
+                                      log_event.timestamp
+                              )
+                              .has_error());
+    }
+
+    // A batch is serialized the same way as its log events are individually
+    vector<int8_t> batch_ir_buf;
+    vector<int8_t> single_ir_buf;
+    flush_and_clear_serializer_buffer(batch_serializer, batch_ir_buf);
+    flush_and_clear_serializer_buffer(single_serializer, single_ir_buf);
+    REQUIRE((batch_ir_buf == single_ir_buf));
+
+    // A batch containing an invalid log event fails as a whole, including the keys added by the
+    // valid log events before it
+    nlohmann::json const new_key_obj = {{"new_key", "value"}};
+    std::array<msgpack::object_kv, 1> integer_key_fields{
+            msgpack::object_kv{.key = msgpack::object{0}, .val = msgpack::object{0}}
+    };
+    auto const empty_map{to_msgpack_map(nlohmann::json::parse("{}"))};
+    std::array<MsgpackLogEvent, 2> const invalid_log_events{
+            MsgpackLogEvent{
+                    .auto_gen_kv_pairs_map = empty_map,
+                    .user_gen_kv_pairs_map = to_msgpack_map(new_key_obj),
+                    .timestamp = std::nullopt
+            },
+            MsgpackLogEvent{
+                    .auto_gen_kv_pairs_map = empty_map,
+                    .user_gen_kv_pairs_map
+                    = {.size = static_cast<uint32_t>(integer_key_fields.size()),
+                       .ptr = integer_key_fields.data()},
+                    .timestamp = std::nullopt
+            }
+    };
+    REQUIRE(batch_serializer.serialize_msgpack_maps(invalid_log_events).has_error());
+    REQUIRE(batch_serializer.get_ir_buf_view().empty());
+    REQUIRE_FALSE(batch_serializer.serialize_msgpack_maps(std::span{invalid_log_events}.first(1))
+                          .has_error());
+    expected_auto_gen_and_user_gen_object_pairs.emplace_back(
+            nlohmann::json::parse("{}"),
+            new_key_obj
+    );
+
+    flush_and_clear_serializer_buffer(batch_serializer, batch_ir_buf);
+    batch_ir_buf.push_back(clp::ffi::ir_stream::cProtocol::Eof);
+    BufferReader reader{size_checked_pointer_cast<char>(batch_ir_buf.data()), batch_ir_buf.size()};
+    REQUIRE((expected_auto_gen_and_user_gen_object_pairs
+             == deserialize_kv_pair_log_events(reader)));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_kv_pair_columnar_serde",
+        "[clp][ffi][ir_stream][Serializer]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    using clp::ffi::ir_stream::IrSerializationError;
+    using clp::ffi::ir_stream::IrSerializationErrorEnum;
+
+    constexpr size_t cNumLogEvents{6};
+    constexpr epoch_time_ms_t cTimestampInterval{1000};
+
+    vector<string> levels;
+    vector<int64_t> indices;
+    vector<double> ratios;
+    // `std::vector<bool>` isn't contiguous
+    std::array<bool, cNumLogEvents> oks{};
+    vector<string> messages;
+    vector<std::optional<epoch_time_ms_t>> timestamps;
+    vector<std::pair<nlohmann::json, nlohmann::json>> expected_auto_gen_and_user_gen_object_pairs;
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        levels.emplace_back(0 == i % 2 ? "INFO" : "WARN");
+        indices.emplace_back(static_cast<int64_t>(i) * INT32_MAX);
+        ratios.emplace_back(static_cast<double>(i) / 4);
+        oks.at(i) = 0 == i % 3;
+        messages.emplace_back("uid=" + std::to_string(i) + ", CPU usage: 99.99%");
+        timestamps.emplace_back(static_cast<epoch_time_ms_t>(i) * cTimestampInterval);
+        expected_auto_gen_and_user_gen_object_pairs.emplace_back(
+                nlohmann::json{{"level", levels.back()}},
+                nlohmann::json{
+                        {"idx", indices.back()},
+                        {"data", {{"ratio", ratios.back()}, {"ok", oks.at(i)}}},
+                        {"msg", messages.back()}
+                }
+        );
+    }
+    vector<string_view> const level_views(levels.cbegin(), levels.cend());
+    vector<string_view> const message_views(messages.cbegin(), messages.cend());
+
+    vector<LogEventColumn> const auto_gen_columns{
+            {.key_path = {"level"}, .values = std::span<string_view const>{level_views}}
+    };
+    vector<LogEventColumn> const user_gen_columns{
+            {.key_path = {"idx"}, .values = std::span<int64_t const>{indices}},
+            {.key_path = {"data", "ratio"}, .values = std::span<double const>{ratios}},
+            {.key_path = {"data", "ok"}, .values = std::span<bool const>{oks}},
+            {.key_path = {"msg"}, .values = std::span<string_view const>{message_views}}
+    };
+    ColumnarLogEvents const log_events{
+            .num_log_events = cNumLogEvents,
+            .auto_gen_columns = auto_gen_columns,
+            .user_gen_columns = user_gen_columns,
+            .timestamps = timestamps
+    };
+
+    auto result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(result.has_error());
+    auto& serializer{result.value()};
+    vector<int8_t> ir_buf;
+    flush_and_clear_serializer_buffer(serializer, ir_buf);
+
+    serializer.add_checkpoint();
+    REQUIRE_FALSE(serializer.serialize_columns(log_events).has_error());
+
+    // Invalid batches fail without serializing anything
+    auto const assert_invalid_columns = [&](vector<LogEventColumn> const& invalid_user_gen_columns,
+                                            std::span<std::optional<epoch_time_ms_t> const>
+                                                    invalid_timestamps) -> void {
+        auto const ir_buf_size{serializer.get_ir_buf_view().size()};
+        auto const invalid_result{serializer.serialize_columns(
+                {.num_log_events = cNumLogEvents,
+                 .auto_gen_columns = auto_gen_columns,
+                 .user_gen_columns = invalid_user_gen_columns,
+                 .timestamps = invalid_timestamps}
+        )};
+        REQUIRE(invalid_result.has_error());
+        REQUIRE((IrSerializationError{IrSerializationErrorEnum::InvalidLogEventColumns}
+                 == invalid_result.error()));
+        REQUIRE((ir_buf_size == serializer.get_ir_buf_view().size()));
+    };
+    std::span<int64_t const> const indices_view{indices};
+    assert_invalid_columns({{.key_path = {"new_key"}, .values = indices_view.first(1)}}, {});
+    assert_invalid_columns(user_gen_columns, std::span{timestamps}.first(1));
+    assert_invalid_columns({{.key_path = {}, .values = indices_view}}, {});
+    assert_invalid_columns(
+            {{.key_path = {"new_key"}, .values = indices_view},
+             {.key_path = {"new_key"}, .values = indices_view}},
+            {}
+    );
+    assert_invalid_columns(
+            {{.key_path = {"new_key"}, .values = indices_view},
+             {.key_path = {"new_key", "nested"}, .values = indices_view}},
+            {}
+    );
+
+    // Log events without user-generated columns have an empty user-generated object
+    REQUIRE_FALSE(serializer
+                          .serialize_columns(
+                                  {.num_log_events = cNumLogEvents,
+                                   .auto_gen_columns = auto_gen_columns,
+                                   .user_gen_columns = {},
+                                   .timestamps = {}}
+                          )
+                          .has_error());
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        expected_auto_gen_and_user_gen_object_pairs.emplace_back(
+                expected_auto_gen_and_user_gen_object_pairs.at(i).first,
+                nlohmann::json::parse("{}")
+        );
+    }
+
+    // The columns' nodes already exist in the schema trees
+    REQUIRE_FALSE(serializer.serialize_columns(log_events).has_error());
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        expected_auto_gen_and_user_gen_object_pairs.emplace_back(
+                expected_auto_gen_and_user_gen_object_pairs.at(i)
+        );
+    }
+
+    auto const& checkpoints{serializer.get_index().get_checkpoints()};
+    REQUIRE((1 == checkpoints.size()));
+    REQUIRE((std::make_pair(timestamps.front().value(), timestamps.back().value())
+             == checkpoints.front().timestamp_range));
+
+    flush_and_clear_serializer_buffer(serializer, ir_buf);
+    ir_buf.push_back(clp::ffi::ir_stream::cProtocol::Eof);
+    BufferReader reader{size_checked_pointer_cast<char>(ir_buf.data()), ir_buf.size()};
+    REQUIRE((expected_auto_gen_and_user_gen_object_pairs
+             == deserialize_kv_pair_log_events(reader)));
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_kv_pair_streaming_serde",
+        "[clp][ffi][ir_stream][StreamingSerializer]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    constexpr string_view cTestStreamPath{"test-kv-pair-streaming-serializer.clp.zst"};
+    constexpr size_t cFrameSize{512};
+    constexpr size_t cNumBatches{20};
+    constexpr size_t cNumLogEventsPerBatch{10};
+    constexpr size_t cDecompressorReadBufferCapacity{4096};
+    TestOutputCleaner const test_cleanup{{string{cTestStreamPath}}};
+
+    vector<std::pair<nlohmann::json, nlohmann::json>> expected_auto_gen_and_user_gen_object_pairs;
+    IrStreamIndex index;
+    {
+        clp::FileWriter file_writer;
+        file_writer.open(string{cTestStreamPath}, clp::FileWriter::OpenMode::CREATE_FOR_WRITING);
+        auto result{StreamingSerializer<TestType>::create(file_writer, cFrameSize)};
+        REQUIRE_FALSE(result.has_error());
+        auto& serializer{result.value()};
+
+        auto const empty_obj = nlohmann::json::parse("{}");
+        for (size_t batch_idx{0}; batch_idx < cNumBatches; ++batch_idx) {
+            // New keys keep getting added to the schema tree throughout the stream
+            auto const key{"key_" + std::to_string(batch_idx)};
+            vector<int64_t> indices;
+            vector<string_view> const values(cNumLogEventsPerBatch, "value");
+            for (size_t i{0}; i < cNumLogEventsPerBatch; ++i) {
+                indices.emplace_back(
+                        static_cast<int64_t>(batch_idx * cNumLogEventsPerBatch + i)
+                );
+                expected_auto_gen_and_user_gen_object_pairs.emplace_back(
+                        empty_obj,
+                        nlohmann::json{{"idx", indices.back()}, {key, "value"}}
+                );
+            }
+            vector<LogEventColumn> const user_gen_columns{
+                    {.key_path = {"idx"}, .values = std::span<int64_t const>{indices}},
+                    {.key_path = {key}, .values = std::span<string_view const>{values}}
+            };
+            REQUIRE_FALSE(serializer
+                                  .serialize_columns(
+                                          {.num_log_events = cNumLogEventsPerBatch,
+                                           .auto_gen_columns = {},
+                                           .user_gen_columns = user_gen_columns,
+                                           .timestamps = {}}
+                                  )
+                                  .has_error());
+        }
+        serializer.close();
+        index = serializer.get_index();
+        file_writer.close();
+    }
+
+    auto const& checkpoints{index.get_checkpoints()};
+    REQUIRE((checkpoints.size() > 2));
+    REQUIRE((0 == checkpoints.front().log_event_idx));
+
+    clp::FileReader file_reader{string{cTestStreamPath}};
+    clp::streaming_compression::zstd::Decompressor decompressor;
+    decompressor.open(file_reader, cDecompressorReadBufferCapacity);
+    REQUIRE((expected_auto_gen_and_user_gen_object_pairs
+             == deserialize_kv_pair_log_events(decompressor)));
+    decompressor.close();
+
+    // Deserialization can start at the compressed frame of any checkpoint
+    for (size_t checkpoint_idx{0}; checkpoint_idx < checkpoints.size(); ++checkpoint_idx) {
+        auto const& checkpoint{checkpoints.at(checkpoint_idx)};
+        REQUIRE(checkpoint.compressed_offset.has_value());
+
+        file_reader.seek_from_begin(0);
+        decompressor.open(file_reader, cDecompressorReadBufferCapacity);
+        auto deserializer_result{
+                Deserializer<IrUnitHandler>::create(decompressor, IrUnitHandler{})
+        };
+        REQUIRE_FALSE(deserializer_result.has_error());
+        auto& deserializer{deserializer_result.value()};
+        REQUIRE_FALSE(deserializer.resume_from_checkpoint(index, checkpoint_idx).has_error());
+        decompressor.close();
+
+        file_reader.seek_from_begin(checkpoint.compressed_offset.value());
+        decompressor.open(file_reader, cDecompressorReadBufferCapacity);
+        while (true) {
+            auto const ir_unit_type_result{deserializer.deserialize_next_ir_unit(decompressor)};
+            REQUIRE_FALSE(ir_unit_type_result.has_error());
+            if (clp::ffi::ir_stream::IrUnitType::EndOfStream == ir_unit_type_result.value()) {
+                break;
+            }
+        }
+        decompressor.close();
+
+        auto const& deserialized_log_events{
+                deserializer.get_ir_unit_handler().get_deserialized_log_events()
+        };
+        REQUIRE((expected_auto_gen_and_user_gen_object_pairs.size() - checkpoint.log_event_idx
+                 == deserialized_log_events.size()));
+        for (size_t i{0}; i < deserialized_log_events.size(); ++i) {
+            auto const serialized_json_result{deserialized_log_events.at(i).serialize_to_json()};
+            REQUIRE_FALSE(serialized_json_result.has_error());
+            REQUIRE((expected_auto_gen_and_user_gen_object_pairs.at(checkpoint.log_event_idx + i)
+                     == serialized_json_result.value()));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE(
         "ffi_ir_stream_unstructured_log_events_serde",
         "[clp][ffi][ir_stream]",
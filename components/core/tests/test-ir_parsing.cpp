@@ -1,14 +1,66 @@
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "../src/clp/ir/parsing.hpp"
 #include "../src/clp/ir/types.hpp"
+#include "../src/clp/string_utils/string_utils.hpp"
 #include "../src/clp/type_utils.hpp"
 
 using clp::ir::get_bounds_of_next_var;
+using clp::ir::is_delim;
 using std::string;
 using std::string_view;
 using std::vector;
 
+namespace {
+/**
+ * A character-at-a-time implementation of `get_bounds_of_next_var` to check the optimized
+ * implementation against.
+ * @param str
+ * @param begin_pos
+ * @param end_pos
+ * @return Whether a variable was found
+ */
+auto get_bounds_of_next_var_reference(string_view str, size_t& begin_pos, size_t& end_pos)
+        -> bool;
+
+auto get_bounds_of_next_var_reference(string_view str, size_t& begin_pos, size_t& end_pos)
+        -> bool {
+    if (str.length() <= end_pos) {
+        return false;
+    }
+    while (true) {
+        begin_pos = end_pos;
+        while (begin_pos < str.length() && is_delim(str[begin_pos])) {
+            ++begin_pos;
+        }
+        if (str.length() == begin_pos) {
+            return false;
+        }
+        bool contains_decimal_digit = false;
+        bool contains_alphabet = false;
+        end_pos = begin_pos;
+        for (; end_pos < str.length() && false == is_delim(str[end_pos]); ++end_pos) {
+            contains_decimal_digit
+                    = contains_decimal_digit || clp::string_utils::is_decimal_digit(str[end_pos]);
+            contains_alphabet = contains_alphabet || clp::string_utils::is_alphabet(str[end_pos]);
+        }
+        auto const token = str.substr(begin_pos, end_pos - begin_pos);
+        if (contains_decimal_digit
+            || (0 < begin_pos && '=' == str[begin_pos - 1] && contains_alphabet)
+            || clp::ir::could_be_multi_digit_hex_value(token))
+        {
+            return true;
+        }
+    }
+}
+}  // namespace
+
 TEST_CASE("ir::get_bounds_of_next_var", "[ir][get_bounds_of_next_var]") {
     string str;
     size_t begin_pos;
@@ -100,3 +152,58 @@ TEST_CASE("ir::get_bounds_of_next_var", "[ir][get_bounds_of_next_var]") {
     REQUIRE(get_bounds_of_next_var(str, begin_pos, end_pos) == true);
     REQUIRE("var123" == str.substr(begin_pos, end_pos - begin_pos));
 }
+
+TEST_CASE("ir::get_bounds_of_next_var on long messages", "[ir][get_bounds_of_next_var]") {
+    // Check the implementation against the reference implementation on random messages mixing
+    // long tokens, runs of delimiters, and non-ASCII characters.
+    constexpr size_t cNumMessages{2000};
+    constexpr size_t cMaxMessageLength{300};
+    vector<string> const fragments{
+            " ",
+            "    ",
+            "=",
+            "user=alice",
+            "0x7ffd3a2c",
+            "deadbeef",
+            "12345",
+            "-3.14",
+            "org.apache.hadoop.hdfs.server.namenode.FSNamesystem",
+            "task_1427088391284_0034_m_000008",
+            "\\path\\to\\file",
+            "[INFO]",
+            "\xc3\xa9t\xc3\xa9",
+            "\x80\xff",
+            "__init__",
+            string(70, 'a'),
+            string(70, '/'),
+            string(40, '7')
+    };
+
+    std::mt19937 generator{0};
+    std::uniform_int_distribution<size_t> fragment_distribution{0, fragments.size() - 1};
+    for (size_t i = 0; i < cNumMessages; ++i) {
+        string message;
+        while (message.length() < cMaxMessageLength && 0 != generator() % 16) {
+            message += fragments[fragment_distribution(generator)];
+        }
+
+        size_t begin_pos = 0;
+        size_t end_pos = 0;
+        size_t expected_begin_pos = 0;
+        size_t expected_end_pos = 0;
+        while (true) {
+            auto const found = get_bounds_of_next_var(message, begin_pos, end_pos);
+            auto const expected_found = get_bounds_of_next_var_reference(
+                    message,
+                    expected_begin_pos,
+                    expected_end_pos
+            );
+            REQUIRE(expected_found == found);
+            if (false == found) {
+                break;
+            }
+            REQUIRE(expected_begin_pos == begin_pos);
+            REQUIRE(expected_end_pos == end_pos);
+        }
+    }
+}
@@ -0,0 +1,372 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/reducer/ConstRecordIterator.hpp"
+#include "../src/reducer/DDSketch.hpp"
+#include "../src/reducer/DeserializedRecordGroup.hpp"
+#include "../src/reducer/GroupTags.hpp"
+#include "../src/reducer/HyperLogLog.hpp"
+#include "../src/reducer/Pipeline.hpp"
+#include "../src/reducer/Record.hpp"
+#include "../src/reducer/RecordGroupIterator.hpp"
+#include "../src/reducer/sketch_serialization.hpp"
+#include "../src/reducer/SketchOperator.hpp"
+#include "../src/reducer/TopKSketch.hpp"
+
+using reducer::DDSketch;
+using reducer::GroupTags;
+using reducer::HyperLogLog;
+using reducer::SketchOperator;
+using reducer::SketchOutputMode;
+using reducer::SketchType;
+using reducer::TopKSketch;
+
+namespace {
+/**
+ * @param value
+ * @param expected_value
+ * @param relative_error
+ * @return Whether `value` is within `relative_error` of `expected_value`.
+ */
+auto is_within_relative_error(double value, double expected_value, double relative_error) -> bool;
+
+/**
+ * Pushes the results of each stage into an intra-stage pipeline through serialized record groups,
+ * the same way they're sent to the reducer.
+ * @param stages
+ * @param reducer_stage
+ */
+auto push_stage_results(
+        std::vector<reducer::Pipeline*> const& stages,
+        reducer::Pipeline& reducer_stage
+) -> void;
+
+auto is_within_relative_error(double value, double expected_value, double relative_error)
+        -> bool {
+    return std::abs(value - expected_value) <= relative_error * std::abs(expected_value);
+}
+
+auto push_stage_results(
+        std::vector<reducer::Pipeline*> const& stages,
+        reducer::Pipeline& reducer_stage
+) -> void {
+    for (auto* stage : stages) {
+        for (auto results{stage->finish()}; false == results->done(); results->next()) {
+            auto& group = results->get();
+            auto serialized_group{reducer::serialize(group.get_tags(), group.record_iter())};
+            reducer::DeserializedRecordGroup deserialized_group{serialized_group};
+            reducer_stage.push_record_group(
+                    deserialized_group.get_tags(),
+                    deserialized_group.record_iter()
+            );
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("HyperLogLog", "[reducer][sketches]") {
+    constexpr size_t cNumDistinctValues{100'000};
+    // Well above the standard error of 1.04 / sqrt(2^12) ~= 1.6%
+    constexpr double cRelativeError{0.05};
+
+    HyperLogLog first_half;
+    HyperLogLog second_half;
+    HyperLogLog all;
+    for (size_t i{0}; i < cNumDistinctValues; ++i) {
+        auto const value{"value-" + std::to_string(i)};
+        // Duplicates shouldn't affect the estimate
+        (i < cNumDistinctValues / 2 ? first_half : second_half).add(value);
+        (i < cNumDistinctValues / 2 ? first_half : second_half).add(value);
+        all.add(value);
+    }
+
+    SECTION("Small cardinalities") {
+        HyperLogLog sketch;
+        REQUIRE((0.0 == sketch.estimate()));
+        for (auto const* value : {"a", "b", "c", "a"}) {
+            sketch.add(value);
+        }
+        REQUIRE((3 == std::llround(sketch.estimate())));
+        REQUIRE((3 == std::llround(HyperLogLog::deserialize(sketch.serialize()).estimate())));
+    }
+
+    SECTION("Estimate and merge") {
+        REQUIRE(is_within_relative_error(all.estimate(), cNumDistinctValues, cRelativeError));
+        first_half.merge(second_half);
+        REQUIRE((first_half.estimate() == all.estimate()));
+    }
+
+    SECTION("Serialization") {
+        auto const deserialized{HyperLogLog::deserialize(all.serialize())};
+        REQUIRE((deserialized.estimate() == all.estimate()));
+        REQUIRE_THROWS(HyperLogLog::deserialize(all.serialize().substr(1)));
+        REQUIRE_THROWS(HyperLogLog{HyperLogLog::cMaxPrecision + 1});
+        REQUIRE_THROWS(all.merge(HyperLogLog{HyperLogLog::cMinPrecision}));
+    }
+}
+
+TEST_CASE("DDSketch", "[reducer][sketches]") {
+    constexpr int cNumValues{10'000};
+
+    DDSketch odd_values;
+    DDSketch even_values;
+    DDSketch all;
+    for (int i{1}; i <= cNumValues; ++i) {
+        auto const value{static_cast<double>(i) * 0.5};
+        (0 == i % 2 ? even_values : odd_values).add(value);
+        all.add(value);
+    }
+
+    SECTION("Quantiles") {
+        REQUIRE_FALSE(DDSketch{}.get_quantile(0.5).has_value());
+        REQUIRE((cNumValues == all.get_count()));
+        for (auto const quantile : {0.0, 0.25, 0.5, 0.9, 0.99, 1.0}) {
+            auto const expected_value{
+                    std::floor(quantile * (cNumValues - 1) + 1) * 0.5
+            };
+            REQUIRE(is_within_relative_error(
+                    all.get_quantile(quantile).value(),
+                    expected_value,
+                    DDSketch::cDefaultRelativeAccuracy
+            ));
+        }
+    }
+
+    SECTION("Negative and zero values") {
+        DDSketch sketch;
+        for (auto const value : {-100.0, -1.0, 0.0, 0.0, 10.0}) {
+            sketch.add(value);
+        }
+        REQUIRE((-100.0 == sketch.get_quantile(0.0).value()));
+        REQUIRE(is_within_relative_error(
+                sketch.get_quantile(0.25).value(),
+                -1.0,
+                DDSketch::cDefaultRelativeAccuracy
+        ));
+        REQUIRE((0.0 == sketch.get_quantile(0.5).value()));
+        REQUIRE((10.0 == sketch.get_quantile(1.0).value()));
+    }
+
+    SECTION("Merge and serialization") {
+        odd_values.merge(DDSketch::deserialize(even_values.serialize()));
+        REQUIRE((odd_values.get_count() == all.get_count()));
+        for (auto const quantile : {0.1, 0.5, 0.95}) {
+            REQUIRE((odd_values.get_quantile(quantile) == all.get_quantile(quantile)));
+        }
+        REQUIRE_THROWS(DDSketch::deserialize(all.serialize() + "x"));
+        REQUIRE_THROWS(all.merge(DDSketch{0.05}));
+    }
+
+    SECTION("Bounded number of bins") {
+        DDSketch sketch{DDSketch::cDefaultRelativeAccuracy, 16};
+        for (int i{0}; i < 1000; ++i) {
+            sketch.add(std::pow(2.0, i % 64));
+        }
+        // The lowest bins are collapsed, so only high quantiles keep their accuracy
+        REQUIRE(is_within_relative_error(
+                sketch.get_quantile(1.0).value(),
+                std::pow(2.0, 63),
+                DDSketch::cDefaultRelativeAccuracy
+        ));
+        auto const deserialized{DDSketch::deserialize(sketch.serialize())};
+        REQUIRE((deserialized.get_quantile(0.5) == sketch.get_quantile(0.5)));
+    }
+
+    SECTION("Corrupt number of bins") {
+        // A sketch allowing up to 2^32 - 1 bins, whose positive bins claim to use all of them
+        std::string buf;
+        reducer::append_fixed_width(DDSketch::cDefaultRelativeAccuracy, buf);
+        reducer::append_varint(std::numeric_limits<uint32_t>::max(), buf);
+        reducer::append_fixed_width(0.0, buf);
+        reducer::append_fixed_width(0.0, buf);
+        reducer::append_varint(0, buf);
+        reducer::append_varint(std::numeric_limits<uint32_t>::max(), buf);
+        reducer::append_varint(0, buf);
+        REQUIRE_THROWS(DDSketch::deserialize(buf));
+    }
+}
+
+TEST_CASE("TopKSketch", "[reducer][sketches]") {
+    constexpr uint32_t cK{3};
+
+    // A few heavy hitters among many unique values
+    TopKSketch first{cK};
+    TopKSketch second{cK};
+    for (int i{0}; i < 2000; ++i) {
+        first.add("unique-first-" + std::to_string(i));
+        second.add("unique-second-" + std::to_string(i));
+    }
+    first.add("error", 500);
+    first.add("warn", 300);
+    second.add("warn", 300);
+    second.add("info", 400);
+    second.add("debug", 10);
+
+    SECTION("Heavy hitters") {
+        // Misra-Gries only reports values whose decremented counts are still positive
+        auto const top_k{first.get_top_k()};
+        REQUIRE((top_k.size() >= 2));
+        REQUIRE(("error" == top_k[0].first));
+        REQUIRE(("warn" == top_k[1].first));
+        // Each estimate is at most the true count
+        REQUIRE((top_k[0].second <= 500));
+        REQUIRE((top_k[1].second <= 300));
+    }
+
+    SECTION("Merge and serialization") {
+        first.merge(TopKSketch::deserialize(second.serialize()));
+        auto const top_k{first.get_top_k()};
+        REQUIRE((cK == top_k.size()));
+        REQUIRE(("warn" == top_k[0].first));
+        REQUIRE(("error" == top_k[1].first));
+        REQUIRE(("info" == top_k[2].first));
+        REQUIRE((top_k[0].second <= 600));
+
+        auto const serialized{first.serialize()};
+        REQUIRE((TopKSketch::deserialize(serialized).get_top_k() == top_k));
+        REQUIRE_THROWS(TopKSketch::deserialize(serialized.substr(0, serialized.size() - 1)));
+        REQUIRE_THROWS(TopKSketch{0});
+    }
+}
+
+TEST_CASE("SketchOperator", "[reducer][sketches][SketchOperator]") {
+    GroupTags const api_tags{"api"};
+    GroupTags const db_tags{"db"};
+
+    SECTION("Distinct count") {
+        reducer::Pipeline first_stage{reducer::PipelineInputMode::InterStage};
+        reducer::Pipeline second_stage{reducer::PipelineInputMode::InterStage};
+        int first_user_id{0};
+        for (auto* stage : {&first_stage, &second_stage}) {
+            stage->add_pipeline_stage(std::make_shared<SketchOperator>(
+                    SketchType::DistinctCount,
+                    SketchOutputMode::Sketch
+            ));
+            reducer::SingleStringRecordAdapter record{SketchOperator::cValueKey};
+            // The stages overlap on "user-5" to "user-9"
+            for (int i{first_user_id}; i < first_user_id + 10; ++i) {
+                auto const value{"user-" + std::to_string(i)};
+                record.set_record_value(value);
+                reducer::SingleRecordIterator record_it{record};
+                stage->push_record_group(api_tags, record_it);
+            }
+            record.set_record_value("user-0");
+            reducer::SingleRecordIterator record_it{record};
+            stage->push_record_group(db_tags, record_it);
+            first_user_id += 5;
+        }
+
+        reducer::Pipeline reducer_stage{reducer::PipelineInputMode::IntraStage};
+        reducer_stage.add_pipeline_stage(std::make_shared<SketchOperator>(
+                SketchType::DistinctCount,
+                SketchOutputMode::Estimates
+        ));
+        push_stage_results({&first_stage, &second_stage}, reducer_stage);
+        auto results{reducer_stage.finish()};
+        std::map<GroupTags, int64_t> distinct_counts;
+        for (; false == results->done(); results->next()) {
+            auto& group = results->get();
+            auto& record_it = group.record_iter();
+            REQUIRE_FALSE(record_it.done());
+            distinct_counts[group.get_tags()]
+                    = record_it.get().get_int64_value(SketchOperator::cDistinctCountKey);
+            record_it.next();
+            REQUIRE(record_it.done());
+        }
+        REQUIRE((std::map<GroupTags, int64_t>{{api_tags, 15}, {db_tags, 1}} == distinct_counts));
+    }
+
+    SECTION("Quantiles") {
+        reducer::Pipeline stage{reducer::PipelineInputMode::InterStage};
+        stage.add_pipeline_stage(
+                std::make_shared<SketchOperator>(SketchType::Quantiles, SketchOutputMode::Sketch)
+        );
+        reducer::SingleDoubleRecordAdapter record{SketchOperator::cValueKey};
+        for (int i{1}; i <= 100; ++i) {
+            record.set_record_value(static_cast<double>(i));
+            reducer::SingleRecordIterator record_it{record};
+            stage.push_record_group(api_tags, record_it);
+        }
+
+        reducer::Pipeline reducer_stage{reducer::PipelineInputMode::IntraStage};
+        reducer_stage.add_pipeline_stage(
+                std::make_shared<SketchOperator>(SketchType::Quantiles, SketchOutputMode::Estimates)
+        );
+        push_stage_results({&stage}, reducer_stage);
+        auto results{reducer_stage.finish()};
+        REQUIRE_FALSE(results->done());
+        auto& record_it = results->get().record_iter();
+        auto const& estimates = record_it.get();
+        REQUIRE((100 == estimates.get_int64_value(SketchOperator::cCountKey)));
+        REQUIRE(is_within_relative_error(
+                estimates.get_double_value("p50"),
+                50.0,
+                DDSketch::cDefaultRelativeAccuracy
+        ));
+        REQUIRE(is_within_relative_error(
+                estimates.get_double_value("p99"),
+                99.0,
+                DDSketch::cDefaultRelativeAccuracy
+        ));
+        results->next();
+        REQUIRE(results->done());
+    }
+
+    SECTION("Top-k") {
+        reducer::Pipeline stage{reducer::PipelineInputMode::InterStage};
+        stage.add_pipeline_stage(
+                std::make_shared<SketchOperator>(SketchType::TopK, SketchOutputMode::Sketch, 2)
+        );
+        reducer::SingleStringRecordAdapter record{SketchOperator::cValueKey};
+        for (auto const* value : {"GET", "POST", "GET", "PUT", "GET", "POST"}) {
+            record.set_record_value(value);
+            reducer::SingleRecordIterator record_it{record};
+            stage.push_record_group(api_tags, record_it);
+        }
+
+        reducer::Pipeline reducer_stage{reducer::PipelineInputMode::IntraStage};
+        reducer_stage.add_pipeline_stage(
+                std::make_shared<SketchOperator>(SketchType::TopK, SketchOutputMode::Estimates, 2)
+        );
+        push_stage_results({&stage}, reducer_stage);
+        auto results{reducer_stage.finish()};
+        REQUIRE_FALSE(results->done());
+        std::vector<std::pair<std::string, int64_t>> top_k;
+        for (auto& record_it = results->get().record_iter(); false == record_it.done();
+             record_it.next())
+        {
+            auto const& top_k_record = record_it.get();
+            top_k.emplace_back(
+                    top_k_record.get_string_view(SketchOperator::cValueKey),
+                    top_k_record.get_int64_value(SketchOperator::cCountKey)
+            );
+        }
+        REQUIRE((std::vector<std::pair<std::string, int64_t>>{{"GET", 3}, {"POST", 2}} == top_k));
+    }
+}
+
+TEST_CASE("Sketch serialization helpers", "[reducer][sketches]") {
+    std::string buf;
+    for (auto const value : {uint64_t{0}, uint64_t{127}, uint64_t{128}, UINT64_MAX}) {
+        reducer::append_varint(value, buf);
+    }
+    reducer::append_fixed_width(1.5, buf);
+
+    reducer::SketchReader reader{buf};
+    REQUIRE((0 == reader.read_varint()));
+    REQUIRE((127 == reader.read_varint()));
+    REQUIRE((128 == reader.read_varint()));
+    REQUIRE((UINT64_MAX == reader.read_varint()));
+    REQUIRE((1.5 == reader.read_fixed_width<double>()));
+    REQUIRE(reader.done());
+    REQUIRE_THROWS(reader.read_varint());
+}
@@ -0,0 +1,713 @@
+#!/usr/bin/env python3
+"""Runs an end-to-end ingestion and search throughput benchmark of the CLP-core's binaries."""
+
+from __future__ import annotations
+
+import argparse
+import datetime
+import http.server
+import json
+import logging
+import os
+import platform
+import random
+import re
+import shlex
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Any
+
+# Set up console logging
+logging_console_handler = logging.StreamHandler()
+logging_formatter = logging.Formatter(
+    "%(asctime)s.%(msecs)03d %(levelname)s [%(module)s] %(message)s", datefmt="%Y-%m-%dT%H:%M:%S"
+)
+logging_console_handler.setFormatter(logging_formatter)
+
+# Set up root logger
+root_logger = logging.getLogger()
+root_logger.setLevel(logging.INFO)
+root_logger.addHandler(logging_console_handler)
+
+# Create logger
+logger = logging.getLogger(__name__)
+
+REPORT_VERSION = 1
+
+DEFAULT_NUM_EVENTS = 200_000
+DEFAULT_SEED = 0x5EEDC10B
+BYTES_PER_MB = 1_000_000
+
+CORE_DIR = Path(__file__).resolve().parents[3]
+DEFAULT_CLG_QUERIES_PATH = CORE_DIR / "tests" / "test_search_queries" / "easy.txt"
+
+# KQL queries over the fields of the generated corpus
+DEFAULT_KQL_QUERIES = [
+    "level: ERROR",
+    "status: 500 AND service: auth",
+    "latency_ms > 990",
+    'message: "*timed out after 3 retries*"',
+    'http.path: "/v1/orders/*"',
+]
+
+# Matches the measurements logged by `Profiler` in builds with `PROF_ENABLED`, e.g.,
+# "clp::Profiler::ContinuousMeasurementIndex::Compression took 1.5 s"
+PROFILER_MEASUREMENT_PATTERN = re.compile(r"(\S*MeasurementIndex::\w+) took ([0-9.eE+-]+) s")
+
+TELEMETRY_ATTRIBUTE_PREFIX = "clp.query."
+# How long to wait for the search telemetry exported when a search process exits
+TELEMETRY_WAIT_SECONDS = 2.0
+
+_SERVICES = ["api", "auth", "billing", "search"]
+_HTTP_METHODS = ["GET", "POST", "PUT"]
+_RESOURCES = ["orders", "users", "sessions", "invoices"]
+_STATUS_CODES = [200, 200, 200, 201, 404, 500]
+_NUM_USERS = 5000
+_NUM_HOSTS = 64
+
+
+@dataclass
+class Corpus:
+    """The inputs to benchmark."""
+
+    json_path: Path | None
+    json_num_events: int
+    text_path: Path | None
+    text_num_events: int
+
+    def to_dict(self) -> dict[str, Any]:
+        """:return: The corpus's description for the report."""
+        result: dict[str, Any] = {}
+        if self.json_path is not None:
+            result["json"] = {
+                "path": str(self.json_path),
+                "num_bytes": _get_size(self.json_path),
+                "num_events": self.json_num_events,
+            }
+        if self.text_path is not None:
+            result["text"] = {
+                "path": str(self.text_path),
+                "num_bytes": _get_size(self.text_path),
+                "num_events": self.text_num_events,
+            }
+        return result
+
+
+@dataclass
+class RunResult:
+    """Resource usage of a single run of a command."""
+
+    wall_time_s: float
+    user_time_s: float
+    sys_time_s: float
+    peak_rss_bytes: int
+    num_stdout_lines: int
+    profiler_measurements: dict[str, float] = field(default_factory=dict)
+
+
+class _OtlpJsonReceiver(http.server.ThreadingHTTPServer):
+    """
+    A minimal OTLP/HTTP receiver that collects the JSON-encoded spans exported by `clp-s s
+    --enable-telemetry`, so that search telemetry can be reported without a collector.
+    """
+
+    def __init__(self) -> None:
+        self._lock = threading.Lock()
+        self._spans: list[dict[str, Any]] = []
+
+        receiver = self
+
+        class Handler(http.server.BaseHTTPRequestHandler):
+            def do_POST(self) -> None:  # noqa: N802
+                length = int(self.headers.get("Content-Length", 0))
+                body = self.rfile.read(length)
+                try:
+                    receiver._add_payload(json.loads(body))
+                except (json.JSONDecodeError, UnicodeDecodeError):
+                    logger.warning("Ignoring non-JSON telemetry payload.")
+                self.send_response(200)
+                self.send_header("Content-Type", "application/json")
+                self.end_headers()
+                self.wfile.write(b"{}")
+
+            def log_message(self, format: str, *args: Any) -> None:  # noqa: A002
+                pass
+
+        super().__init__(("127.0.0.1", 0), Handler)
+        self._thread = threading.Thread(target=self.serve_forever, daemon=True)
+        self._thread.start()
+
+    @property
+    def traces_endpoint(self) -> str:
+        """:return: The URL to export traces to."""
+        return f"http://127.0.0.1:{self.server_address[1]}/v1/traces"
+
+    def pop_spans(self) -> list[dict[str, Any]]:
+        """:return: The spans received since the last call."""
+        with self._lock:
+            spans = self._spans
+            self._spans = []
+        return spans
+
+    def close(self) -> None:
+        """Stops the receiver."""
+        self.shutdown()
+        self.server_close()
+
+    def _add_payload(self, payload: dict[str, Any]) -> None:
+        # opentelemetry-cpp may use either the proto field names or their JSON (camelCase) names
+        spans = []
+        for resource_spans in _get_field(payload, "resource_spans", "resourceSpans", []):
+            for scope_spans in _get_field(resource_spans, "scope_spans", "scopeSpans", []):
+                for span in scope_spans.get("spans", []):
+                    spans.append(_summarize_span(span))
+        with self._lock:
+            self._spans.extend(spans)
+
+
+def _get_field(obj: dict[str, Any], proto_name: str, json_name: str, default: Any = None) -> Any:
+    if proto_name in obj:
+        return obj[proto_name]
+    return obj.get(json_name, default)
+
+
+def _summarize_span(span: dict[str, Any]) -> dict[str, Any]:
+    """
+    :param span: A span in OTLP JSON encoding.
+    :return: The span's duration and its `clp.query.*` attributes.
+    """
+    start_ns = int(_get_field(span, "start_time_unix_nano", "startTimeUnixNano", 0))
+    end_ns = int(_get_field(span, "end_time_unix_nano", "endTimeUnixNano", 0))
+    summary: dict[str, Any] = {
+        "name": span.get("name"),
+        "duration_s": max(0, end_ns - start_ns) / 1e9,
+    }
+    for attribute in span.get("attributes", []):
+        key: str = attribute.get("key", "")
+        if not key.startswith(TELEMETRY_ATTRIBUTE_PREFIX):
+            continue
+        value = attribute.get("value", {})
+        for proto_name, json_name in (
+            ("string_value", "stringValue"),
+            ("int_value", "intValue"),
+            ("double_value", "doubleValue"),
+            ("bool_value", "boolValue"),
+        ):
+            typed_value = _get_field(value, proto_name, json_name)
+            if typed_value is not None:
+                # OTLP JSON encodes 64-bit integers as strings
+                if "int_value" == proto_name:
+                    typed_value = int(typed_value)
+                summary[key[len(TELEMETRY_ATTRIBUTE_PREFIX) :]] = typed_value
+                break
+    return summary
+
+
+def _positive_int(value: str) -> int:
+    """Argparse type that rejects non-positive integers."""
+    ivalue = int(value)
+    if ivalue < 1:
+        message = f"{value} is not a positive integer (must be >= 1)"
+        raise argparse.ArgumentTypeError(message)
+    return ivalue
+
+
+def _parse_config(value: str) -> tuple[str, list[str]]:
+    """
+    Argparse type for a named set of extra `clp-s c` arguments, e.g.,
+    `level-9=--compression-level 9`.
+    """
+    name, separator, args = value.partition("=")
+    if "" == separator or "" == name:
+        message = f"{value} is not of the form NAME=ARGS"
+        raise argparse.ArgumentTypeError(message)
+    return name, shlex.split(args)
+
+
+def _get_size(path: Path) -> int:
+    """:return: The size of a file, or the total size of the files in a directory."""
+    if path.is_file():
+        return path.stat().st_size
+    return sum(p.stat().st_size for p in path.rglob("*") if p.is_file())
+
+
+def _count_lines(path: Path) -> int:
+    with path.open("rb") as file:
+        return sum(1 for _ in file)
+
+
+def _format_timestamp(timestamp_ms: int) -> str:
+    """:return: The timestamp formatted as "2024-03-05 00:00:00,012"."""
+    time_point = datetime.datetime.fromtimestamp(timestamp_ms / 1000, tz=datetime.timezone.utc)
+    return time_point.strftime("%Y-%m-%d %H:%M:%S,") + f"{timestamp_ms % 1000:03}"
+
+
+def _generate_corpus(output_dir: Path, num_events: int, seed: int) -> Corpus:
+    """
+    Generates a JSON corpus and an equivalent unstructured text corpus. The corpus only depends on
+    `seed`, so benchmark results are reproducible.
+
+    :param output_dir:
+    :param num_events:
+    :param seed:
+    :return: The generated corpus.
+    """
+    rng = random.Random(seed)  # noqa: S311
+    json_path = output_dir / "corpus.jsonl"
+    text_path = output_dir / "corpus.log"
+
+    def skewed(bound: int) -> int:
+        # Smaller values are much more likely, so some values repeat often
+        return rng.randrange(rng.randrange(bound) + 1)
+
+    timestamp = 1_709_596_800_000  # 2024-03-05 00:00:00 UTC
+    with json_path.open("w") as json_file, text_path.open("w") as text_file:
+        for _ in range(num_events):
+            timestamp += rng.randrange(250)
+            template = rng.randrange(20)
+            extra_fields: dict[str, Any] = {}
+            if template < 12:  # noqa: PLR2004
+                level = "INFO"
+                message = (
+                    f"[worker-{rng.randrange(16)}] Processed request 0x{rng.randrange(65535):04x}"
+                    f" for user user_{skewed(_NUM_USERS)} in {skewed(1000)}.{rng.randrange(100):02}"
+                    " ms"
+                )
+                extra_fields["http"] = {
+                    "method": rng.choice(_HTTP_METHODS),
+                    "path": f"/v1/{rng.choice(_RESOURCES)}/{skewed(_NUM_USERS)}",
+                    "bytes": rng.randrange(1_000_000),
+                }
+            elif template < 15:  # noqa: PLR2004
+                level = "WARN"
+                message = (
+                    f"Connection to 10.{rng.randrange(4)}.{rng.randrange(256)}.{rng.randrange(256)}"
+                    f":{8000 + rng.randrange(8)} timed out after {rng.randrange(5)} retries"
+                )
+                extra_fields["retries"] = rng.randrange(5)
+            elif template < 16:  # noqa: PLR2004
+                level = "ERROR"
+                message = (
+                    f"Failed to open /var/data/shard-{skewed(_NUM_HOSTS)}/part-"
+                    f"{rng.randrange(1000)}.log: error code {rng.randrange(32)}"
+                )
+            else:
+                level = "DEBUG"
+                message = (
+                    f"Cache hit ratio 0.{rng.randrange(1000):03} for key"
+                    f" session:{rng.randrange(2**32 - 1):08x}"
+                )
+
+            record = {
+                "timestamp": timestamp,
+                "level": level,
+                "service": rng.choice(_SERVICES),
+                "host": f"host-{skewed(_NUM_HOSTS)}",
+                "status": rng.choice(_STATUS_CODES),
+                "latency_ms": rng.randrange(100_000) / 100,
+                "user": f"user_{skewed(_NUM_USERS)}",
+                "message": message,
+                **extra_fields,
+            }
+            json_file.write(json.dumps(record, separators=(",", ":")))
+            json_file.write("\n")
+            text_file.write(f"{_format_timestamp(timestamp)} {level} {message}\n")
+
+    return Corpus(json_path, num_events, text_path, num_events)
+
+
+def _run_command(cmd: list[str], env: dict[str, str] | None = None) -> RunResult:
+    """
+    Runs a command, measuring its resource usage.
+
+    :param cmd:
+    :param env: Environment variables to add to the command's environment.
+    :return: The command's resource usage.
+    :raise subprocess.CalledProcessError: If the command fails.
+    """
+    logger.debug("Running %s", shlex.join(cmd))
+    full_env = None
+    if env is not None:
+        full_env = {**os.environ, **env}
+
+    with tempfile.TemporaryFile() as stderr_file:
+        begin_time = time.perf_counter()
+        proc = subprocess.Popen(  # noqa: S603
+            cmd, stdout=subprocess.PIPE, stderr=stderr_file, env=full_env
+        )
+        num_stdout_lines = 0
+        assert proc.stdout is not None
+        for chunk in iter(lambda: proc.stdout.read(1024 * 1024), b""):
+            num_stdout_lines += chunk.count(b"\n")
+        proc.stdout.close()
+
+        # Wait with `wait4` to get the resource usage of this process alone
+        _, status, rusage = os.wait4(proc.pid, 0)
+        wall_time_s = time.perf_counter() - begin_time
+        proc.returncode = os.waitstatus_to_exitcode(status)
+
+        stderr_file.seek(0)
+        stderr = stderr_file.read().decode(errors="replace")
+
+    if 0 != proc.returncode:
+        logger.error("%s failed:\n%s", shlex.join(cmd), stderr)
+        raise subprocess.CalledProcessError(proc.returncode, cmd, stderr=stderr)
+
+    profiler_measurements = {
+        name: float(seconds) for name, seconds in PROFILER_MEASUREMENT_PATTERN.findall(stderr)
+    }
+    return RunResult(
+        wall_time_s=wall_time_s,
+        user_time_s=rusage.ru_utime,
+        sys_time_s=rusage.ru_stime,
+        # Linux reports `ru_maxrss` in KiB
+        peak_rss_bytes=rusage.ru_maxrss * 1024,
+        num_stdout_lines=num_stdout_lines,
+        profiler_measurements=profiler_measurements,
+    )
+
+
+def _summarize_runs(
+    cmd: list[str],
+    runs: list[RunResult],
+    input_bytes: int | None = None,
+    num_events: int | None = None,
+    output_bytes: int | None = None,
+) -> dict[str, Any]:
+    """
+    :param cmd:
+    :param runs: The runs of `cmd`.
+    :param input_bytes: The size of the input processed by each run, if applicable.
+    :param num_events: The number of log events processed by each run, if applicable.
+    :param output_bytes: The size of the output written by each run, if applicable.
+    :return: The stage's metrics, computed from the median wall time across the runs.
+    """
+    wall_time_s = statistics.median(run.wall_time_s for run in runs)
+    summary: dict[str, Any] = {
+        "command": cmd,
+        "wall_time_s": wall_time_s,
+        "wall_times_s": [run.wall_time_s for run in runs],
+        "user_time_s": statistics.median(run.user_time_s for run in runs),
+        "sys_time_s": statistics.median(run.sys_time_s for run in runs),
+        "peak_rss_bytes": max(run.peak_rss_bytes for run in runs),
+    }
+    if input_bytes is not None:
+        summary["input_bytes"] = input_bytes
+        summary["mb_per_s"] = input_bytes / BYTES_PER_MB / wall_time_s if wall_time_s > 0 else None
+    if num_events is not None:
+        summary["num_events"] = num_events
+        summary["events_per_s"] = num_events / wall_time_s if wall_time_s > 0 else None
+    if output_bytes is not None:
+        summary["output_bytes"] = output_bytes
+        if input_bytes is not None and output_bytes > 0:
+            summary["compression_ratio"] = input_bytes / output_bytes
+
+    profiler_measurements: dict[str, list[float]] = {}
+    for run in runs:
+        for name, seconds in run.profiler_measurements.items():
+            profiler_measurements.setdefault(name, []).append(seconds)
+    if len(profiler_measurements) > 0:
+        summary["profiler_s"] = {
+            name: statistics.median(values) for name, values in profiler_measurements.items()
+        }
+    return summary
+
+
+def _run_compression(
+    cmd: list[str], output_dir: Path, input_path: Path, num_events: int, repetitions: int
+) -> dict[str, Any]:
+    """
+    Runs a compression command `repetitions` times into a fresh output directory.
+
+    :return: The compression stage's metrics.
+    """
+    runs = []
+    for _ in range(repetitions):
+        shutil.rmtree(output_dir, ignore_errors=True)
+        runs.append(_run_command(cmd))
+    return _summarize_runs(
+        cmd,
+        runs,
+        input_bytes=_get_size(input_path),
+        num_events=num_events,
+        output_bytes=_get_size(output_dir),
+    )
+
+
+def _run_searches(
+    cmds: list[tuple[str, list[str]]],
+    repetitions: int,
+    telemetry_receiver: _OtlpJsonReceiver | None,
+) -> dict[str, Any]:
+    """
+    Runs each search command `repetitions` times.
+
+    :param cmds: Pairs of queries and the commands that search for them.
+    :param repetitions:
+    :param telemetry_receiver: The receiver for the commands' search telemetry, if enabled.
+    :return: The search stage's metrics, overall and per query.
+    """
+    env = None
+    if telemetry_receiver is not None:
+        env = {
+            "OTEL_EXPORTER_OTLP_TRACES_ENDPOINT": telemetry_receiver.traces_endpoint,
+            "OTEL_EXPORTER_OTLP_TRACES_PROTOCOL": "http/json",
+        }
+
+    queries = []
+    total_wall_time_s = 0.0
+    for query, cmd in cmds:
+        runs = [_run_command(cmd, env) for _ in range(repetitions)]
+        query_summary = {"query": query, **_summarize_runs(cmd, runs)}
+        query_summary["num_results"] = runs[-1].num_stdout_lines
+        total_wall_time_s += query_summary["wall_time_s"]
+        if telemetry_receiver is not None:
+            # Spans are exported when the process exits, but may arrive just after it does
+            deadline = time.monotonic() + TELEMETRY_WAIT_SECONDS
+            spans = telemetry_receiver.pop_spans()
+            while 0 == len(spans) and time.monotonic() < deadline:
+                time.sleep(0.05)
+                spans = telemetry_receiver.pop_spans()
+            query_summary["telemetry"] = spans
+        queries.append(query_summary)
+
+    return {
+        "num_queries": len(queries),
+        "total_wall_time_s": total_wall_time_s,
+        "queries": queries,
+    }
+
+
+def _find_binary(bin_dir: Path, name: str) -> Path | None:
+    path = bin_dir / name
+    if path.is_file() and os.access(path, os.X_OK):
+        return path
+    logger.warning("%s not found in %s; skipping its stages.", name, bin_dir)
+    return None
+
+
+def _read_queries(path: Path) -> list[str]:
+    return [line for line in path.read_text().splitlines() if "" != line.strip()]
+
+
+def main(argv: list[str]) -> int:
+    """Runs an end-to-end ingestion and search throughput benchmark."""
+    args_parser = argparse.ArgumentParser(
+        description="Runs an end-to-end ingestion and search throughput benchmark of the"
+        " CLP-core's binaries and writes the results as JSON."
+    )
+    args_parser.add_argument(
+        "--bin-dir", required=True, help="Directory containing clp-s, clp, clg, and log-converter."
+    )
+    args_parser.add_argument(
+        "--output", default="-", help="Path to write the JSON report to, or - for stdout."
+    )
+    args_parser.add_argument(
+        "--work-dir",
+        help="Directory for the corpus and archives. Defaults to a temporary directory that's"
+        " deleted afterwards.",
+    )
+    args_parser.add_argument(
+        "--json-input", help="JSON lines file to benchmark instead of a generated corpus."
+    )
+    args_parser.add_argument(
+        "--text-input", help="Unstructured log file to benchmark instead of a generated corpus."
+    )
+    args_parser.add_argument(
+        "--num-events",
+        type=_positive_int,
+        default=DEFAULT_NUM_EVENTS,
+        help="Number of log events to generate when no input is given.",
+    )
+    args_parser.add_argument(
+        "--seed", type=int, default=DEFAULT_SEED, help="Seed for generating the corpus."
+    )
+    args_parser.add_argument(
+        "--timestamp-key",
+        default="timestamp",
+        help="Timestamp key of the JSON input, or an empty string for none.",
+    )
+    args_parser.add_argument(
+        "--kql-queries",
+        help="File containing a KQL query per line to search the clp-s archives for. Defaults to"
+        " queries over the generated corpus.",
+    )
+    args_parser.add_argument(
+        "--clg-queries",
+        default=str(DEFAULT_CLG_QUERIES_PATH),
+        help="File containing a wildcard query per line to search the clp archives for.",
+    )
+    args_parser.add_argument(
+        "--config",
+        dest="configs",
+        action="append",
+        type=_parse_config,
+        default=[],
+        metavar="NAME=ARGS",
+        help="A named set of extra arguments for `clp-s c` to benchmark (e.g., 'level-9="
+        "--compression-level 9'). Can be repeated; defaults to a single 'default' config.",
+    )
+    args_parser.add_argument(
+        "--repetitions",
+        type=_positive_int,
+        default=1,
+        help="Number of times to run each command; metrics use the median wall time.",
+    )
+    args_parser.add_argument(
+        "--no-search-telemetry",
+        action="store_true",
+        help="Don't collect clp-s's search telemetry.",
+    )
+
+    parsed_args = args_parser.parse_args(argv[1:])
+    bin_dir = Path(parsed_args.bin_dir)
+    configs: list[tuple[str, list[str]]] = parsed_args.configs or [("default", [])]
+    repetitions: int = parsed_args.repetitions
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        work_dir = Path(parsed_args.work_dir) if parsed_args.work_dir else Path(temp_dir)
+        work_dir.mkdir(parents=True, exist_ok=True)
+
+        if parsed_args.json_input is None and parsed_args.text_input is None:
+            logger.info("Generating a corpus of %d log events.", parsed_args.num_events)
+            corpus = _generate_corpus(work_dir, parsed_args.num_events, parsed_args.seed)
+            kql_queries = DEFAULT_KQL_QUERIES
+        else:
+            json_path = Path(parsed_args.json_input) if parsed_args.json_input else None
+            text_path = Path(parsed_args.text_input) if parsed_args.text_input else None
+            corpus = Corpus(
+                json_path,
+                _count_lines(json_path) if json_path is not None else 0,
+                text_path,
+                _count_lines(text_path) if text_path is not None else 0,
+            )
+            kql_queries = []
+        if parsed_args.kql_queries is not None:
+            kql_queries = _read_queries(Path(parsed_args.kql_queries))
+        clg_queries = _read_queries(Path(parsed_args.clg_queries))
+
+        telemetry_receiver = None if parsed_args.no_search_telemetry else _OtlpJsonReceiver()
+        report: dict[str, Any] = {
+            "version": REPORT_VERSION,
+            "host": {
+                "platform": platform.platform(),
+                "machine": platform.machine(),
+                "num_cpus": os.cpu_count(),
+            },
+            "corpus": corpus.to_dict(),
+            "clp_s": [],
+        }
+
+        try:
+            clp_s = _find_binary(bin_dir, "clp-s")
+            timestamp_args = (
+                ["--timestamp-key", parsed_args.timestamp_key]
+                if "" != parsed_args.timestamp_key
+                else []
+            )
+            if clp_s is not None and corpus.json_path is not None:
+                for name, extra_args in configs:
+                    logger.info("Benchmarking clp-s with the '%s' config.", name)
+                    archives_dir = work_dir / f"clp-s-archives-{name}"
+                    compress_cmd = [
+                        str(clp_s),
+                        "c",
+                        *timestamp_args,
+                        *extra_args,
+                        str(archives_dir),
+                        str(corpus.json_path),
+                    ]
+                    search_cmds = [
+                        (query, [str(clp_s), "s", "--enable-telemetry", str(archives_dir), query])
+                        for query in kql_queries
+                    ]
+                    if telemetry_receiver is None:
+                        search_cmds = [
+                            (query, [arg for arg in cmd if "--enable-telemetry" != arg])
+                            for query, cmd in search_cmds
+                        ]
+                    report["clp_s"].append(
+                        {
+                            "config": name,
+                            "extra_args": extra_args,
+                            "compression": _run_compression(
+                                compress_cmd,
+                                archives_dir,
+                                corpus.json_path,
+                                corpus.json_num_events,
+                                repetitions,
+                            ),
+                            "search": _run_searches(search_cmds, repetitions, telemetry_receiver),
+                        }
+                    )
+
+            clp = _find_binary(bin_dir, "clp")
+            clg = _find_binary(bin_dir, "clg")
+            if clp is not None and clg is not None and corpus.text_path is not None:
+                logger.info("Benchmarking clp.")
+                archives_dir = work_dir / "clp-archives"
+                compress_cmd = [str(clp), "c", str(archives_dir), str(corpus.text_path)]
+                search_cmds = [
+                    (query, [str(clg), str(archives_dir), query]) for query in clg_queries
+                ]
+                report["clp"] = {
+                    "compression": _run_compression(
+                        compress_cmd,
+                        archives_dir,
+                        corpus.text_path,
+                        corpus.text_num_events,
+                        repetitions,
+                    ),
+                    "search": _run_searches(search_cmds, repetitions, None),
+                }
+
+            log_converter = _find_binary(bin_dir, "log-converter")
+            if log_converter is not None and clp_s is not None and corpus.text_path is not None:
+                logger.info("Benchmarking KV-IR conversion.")
+                kv_ir_dir = work_dir / "kv-ir"
+                kv_ir_archives_dir = work_dir / "clp-s-archives-kv-ir"
+                convert_cmd = [
+                    str(log_converter),
+                    "--output-dir",
+                    str(kv_ir_dir),
+                    str(corpus.text_path),
+                ]
+                report["kv_ir"] = {
+                    "conversion": _run_compression(
+                        convert_cmd,
+                        kv_ir_dir,
+                        corpus.text_path,
+                        corpus.text_num_events,
+                        repetitions,
+                    ),
+                    "clp_s_compression": _run_compression(
+                        [str(clp_s), "c", str(kv_ir_archives_dir), str(kv_ir_dir)],
+                        kv_ir_archives_dir,
+                        kv_ir_dir,
+                        corpus.text_num_events,
+                        repetitions,
+                    ),
+                }
+        finally:
+            if telemetry_receiver is not None:
+                telemetry_receiver.close()
+
+    report_json = json.dumps(report, indent=2)
+    if "-" == parsed_args.output:
+        print(report_json)  # noqa: T201
+    else:
+        Path(parsed_args.output).write_text(report_json + "\n")
+        logger.info("Wrote the report to %s.", parsed_args.output)
+
+    return 0
+
+
+if "__main__" == __name__:
+    sys.exit(main(sys.argv))
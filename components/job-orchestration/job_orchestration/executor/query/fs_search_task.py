@@ -29,13 +29,61 @@ from job_orchestration.executor.query.utils import (
     run_query_task,
 )
 from job_orchestration.executor.utils import load_worker_config
-from job_orchestration.scheduler.job_config import SearchJobConfig
+from job_orchestration.scheduler.job_config import AggregationConfig, SearchJobConfig
 from job_orchestration.scheduler.scheduler_data import QueryTaskResult, QueryTaskStatus
 
 # Setup logging
 logger = get_task_logger(__name__)
 
 
+_SKETCH_TYPES = ("count-distinct", "quantiles", "top-k")
+
+
+def _get_field_aggregation_args(aggregation_config: AggregationConfig) -> list[str] | None:
+    """
+    Gets the arguments for the field aggregations (stats, sketches, and grouping) in the given
+    config, after validating them.
+
+    :param aggregation_config:
+    :return: The arguments, or None if the config is invalid.
+    """
+    args = []
+    if aggregation_config.statistics_field is not None:
+        if "" == aggregation_config.statistics_field:
+            logger.error("statistics_field cannot be an empty string.")
+            return None
+        args.extend(("--stats", aggregation_config.statistics_field))
+
+    if aggregation_config.sketch_type is not None:
+        if aggregation_config.statistics_field is not None:
+            logger.error("statistics_field and sketch_type are mutually exclusive.")
+            return None
+        if aggregation_config.sketch_type not in _SKETCH_TYPES:
+            logger.error(f"Unsupported sketch type '{aggregation_config.sketch_type}'.")
+            return None
+        if not aggregation_config.sketch_field:
+            logger.error(f"sketch_type '{aggregation_config.sketch_type}' requires a sketch_field.")
+            return None
+        args.extend((f"--{aggregation_config.sketch_type}", aggregation_config.sketch_field))
+    elif aggregation_config.sketch_field is not None:
+        logger.error("sketch_field requires a sketch_type.")
+        return None
+
+    if aggregation_config.top_k_size is not None:
+        if "top-k" != aggregation_config.sketch_type:
+            logger.error("top_k_size can only be used with the 'top-k' sketch type.")
+            return None
+        args.extend(("--top-k-size", str(aggregation_config.top_k_size)))
+
+    if aggregation_config.group_by_keys:
+        if aggregation_config.statistics_field is None and aggregation_config.sketch_type is None:
+            logger.error("group_by_keys requires a statistics_field or a sketch_type.")
+            return None
+        for group_by_key in aggregation_config.group_by_keys:
+            args.extend(("--group-by", group_by_key))
+    return args
+
+
 def _make_core_clp_command_and_env_vars(
     clp_home: Path,
     worker_config: WorkerConfig,
@@ -146,6 +194,18 @@ def _make_command_and_env_vars(
     if command is None:
         return None, None
 
+    field_aggregation_args = []
+    if search_config.aggregation_config is not None:
+        field_aggregation_args = _get_field_aggregation_args(search_config.aggregation_config)
+        if field_aggregation_args is None:
+            return None, None
+        if field_aggregation_args and StorageEngine.CLP_S != storage_engine:
+            logger.error(
+                f"Stats, sketch, and group-by aggregations are not supported while using the"
+                f" '{storage_engine}' storage engine."
+            )
+            return None, None
+
     command.append(search_config.query_string)
     if search_config.begin_timestamp is not None:
         command.append("--tge")
@@ -171,6 +231,7 @@ def _make_command_and_env_vars(
         if aggregation_config.count_by_time_bucket_size is not None:
             command.append("--count-by-time")
             command.append(str(aggregation_config.count_by_time_bucket_size))
+        command.extend(field_aggregation_args)
     elif search_config.network_address is not None:
         # fmt: off
         command.extend((
@@ -82,6 +82,12 @@ class AggregationConfig(BaseModel):
     reducer_port: int | None = None
     do_count_aggregation: bool | None = None
     count_by_time_bucket_size: int | None = None  # Milliseconds
+    statistics_field: str | None = None
+    # One of "count-distinct", "quantiles", or "top-k"
+    sketch_type: str | None = None
+    sketch_field: str | None = None
+    top_k_size: int | None = None
+    group_by_keys: list[str] | None = None
 
 
 class QueryJobConfig(BaseModel):
@@ -176,6 +176,9 @@ async def handle_reducer_connection(
                         {
                             "job_id": job_id,
                             "count_by_time_bucket_size": time_bucket_size,
+                            "statistics_field": aggregation_config.statistics_field,
+                            "sketch_type": aggregation_config.sketch_type,
+                            "top_k_size": aggregation_config.top_k_size,
                         }
                     ),
                     writer,